@@ -0,0 +1,223 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+
+Checks that, with ASHES_GL_ERROR_CHECK=async, an out of memory error reported
+through the KHR_debug callback makes the next vkQueueSubmit fail.
+
+The error is injected with glDebugMessageInsert, on the gl plugin's device context.
+Exits with code 77 (skipped) when the gl plugin or KHR_debug isn't available.
+*/
+#include "renderer/GlRenderer/Core/GlContextLock.hpp"
+#include "renderer/GlRenderer/Core/GlDevice.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+	// The test's SKIP_RETURN_CODE.
+	int constexpr SkipReturnCode = 77;
+
+	struct Objects
+	{
+		VkInstance instance{};
+		VkPhysicalDevice physicalDevice{};
+		VkDevice device{};
+		VkQueue queue{};
+		VkCommandPool commandPool{};
+		VkCommandBuffer commandBuffer{};
+
+		~Objects()
+		{
+			if ( commandPool )
+			{
+				vkDestroyCommandPool( device, commandPool, nullptr );
+			}
+
+			if ( device )
+			{
+				vkDestroyDevice( device, nullptr );
+			}
+
+			if ( instance )
+			{
+				vkDestroyInstance( instance, nullptr );
+			}
+		}
+	};
+
+	bool selectGlPlugin()
+	{
+		uint32_t count{};
+		ashEnumeratePluginsDescriptions( &count, nullptr );
+		std::vector< AshPluginDescription > plugins( count );
+		ashEnumeratePluginsDescriptions( &count, plugins.data() );
+		plugins.resize( count );
+		auto it = std::find_if( plugins.begin()
+			, plugins.end()
+			, []( AshPluginDescription const & lookup )
+			{
+				return std::strcmp( lookup.name, "gl" ) == 0;
+			} );
+		return it != plugins.end()
+			&& ashSelectPlugin( *it ) == VK_SUCCESS;
+	}
+
+	bool createObjects( Objects & objects )
+	{
+		VkApplicationInfo appInfo{ VK_STRUCTURE_TYPE_APPLICATION_INFO
+			, nullptr
+			, "ashes-gl-async-oom-test"
+			, VK_MAKE_VERSION( 1, 0, 0 )
+			, "Ashes"
+			, VK_MAKE_VERSION( 1, 0, 0 )
+			, VK_API_VERSION_1_0 };
+		VkInstanceCreateInfo instanceInfo{ VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO
+			, nullptr
+			, 0u
+			, &appInfo
+			, 0u
+			, nullptr
+			, 0u
+			, nullptr };
+
+		if ( vkCreateInstance( &instanceInfo, nullptr, &objects.instance ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		uint32_t count = 1u;
+		vkEnumeratePhysicalDevices( objects.instance, &count, &objects.physicalDevice );
+
+		if ( !objects.physicalDevice )
+		{
+			return false;
+		}
+
+		float priority = 1.0f;
+		VkDeviceQueueCreateInfo queueInfo{ VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO
+			, nullptr
+			, 0u
+			, 0u
+			, 1u
+			, &priority };
+		VkDeviceCreateInfo deviceInfo{ VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO
+			, nullptr
+			, 0u
+			, 1u
+			, &queueInfo
+			, 0u
+			, nullptr
+			, 0u
+			, nullptr
+			, nullptr };
+
+		if ( vkCreateDevice( objects.physicalDevice, &deviceInfo, nullptr, &objects.device ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		vkGetDeviceQueue( objects.device, 0u, 0u, &objects.queue );
+		VkCommandPoolCreateInfo poolInfo{ VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO
+			, nullptr
+			, 0u
+			, 0u };
+
+		if ( vkCreateCommandPool( objects.device, &poolInfo, nullptr, &objects.commandPool ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkCommandBufferAllocateInfo allocateInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO
+			, nullptr
+			, objects.commandPool
+			, VK_COMMAND_BUFFER_LEVEL_PRIMARY
+			, 1u };
+
+		if ( vkAllocateCommandBuffers( objects.device, &allocateInfo, &objects.commandBuffer ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkCommandBufferBeginInfo beginInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO
+			, nullptr
+			, 0u
+			, nullptr };
+		return vkBeginCommandBuffer( objects.commandBuffer, &beginInfo ) == VK_SUCCESS
+			&& vkEndCommandBuffer( objects.commandBuffer ) == VK_SUCCESS;
+	}
+
+	VkResult submit( Objects const & objects )
+	{
+		VkSubmitInfo submitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO
+			, nullptr
+			, 0u
+			, nullptr
+			, nullptr
+			, 1u
+			, &objects.commandBuffer
+			, 0u
+			, nullptr };
+		return vkQueueSubmit( objects.queue, 1u, &submitInfo, VK_NULL_HANDLE );
+	}
+}
+
+int main()
+{
+	if ( !selectGlPlugin() )
+	{
+		std::cerr << "The gl plugin isn't available, skipping" << std::endl;
+		return SkipReturnCode;
+	}
+
+	Objects objects;
+
+	if ( !createObjects( objects ) )
+	{
+		std::cerr << "Couldn't create the Vulkan objects with the gl plugin, skipping" << std::endl;
+		return SkipReturnCode;
+	}
+
+	if ( submit( objects ) != VK_SUCCESS )
+	{
+		std::cerr << "The submit failed before the error was injected" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	vkQueueWaitIdle( objects.queue );
+
+	{
+		auto context = ashes::gl::get( objects.device )->getContext();
+
+		if ( context->getErrorCheckPolicy() != ashes::gl::GlErrorCheckPolicy::eAsync
+			|| !context->hasDebugMessageInsert() )
+		{
+			std::cerr << "The gl plugin doesn't use the KHR_debug callback, skipping" << std::endl;
+			return SkipReturnCode;
+		}
+
+		// So that the callback runs before glDebugMessageInsert returns.
+		context->glEnable( ashes::gl::GL_DEBUG_OUTPUT_SYNC );
+		context->glDebugMessageInsert( ashes::gl::GL_DEBUG_SOURCE_APPLICATION
+			, ashes::gl::GL_DEBUG_TYPE_ERROR
+			, ashes::gl::GL_ERROR_OUT_OF_MEMORY
+			, ashes::gl::GL_DEBUG_SEVERITY_HIGH
+			, -1
+			, "Injected GL_OUT_OF_MEMORY" );
+	}
+
+	auto result = submit( objects );
+
+	if ( result != VK_ERROR_OUT_OF_DEVICE_MEMORY )
+	{
+		std::cerr << "The submit returned " << result << " instead of VK_ERROR_OUT_OF_DEVICE_MEMORY" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "The injected out of memory error failed the submit" << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,592 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "BenchmarkBaseline.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <iomanip>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+
+namespace ashes::bench
+{
+	namespace
+	{
+		struct JsonValue
+		{
+			enum class Type
+			{
+				eNull,
+				eBool,
+				eNumber,
+				eString,
+				eArray,
+				eObject,
+			};
+
+			JsonValue const * find( std::string const & key )const
+			{
+				auto it = std::find( keys.begin(), keys.end(), key );
+				return it == keys.end()
+					? nullptr
+					: &values[size_t( std::distance( keys.begin(), it ) )];
+			}
+
+			Type type{ Type::eNull };
+			double number{};
+			std::string string;
+			// The array items, or the object members values.
+			std::vector< JsonValue > values;
+			// The object members names.
+			std::vector< std::string > keys;
+		};
+
+		// A minimal reader, enough for the files this suite writes.
+		class JsonReader
+		{
+		public:
+			explicit JsonReader( std::string text )
+				: m_text{ std::move( text ) }
+			{
+			}
+
+			bool parse( JsonValue & value
+				, std::string & error )
+			{
+				auto result = doParseValue( value );
+				doSkipSpaces();
+
+				if ( result && m_index != m_text.size() )
+				{
+					m_error = "unexpected content after the root value";
+					result = false;
+				}
+
+				if ( !result )
+				{
+					error = m_error + " (at offset " + std::to_string( m_index ) + ")";
+				}
+
+				return result;
+			}
+
+		private:
+			void doSkipSpaces()
+			{
+				while ( m_index < m_text.size()
+					&& std::isspace( static_cast< unsigned char >( m_text[m_index] ) ) )
+				{
+					++m_index;
+				}
+			}
+
+			bool doExpect( char c )
+			{
+				doSkipSpaces();
+
+				if ( m_index >= m_text.size() || m_text[m_index] != c )
+				{
+					m_error = std::string{ "expected '" } + c + "'";
+					return false;
+				}
+
+				++m_index;
+				return true;
+			}
+
+			bool doParseLiteral( std::string const & literal )
+			{
+				if ( m_text.compare( m_index, literal.size(), literal ) != 0 )
+				{
+					m_error = "invalid literal";
+					return false;
+				}
+
+				m_index += literal.size();
+				return true;
+			}
+
+			bool doParseString( std::string & value )
+			{
+				if ( !doExpect( '"' ) )
+				{
+					return false;
+				}
+
+				while ( m_index < m_text.size() && m_text[m_index] != '"' )
+				{
+					auto c = m_text[m_index++];
+
+					if ( c == '\\' && m_index < m_text.size() )
+					{
+						c = m_text[m_index++];
+
+						switch ( c )
+						{
+						case 'n':
+							c = '\n';
+							break;
+						case 't':
+							c = '\t';
+							break;
+						case 'r':
+							c = '\r';
+							break;
+						case 'u':
+							if ( m_index + 4u > m_text.size() )
+							{
+								m_error = "truncated escape sequence";
+								return false;
+							}
+							// Only the control characters escapeJson writes are expected.
+							c = char( std::strtoul( m_text.substr( m_index, 4u ).c_str(), nullptr, 16 ) );
+							m_index += 4u;
+							break;
+						default:
+							break;
+						}
+					}
+
+					value += c;
+				}
+
+				if ( m_index >= m_text.size() )
+				{
+					m_error = "unterminated string";
+					return false;
+				}
+
+				++m_index;
+				return true;
+			}
+
+			bool doParseNumber( double & value )
+			{
+				auto begin = m_text.c_str() + m_index;
+				char * end{};
+				value = std::strtod( begin, &end );
+
+				if ( end == begin )
+				{
+					m_error = "invalid value";
+					return false;
+				}
+
+				m_index += size_t( end - begin );
+				return true;
+			}
+
+			bool doParseArray( JsonValue & value )
+			{
+				value.type = JsonValue::Type::eArray;
+				++m_index;
+				doSkipSpaces();
+
+				if ( m_index < m_text.size() && m_text[m_index] == ']' )
+				{
+					++m_index;
+					return true;
+				}
+
+				do
+				{
+					value.values.emplace_back();
+
+					if ( !doParseValue( value.values.back() ) )
+					{
+						return false;
+					}
+
+					doSkipSpaces();
+				}
+				while ( m_index < m_text.size() && m_text[m_index++] == ',' );
+
+				if ( m_text[m_index - 1u] != ']' )
+				{
+					m_error = "expected ']'";
+					return false;
+				}
+
+				return true;
+			}
+
+			bool doParseObject( JsonValue & value )
+			{
+				value.type = JsonValue::Type::eObject;
+				++m_index;
+				doSkipSpaces();
+
+				if ( m_index < m_text.size() && m_text[m_index] == '}' )
+				{
+					++m_index;
+					return true;
+				}
+
+				do
+				{
+					value.keys.emplace_back();
+					value.values.emplace_back();
+
+					if ( !doParseString( value.keys.back() )
+						|| !doExpect( ':' )
+						|| !doParseValue( value.values.back() ) )
+					{
+						return false;
+					}
+
+					doSkipSpaces();
+				}
+				while ( m_index < m_text.size() && m_text[m_index++] == ',' );
+
+				if ( m_text[m_index - 1u] != '}' )
+				{
+					m_error = "expected '}'";
+					return false;
+				}
+
+				return true;
+			}
+
+			bool doParseValue( JsonValue & value )
+			{
+				doSkipSpaces();
+
+				if ( m_index >= m_text.size() )
+				{
+					m_error = "unexpected end of file";
+					return false;
+				}
+
+				switch ( m_text[m_index] )
+				{
+				case '{':
+					return doParseObject( value );
+				case '[':
+					return doParseArray( value );
+				case '"':
+					value.type = JsonValue::Type::eString;
+					return doParseString( value.string );
+				case 't':
+					value.type = JsonValue::Type::eBool;
+					value.number = 1.0;
+					return doParseLiteral( "true" );
+				case 'f':
+					value.type = JsonValue::Type::eBool;
+					return doParseLiteral( "false" );
+				case 'n':
+					return doParseLiteral( "null" );
+				default:
+					value.type = JsonValue::Type::eNumber;
+					return doParseNumber( value.number );
+				}
+			}
+
+		private:
+			std::string m_text;
+			size_t m_index{};
+			std::string m_error;
+		};
+
+		double getNumber( JsonValue const & object
+			, std::string const & key )
+		{
+			auto value = object.find( key );
+			return ( value && value->type == JsonValue::Type::eNumber )
+				? value->number
+				: 0.0;
+		}
+
+		std::string getString( JsonValue const & object
+			, std::string const & key )
+		{
+			auto value = object.find( key );
+			return ( value && value->type == JsonValue::Type::eString )
+				? value->string
+				: std::string{};
+		}
+
+		Result const * findResult( ResultArray const & results
+			, std::string const & plugin
+			, std::string const & name )
+		{
+			auto it = std::find_if( results.begin()
+				, results.end()
+				, [&plugin, &name]( Result const & lookup )
+				{
+					return lookup.plugin == plugin
+						&& lookup.name == name;
+				} );
+			return it == results.end()
+				? nullptr
+				: &( *it );
+		}
+
+		BaselineEntry const * findEntry( Baseline const & baseline
+			, std::string const & plugin
+			, std::string const & name )
+		{
+			auto it = std::find_if( baseline.entries.begin()
+				, baseline.entries.end()
+				, [&plugin, &name]( BaselineEntry const & lookup )
+				{
+					return lookup.plugin == plugin
+						&& lookup.name == name;
+				} );
+			return it == baseline.entries.end()
+				? nullptr
+				: &( *it );
+		}
+
+		void printRow( std::ostream & stream
+			, std::string const & plugin
+			, std::string const & name
+			, double baseline
+			, double current
+			, double tolerance
+			, char const * status )
+		{
+			stream << std::left << std::setw( 8 ) << plugin
+				<< std::setw( 32 ) << name
+				<< std::right << std::fixed << std::setprecision( 2 );
+
+			if ( baseline > 0.0 )
+			{
+				stream << std::setw( 12 ) << baseline;
+			}
+			else
+			{
+				stream << std::setw( 12 ) << "-";
+			}
+
+			if ( current > 0.0 )
+			{
+				stream << std::setw( 12 ) << current;
+			}
+			else
+			{
+				stream << std::setw( 12 ) << "-";
+			}
+
+			if ( baseline > 0.0 && current > 0.0 )
+			{
+				std::stringstream change;
+				change << std::showpos << std::fixed << std::setprecision( 1 )
+					<< ( current - baseline ) * 100.0 / baseline << "%";
+				stream << std::setw( 10 ) << change.str();
+			}
+			else
+			{
+				stream << std::setw( 10 ) << "-";
+			}
+
+			std::stringstream allowed;
+			allowed << "+" << std::fixed << std::setprecision( 1 ) << tolerance << "%";
+			stream << std::setw( 10 ) << allowed.str()
+				<< "  " << status << std::endl;
+		}
+	}
+
+	//*********************************************************************************************
+
+	bool readBaseline( std::istream & stream
+		, Baseline & baseline
+		, std::string & error )
+	{
+		JsonValue root;
+		JsonReader reader{ std::string{ std::istreambuf_iterator< char >( stream ), std::istreambuf_iterator< char >() } };
+
+		if ( !reader.parse( root, error ) )
+		{
+			return false;
+		}
+
+		if ( root.type != JsonValue::Type::eObject )
+		{
+			error = "the root value isn't an object";
+			return false;
+		}
+
+		if ( auto tolerance = getNumber( root, "tolerance" ); tolerance > 0.0 )
+		{
+			baseline.tolerance = tolerance;
+		}
+
+		auto benchmarks = root.find( "benchmarks" );
+
+		if ( !benchmarks || benchmarks->type != JsonValue::Type::eArray )
+		{
+			error = "the benchmarks array is missing";
+			return false;
+		}
+
+		for ( auto & benchmark : benchmarks->values )
+		{
+			BaselineEntry entry;
+			entry.plugin = getString( benchmark, "plugin" );
+			entry.name = getString( benchmark, "name" );
+			entry.tolerance = getNumber( benchmark, "tolerance" );
+			entry.median = getNumber( benchmark, "median" );
+
+			if ( entry.plugin.empty() || entry.name.empty() )
+			{
+				error = "a benchmark misses its plugin or name";
+				return false;
+			}
+
+			baseline.entries.push_back( std::move( entry ) );
+		}
+
+		return true;
+	}
+
+	bool hasMedians( Baseline const & baseline
+		, ResultArray const & results )
+	{
+		return std::any_of( results.begin()
+			, results.end()
+			, [&baseline]( Result const & result )
+			{
+				auto entry = findEntry( baseline, result.plugin, result.name );
+				return entry
+					&& entry->median > 0.0;
+			} );
+	}
+
+	bool compareResults( std::ostream & stream
+		, Baseline const & baseline
+		, ResultArray const & results )
+	{
+		uint32_t regressions{};
+		stream << std::left << std::setw( 8 ) << "Plugin"
+			<< std::setw( 32 ) << "Benchmark"
+			<< std::right << std::setw( 12 ) << "Baseline"
+			<< std::setw( 12 ) << "Current"
+			<< std::setw( 10 ) << "Change"
+			<< std::setw( 10 ) << "Allowed"
+			<< "  Status" << std::endl;
+
+		for ( auto & result : results )
+		{
+			auto entry = findEntry( baseline, result.plugin, result.name );
+			auto tolerance = ( entry && entry->tolerance > 0.0 )
+				? entry->tolerance
+				: baseline.tolerance;
+			auto reference = entry
+				? entry->median
+				: 0.0;
+
+			if ( !result.error.empty() )
+			{
+				++regressions;
+				printRow( stream, result.plugin, result.name, reference, 0.0, tolerance, "FAILED" );
+				continue;
+			}
+
+			auto current = result.getMedian();
+			char const * status = "ok";
+
+			if ( reference <= 0.0 )
+			{
+				status = "new";
+			}
+			else if ( current > reference * ( 1.0 + tolerance / 100.0 ) )
+			{
+				++regressions;
+				status = "REGRESSED";
+			}
+			else if ( current < reference * ( 1.0 - tolerance / 100.0 ) )
+			{
+				status = "improved";
+			}
+
+			printRow( stream, result.plugin, result.name, reference, current, tolerance, status );
+		}
+
+		for ( auto & entry : baseline.entries )
+		{
+			if ( !findResult( results, entry.plugin, entry.name ) )
+			{
+				printRow( stream
+					, entry.plugin
+					, entry.name
+					, entry.median
+					, 0.0
+					, entry.tolerance > 0.0 ? entry.tolerance : baseline.tolerance
+					, "not run" );
+			}
+		}
+
+		if ( regressions )
+		{
+			stream << regressions << " benchmark(s) regressed beyond their tolerance" << std::endl;
+		}
+
+		return regressions == 0u;
+	}
+
+	void writeBaseline( std::ostream & stream
+		, Baseline const & baseline
+		, ResultArray const & results )
+	{
+		auto entries = baseline.entries;
+
+		for ( auto & result : results )
+		{
+			if ( !result.error.empty() )
+			{
+				continue;
+			}
+
+			auto it = std::find_if( entries.begin()
+				, entries.end()
+				, [&result]( BaselineEntry const & lookup )
+				{
+					return lookup.plugin == result.plugin
+						&& lookup.name == result.name;
+				} );
+
+			if ( it == entries.end() )
+			{
+				entries.push_back( { result.plugin, result.name, 0.0, 0.0 } );
+				it = std::prev( entries.end() );
+			}
+
+			it->median = result.getMedian();
+		}
+
+		stream << std::fixed << std::setprecision( 3 );
+		stream << "{\n";
+		stream << "\t\"version\": 1,\n";
+		stream << "\t\"unit\": \"ns\",\n";
+		stream << "\t\"tolerance\": " << baseline.tolerance << ",\n";
+		stream << "\t\"benchmarks\": [";
+		auto separator = "\n";
+
+		for ( auto & entry : entries )
+		{
+			stream << separator << "\t\t{ \"plugin\": \"" << escapeJson( entry.plugin ) << "\"";
+			stream << ", \"name\": \"" << escapeJson( entry.name ) << "\"";
+
+			if ( entry.tolerance > 0.0 )
+			{
+				stream << ", \"tolerance\": " << entry.tolerance;
+			}
+
+			if ( entry.median > 0.0 )
+			{
+				stream << ", \"median\": " << entry.median;
+			}
+
+			stream << " }";
+			separator = ",\n";
+		}
+
+		stream << "\n\t]\n";
+		stream << "}\n";
+	}
+}
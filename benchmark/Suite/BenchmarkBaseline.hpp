@@ -0,0 +1,60 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "BenchmarkHarness.hpp"
+
+namespace ashes::bench
+{
+	struct BaselineEntry
+	{
+		std::string plugin;
+		std::string name;
+		// Allowed median increase, in percent, zero to use the baseline's one.
+		double tolerance{};
+		// Zero when the benchmark has never been measured.
+		double median{};
+	};
+
+	struct Baseline
+	{
+		// Used by the entries that don't define their own tolerance.
+		double tolerance{ 10.0 };
+		std::vector< BaselineEntry > entries;
+	};
+	/**
+	*\brief
+	*	Reads a baseline file, as written by writeBaseline.
+	*\return
+	*	false, with an error message, if the file isn't valid.
+	*/
+	bool readBaseline( std::istream & stream
+		, Baseline & baseline
+		, std::string & error );
+	/**
+	*\brief
+	*	Tells if at least one of the results has a baseline median to be compared to.
+	*/
+	bool hasMedians( Baseline const & baseline
+		, ResultArray const & results );
+	/**
+	*\brief
+	*	Compares the results medians to the baseline ones, and prints the comparison table.
+	*\return
+	*	false if any benchmark regressed beyond its tolerance.
+	*/
+	bool compareResults( std::ostream & stream
+		, Baseline const & baseline
+		, ResultArray const & results );
+	/**
+	*\brief
+	*	Writes the baseline updated with the results medians.
+	*\remarks
+	*	The tolerances are kept, as are the entries of the benchmarks that weren't run.
+	*/
+	void writeBaseline( std::ostream & stream
+		, Baseline const & baseline
+		, ResultArray const & results );
+}
@@ -0,0 +1,676 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "BenchmarkContext.hpp"
+#include "BenchmarkShaders.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace ashes::bench
+{
+	bool Context::initialise( char const * appName )
+	{
+		return doCreateDevice( appName )
+			&& doCreateTarget()
+			&& doCreateBuffers()
+			&& doCreateDescriptors()
+			&& doCreatePipeline();
+	}
+
+	void Context::cleanup()
+	{
+		if ( device )
+		{
+			vkDeviceWaitIdle( device );
+		}
+
+		if ( pipeline )
+		{
+			vkDestroyPipeline( device, pipeline, nullptr );
+		}
+
+		if ( fragmentShader )
+		{
+			vkDestroyShaderModule( device, fragmentShader, nullptr );
+		}
+
+		if ( vertexShader )
+		{
+			vkDestroyShaderModule( device, vertexShader, nullptr );
+		}
+
+		if ( pipelineLayout )
+		{
+			vkDestroyPipelineLayout( device, pipelineLayout, nullptr );
+		}
+
+		if ( descriptorPool )
+		{
+			vkDestroyDescriptorPool( device, descriptorPool, nullptr );
+		}
+
+		if ( descriptorLayout )
+		{
+			vkDestroyDescriptorSetLayout( device, descriptorLayout, nullptr );
+		}
+
+		for ( auto buffer : { vertexBuffer, uniformBuffer, transferBuffers[0], transferBuffers[1] } )
+		{
+			if ( buffer )
+			{
+				vkDestroyBuffer( device, buffer, nullptr );
+			}
+		}
+
+		if ( frameBuffer )
+		{
+			vkDestroyFramebuffer( device, frameBuffer, nullptr );
+		}
+
+		if ( imageView )
+		{
+			vkDestroyImageView( device, imageView, nullptr );
+		}
+
+		if ( image )
+		{
+			vkDestroyImage( device, image, nullptr );
+		}
+
+		if ( renderPass )
+		{
+			vkDestroyRenderPass( device, renderPass, nullptr );
+		}
+
+		for ( auto memory : m_memories )
+		{
+			vkFreeMemory( device, memory, nullptr );
+		}
+
+		if ( secondaryCommandBuffer )
+		{
+			vkFreeCommandBuffers( device, commandPool, 1u, &secondaryCommandBuffer );
+		}
+
+		if ( commandBuffer )
+		{
+			vkFreeCommandBuffers( device, commandPool, 1u, &commandBuffer );
+		}
+
+		if ( commandPool )
+		{
+			vkDestroyCommandPool( device, commandPool, nullptr );
+		}
+
+		if ( device )
+		{
+			vkDestroyDevice( device, nullptr );
+		}
+
+		if ( instance )
+		{
+			vkDestroyInstance( instance, nullptr );
+		}
+
+		*this = Context{};
+	}
+
+	VkResult Context::createPipeline( VkPipeline & result )const
+	{
+		std::array< VkPipelineShaderStageCreateInfo, 2u > stages
+		{
+			VkPipelineShaderStageCreateInfo{ VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO
+				, nullptr
+				, 0u
+				, VK_SHADER_STAGE_VERTEX_BIT
+				, vertexShader
+				, "main"
+				, nullptr },
+			VkPipelineShaderStageCreateInfo{ VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO
+				, nullptr
+				, 0u
+				, VK_SHADER_STAGE_FRAGMENT_BIT
+				, fragmentShader
+				, "main"
+				, nullptr },
+		};
+		VkVertexInputBindingDescription binding{ 0u
+			, 2u * sizeof( float )
+			, VK_VERTEX_INPUT_RATE_VERTEX };
+		VkVertexInputAttributeDescription attribute{ 0u
+			, 0u
+			, VK_FORMAT_R32G32_SFLOAT
+			, 0u };
+		VkPipelineVertexInputStateCreateInfo vertexInput{ VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO
+			, nullptr
+			, 0u
+			, 1u
+			, &binding
+			, 1u
+			, &attribute };
+		VkPipelineInputAssemblyStateCreateInfo inputAssembly{ VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO
+			, nullptr
+			, 0u
+			, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST
+			, VK_FALSE };
+		VkViewport viewport{ 0.0f, 0.0f, float( Extent ), float( Extent ), 0.0f, 1.0f };
+		VkRect2D scissor{ { 0, 0 }, { Extent, Extent } };
+		VkPipelineViewportStateCreateInfo viewportState{ VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO
+			, nullptr
+			, 0u
+			, 1u
+			, &viewport
+			, 1u
+			, &scissor };
+		VkPipelineRasterizationStateCreateInfo rasterization{ VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO
+			, nullptr
+			, 0u
+			, VK_FALSE
+			, VK_FALSE
+			, VK_POLYGON_MODE_FILL
+			, VK_CULL_MODE_NONE
+			, VK_FRONT_FACE_COUNTER_CLOCKWISE
+			, VK_FALSE
+			, 0.0f
+			, 0.0f
+			, 0.0f
+			, 1.0f };
+		VkPipelineMultisampleStateCreateInfo multisample{ VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO
+			, nullptr
+			, 0u
+			, VK_SAMPLE_COUNT_1_BIT
+			, VK_FALSE
+			, 0.0f
+			, nullptr
+			, VK_FALSE
+			, VK_FALSE };
+		VkPipelineColorBlendAttachmentState blendAttachment{ VK_FALSE
+			, VK_BLEND_FACTOR_ONE
+			, VK_BLEND_FACTOR_ZERO
+			, VK_BLEND_OP_ADD
+			, VK_BLEND_FACTOR_ONE
+			, VK_BLEND_FACTOR_ZERO
+			, VK_BLEND_OP_ADD
+			, VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT };
+		VkPipelineColorBlendStateCreateInfo colourBlend{ VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO
+			, nullptr
+			, 0u
+			, VK_FALSE
+			, VK_LOGIC_OP_COPY
+			, 1u
+			, &blendAttachment
+			, { 0.0f, 0.0f, 0.0f, 0.0f } };
+		VkGraphicsPipelineCreateInfo createInfo{ VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO
+			, nullptr
+			, 0u
+			, uint32_t( stages.size() )
+			, stages.data()
+			, &vertexInput
+			, &inputAssembly
+			, nullptr
+			, &viewportState
+			, &rasterization
+			, &multisample
+			, nullptr
+			, &colourBlend
+			, nullptr
+			, pipelineLayout
+			, renderPass
+			, 0u
+			, VK_NULL_HANDLE
+			, -1 };
+		return vkCreateGraphicsPipelines( device, VK_NULL_HANDLE, 1u, &createInfo, nullptr, &result );
+	}
+
+	void Context::beginRecording( bool inRenderPass )const
+	{
+		VkCommandBufferBeginInfo beginInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO
+			, nullptr
+			, 0u
+			, nullptr };
+		vkResetCommandBuffer( commandBuffer, 0u );
+		vkBeginCommandBuffer( commandBuffer, &beginInfo );
+
+		if ( inRenderPass )
+		{
+			VkClearValue clearValue{};
+			VkRenderPassBeginInfo renderPassInfo{ VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO
+				, nullptr
+				, renderPass
+				, frameBuffer
+				, { { 0, 0 }, { Extent, Extent } }
+				, 1u
+				, &clearValue };
+			vkCmdBeginRenderPass( commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE );
+		}
+	}
+
+	void Context::endRecording( bool inRenderPass )const
+	{
+		if ( inRenderPass )
+		{
+			vkCmdEndRenderPass( commandBuffer );
+		}
+
+		vkEndCommandBuffer( commandBuffer );
+	}
+
+	VkResult Context::submitAndWait()const
+	{
+		VkSubmitInfo submitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO
+			, nullptr
+			, 0u
+			, nullptr
+			, nullptr
+			, 1u
+			, &commandBuffer
+			, 0u
+			, nullptr };
+		auto result = vkQueueSubmit( queue, 1u, &submitInfo, VK_NULL_HANDLE );
+
+		if ( result == VK_SUCCESS )
+		{
+			result = vkQueueWaitIdle( queue );
+		}
+
+		return result;
+	}
+
+	void Context::recordTransferCommands( VkCommandBuffer target
+		, uint32_t count )const
+	{
+		VkViewport viewport{ 0.0f, 0.0f, float( Extent ), float( Extent ), 0.0f, 1.0f };
+		VkRect2D scissor{ { 0, 0 }, { Extent, Extent } };
+		std::array< uint32_t, 4u > data{ 1u, 2u, 3u, 4u };
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			auto src = transferBuffers[i % 2u];
+			auto dst = transferBuffers[( i + 1u ) % 2u];
+
+			switch ( i % 5u )
+			{
+			case 0u:
+				vkCmdSetViewport( target, 0u, 1u, &viewport );
+				break;
+			case 1u:
+				vkCmdSetScissor( target, 0u, 1u, &scissor );
+				break;
+			case 2u:
+				vkCmdFillBuffer( target, dst, 0u, 256u, i );
+				break;
+			case 3u:
+				vkCmdUpdateBuffer( target, dst, 256u, sizeof( data ), data.data() );
+				break;
+			default:
+				{
+					VkBufferCopy copy{ 0u, 512u, 256u };
+					vkCmdCopyBuffer( target, src, dst, 1u, &copy );
+				}
+				break;
+			}
+		}
+	}
+
+	bool Context::doCreateDevice( char const * appName )
+	{
+		VkApplicationInfo appInfo{ VK_STRUCTURE_TYPE_APPLICATION_INFO
+			, nullptr
+			, appName
+			, VK_MAKE_VERSION( 1, 0, 0 )
+			, "Ashes"
+			, VK_MAKE_VERSION( 1, 0, 0 )
+			, VK_API_VERSION_1_0 };
+		VkInstanceCreateInfo instanceInfo{ VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO
+			, nullptr
+			, 0u
+			, &appInfo
+			, 0u
+			, nullptr
+			, 0u
+			, nullptr };
+
+		if ( vkCreateInstance( &instanceInfo, nullptr, &instance ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		uint32_t count = 1u;
+		vkEnumeratePhysicalDevices( instance, &count, &physicalDevice );
+
+		if ( !physicalDevice )
+		{
+			return false;
+		}
+
+		vkGetPhysicalDeviceMemoryProperties( physicalDevice, &m_memoryProperties );
+		float priority = 1.0f;
+		VkDeviceQueueCreateInfo queueInfo{ VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO
+			, nullptr
+			, 0u
+			, 0u
+			, 1u
+			, &priority };
+		VkDeviceCreateInfo deviceInfo{ VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO
+			, nullptr
+			, 0u
+			, 1u
+			, &queueInfo
+			, 0u
+			, nullptr
+			, 0u
+			, nullptr
+			, nullptr };
+
+		if ( vkCreateDevice( physicalDevice, &deviceInfo, nullptr, &device ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		vkGetDeviceQueue( device, 0u, 0u, &queue );
+		VkCommandPoolCreateInfo poolInfo{ VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO
+			, nullptr
+			, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT
+			, 0u };
+
+		if ( vkCreateCommandPool( device, &poolInfo, nullptr, &commandPool ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkCommandBufferAllocateInfo allocateInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO
+			, nullptr
+			, commandPool
+			, VK_COMMAND_BUFFER_LEVEL_PRIMARY
+			, 1u };
+
+		if ( vkAllocateCommandBuffers( device, &allocateInfo, &commandBuffer ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+		return vkAllocateCommandBuffers( device, &allocateInfo, &secondaryCommandBuffer ) == VK_SUCCESS;
+	}
+
+	bool Context::doCreateTarget()
+	{
+		VkAttachmentDescription attachment{ 0u
+			, VK_FORMAT_R8G8B8A8_UNORM
+			, VK_SAMPLE_COUNT_1_BIT
+			, VK_ATTACHMENT_LOAD_OP_CLEAR
+			, VK_ATTACHMENT_STORE_OP_STORE
+			, VK_ATTACHMENT_LOAD_OP_DONT_CARE
+			, VK_ATTACHMENT_STORE_OP_DONT_CARE
+			, VK_IMAGE_LAYOUT_UNDEFINED
+			, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+		VkAttachmentReference reference{ 0u, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+		VkSubpassDescription subpass{ 0u
+			, VK_PIPELINE_BIND_POINT_GRAPHICS
+			, 0u
+			, nullptr
+			, 1u
+			, &reference
+			, nullptr
+			, nullptr
+			, 0u
+			, nullptr };
+		VkRenderPassCreateInfo renderPassInfo{ VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO
+			, nullptr
+			, 0u
+			, 1u
+			, &attachment
+			, 1u
+			, &subpass
+			, 0u
+			, nullptr };
+
+		if ( vkCreateRenderPass( device, &renderPassInfo, nullptr, &renderPass ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkImageCreateInfo imageInfo{ VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO
+			, nullptr
+			, 0u
+			, VK_IMAGE_TYPE_2D
+			, VK_FORMAT_R8G8B8A8_UNORM
+			, { Extent, Extent, 1u }
+			, 1u
+			, 1u
+			, VK_SAMPLE_COUNT_1_BIT
+			, VK_IMAGE_TILING_OPTIMAL
+			, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT
+			, VK_SHARING_MODE_EXCLUSIVE
+			, 0u
+			, nullptr
+			, VK_IMAGE_LAYOUT_UNDEFINED };
+
+		if ( vkCreateImage( device, &imageInfo, nullptr, &image ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkMemoryRequirements requirements{};
+		vkGetImageMemoryRequirements( device, image, &requirements );
+		VkDeviceMemory memory{};
+
+		if ( !doAllocateMemory( requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, memory )
+			|| vkBindImageMemory( device, image, memory, 0u ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkImageViewCreateInfo viewInfo{ VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO
+			, nullptr
+			, 0u
+			, image
+			, VK_IMAGE_VIEW_TYPE_2D
+			, VK_FORMAT_R8G8B8A8_UNORM
+			, { VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY }
+			, { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u } };
+
+		if ( vkCreateImageView( device, &viewInfo, nullptr, &imageView ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkFramebufferCreateInfo frameBufferInfo{ VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO
+			, nullptr
+			, 0u
+			, renderPass
+			, 1u
+			, &imageView
+			, Extent
+			, Extent
+			, 1u };
+		return vkCreateFramebuffer( device, &frameBufferInfo, nullptr, &frameBuffer ) == VK_SUCCESS;
+	}
+
+	bool Context::doCreateBuffers()
+	{
+		auto hostVisible = VkMemoryPropertyFlags( VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT );
+		auto deviceLocal = VkMemoryPropertyFlags( VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT );
+		auto transfer = VkBufferUsageFlags( VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT );
+		VkDeviceMemory vertexMemory{};
+		VkDeviceMemory memory{};
+
+		if ( !doCreateBuffer( VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, hostVisible, vertexBuffer, vertexMemory )
+			|| !doCreateBuffer( VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, deviceLocal, uniformBuffer, memory )
+			|| !doCreateBuffer( transfer, deviceLocal, transferBuffers[0], memory )
+			|| !doCreateBuffer( transfer, deviceLocal, transferBuffers[1], memory ) )
+		{
+			return false;
+		}
+
+		// A small triangle, so that the rasterisation cost stays low next to the API cost.
+		std::array< float, 6u > vertices{ -0.1f, -0.1f, 0.1f, -0.1f, 0.0f, 0.1f };
+		void * data{};
+
+		if ( vkMapMemory( device, vertexMemory, 0u, VK_WHOLE_SIZE, 0u, &data ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		std::memcpy( data, vertices.data(), sizeof( vertices ) );
+		VkMappedMemoryRange range{ VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE
+			, nullptr
+			, vertexMemory
+			, 0u
+			, VK_WHOLE_SIZE };
+		vkFlushMappedMemoryRanges( device, 1u, &range );
+		vkUnmapMemory( device, vertexMemory );
+
+		VkMemoryRequirements requirements{ BufferSize, 1u, ~0u };
+		return doAllocateMemory( requirements, hostVisible, hostMemory );
+	}
+
+	bool Context::doCreateDescriptors()
+	{
+		VkDescriptorSetLayoutBinding binding{ 0u
+			, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+			, 1u
+			, VK_SHADER_STAGE_FRAGMENT_BIT
+			, nullptr };
+		VkDescriptorSetLayoutCreateInfo layoutInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO
+			, nullptr
+			, 0u
+			, 1u
+			, &binding };
+
+		if ( vkCreateDescriptorSetLayout( device, &layoutInfo, nullptr, &descriptorLayout ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkDescriptorPoolSize poolSize{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1u };
+		VkDescriptorPoolCreateInfo poolInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO
+			, nullptr
+			, 0u
+			, 1u
+			, 1u
+			, &poolSize };
+
+		if ( vkCreateDescriptorPool( device, &poolInfo, nullptr, &descriptorPool ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkDescriptorSetAllocateInfo allocateInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO
+			, nullptr
+			, descriptorPool
+			, 1u
+			, &descriptorLayout };
+
+		if ( vkAllocateDescriptorSets( device, &allocateInfo, &descriptorSet ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkDescriptorBufferInfo bufferInfo{ uniformBuffer, 0u, VK_WHOLE_SIZE };
+		VkWriteDescriptorSet write{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET
+			, nullptr
+			, descriptorSet
+			, 0u
+			, 0u
+			, 1u
+			, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+			, nullptr
+			, &bufferInfo
+			, nullptr };
+		vkUpdateDescriptorSets( device, 1u, &write, 0u, nullptr );
+		VkPushConstantRange pushConstants{ VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT
+			, 0u
+			, PushConstantsSize };
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo{ VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO
+			, nullptr
+			, 0u
+			, 1u
+			, &descriptorLayout
+			, 1u
+			, &pushConstants };
+		return vkCreatePipelineLayout( device, &pipelineLayoutInfo, nullptr, &pipelineLayout ) == VK_SUCCESS;
+	}
+
+	bool Context::doCreatePipeline()
+	{
+		VkShaderModuleCreateInfo vertexInfo{ VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO
+			, nullptr
+			, 0u
+			, sizeof( VertexShader )
+			, VertexShader };
+		VkShaderModuleCreateInfo fragmentInfo{ VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO
+			, nullptr
+			, 0u
+			, sizeof( FragmentShader )
+			, FragmentShader };
+		return vkCreateShaderModule( device, &vertexInfo, nullptr, &vertexShader ) == VK_SUCCESS
+			&& vkCreateShaderModule( device, &fragmentInfo, nullptr, &fragmentShader ) == VK_SUCCESS
+			&& createPipeline( pipeline ) == VK_SUCCESS;
+	}
+
+	uint32_t Context::doGetMemoryTypeIndex( uint32_t typeBits
+		, VkMemoryPropertyFlags flags )const
+	{
+		// Prefer a type with the requested properties, fall back to any allowed one.
+		for ( auto required : { flags, VkMemoryPropertyFlags( 0u ) } )
+		{
+			for ( uint32_t index = 0u; index < m_memoryProperties.memoryTypeCount; ++index )
+			{
+				if ( ( typeBits & ( 1u << index ) )
+					&& ( m_memoryProperties.memoryTypes[index].propertyFlags & required ) == required )
+				{
+					return index;
+				}
+			}
+		}
+
+		return m_memoryProperties.memoryTypeCount;
+	}
+
+	bool Context::doAllocateMemory( VkMemoryRequirements const & requirements
+		, VkMemoryPropertyFlags flags
+		, VkDeviceMemory & memory )
+	{
+		VkMemoryAllocateInfo allocateInfo{ VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO
+			, nullptr
+			, requirements.size
+			, doGetMemoryTypeIndex( requirements.memoryTypeBits, flags ) };
+
+		if ( allocateInfo.memoryTypeIndex >= m_memoryProperties.memoryTypeCount
+			|| vkAllocateMemory( device, &allocateInfo, nullptr, &memory ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		m_memories.push_back( memory );
+		return true;
+	}
+
+	bool Context::doCreateBuffer( VkBufferUsageFlags usage
+		, VkMemoryPropertyFlags flags
+		, VkBuffer & buffer
+		, VkDeviceMemory & memory )
+	{
+		VkBufferCreateInfo bufferInfo{ VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO
+			, nullptr
+			, 0u
+			, BufferSize
+			, usage
+			, VK_SHARING_MODE_EXCLUSIVE
+			, 0u
+			, nullptr };
+
+		if ( vkCreateBuffer( device, &bufferInfo, nullptr, &buffer ) != VK_SUCCESS )
+		{
+			return false;
+		}
+
+		VkMemoryRequirements requirements{};
+		vkGetBufferMemoryRequirements( device, buffer, &requirements );
+		return doAllocateMemory( requirements, flags, memory )
+			&& vkBindBufferMemory( device, buffer, memory, 0u ) == VK_SUCCESS;
+	}
+}
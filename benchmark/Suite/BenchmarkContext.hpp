@@ -0,0 +1,100 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include <ashes/ashes.h>
+
+#include <vector>
+
+namespace ashes::bench
+{
+	/**
+	*\brief
+	*	The Vulkan objects the benchmarks run with, created with the selected plugin.
+	*\remarks
+	*	A single triangle pipeline, rendering to a small colour image,
+	*	with one uniform buffer descriptor set and a push constants range.
+	*/
+	struct Context
+	{
+		static uint32_t constexpr Extent = 64u;
+		static uint32_t constexpr PushConstantsSize = 64u;
+		static VkDeviceSize constexpr BufferSize = 4096u;
+
+		bool initialise( char const * appName );
+		void cleanup();
+		/**
+		*\brief
+		*	Creates a pipeline like the context's one, the caller destroys it.
+		*/
+		VkResult createPipeline( VkPipeline & result )const;
+		/**
+		*\brief
+		*	Resets the command buffer and begins it, in the render pass if requested.
+		*/
+		void beginRecording( bool inRenderPass )const;
+		/**
+		*\brief
+		*	Ends the render pass if it was begun, then the command buffer.
+		*/
+		void endRecording( bool inRenderPass )const;
+		/**
+		*\brief
+		*	Submits the command buffer, and waits for the queue to be idle.
+		*/
+		VkResult submitAndWait()const;
+		/**
+		*\brief
+		*	Records the given count of commands, cycling through viewport, scissor,
+		*	fill, update and copy ones on the transfer buffers, outside of any render pass.
+		*/
+		void recordTransferCommands( VkCommandBuffer target
+			, uint32_t count )const;
+
+		VkInstance instance{};
+		VkPhysicalDevice physicalDevice{};
+		VkDevice device{};
+		VkQueue queue{};
+		VkCommandPool commandPool{};
+		VkCommandBuffer commandBuffer{};
+		VkCommandBuffer secondaryCommandBuffer{};
+		VkRenderPass renderPass{};
+		VkImage image{};
+		VkImageView imageView{};
+		VkFramebuffer frameBuffer{};
+		VkBuffer vertexBuffer{};
+		VkBuffer uniformBuffer{};
+		VkBuffer transferBuffers[2]{};
+		// Host visible, not bound to any buffer, for the map/flush benchmarks.
+		VkDeviceMemory hostMemory{};
+		VkDescriptorSetLayout descriptorLayout{};
+		VkDescriptorPool descriptorPool{};
+		VkDescriptorSet descriptorSet{};
+		VkPipelineLayout pipelineLayout{};
+		VkShaderModule vertexShader{};
+		VkShaderModule fragmentShader{};
+		VkPipeline pipeline{};
+
+	private:
+		bool doCreateDevice( char const * appName );
+		bool doCreateTarget();
+		bool doCreateBuffers();
+		bool doCreateDescriptors();
+		bool doCreatePipeline();
+		uint32_t doGetMemoryTypeIndex( uint32_t typeBits
+			, VkMemoryPropertyFlags flags )const;
+		bool doAllocateMemory( VkMemoryRequirements const & requirements
+			, VkMemoryPropertyFlags flags
+			, VkDeviceMemory & memory );
+		bool doCreateBuffer( VkBufferUsageFlags usage
+			, VkMemoryPropertyFlags flags
+			, VkBuffer & buffer
+			, VkDeviceMemory & memory );
+
+	private:
+		VkPhysicalDeviceMemoryProperties m_memoryProperties{};
+		std::vector< VkDeviceMemory > m_memories;
+	};
+}
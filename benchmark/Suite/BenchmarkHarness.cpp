@@ -0,0 +1,221 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "BenchmarkHarness.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+#include <ostream>
+
+namespace ashes::bench
+{
+	std::string escapeJson( std::string const & value )
+	{
+		std::string result;
+
+		for ( auto c : value )
+		{
+			switch ( c )
+			{
+			case '"':
+				result += "\\\"";
+				break;
+			case '\\':
+				result += "\\\\";
+				break;
+			default:
+				if ( uint8_t( c ) < 0x20u )
+				{
+					char buffer[8];
+					std::snprintf( buffer, sizeof( buffer ), "\\u%04x", uint32_t( c ) );
+					result += buffer;
+				}
+				else
+				{
+					result += c;
+				}
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	//*********************************************************************************************
+
+	State::State( uint32_t iterations )
+		: m_iterations{ iterations }
+	{
+	}
+
+	void State::resume()
+	{
+		m_start = Clock::now();
+	}
+
+	void State::pause()
+	{
+		m_elapsed += Clock::now() - m_start;
+	}
+
+	void State::addElapsed( Clock::duration elapsed )
+	{
+		m_elapsed += elapsed;
+	}
+
+	void State::setItemsPerIteration( uint32_t count )
+	{
+		m_items = std::max( 1u, count );
+	}
+
+	void State::fail( std::string error )
+	{
+		if ( m_error.empty() )
+		{
+			m_error = std::move( error );
+		}
+	}
+
+	double State::getNanosecondsPerItem()const
+	{
+		return double( std::chrono::duration_cast< std::chrono::nanoseconds >( m_elapsed ).count() )
+			/ ( double( m_iterations ) * double( m_items ) );
+	}
+
+	//*********************************************************************************************
+
+	double Result::getMedian()const
+	{
+		return samples.empty()
+			? 0.0
+			: samples[samples.size() / 2u];
+	}
+
+	//*********************************************************************************************
+
+	ResultArray runBenchmarks( BenchmarkArray const & benchmarks
+		, Context const & context
+		, std::string const & plugin
+		, std::string const & filter
+		, uint32_t repetitions )
+	{
+		ResultArray results;
+
+		for ( auto & benchmark : benchmarks )
+		{
+			if ( benchmark.name.find( filter ) == std::string::npos )
+			{
+				continue;
+			}
+
+			Result result;
+			result.plugin = plugin;
+			result.name = benchmark.name;
+			result.iterations = benchmark.iterations;
+
+			// The first run warms up, its results are dropped.
+			for ( uint32_t repetition = 0u; repetition <= repetitions && result.error.empty(); ++repetition )
+			{
+				State state{ benchmark.iterations };
+				benchmark.body( context, state );
+				result.error = state.getError();
+				result.items = state.getItemsPerIteration();
+
+				if ( repetition > 0u )
+				{
+					result.samples.push_back( state.getNanosecondsPerItem() );
+				}
+			}
+
+			if ( !result.error.empty() )
+			{
+				result.samples.clear();
+			}
+
+			std::sort( result.samples.begin(), result.samples.end() );
+			results.push_back( std::move( result ) );
+		}
+
+		return results;
+	}
+
+	void printResults( std::ostream & stream
+		, ResultArray const & results )
+	{
+		stream << std::left << std::setw( 8 ) << "Plugin"
+			<< std::setw( 32 ) << "Benchmark"
+			<< std::right << std::setw( 12 ) << "Median"
+			<< std::setw( 12 ) << "Min"
+			<< std::setw( 12 ) << "Max"
+			<< "  ns/item" << std::endl;
+
+		for ( auto & result : results )
+		{
+			stream << std::left << std::setw( 8 ) << result.plugin
+				<< std::setw( 32 ) << result.name;
+
+			if ( !result.error.empty() )
+			{
+				stream << "  failed: " << result.error << std::endl;
+				continue;
+			}
+
+			stream << std::right << std::fixed << std::setprecision( 2 )
+				<< std::setw( 12 ) << result.getMedian()
+				<< std::setw( 12 ) << result.samples.front()
+				<< std::setw( 12 ) << result.samples.back()
+				<< std::endl;
+		}
+	}
+
+	void writeJson( std::ostream & stream
+		, ResultArray const & results
+		, uint32_t repetitions )
+	{
+		stream << "{\n";
+		stream << "\t\"version\": 1,\n";
+		stream << "\t\"unit\": \"ns\",\n";
+		stream << "\t\"repetitions\": " << repetitions << ",\n";
+		stream << "\t\"benchmarks\": [";
+		auto separator = "\n";
+
+		for ( auto & result : results )
+		{
+			stream << separator << "\t\t{\n";
+			stream << "\t\t\t\"plugin\": \"" << escapeJson( result.plugin ) << "\",\n";
+			stream << "\t\t\t\"name\": \"" << escapeJson( result.name ) << "\",\n";
+			stream << "\t\t\t\"iterations\": " << result.iterations << ",\n";
+			stream << "\t\t\t\"items\": " << result.items << ",\n";
+
+			if ( !result.error.empty() )
+			{
+				stream << "\t\t\t\"error\": \"" << escapeJson( result.error ) << "\"\n";
+			}
+			else
+			{
+				stream << std::fixed << std::setprecision( 3 );
+				stream << "\t\t\t\"median\": " << result.getMedian() << ",\n";
+				stream << "\t\t\t\"min\": " << result.samples.front() << ",\n";
+				stream << "\t\t\t\"max\": " << result.samples.back() << ",\n";
+				stream << "\t\t\t\"samples\": [";
+				auto sampleSeparator = " ";
+
+				for ( auto sample : result.samples )
+				{
+					stream << sampleSeparator << sample;
+					sampleSeparator = ", ";
+				}
+
+				stream << " ]\n";
+			}
+
+			stream << "\t\t}";
+			separator = ",\n";
+		}
+
+		stream << "\n\t]\n";
+		stream << "}\n";
+	}
+}
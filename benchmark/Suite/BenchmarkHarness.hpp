@@ -0,0 +1,130 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace ashes::bench
+{
+	struct Context;
+	/**
+	*\brief
+	*	Given to a benchmark body, which times its measured part with it.
+	*/
+	class State
+	{
+	public:
+		using Clock = std::chrono::high_resolution_clock;
+
+		explicit State( uint32_t iterations );
+		/**
+		*\brief
+		*	Starts timing, what precedes isn't measured.
+		*/
+		void resume();
+		/**
+		*\brief
+		*	Stops timing, what follows isn't measured until the next resume.
+		*/
+		void pause();
+		/**
+		*\brief
+		*	Adds a duration measured out of this process (e.g. by a child process).
+		*/
+		void addElapsed( Clock::duration elapsed );
+		/**
+		*\brief
+		*	Sets the count of items each iteration processes (e.g. commands per submit),
+		*	the results are then given per item.
+		*/
+		void setItemsPerIteration( uint32_t count );
+		/**
+		*\brief
+		*	Marks the run as failed, its results are discarded.
+		*/
+		void fail( std::string error );
+
+		inline uint32_t getIterations()const
+		{
+			return m_iterations;
+		}
+
+		inline uint32_t getItemsPerIteration()const
+		{
+			return m_items;
+		}
+
+		inline std::string const & getError()const
+		{
+			return m_error;
+		}
+
+		double getNanosecondsPerItem()const;
+
+	private:
+		uint32_t m_iterations;
+		uint32_t m_items{ 1u };
+		Clock::duration m_elapsed{};
+		Clock::time_point m_start{};
+		std::string m_error;
+	};
+
+	using BenchmarkBody = std::function< void( Context const &, State & ) >;
+
+	struct Benchmark
+	{
+		std::string name;
+		uint32_t iterations;
+		BenchmarkBody body;
+	};
+	using BenchmarkArray = std::vector< Benchmark >;
+
+	struct Result
+	{
+		std::string plugin;
+		std::string name;
+		uint32_t iterations{};
+		uint32_t items{};
+		// Nanoseconds per item, one per repetition, sorted.
+		std::vector< double > samples;
+		std::string error;
+
+		double getMedian()const;
+	};
+	using ResultArray = std::vector< Result >;
+	/**
+	*\brief
+	*	Runs the benchmarks whose name contains the filter,
+	*	once to warm up, then the given count of repetitions.
+	*/
+	ResultArray runBenchmarks( BenchmarkArray const & benchmarks
+		, Context const & context
+		, std::string const & plugin
+		, std::string const & filter
+		, uint32_t repetitions );
+	/**
+	*\brief
+	*	Prints the results as a table.
+	*/
+	void printResults( std::ostream & stream
+		, ResultArray const & results );
+	/**
+	*\brief
+	*	Writes the results as JSON, one object per benchmark and plugin.
+	*/
+	void writeJson( std::ostream & stream
+		, ResultArray const & results
+		, uint32_t repetitions );
+	/**
+	*\brief
+	*	Escapes a string's quotes, backslashes and control characters, for JSON output.
+	*/
+	std::string escapeJson( std::string const & value );
+}
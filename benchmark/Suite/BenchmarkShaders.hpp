@@ -0,0 +1,55 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include <cstdint>
+
+namespace ashes::bench
+{
+	/**
+	*\brief
+	*	layout( location = 0 ) in vec2 position;
+	*	void main() { gl_Position = vec4( position, 0.0, 1.0 ); }
+	*/
+	static uint32_t const VertexShader[]
+	{
+		0x07230203u, 0x00010000u, 0x00000000u, 0x00000012u, 0x00000000u, 0x00020011u,
+		0x00000001u, 0x0003000eu, 0x00000000u, 0x00000001u, 0x0007000fu, 0x00000000u,
+		0x00000001u, 0x6e69616du, 0x00000000u, 0x00000002u, 0x00000003u, 0x00040047u,
+		0x00000002u, 0x0000001eu, 0x00000000u, 0x00040047u, 0x00000003u, 0x0000000bu,
+		0x00000000u, 0x00020013u, 0x00000004u, 0x00030021u, 0x00000005u, 0x00000004u,
+		0x00030016u, 0x00000006u, 0x00000020u, 0x00040017u, 0x00000007u, 0x00000006u,
+		0x00000002u, 0x00040017u, 0x00000008u, 0x00000006u, 0x00000004u, 0x00040020u,
+		0x00000009u, 0x00000001u, 0x00000007u, 0x00040020u, 0x0000000au, 0x00000003u,
+		0x00000008u, 0x0004003bu, 0x00000009u, 0x00000002u, 0x00000001u, 0x0004003bu,
+		0x0000000au, 0x00000003u, 0x00000003u, 0x0004002bu, 0x00000006u, 0x0000000bu,
+		0x00000000u, 0x0004002bu, 0x00000006u, 0x0000000cu, 0x3f800000u, 0x00050036u,
+		0x00000004u, 0x00000001u, 0x00000000u, 0x00000005u, 0x000200f8u, 0x0000000du,
+		0x0004003du, 0x00000007u, 0x0000000eu, 0x00000002u, 0x00050051u, 0x00000006u,
+		0x0000000fu, 0x0000000eu, 0x00000000u, 0x00050051u, 0x00000006u, 0x00000010u,
+		0x0000000eu, 0x00000001u, 0x00070050u, 0x00000008u, 0x00000011u, 0x0000000fu,
+		0x00000010u, 0x0000000bu, 0x0000000cu, 0x0003003eu, 0x00000003u, 0x00000011u,
+		0x000100fdu, 0x00010038u,
+	};
+	/**
+	*\brief
+	*	layout( location = 0 ) out vec4 colour;
+	*	void main() { colour = vec4( 1.0 ); }
+	*/
+	static uint32_t const FragmentShader[]
+	{
+		0x07230203u, 0x00010000u, 0x00000000u, 0x0000000bu, 0x00000000u, 0x00020011u,
+		0x00000001u, 0x0003000eu, 0x00000000u, 0x00000001u, 0x0006000fu, 0x00000004u,
+		0x00000001u, 0x6e69616du, 0x00000000u, 0x00000002u, 0x00030010u, 0x00000001u,
+		0x00000007u, 0x00040047u, 0x00000002u, 0x0000001eu, 0x00000000u, 0x00020013u,
+		0x00000003u, 0x00030021u, 0x00000004u, 0x00000003u, 0x00030016u, 0x00000005u,
+		0x00000020u, 0x00040017u, 0x00000006u, 0x00000005u, 0x00000004u, 0x00040020u,
+		0x00000007u, 0x00000003u, 0x00000006u, 0x0004003bu, 0x00000007u, 0x00000002u,
+		0x00000003u, 0x0004002bu, 0x00000005u, 0x00000008u, 0x3f800000u, 0x0007002cu,
+		0x00000006u, 0x00000009u, 0x00000008u, 0x00000008u, 0x00000008u, 0x00000008u,
+		0x00050036u, 0x00000003u, 0x00000001u, 0x00000000u, 0x00000004u, 0x000200f8u,
+		0x0000000au, 0x0003003eu, 0x00000002u, 0x00000009u, 0x000100fdu, 0x00010038u,
+	};
+}
@@ -0,0 +1,42 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "BenchmarkHarness.hpp"
+
+namespace ashes::bench
+{
+	/**
+	*\brief
+	*	vkCmd* recording costs, per recorded command.
+	*/
+	void registerRecordBenchmarks( BenchmarkArray & benchmarks );
+	/**
+	*\brief
+	*	vkQueueSubmit costs, per submitted command, the command buffer replay included.
+	*/
+	void registerSubmitBenchmarks( BenchmarkArray & benchmarks );
+	/**
+	*\brief
+	*	Descriptor updates, memory mapping and pipeline creation costs.
+	*/
+	void registerResourceBenchmarks( BenchmarkArray & benchmarks );
+	/**
+	*\brief
+	*	vkCreateInstance latency, in this process (warm), and in child processes (cold),
+	*	with the GL probe cache disabled then enabled.
+	*\param[in] self
+	*	This executable, the child processes run it with --startup-child.
+	*/
+	void registerStartupBenchmarks( BenchmarkArray & benchmarks
+		, std::string const & self );
+	/**
+	*\brief
+	*	Creates then destroys an instance with the selected plugin.
+	*\return
+	*	The vkCreateInstance duration, in nanoseconds, negative on failure.
+	*/
+	int64_t timeInstanceCreation();
+}
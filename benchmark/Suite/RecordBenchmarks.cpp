@@ -0,0 +1,143 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Benchmarks.hpp"
+#include "BenchmarkContext.hpp"
+
+#include <array>
+
+namespace ashes::bench
+{
+	namespace
+	{
+		uint32_t constexpr CommandsPerRecord = 10000u;
+
+		// Records the command given count of times, in the render pass, after the pipeline and vertex buffer binds.
+		template< typename RecordFuncT >
+		void record( Context const & context
+			, State & state
+			, RecordFuncT recordCommand )
+		{
+			VkDeviceSize offset{};
+			context.beginRecording( true );
+			vkCmdBindPipeline( context.commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, context.pipeline );
+			vkCmdBindVertexBuffers( context.commandBuffer, 0u, 1u, &context.vertexBuffer, &offset );
+			state.setItemsPerIteration( CommandsPerRecord );
+			state.resume();
+
+			for ( uint32_t i = 0u; i < CommandsPerRecord; ++i )
+			{
+				recordCommand( context.commandBuffer, i );
+			}
+
+			state.pause();
+			context.endRecording( true );
+		}
+	}
+
+	void registerRecordBenchmarks( BenchmarkArray & benchmarks )
+	{
+		benchmarks.push_back( { "record/draw"
+			, 1u
+			, []( Context const & context, State & state )
+			{
+				record( context
+					, state
+					, []( VkCommandBuffer commandBuffer, uint32_t )
+					{
+						vkCmdDraw( commandBuffer, 3u, 1u, 0u, 0u );
+					} );
+			} } );
+		// Through the plugin's entry point, the difference with record/draw is the loader's per call overhead.
+		benchmarks.push_back( { "record/draw_direct"
+			, 1u
+			, []( Context const & context, State & state )
+			{
+				auto draw = reinterpret_cast< PFN_vkCmdDraw >( vkGetDeviceProcAddr( context.device, "vkCmdDraw" ) );
+
+				if ( !draw )
+				{
+					state.fail( "Couldn't retrieve vkCmdDraw" );
+					return;
+				}
+
+				record( context
+					, state
+					, [draw]( VkCommandBuffer commandBuffer, uint32_t )
+					{
+						draw( commandBuffer, 3u, 1u, 0u, 0u );
+					} );
+			} } );
+		benchmarks.push_back( { "record/bind_pipeline"
+			, 1u
+			, []( Context const & context, State & state )
+			{
+				record( context
+					, state
+					, [&context]( VkCommandBuffer commandBuffer, uint32_t )
+					{
+						vkCmdBindPipeline( commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, context.pipeline );
+					} );
+			} } );
+		benchmarks.push_back( { "record/bind_vertex_buffers"
+			, 1u
+			, []( Context const & context, State & state )
+			{
+				record( context
+					, state
+					, [&context]( VkCommandBuffer commandBuffer, uint32_t i )
+					{
+						VkDeviceSize offset = ( i % 2u ) * 8u;
+						vkCmdBindVertexBuffers( commandBuffer, 0u, 1u, &context.vertexBuffer, &offset );
+					} );
+			} } );
+		benchmarks.push_back( { "record/push_constants"
+			, 1u
+			, []( Context const & context, State & state )
+			{
+				std::array< float, Context::PushConstantsSize / sizeof( float ) > data{};
+				record( context
+					, state
+					, [&context, &data]( VkCommandBuffer commandBuffer, uint32_t i )
+					{
+						data[0] = float( i );
+						vkCmdPushConstants( commandBuffer
+							, context.pipelineLayout
+							, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT
+							, 0u
+							, Context::PushConstantsSize
+							, data.data() );
+					} );
+			} } );
+		benchmarks.push_back( { "record/bind_descriptor_sets"
+			, 1u
+			, []( Context const & context, State & state )
+			{
+				record( context
+					, state
+					, [&context]( VkCommandBuffer commandBuffer, uint32_t )
+					{
+						vkCmdBindDescriptorSets( commandBuffer
+							, VK_PIPELINE_BIND_POINT_GRAPHICS
+							, context.pipelineLayout
+							, 0u
+							, 1u
+							, &context.descriptorSet
+							, 0u
+							, nullptr );
+					} );
+			} } );
+		benchmarks.push_back( { "record/mixed"
+			, 1u
+			, []( Context const & context, State & state )
+			{
+				context.beginRecording( false );
+				state.setItemsPerIteration( CommandsPerRecord );
+				state.resume();
+				context.recordTransferCommands( context.commandBuffer, CommandsPerRecord );
+				state.pause();
+				context.endRecording( false );
+			} } );
+	}
+}
@@ -0,0 +1,104 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Benchmarks.hpp"
+#include "BenchmarkContext.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace ashes::bench
+{
+	void registerResourceBenchmarks( BenchmarkArray & benchmarks )
+	{
+		benchmarks.push_back( { "descriptors/update"
+			, 10000u
+			, []( Context const & context, State & state )
+			{
+				VkDescriptorBufferInfo bufferInfo{ context.uniformBuffer, 0u, VK_WHOLE_SIZE };
+				VkWriteDescriptorSet write{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET
+					, nullptr
+					, context.descriptorSet
+					, 0u
+					, 0u
+					, 1u
+					, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+					, nullptr
+					, &bufferInfo
+					, nullptr };
+				state.resume();
+
+				for ( uint32_t i = 0u; i < state.getIterations(); ++i )
+				{
+					vkUpdateDescriptorSets( context.device, 1u, &write, 0u, nullptr );
+				}
+
+				state.pause();
+			} } );
+		benchmarks.push_back( { "memory/map_flush"
+			, 1000u
+			, []( Context const & context, State & state )
+			{
+				std::array< uint8_t, Context::BufferSize > data{};
+				VkMappedMemoryRange range{ VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE
+					, nullptr
+					, context.hostMemory
+					, 0u
+					, VK_WHOLE_SIZE };
+				state.resume();
+
+				for ( uint32_t i = 0u; i < state.getIterations(); ++i )
+				{
+					void * mapped{};
+
+					if ( vkMapMemory( context.device, context.hostMemory, 0u, VK_WHOLE_SIZE, 0u, &mapped ) != VK_SUCCESS )
+					{
+						state.pause();
+						state.fail( "vkMapMemory failed" );
+						return;
+					}
+
+					data[0] = uint8_t( i );
+					std::memcpy( mapped, data.data(), data.size() );
+					vkFlushMappedMemoryRanges( context.device, 1u, &range );
+					vkUnmapMemory( context.device, context.hostMemory );
+				}
+
+				state.pause();
+			} } );
+		benchmarks.push_back( { "pipeline/create"
+			, 100u
+			, []( Context const & context, State & state )
+			{
+				std::vector< VkPipeline > pipelines( state.getIterations(), VK_NULL_HANDLE );
+				VkResult result = VK_SUCCESS;
+				state.resume();
+
+				for ( auto & pipeline : pipelines )
+				{
+					result = context.createPipeline( pipeline );
+
+					if ( result != VK_SUCCESS )
+					{
+						break;
+					}
+				}
+
+				state.pause();
+
+				for ( auto pipeline : pipelines )
+				{
+					if ( pipeline != VK_NULL_HANDLE )
+					{
+						vkDestroyPipeline( context.device, pipeline, nullptr );
+					}
+				}
+
+				if ( result != VK_SUCCESS )
+				{
+					state.fail( "vkCreateGraphicsPipelines failed: " + std::to_string( result ) );
+				}
+			} } );
+	}
+}
@@ -0,0 +1,190 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Benchmarks.hpp"
+#include "BenchmarkContext.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if _WIN32
+#	define popen _popen
+#	define pclose _pclose
+#endif
+
+namespace ashes::bench
+{
+	namespace
+	{
+		/**
+		*\brief
+		*	Sets an environment variable, which the child processes inherit,
+		*	and restores its previous value when destroyed.
+		*/
+		class EnvironmentSetting
+		{
+		public:
+			EnvironmentSetting( char const * name
+				, std::string const & value )
+				: m_name{ name }
+			{
+				if ( auto previous = std::getenv( name ) )
+				{
+					m_previous = previous;
+					m_hadPrevious = true;
+				}
+
+				doSet( value.c_str() );
+			}
+
+			~EnvironmentSetting()
+			{
+				doSet( m_hadPrevious ? m_previous.c_str() : nullptr );
+			}
+
+			EnvironmentSetting( EnvironmentSetting const & ) = delete;
+			EnvironmentSetting & operator=( EnvironmentSetting const & ) = delete;
+
+		private:
+			void doSet( char const * value )
+			{
+#if _WIN32
+				_putenv_s( m_name, value ? value : "" );
+#else
+				if ( value )
+				{
+					setenv( m_name, value, 1 );
+				}
+				else
+				{
+					unsetenv( m_name );
+				}
+#endif
+			}
+
+		private:
+			char const * m_name;
+			std::string m_previous;
+			bool m_hadPrevious{ false };
+		};
+
+		// The first instance of a process pays for the plugins discovery and probing.
+		int64_t runChild( std::string const & command )
+		{
+			auto pipe = popen( command.c_str(), "r" );
+
+			if ( !pipe )
+			{
+				return -1;
+			}
+
+			char buffer[256]{};
+			int64_t result = -1;
+
+			while ( std::fgets( buffer, sizeof( buffer ), pipe ) )
+			{
+				if ( std::strncmp( buffer, "cold ", 5 ) == 0 )
+				{
+					result = std::atoll( buffer + 5 );
+				}
+			}
+
+			pclose( pipe );
+			return result;
+		}
+
+		BenchmarkBody makeColdBody( std::string const & self
+			, bool probeCache )
+		{
+			return [self, probeCache]( Context const & context, State & state )
+			{
+				AshPluginDescription description{};
+				ashGetCurrentPluginDescription( &description );
+				auto command = "\"" + self + "\" --startup-child";
+				EnvironmentSetting plugin{ "ASHES_RENDERER_NAME", description.name };
+				EnvironmentSetting cache{ "ASHES_GL_PROBE_CACHE", probeCache ? "1" : "0" };
+
+				if ( probeCache )
+				{
+					// Populates the cache, if the plugin uses one.
+					runChild( command );
+				}
+
+				for ( uint32_t i = 0u; i < state.getIterations(); ++i )
+				{
+					auto elapsed = runChild( command );
+
+					if ( elapsed < 0 )
+					{
+						state.fail( "The child process couldn't create an instance" );
+						return;
+					}
+
+					state.addElapsed( std::chrono::nanoseconds{ elapsed } );
+				}
+			};
+		}
+	}
+
+	int64_t timeInstanceCreation()
+	{
+		VkApplicationInfo appInfo{ VK_STRUCTURE_TYPE_APPLICATION_INFO
+			, nullptr
+			, "ashes-bench"
+			, VK_MAKE_VERSION( 1, 0, 0 )
+			, "Ashes"
+			, VK_MAKE_VERSION( 1, 0, 0 )
+			, VK_API_VERSION_1_0 };
+		VkInstanceCreateInfo createInfo{ VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO
+			, nullptr
+			, 0u
+			, &appInfo
+			, 0u
+			, nullptr
+			, 0u
+			, nullptr };
+		VkInstance instance{};
+		auto begin = State::Clock::now();
+		auto res = vkCreateInstance( &createInfo, nullptr, &instance );
+		auto end = State::Clock::now();
+
+		if ( res != VK_SUCCESS )
+		{
+			return -1;
+		}
+
+		vkDestroyInstance( instance, nullptr );
+		return std::chrono::duration_cast< std::chrono::nanoseconds >( end - begin ).count();
+	}
+
+	void registerStartupBenchmarks( BenchmarkArray & benchmarks
+		, std::string const & self )
+	{
+		benchmarks.push_back( { "startup/create_instance"
+			, 20u
+			, []( Context const & context, State & state )
+			{
+				for ( uint32_t i = 0u; i < state.getIterations(); ++i )
+				{
+					auto elapsed = timeInstanceCreation();
+
+					if ( elapsed < 0 )
+					{
+						state.fail( "vkCreateInstance failed" );
+						return;
+					}
+
+					state.addElapsed( std::chrono::nanoseconds{ elapsed } );
+				}
+			} } );
+		// Each sample is a child process, so these are kept short.
+		benchmarks.push_back( { "startup/create_instance_cold"
+			, 3u
+			, makeColdBody( self, false ) } );
+		benchmarks.push_back( { "startup/create_instance_cold_cached"
+			, 3u
+			, makeColdBody( self, true ) } );
+	}
+}
@@ -0,0 +1,152 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Benchmarks.hpp"
+#include "BenchmarkContext.hpp"
+
+namespace ashes::bench
+{
+	namespace
+	{
+		uint32_t constexpr SubmitsPerRun = 50u;
+		uint32_t constexpr CommandsPerSubmit = 1000u;
+
+		// Records the command buffer once, then times its submissions, waiting for each one.
+		template< typename RecordFuncT >
+		void submit( Context const & context
+			, State & state
+			, bool inRenderPass
+			, uint32_t commandCount
+			, RecordFuncT recordCommands )
+		{
+			context.beginRecording( inRenderPass );
+			recordCommands( context.commandBuffer );
+			context.endRecording( inRenderPass );
+			state.setItemsPerIteration( commandCount );
+
+			for ( uint32_t i = 0u; i < state.getIterations(); ++i )
+			{
+				state.resume();
+				auto result = context.submitAndWait();
+				state.pause();
+
+				if ( result != VK_SUCCESS )
+				{
+					state.fail( "vkQueueSubmit failed: " + std::to_string( result ) );
+					return;
+				}
+			}
+		}
+	}
+
+	void registerSubmitBenchmarks( BenchmarkArray & benchmarks )
+	{
+		benchmarks.push_back( { "submit/empty"
+			, SubmitsPerRun
+			, []( Context const & context, State & state )
+			{
+				submit( context
+					, state
+					, false
+					, 1u
+					, []( VkCommandBuffer )
+					{
+					} );
+			} } );
+		benchmarks.push_back( { "submit/draws"
+			, SubmitsPerRun
+			, []( Context const & context, State & state )
+			{
+				submit( context
+					, state
+					, true
+					, CommandsPerSubmit
+					, [&context]( VkCommandBuffer commandBuffer )
+					{
+						VkDeviceSize offset{};
+						vkCmdBindPipeline( commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, context.pipeline );
+						vkCmdBindVertexBuffers( commandBuffer, 0u, 1u, &context.vertexBuffer, &offset );
+						vkCmdBindDescriptorSets( commandBuffer
+							, VK_PIPELINE_BIND_POINT_GRAPHICS
+							, context.pipelineLayout
+							, 0u
+							, 1u
+							, &context.descriptorSet
+							, 0u
+							, nullptr );
+
+						for ( uint32_t i = 0u; i < CommandsPerSubmit; ++i )
+						{
+							vkCmdDraw( commandBuffer, 3u, 1u, 0u, 0u );
+						}
+					} );
+			} } );
+		benchmarks.push_back( { "submit/copies"
+			, SubmitsPerRun
+			, []( Context const & context, State & state )
+			{
+				submit( context
+					, state
+					, false
+					, CommandsPerSubmit
+					, [&context]( VkCommandBuffer commandBuffer )
+					{
+						VkBufferCopy copy{ 0u, 0u, Context::BufferSize / 4u };
+
+						for ( uint32_t i = 0u; i < CommandsPerSubmit; ++i )
+						{
+							copy.srcOffset = ( i % 4u ) * copy.size;
+							copy.dstOffset = ( ( i + 1u ) % 4u ) * copy.size;
+							vkCmdCopyBuffer( commandBuffer
+								, context.transferBuffers[i % 2u]
+								, context.transferBuffers[( i + 1u ) % 2u]
+								, 1u
+								, &copy );
+						}
+					} );
+			} } );
+		benchmarks.push_back( { "submit/mixed"
+			, SubmitsPerRun
+			, []( Context const & context, State & state )
+			{
+				submit( context
+					, state
+					, false
+					, CommandsPerSubmit
+					, [&context]( VkCommandBuffer commandBuffer )
+					{
+						context.recordTransferCommands( commandBuffer, CommandsPerSubmit );
+					} );
+			} } );
+		benchmarks.push_back( { "submit/mixed_secondary"
+			, SubmitsPerRun
+			, []( Context const & context, State & state )
+			{
+				submit( context
+					, state
+					, false
+					, CommandsPerSubmit
+					, [&context]( VkCommandBuffer commandBuffer )
+					{
+						VkCommandBufferInheritanceInfo inheritanceInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO
+							, nullptr
+							, VK_NULL_HANDLE
+							, 0u
+							, VK_NULL_HANDLE
+							, VK_FALSE
+							, 0u
+							, 0u };
+						VkCommandBufferBeginInfo beginInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO
+							, nullptr
+							, 0u
+							, &inheritanceInfo };
+						vkResetCommandBuffer( context.secondaryCommandBuffer, 0u );
+						vkBeginCommandBuffer( context.secondaryCommandBuffer, &beginInfo );
+						context.recordTransferCommands( context.secondaryCommandBuffer, CommandsPerSubmit );
+						vkEndCommandBuffer( context.secondaryCommandBuffer );
+						vkCmdExecuteCommands( commandBuffer, 1u, &context.secondaryCommandBuffer );
+					} );
+			} } );
+	}
+}
@@ -0,0 +1,419 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+
+Runs the benchmark suite against each requested plugin:
+- record/*: vkCmd* recording, per command.
+- submit/*: vkQueueSubmit of prerecorded command buffers, per command, the replay included.
+- descriptors/update, memory/map_flush, pipeline/create: per call.
+- startup/*: vkCreateInstance, per call. The cold ones run in a child process (ashes-bench --startup-child),
+  since the first instance of a process pays for the plugins discovery and probing.
+
+Usage: ashes-bench [--plugins test,gl] [--repetitions N] [--filter TEXT] [--json FILE] [--llvmpipe] [--list]
+	[--gl-error-check call|submit|async] [--pin-cpu N] [--baseline FILE [--update-baseline]]
+--llvmpipe forces Mesa's software rasteriser, so that the gl plugin runs headless.
+--gl-error-check selects the gl plugin's error check policy (ASHES_GL_ERROR_CHECK),
+  to compare their submit/* costs. Only meaningful with a release build of the gl plugin.
+--pin-cpu restricts the benchmark thread to the given CPU, the threads the plugins create keep their affinity.
+--baseline compares the medians to the baseline file ones, and fails if any regressed beyond its tolerance,
+  or rewrites the file with the new medians when --update-baseline is given.
+  Fails when no benchmark has a baseline median yet, since nothing would be compared.
+*/
+#include "Benchmarks.hpp"
+#include "BenchmarkBaseline.hpp"
+#include "BenchmarkContext.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if _WIN32
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <Windows.h>
+#elif defined( __linux__ )
+#	include <sched.h>
+#endif
+
+namespace
+{
+	struct Options
+	{
+		std::vector< std::string > plugins{ "test", "gl" };
+		uint32_t repetitions{ 10u };
+		std::string filter;
+		std::string json;
+		std::string baseline;
+		std::string glErrorCheck;
+		int32_t pinnedCpu{ -1 };
+		bool llvmpipe{ false };
+		bool list{ false };
+		bool updateBaseline{ false };
+		bool startupChild{ false };
+	};
+
+	std::vector< std::string > split( std::string const & value )
+	{
+		std::vector< std::string > result;
+		std::stringstream stream{ value };
+		std::string item;
+
+		while ( std::getline( stream, item, ',' ) )
+		{
+			if ( !item.empty() )
+			{
+				result.push_back( item );
+			}
+		}
+
+		return result;
+	}
+
+	Options parseOptions( int argc, char ** argv )
+	{
+		Options result;
+
+		for ( int i = 1; i < argc; ++i )
+		{
+			std::string arg = argv[i];
+			bool hasValue = i + 1 < argc;
+
+			if ( arg == "--plugins" && hasValue )
+			{
+				result.plugins = split( argv[++i] );
+			}
+			else if ( arg == "--repetitions" && hasValue )
+			{
+				result.repetitions = uint32_t( std::max( 1, std::atoi( argv[++i] ) ) );
+			}
+			else if ( arg == "--filter" && hasValue )
+			{
+				result.filter = argv[++i];
+			}
+			else if ( arg == "--json" && hasValue )
+			{
+				result.json = argv[++i];
+			}
+			else if ( arg == "--baseline" && hasValue )
+			{
+				result.baseline = argv[++i];
+			}
+			else if ( arg == "--update-baseline" )
+			{
+				result.updateBaseline = true;
+			}
+			else if ( arg == "--pin-cpu" && hasValue )
+			{
+				result.pinnedCpu = std::max( 0, std::atoi( argv[++i] ) );
+			}
+			else if ( arg == "--gl-error-check" && hasValue )
+			{
+				result.glErrorCheck = argv[++i];
+			}
+			else if ( arg == "--llvmpipe" )
+			{
+				result.llvmpipe = true;
+			}
+			else if ( arg == "--list" )
+			{
+				result.list = true;
+			}
+			else if ( arg == "--startup-child" )
+			{
+				result.startupChild = true;
+			}
+			else
+			{
+				std::cerr << "Ignoring unknown option " << arg << std::endl;
+			}
+		}
+
+		return result;
+	}
+
+	void setEnv( char const * name
+		, char const * value )
+	{
+#if _WIN32
+		_putenv_s( name, value );
+#else
+		setenv( name, value, 1 );
+#endif
+	}
+
+	/**
+	*\brief
+	*	Restricts the calling thread only to a CPU, and restores its affinity when destroyed.
+	*\remarks
+	*	To be created once the device exists, so that the plugin's queue and pool threads,
+	*	which are created with the device, don't inherit the affinity and stay parallel.
+	*/
+	class ThreadPinning
+	{
+	public:
+		explicit ThreadPinning( int32_t cpu )
+		{
+#if _WIN32
+			if ( cpu < int32_t( sizeof( DWORD_PTR ) * 8u ) )
+			{
+				m_previous = SetThreadAffinityMask( GetCurrentThread(), DWORD_PTR( 1u ) << cpu );
+				m_pinned = m_previous != 0u;
+			}
+#elif defined( __linux__ )
+			cpu_set_t set;
+			CPU_ZERO( &set );
+			CPU_SET( cpu, &set );
+			// With a zero pid, these only affect the calling thread.
+			m_pinned = sched_getaffinity( 0, sizeof( m_previous ), &m_previous ) == 0
+				&& sched_setaffinity( 0, sizeof( set ), &set ) == 0;
+#endif
+		}
+
+		~ThreadPinning()
+		{
+			if ( m_pinned )
+			{
+#if _WIN32
+				SetThreadAffinityMask( GetCurrentThread(), m_previous );
+#elif defined( __linux__ )
+				sched_setaffinity( 0, sizeof( m_previous ), &m_previous );
+#endif
+			}
+		}
+
+		ThreadPinning( ThreadPinning const & ) = delete;
+		ThreadPinning & operator=( ThreadPinning const & ) = delete;
+
+		bool isPinned()const
+		{
+			return m_pinned;
+		}
+
+	private:
+		bool m_pinned{ false };
+#if _WIN32
+		DWORD_PTR m_previous{};
+#elif defined( __linux__ )
+		cpu_set_t m_previous{};
+#endif
+	};
+
+	bool loadBaseline( Options const & options
+		, ashes::bench::Baseline & baseline )
+	{
+		std::ifstream file{ options.baseline };
+
+		if ( !file )
+		{
+			// A missing baseline is only valid when it is to be created.
+			if ( !options.updateBaseline )
+			{
+				std::cerr << "Couldn't open " << options.baseline << std::endl;
+			}
+
+			return options.updateBaseline;
+		}
+
+		std::string error;
+
+		if ( !ashes::bench::readBaseline( file, baseline, error ) )
+		{
+			std::cerr << "Invalid baseline " << options.baseline << ": " << error << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	std::vector< AshPluginDescription > listPlugins()
+	{
+		uint32_t count{};
+		ashEnumeratePluginsDescriptions( &count, nullptr );
+		std::vector< AshPluginDescription > result( count );
+		ashEnumeratePluginsDescriptions( &count, result.data() );
+		result.resize( count );
+		return result;
+	}
+}
+
+int main( int argc, char ** argv )
+{
+	auto options = parseOptions( argc, argv );
+
+	if ( options.llvmpipe )
+	{
+		// Must be set before the GL plugin loads the driver.
+		setEnv( "LIBGL_ALWAYS_SOFTWARE", "1" );
+		setEnv( "GALLIUM_DRIVER", "llvmpipe" );
+	}
+
+	if ( !options.glErrorCheck.empty() )
+	{
+		// Read when the GL context is created.
+		setEnv( "ASHES_GL_ERROR_CHECK", options.glErrorCheck.c_str() );
+	}
+
+	if ( options.startupChild )
+	{
+		// The plugin is selected through ASHES_RENDERER_NAME, so that the loader's
+		// discovery and probing happen in vkCreateInstance, as in an application.
+		std::cout << "cold " << ashes::bench::timeInstanceCreation() << std::endl;
+		return EXIT_SUCCESS;
+	}
+
+	ashes::bench::Baseline baseline;
+
+	if ( !options.baseline.empty()
+		&& !loadBaseline( options, baseline ) )
+	{
+		return EXIT_FAILURE;
+	}
+
+	ashes::bench::BenchmarkArray benchmarks;
+	ashes::bench::registerRecordBenchmarks( benchmarks );
+	ashes::bench::registerSubmitBenchmarks( benchmarks );
+	ashes::bench::registerResourceBenchmarks( benchmarks );
+	ashes::bench::registerStartupBenchmarks( benchmarks, argv[0] );
+	auto plugins = listPlugins();
+
+	if ( options.list )
+	{
+		std::cout << "Plugins:" << std::endl;
+
+		for ( auto & plugin : plugins )
+		{
+			std::cout << "  " << plugin.name << " (" << plugin.description << ")" << std::endl;
+		}
+
+		std::cout << "Benchmarks:" << std::endl;
+
+		for ( auto & benchmark : benchmarks )
+		{
+			std::cout << "  " << benchmark.name << std::endl;
+		}
+
+		return EXIT_SUCCESS;
+	}
+
+	ashes::bench::ResultArray results;
+	bool failed = false;
+
+	for ( auto & name : options.plugins )
+	{
+		auto it = std::find_if( plugins.begin()
+			, plugins.end()
+			, [&name]( AshPluginDescription const & lookup )
+			{
+				return name == lookup.name;
+			} );
+
+		if ( it == plugins.end()
+			|| ashSelectPlugin( *it ) != VK_SUCCESS )
+		{
+			std::cerr << "Plugin " << name << " isn't available, skipping it" << std::endl;
+			continue;
+		}
+
+		ashes::bench::Context context;
+
+		if ( !context.initialise( "ashes-bench" ) )
+		{
+			std::cerr << "Couldn't create the Vulkan objects with plugin " << name << std::endl;
+			context.cleanup();
+			failed = true;
+			continue;
+		}
+
+		ashes::bench::ResultArray pluginResults;
+
+		{
+			std::unique_ptr< ThreadPinning > pinning;
+
+			if ( options.pinnedCpu >= 0 )
+			{
+				pinning = std::make_unique< ThreadPinning >( options.pinnedCpu );
+
+				if ( !pinning->isPinned() )
+				{
+					std::cerr << "Couldn't pin the benchmark thread to CPU " << options.pinnedCpu << std::endl;
+				}
+			}
+
+			pluginResults = ashes::bench::runBenchmarks( benchmarks
+				, context
+				, name
+				, options.filter
+				, options.repetitions );
+		}
+
+		context.cleanup();
+
+		for ( auto & result : pluginResults )
+		{
+			failed = failed || !result.error.empty();
+			results.push_back( std::move( result ) );
+		}
+	}
+
+	if ( !options.baseline.empty() )
+	{
+		if ( options.updateBaseline )
+		{
+			ashes::bench::printResults( std::cout, results );
+			std::ofstream file{ options.baseline };
+
+			if ( !file )
+			{
+				std::cerr << "Couldn't open " << options.baseline << std::endl;
+				return EXIT_FAILURE;
+			}
+
+			ashes::bench::writeBaseline( file, baseline, results );
+			std::cout << "Updated " << options.baseline << std::endl;
+		}
+		else if ( !ashes::bench::compareResults( std::cout, baseline, results ) )
+		{
+			failed = true;
+		}
+		else if ( !ashes::bench::hasMedians( baseline, results ) )
+		{
+			// Nothing was actually compared, so this can't be reported as a pass.
+			std::cerr << "No benchmark has a baseline median in " << options.baseline
+				<< ", run with --update-baseline to measure them" << std::endl;
+			failed = true;
+		}
+	}
+	else if ( options.json.empty() )
+	{
+		ashes::bench::printResults( std::cerr, results );
+		ashes::bench::writeJson( std::cout, results, options.repetitions );
+	}
+	else
+	{
+		ashes::bench::printResults( std::cout, results );
+	}
+
+	if ( !options.json.empty() )
+	{
+		std::ofstream file{ options.json };
+
+		if ( !file )
+		{
+			std::cerr << "Couldn't open " << options.json << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		ashes::bench::writeJson( file, results, options.repetitions );
+	}
+
+	return failed
+		? EXIT_FAILURE
+		: EXIT_SUCCESS;
+}
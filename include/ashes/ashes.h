@@ -191,7 +191,101 @@ extern "C"
 		AshPluginMode mode;
 	} AshPluginDescription;
 
+	typedef struct AshObjectTypeStatistics
+	{
+		/**
+		*\brief
+		*	The objects' type.
+		*/
+		VkObjectType objectType;
+		/**
+		*\brief
+		*	The objects' type name (e.g. "VkBuffer").
+		*/
+		char typeName[32];
+		/**
+		*\brief
+		*	The count of objects of this type created on the device.
+		*/
+		uint64_t created;
+		/**
+		*\brief
+		*	The count of objects of this type destroyed on the device.
+		*/
+		uint64_t destroyed;
+	} AshObjectTypeStatistics;
+
+	typedef struct AshRendererOperationStatistics
+	{
+		/**
+		*\brief
+		*	The operation's name (e.g. "Draw").
+		*/
+		char name[32];
+		/**
+		*\brief
+		*	The count of executions of this operation.
+		*/
+		uint64_t count;
+		/**
+		*\brief
+		*	The CPU time spent executing this operation, in nanoseconds.
+		*	Includes the operations it executes itself.
+		*/
+		uint64_t cpuTime;
+	} AshRendererOperationStatistics;
+
+	typedef struct AshRendererSubmitStatistics
+	{
+		/**
+		*\brief
+		*	The count of calls made to the rendering API.
+		*/
+		uint64_t apiCalls;
+		/**
+		*\brief
+		*	The bytes uploaded from the mapped memory to the rendering API.
+		*/
+		uint64_t uploadedBytes;
+		/**
+		*\brief
+		*	The bytes downloaded from the rendering API to the mapped memory.
+		*/
+		uint64_t downloadedBytes;
+		/**
+		*\brief
+		*	The count of framebuffer objects created.
+		*/
+		uint64_t framebuffersCreated;
+		/**
+		*\brief
+		*	The count of vertex array objects created.
+		*/
+		uint64_t vertexArraysCreated;
+	} AshRendererSubmitStatistics;
+
+	typedef struct AshRendererStatistics
+	{
+		/**
+		*\brief
+		*	The count of vkQueueSubmit calls.
+		*/
+		uint64_t submitCount;
+		/**
+		*\brief
+		*	The statistics of the last vkQueueSubmit.
+		*/
+		AshRendererSubmitStatistics lastSubmit;
+		/**
+		*\brief
+		*	The sum of all vkQueueSubmit statistics.
+		*/
+		AshRendererSubmitStatistics total;
+	} AshRendererStatistics;
+
 	typedef VkResult( VKAPI_PTR * PFN_ashGetPluginDescription )( AshPluginDescription * );
+	typedef VkResult( VKAPI_PTR * PFN_ashGetObjectStatistics )( VkDevice, uint32_t *, AshObjectTypeStatistics * );
+	typedef VkResult( VKAPI_PTR * PFN_ashGetRendererStatistics )( VkDevice, AshRendererStatistics *, uint32_t *, AshRendererOperationStatistics * );
 
 	typedef void( VKAPI_PTR * PFN_ashEnumeratePluginsDescriptions )( uint32_t *, AshPluginDescription * );
 	typedef VkResult( VKAPI_PTR * PFN_ashSelectPlugin )( AshPluginDescription );
@@ -200,6 +294,32 @@ extern "C"
 		, AshPluginDescription * pDescriptions );
 	Ashes_API VkResult VKAPI_PTR ashSelectPlugin( AshPluginDescription description );
 	Ashes_API VkResult VKAPI_PTR ashGetCurrentPluginDescription( AshPluginDescription * description );
+	/**
+	*\brief
+	*	Retrieves the per object type creation counters of a device, from the selected plugin.
+	*\remarks
+	*	Works like the Vulkan enumeration functions: if \p pStatistics is null,
+	*	\p pCount receives the available types count.
+	*\return
+	*	VK_ERROR_FEATURE_NOT_PRESENT if the selected plugin doesn't count its objects.
+	*/
+	Ashes_API VkResult VKAPI_PTR ashGetObjectStatistics( VkDevice device
+		, uint32_t * pCount
+		, AshObjectTypeStatistics * pStatistics );
+	/**
+	*\brief
+	*	Retrieves the selected plugin's submit statistics, and its per operation execution counters.
+	*\remarks
+	*	The operations are the plugin's translated commands, they are enumerated like in the Vulkan enumeration functions:
+	*	if \p pOperations is null, \p pOperationCount receives the available operations count.
+	*	\p pStatistics may be null, if only the operations are wanted.
+	*\return
+	*	VK_ERROR_FEATURE_NOT_PRESENT if the selected plugin doesn't gather these statistics, or if they aren't enabled.
+	*/
+	Ashes_API VkResult VKAPI_PTR ashGetRendererStatistics( VkDevice device
+		, AshRendererStatistics * pStatistics
+		, uint32_t * pOperationCount
+		, AshRendererOperationStatistics * pOperations );
 
 #ifdef __cplusplus
 }
@@ -236,6 +236,10 @@ See LICENSE file in root folder.
 	VK_LIB_INSTANCE_FUNCTION_EXT( ASHES_MAKE_VERSION( 1, 0, 0 ), VK_NV_COOPERATIVE_MATRIX_EXTENSION_NAME, GetPhysicalDeviceCooperativeMatrixPropertiesNV )
 #endif
 
+#ifdef VK_EXT_headless_surface
+	VK_LIB_INSTANCE_FUNCTION_EXT( ASHES_MAKE_VERSION( 1, 0, 0 ), VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME, CreateHeadlessSurfaceEXT )
+#endif
+
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 #	ifdef VK_KHR_android_surface
 	VK_LIB_INSTANCE_FUNCTION( ASHES_MAKE_VERSION( 1, 0, 0 ), CreateAndroidSurfaceKHR )
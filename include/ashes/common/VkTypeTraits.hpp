@@ -564,6 +564,21 @@ namespace ashes
 		static VkStructureType constexpr TypeValue = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT;
 	};
 
+#endif
+#if VK_KHR_timeline_semaphore
+
+	template<>
+	struct VkStructureTypeTraits< VkSemaphoreTypeCreateInfoKHR >
+	{
+		static VkStructureType constexpr TypeValue = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+	};
+
+	template<>
+	struct VkStructureTypeTraits< VkTimelineSemaphoreSubmitInfoKHR >
+	{
+		static VkStructureType constexpr TypeValue = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+	};
+
 #endif
 
 	template< typename VkType >
@@ -0,0 +1,16 @@
+@echo OFF
+
+rem Runs ashes-bench from the binaries folder (the current one), and compares its medians to the baseline.
+rem Usage: RunBenchmarks.bat [--update] [ashes-bench options]
+rem --update rewrites the baseline with the new medians, instead of comparing to them.
+
+set DATA_DIR=.\
+set BASELINE=%~dp0..\benchmark\Suite\Baseline.json
+set UPDATE=
+
+if "%1"=="--update" (
+	set UPDATE=--update-baseline
+	shift
+)
+
+%DATA_DIR%ashes-bench.exe --plugins test --repetitions 15 --pin-cpu 0 --baseline "%BASELINE%" %UPDATE% %1 %2 %3 %4 %5 %6 %7 %8 %9
@@ -0,0 +1,26 @@
+#!/usr/bin/sh
+
+# Runs ashes-bench from the binaries folder (the current one), and compares its medians to the baseline.
+# Usage: RunBenchmarks.sh [--update] [ashes-bench options]
+# --update rewrites the baseline with the new medians, instead of comparing to them.
+# ASHES_BENCH_BASELINE overrides the baseline file, ASHES_BENCH_PIN_CPU pins the benchmark thread to a CPU (not pinned by default).
+# Exits with 77 when the baseline has no median to compare to yet.
+
+ASHES_DIR=$PWD
+SCRIPT_DIR=$(dirname "$0")
+BASELINE=${ASHES_BENCH_BASELINE:-$SCRIPT_DIR/../benchmark/Suite/Baseline.json}
+PIN_CPU=
+UPDATE=
+
+if [ -n "$ASHES_BENCH_PIN_CPU" ]
+then
+	PIN_CPU="--pin-cpu $ASHES_BENCH_PIN_CPU"
+fi
+
+if [ "$1" = "--update" ]
+then
+	UPDATE=--update-baseline
+	shift
+fi
+
+"$ASHES_DIR/ashes-bench" --plugins test --repetitions 15 $PIN_CPU --baseline "$BASELINE" $UPDATE "$@"
@@ -6,11 +6,17 @@
 #include <ashes/common/DynamicLibrary.hpp>
 #include <ashes/common/FileUtils.hpp>
 
+#if Ashes_CaptureCalls
+#	include "capture/CaptureLayer.hpp"
+#endif
+
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <regex>
 #include <set>
@@ -23,6 +29,10 @@ struct Plugin
 
 	std::unique_ptr< ashes::DynamicLibrary > library;
 	PFN_ashGetPluginDescription fnGetPluginDescription;
+	// Optional, only exported by the plugins that count their objects.
+	PFN_ashGetObjectStatistics fnGetObjectStatistics{ nullptr };
+	// Optional, only exported by the plugins that gather their execution statistics.
+	PFN_ashGetRendererStatistics fnGetRendererStatistics{ nullptr };
 	AshPluginDescription description;
 
 	inline Plugin( std::unique_ptr< ashes::DynamicLibrary > lib )
@@ -35,6 +45,8 @@ struct Plugin
 		}
 
 		fnGetPluginDescription( &description );
+		( void )library->getFunction( "ashGetPluginObjectStatistics", fnGetObjectStatistics );
+		( void )library->getFunction( "ashGetPluginRendererStatistics", fnGetRendererStatistics );
 	}
 };
 
@@ -56,18 +68,52 @@ inline bool operator==( AshPluginDescription const & lhs, AshPluginDescription c
 		&& lhs.support == rhs.support;
 }
 
-using PluginArray = std::vector< Plugin >;
+// A deque, so that loading a plugin doesn't invalidate the selected one.
+using PluginArray = std::deque< Plugin >;
 
 namespace details
 {
-	Plugin * findFirstSupportedPlugin( PluginArray & plugins );
-	Plugin * findDefaultPlugin( PluginArray & plugins );
-	PluginArray listPlugins();
+	/**
+	*\return
+	*	The candidate plugin files, sorted by decreasing expected priority.
+	*/
+	ashes::StringArray listPluginFiles();
+	/**
+	*\return
+	*	The plugin name deduced from its file name (e.g. "gl" for libashesGlRenderer.so).
+	*/
+	std::string getPluginName( std::string const & file );
+	/**
+	*\return
+	*	The priority the named plugin is expected to report plus one, 0 for unknown plugins.
+	*	Only used to order the probes, before the plugins are loaded.
+	*/
+	uint32_t getExpectedPriority( std::string const & name );
+	/**
+	*\return
+	*	The content of ASHES_RENDERER_NAME.
+	*/
+	std::string const & getDefaultPluginName();
 }
-
+/**
+*\brief
+*	Loads the plugins lazily.
+*\remarks
+*	When ASHES_RENDERER_NAME is set, only the named plugin is loaded,
+*	provided it is supported.
+*	Otherwise the plugins are loaded in decreasing expected priority order,
+*	until a supported one is found.
+*	All the plugins are only loaded when they are enumerated, or when
+*	a plugin is explicitly selected.
+*/
 struct PluginLibrary
 {
-	inline PluginLibrary()
+	/**
+	*\param[in] dispatch
+	*	The exported entry points' table, overwritten with the selected plugin's functions.
+	*/
+	inline explicit PluginLibrary( AshPluginStaticFunction & dispatch )
+		: dispatch{ dispatch }
 	{
 		getSelectedDesc = [this]() -> AshPluginDescription &
 		{
@@ -82,19 +128,19 @@ struct PluginLibrary
 
 		if ( !selectedPlugin )
 		{
-			plugins = details::listPlugins();
+			doListFiles();
 
-			if ( plugins.empty() )
+			if ( files.empty() )
 			{
 				result = VK_ERROR_INITIALIZATION_FAILED;
 			}
 			else
 			{
-				selectedPlugin = details::findDefaultPlugin( plugins );
+				selectedPlugin = doFindDefaultPlugin();
 
 				if ( !selectedPlugin )
 				{
-					selectedPlugin = details::findFirstSupportedPlugin( plugins );
+					selectedPlugin = doFindFirstSupportedPlugin();
 				}
 
 				if ( selectedPlugin )
@@ -114,6 +160,7 @@ struct PluginLibrary
 				{
 					return selectedPlugin->description;
 				};
+				doUpdateDispatch();
 			}
 		}
 
@@ -121,9 +168,23 @@ struct PluginLibrary
 		return result;
 	}
 
+	inline void loadAll()
+	{
+		doListFiles();
+
+		for ( auto & file : files )
+		{
+			( void )doLoad( file );
+		}
+
+		assert( isProbeOrderConsistent()
+			&& "details::getExpectedPriority disagrees with the priorities the plugins report" );
+	}
+
 	inline VkResult selectDesc( AshPluginDescription const & description )
 	{
 		( void )init();
+		loadAll();
 		auto it = std::find_if( plugins.begin()
 			, plugins.end()
 			, [&description]( Plugin const & lookup )
@@ -137,6 +198,7 @@ struct PluginLibrary
 		}
 
 		selectedPlugin = &( *it );
+		doUpdateDispatch();
 		return VK_SUCCESS;
 	}
 
@@ -145,4 +207,124 @@ struct PluginLibrary
 	bool isUsingICD{ false };
 	Plugin * selectedPlugin{ nullptr };
 	SelectedDescGetter getSelectedDesc;
+	AshPluginStaticFunction & dispatch;
+
+private:
+	static bool isSupported( Plugin const & plugin )
+	{
+		return plugin.description.support.supported == VK_TRUE;
+	}
+
+	// The known plugins are probed in the expected priorities order,
+	// which must be the order of the priorities they report once loaded.
+	inline bool isProbeOrderConsistent()const
+	{
+		bool result = true;
+		uint32_t previous{ ~0u };
+
+		for ( auto & file : files )
+		{
+			auto it = loaded.find( file );
+
+			if ( it != loaded.end()
+				&& it->second
+				&& isSupported( *it->second )
+				&& details::getExpectedPriority( it->second->description.name ) != 0u )
+			{
+				auto priority = it->second->description.support.priority;
+				result = result && priority <= previous;
+				previous = priority;
+			}
+		}
+
+		return result;
+	}
+
+	inline void doUpdateDispatch()
+	{
+#if Ashes_CaptureCalls
+		dispatch = ashes::capture::wrap( selectedPlugin->description.functions );
+#else
+		dispatch = selectedPlugin->description.functions;
+#endif
+	}
+
+	inline void doListFiles()
+	{
+		if ( !filesListed )
+		{
+			files = details::listPluginFiles();
+			filesListed = true;
+		}
+	}
+
+	inline Plugin * doLoad( std::string const & file )
+	{
+		auto ires = loaded.emplace( file, nullptr );
+
+		if ( ires.second )
+		{
+			try
+			{
+				plugins.emplace_back( std::make_unique< ashes::DynamicLibrary >( file ) );
+				ires.first->second = &plugins.back();
+			}
+			catch ( std::exception & exc )
+			{
+				// Prevent useless noisy message
+				std::clog << exc.what() << std::endl;
+			}
+		}
+
+		return ires.first->second;
+	}
+
+	inline Plugin * doFindDefaultPlugin()
+	{
+		auto & name = details::getDefaultPluginName();
+
+		if ( name.empty() )
+		{
+			return nullptr;
+		}
+
+		for ( auto & file : files )
+		{
+			if ( details::getPluginName( file ) == name )
+			{
+				auto plugin = doLoad( file );
+
+				if ( plugin
+					&& plugin->description.name == name
+					&& isSupported( *plugin ) )
+				{
+					return plugin;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	inline Plugin * doFindFirstSupportedPlugin()
+	{
+		for ( auto & file : files )
+		{
+			auto plugin = doLoad( file );
+
+			if ( plugin
+				&& isSupported( *plugin ) )
+			{
+				return plugin;
+			}
+		}
+
+		return nullptr;
+	}
+
+private:
+	ashes::StringArray files;
+	bool filesListed{ false };
+	// Loaded plugin per file, nullptr when the file is not a valid plugin.
+	std::map< std::string, Plugin * > loaded;
 };
@@ -0,0 +1,618 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "CaptureFormat.hpp"
+
+#include <ashes/ashes.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace ashes::capture
+{
+	// Handle value to file id when capturing, file id to handle value when replaying.
+	using HandleMap = std::unordered_map< uint64_t, uint64_t >;
+
+	template< typename HandleT >
+	uint64_t toHandleValue( HandleT handle )
+	{
+		if constexpr ( std::is_pointer_v< HandleT > )
+		{
+			return uint64_t( reinterpret_cast< uintptr_t >( handle ) );
+		}
+		else
+		{
+			return uint64_t( handle );
+		}
+	}
+
+	template< typename HandleT >
+	HandleT fromHandleValue( uint64_t value )
+	{
+		if constexpr ( std::is_pointer_v< HandleT > )
+		{
+			return reinterpret_cast< HandleT >( uintptr_t( value ) );
+		}
+		else
+		{
+			return HandleT( value );
+		}
+	}
+	/**
+	*\brief
+	*	Writes the parameters of a call into a record payload.
+	*\remarks
+	*	The structures are written by the serialize functions of CaptureStructs.hpp,
+	*	which are shared with the Decoder, hence the non const references.
+	*	The integers are LEB128 encoded (zigzag for the signed ones), the other values are stored as is.
+	*/
+	class Encoder
+	{
+	public:
+		Encoder( std::vector< uint8_t > & data
+			, HandleMap & ids
+			, uint64_t & lastId
+			, VkPhysicalDeviceMemoryProperties const & memoryProperties )
+			: m_data{ data }
+			, m_ids{ ids }
+			, m_lastId{ lastId }
+			, m_memoryProperties{ memoryProperties }
+		{
+		}
+
+		void varint( uint64_t value )
+		{
+			while ( value >= 0x80u )
+			{
+				m_data.push_back( uint8_t( value | 0x80u ) );
+				value >>= 7u;
+			}
+
+			m_data.push_back( uint8_t( value ) );
+		}
+
+		void write( void const * data
+			, size_t size )
+		{
+			auto bytes = static_cast< uint8_t const * >( data );
+			m_data.insert( m_data.end(), bytes, bytes + size );
+		}
+
+		template< typename T >
+		void value( T & value )
+		{
+			static_assert( !std::is_pointer_v< T >, "Pointers must be written through array, pointer, string or bytes" );
+
+			if constexpr ( std::is_enum_v< T > )
+			{
+				auto underlying = std::underlying_type_t< T >( value );
+				this->value( underlying );
+			}
+			else if constexpr ( std::is_integral_v< T > && std::is_signed_v< T > )
+			{
+				auto signedValue = int64_t( value );
+				varint( ( uint64_t( signedValue ) << 1u ) ^ uint64_t( signedValue >> 63 ) );
+			}
+			else if constexpr ( std::is_integral_v< T > )
+			{
+				varint( uint64_t( value ) );
+			}
+			else
+			{
+				raw( value );
+			}
+		}
+
+		template< typename T >
+		void raw( T & value )
+		{
+			static_assert( std::is_trivially_copyable_v< T > );
+			write( &value, sizeof( T ) );
+		}
+
+		template< typename HandleT >
+		void handle( HandleT & handle )
+		{
+			varint( getId( toHandleValue( handle ) ) );
+		}
+
+		template< typename HandleT >
+		void created( HandleT & handle )
+		{
+			auto value = toHandleValue( handle );
+			uint64_t id = 0u;
+
+			if ( value )
+			{
+				id = ++m_lastId;
+				m_ids[value] = id;
+			}
+
+			varint( id );
+		}
+
+		template< typename HandleT >
+		void destroyed( HandleT & handle )
+		{
+			auto it = m_ids.find( toHandleValue( handle ) );
+			uint64_t id = 0u;
+
+			if ( it != m_ids.end() )
+			{
+				id = it->second;
+				m_ids.erase( it );
+			}
+
+			varint( id );
+		}
+		/**
+		*\brief
+		*	Writes the memory type index, followed by its property flags,
+		*	so that the replay can pick an equivalent type on another device.
+		*/
+		void memoryType( uint32_t & index )
+		{
+			varint( index );
+			varint( index < m_memoryProperties.memoryTypeCount
+				? m_memoryProperties.memoryTypes[index].propertyFlags
+				: 0u );
+		}
+
+		void next( void const *& next )
+		{
+			if ( next )
+			{
+				++m_droppedNext;
+			}
+		}
+
+		void string( char const *& value )
+		{
+			if ( !value )
+			{
+				varint( 0u );
+				return;
+			}
+
+			auto size = strlen( value );
+			varint( size + 1u );
+			write( value, size );
+		}
+
+		template< typename T, typename CountT >
+		void array( T const *& data
+			, CountT count )
+		{
+			bool present = data && count;
+			varint( present ? 1u : 0u );
+
+			if ( present )
+			{
+				for ( CountT i = 0u; i < count; ++i )
+				{
+					serialize( *this, const_cast< T & >( data[i] ) );
+				}
+			}
+		}
+
+		template< typename HandleT, typename CountT >
+		void handles( HandleT const *& data
+			, CountT count )
+		{
+			bool present = data && count;
+			varint( present ? 1u : 0u );
+
+			if ( present )
+			{
+				for ( CountT i = 0u; i < count; ++i )
+				{
+					varint( getId( toHandleValue( data[i] ) ) );
+				}
+			}
+		}
+
+		template< typename T, typename SizeT >
+		void bytes( T const *& data
+			, SizeT size )
+		{
+			bool present = data && size;
+			varint( present ? 1u : 0u );
+
+			if ( present )
+			{
+				write( data, size_t( size ) );
+			}
+		}
+
+		template< typename T >
+		void pointer( T const *& data )
+		{
+			varint( data ? 1u : 0u );
+
+			if ( data )
+			{
+				serialize( *this, const_cast< T & >( *data ) );
+			}
+		}
+		/**
+		*\return
+		*	The count of pNext chains that weren't written, since the start of the capture.
+		*/
+		static uint32_t getDroppedNextCount()
+		{
+			return m_droppedNext;
+		}
+
+	private:
+		uint64_t getId( uint64_t value )const
+		{
+			auto it = m_ids.find( value );
+			return it == m_ids.end()
+				? 0u
+				: it->second;
+		}
+
+	private:
+		std::vector< uint8_t > & m_data;
+		HandleMap & m_ids;
+		uint64_t & m_lastId;
+		VkPhysicalDeviceMemoryProperties const & m_memoryProperties;
+		static inline uint32_t m_droppedNext{};
+	};
+	/**
+	*\brief
+	*	Holds the decoded parameters of one call.
+	*/
+	class Arena
+	{
+	public:
+		void * allocate( size_t size )
+		{
+			auto count = ( size + sizeof( uint64_t ) - 1u ) / sizeof( uint64_t );
+			m_blocks.push_back( std::make_unique< uint64_t[] >( std::max( count, size_t( 1u ) ) ) );
+			return m_blocks.back().get();
+		}
+
+		void clear()
+		{
+			m_blocks.clear();
+		}
+
+	private:
+		std::vector< std::unique_ptr< uint64_t[] > > m_blocks;
+	};
+	/**
+	*\brief
+	*	Reads the parameters of a call from a record payload, into the arena.
+	*\remarks
+	*	The ids are translated to the replay handles, the unknown ones to VK_NULL_HANDLE.
+	*	The pNext chains are set to nullptr, as they weren't captured.
+	*	Reading past the payload's end leaves the decoder invalid, instead of throwing.
+	*/
+	class Decoder
+	{
+	public:
+		Decoder( uint8_t const * data
+			, size_t size
+			, HandleMap & handles
+			, VkPhysicalDeviceMemoryProperties const & memoryProperties
+			, Arena & arena )
+			: m_data{ data }
+			, m_size{ size }
+			, m_handles{ handles }
+			, m_memoryProperties{ memoryProperties }
+			, m_arena{ arena }
+		{
+		}
+
+		bool isValid()const
+		{
+			return m_valid;
+		}
+
+		uint64_t varint()
+		{
+			uint64_t result{};
+			uint32_t shift{};
+
+			while ( m_valid )
+			{
+				if ( m_offset >= m_size || shift > 63u )
+				{
+					m_valid = false;
+					break;
+				}
+
+				auto byte = m_data[m_offset++];
+				result |= uint64_t( byte & 0x7Fu ) << shift;
+				shift += 7u;
+
+				if ( !( byte & 0x80u ) )
+				{
+					break;
+				}
+			}
+
+			return result;
+		}
+
+		void read( void * data
+			, size_t size )
+		{
+			if ( !m_valid || size > m_size - m_offset )
+			{
+				m_valid = false;
+				std::memset( data, 0, size );
+				return;
+			}
+
+			std::memcpy( data, m_data + m_offset, size );
+			m_offset += size;
+		}
+
+		template< typename T >
+		void value( T & value )
+		{
+			static_assert( !std::is_pointer_v< T >, "Pointers must be read through array, pointer, string or bytes" );
+
+			if constexpr ( std::is_enum_v< T > )
+			{
+				std::underlying_type_t< T > underlying{};
+				this->value( underlying );
+				value = T( underlying );
+			}
+			else if constexpr ( std::is_integral_v< T > && std::is_signed_v< T > )
+			{
+				auto zigzag = varint();
+				value = T( int64_t( zigzag >> 1u ) ^ -int64_t( zigzag & 1u ) );
+			}
+			else if constexpr ( std::is_integral_v< T > )
+			{
+				value = T( varint() );
+			}
+			else
+			{
+				raw( value );
+			}
+		}
+
+		template< typename T >
+		void raw( T & value )
+		{
+			static_assert( std::is_trivially_copyable_v< T > );
+			read( &value, sizeof( T ) );
+		}
+
+		template< typename HandleT >
+		void handle( HandleT & handle )
+		{
+			handle = fromHandleValue< HandleT >( resolve( varint() ) );
+		}
+
+		void memoryType( uint32_t & index )
+		{
+			auto captured = uint32_t( varint() );
+			auto flags = VkMemoryPropertyFlags( varint() );
+			index = findMemoryType( captured, flags );
+		}
+
+		void next( void const *& next )
+		{
+			next = nullptr;
+		}
+
+		void string( char const *& value )
+		{
+			auto size = varint();
+			value = nullptr;
+
+			if ( size && m_valid )
+			{
+				auto result = allocate< char >( size_t( size ) );
+
+				if ( result )
+				{
+					read( result, size_t( size - 1u ) );
+					value = result;
+				}
+			}
+		}
+
+		template< typename T, typename CountT >
+		void array( T const *& data
+			, CountT count )
+		{
+			data = nullptr;
+
+			if ( varint() )
+			{
+				auto result = allocate< T >( size_t( count ) );
+
+				if ( result )
+				{
+					for ( CountT i = 0u; i < count; ++i )
+					{
+						serialize( *this, result[i] );
+					}
+
+					data = result;
+				}
+			}
+		}
+
+		template< typename HandleT, typename CountT >
+		void handles( HandleT const *& data
+			, CountT count )
+		{
+			data = nullptr;
+
+			if ( varint() )
+			{
+				auto result = allocate< HandleT >( size_t( count ) );
+
+				if ( result )
+				{
+					for ( CountT i = 0u; i < count; ++i )
+					{
+						handle( result[i] );
+					}
+
+					data = result;
+				}
+			}
+		}
+
+		template< typename T, typename SizeT >
+		void bytes( T const *& data
+			, SizeT size )
+		{
+			data = nullptr;
+
+			if ( varint() )
+			{
+				auto result = allocate< uint8_t >( size_t( size ) );
+
+				if ( result )
+				{
+					read( result, size_t( size ) );
+					data = reinterpret_cast< T const * >( result );
+				}
+			}
+		}
+
+		template< typename T >
+		void pointer( T const *& data )
+		{
+			data = nullptr;
+
+			if ( varint() )
+			{
+				auto result = allocate< T >( 1u );
+
+				if ( result )
+				{
+					serialize( *this, *result );
+					data = result;
+				}
+			}
+		}
+		/**
+		*\return
+		*	Zero initialised storage for count T, valid until the arena is cleared,
+		*	nullptr if count can't have been written in what remains of the payload.
+		*/
+		template< typename T >
+		T * allocate( size_t count )
+		{
+			static_assert( std::is_trivially_default_constructible_v< T > );
+
+			// Each element takes at least one byte in the payload, which protects against corrupted counts.
+			if ( !m_valid || count > m_size - m_offset + sizeof( uint64_t ) )
+			{
+				m_valid = false;
+				return nullptr;
+			}
+
+			return allocateOutput< T >( count );
+		}
+		/**
+		*eturn
+		*	Zero initialised storage for count T, valid until the arena is cleared,
+		*	for the values the call writes.
+		*/
+		template< typename T >
+		T * allocateOutput( size_t count )
+		{
+			static_assert( std::is_trivially_default_constructible_v< T > );
+			auto size = sizeof( T ) * count;
+			auto result = m_arena.allocate( size );
+			std::memset( result, 0, size );
+			return static_cast< T * >( result );
+		}
+
+		uint64_t resolve( uint64_t id )const
+		{
+			auto it = m_handles.find( id );
+			return it == m_handles.end()
+				? 0u
+				: it->second;
+		}
+
+		void registerHandle( uint64_t id
+			, uint64_t value )
+		{
+			if ( id )
+			{
+				m_handles[id] = value;
+			}
+		}
+
+		void releaseHandle( uint64_t id )
+		{
+			m_handles.erase( id );
+		}
+		/**
+		*\brief
+		*	The ids of the handles created or destroyed by the call,
+		*	kept between the parameters decoding and the call completion.
+		*/
+		void pushPending( uint64_t id )
+		{
+			m_pending.push_back( id );
+		}
+
+		uint64_t popPending()
+		{
+			return m_pendingIndex < m_pending.size()
+				? m_pending[m_pendingIndex++]
+				: 0u;
+		}
+
+	private:
+		uint32_t findMemoryType( uint32_t captured
+			, VkMemoryPropertyFlags flags )const
+		{
+			if ( flags )
+			{
+				// The first type with the same flags, failing that the first one with more flags.
+				for ( uint32_t i = 0u; i < m_memoryProperties.memoryTypeCount; ++i )
+				{
+					if ( m_memoryProperties.memoryTypes[i].propertyFlags == flags )
+					{
+						return i;
+					}
+				}
+
+				for ( uint32_t i = 0u; i < m_memoryProperties.memoryTypeCount; ++i )
+				{
+					if ( ( m_memoryProperties.memoryTypes[i].propertyFlags & flags ) == flags )
+					{
+						return i;
+					}
+				}
+			}
+
+			return captured < m_memoryProperties.memoryTypeCount
+				? captured
+				: 0u;
+		}
+
+	private:
+		uint8_t const * m_data;
+		size_t m_size;
+		size_t m_offset{};
+		bool m_valid{ true };
+		HandleMap & m_handles;
+		VkPhysicalDeviceMemoryProperties const & m_memoryProperties;
+		Arena & m_arena;
+		std::vector< uint64_t > m_pending;
+		size_t m_pendingIndex{};
+	};
+}
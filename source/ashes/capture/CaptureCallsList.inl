@@ -0,0 +1,143 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+
+The captured Vulkan calls, with their parameters codecs, in parameters order (see CaptureCodecs.hpp).
+ASHES_CAPTURE_CALL are the functions of AshPluginStaticFunction.
+ASHES_CAPTURE_EXT_CALL are the device functions only reachable through vkGetDeviceProcAddr.
+The order defines the calls ids in the capture files, new calls must be appended.
+*/
+#if defined( CreateSemaphore )
+#	undef CreateSemaphore
+#endif
+#if defined( CreateEvent )
+#	undef CreateEvent
+#endif
+
+#ifndef ASHES_CAPTURE_CALL
+#	define ASHES_CAPTURE_CALL( name, ... )
+#endif
+
+#ifndef ASHES_CAPTURE_EXT_CALL
+#	define ASHES_CAPTURE_EXT_CALL( name, ... )
+#endif
+
+ASHES_CAPTURE_CALL( CreateInstance, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyInstance, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( EnumeratePhysicalDevices, Handle, Count, Enumerated< 1 > )
+ASHES_CAPTURE_CALL( CreateDevice, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyDevice, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( GetDeviceQueue, Handle, Value, Value, Created )
+ASHES_CAPTURE_CALL( QueueSubmit, Handle, Value, Array< 1 >, Handle )
+ASHES_CAPTURE_CALL( QueueWaitIdle, Handle )
+ASHES_CAPTURE_CALL( DeviceWaitIdle, Handle )
+ASHES_CAPTURE_CALL( AllocateMemory, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( FreeMemory, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( MapMemory, Handle, Handle, Value, Value, Value, Mapped )
+ASHES_CAPTURE_CALL( UnmapMemory, Handle, Handle )
+ASHES_CAPTURE_CALL( FlushMappedMemoryRanges, Handle, Value, Array< 1 > )
+ASHES_CAPTURE_CALL( InvalidateMappedMemoryRanges, Handle, Value, Array< 1 > )
+ASHES_CAPTURE_CALL( BindBufferMemory, Handle, Handle, Handle, Value )
+ASHES_CAPTURE_CALL( BindImageMemory, Handle, Handle, Handle, Value )
+ASHES_CAPTURE_CALL( CreateFence, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyFence, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( ResetFences, Handle, Value, HandleArray< 1 > )
+ASHES_CAPTURE_CALL( WaitForFences, Handle, Value, HandleArray< 1 >, Value, Value )
+ASHES_CAPTURE_CALL( CreateSemaphore, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroySemaphore, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateEvent, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyEvent, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( SetEvent, Handle, Handle )
+ASHES_CAPTURE_CALL( ResetEvent, Handle, Handle )
+ASHES_CAPTURE_CALL( CreateQueryPool, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyQueryPool, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( GetQueryPoolResults, Handle, Handle, Value, Value, Value, OutBytes< 4 >, Value, Value )
+ASHES_CAPTURE_CALL( CreateBuffer, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyBuffer, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateBufferView, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyBufferView, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateImage, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyImage, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateImageView, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyImageView, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateShaderModule, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyShaderModule, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateGraphicsPipelines, Handle, Ignored, Value, Array< 2 >, Ignored, CreatedArray< 2 > )
+ASHES_CAPTURE_CALL( CreateComputePipelines, Handle, Ignored, Value, Array< 2 >, Ignored, CreatedArray< 2 > )
+ASHES_CAPTURE_CALL( DestroyPipeline, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreatePipelineLayout, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyPipelineLayout, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateSampler, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroySampler, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateDescriptorSetLayout, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyDescriptorSetLayout, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateDescriptorPool, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyDescriptorPool, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( ResetDescriptorPool, Handle, Handle, Value )
+ASHES_CAPTURE_CALL( AllocateDescriptorSets, Handle, Struct, CreatedArrayIn< 1, &VkDescriptorSetAllocateInfo::descriptorSetCount > )
+ASHES_CAPTURE_CALL( FreeDescriptorSets, Handle, Handle, Value, DestroyedArray< 2 > )
+ASHES_CAPTURE_CALL( UpdateDescriptorSets, Handle, Value, Array< 1 >, Value, Array< 3 > )
+ASHES_CAPTURE_CALL( CreateFramebuffer, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyFramebuffer, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateRenderPass, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyRenderPass, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( CreateCommandPool, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroyCommandPool, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_CALL( ResetCommandPool, Handle, Handle, Value )
+ASHES_CAPTURE_CALL( AllocateCommandBuffers, Handle, Struct, CreatedArrayIn< 1, &VkCommandBufferAllocateInfo::commandBufferCount > )
+ASHES_CAPTURE_CALL( FreeCommandBuffers, Handle, Handle, Value, DestroyedArray< 2 > )
+ASHES_CAPTURE_CALL( BeginCommandBuffer, Handle, Struct )
+ASHES_CAPTURE_CALL( EndCommandBuffer, Handle )
+ASHES_CAPTURE_CALL( ResetCommandBuffer, Handle, Value )
+ASHES_CAPTURE_CALL( CmdBindPipeline, Handle, Value, Handle )
+ASHES_CAPTURE_CALL( CmdSetViewport, Handle, Value, Value, Array< 2 > )
+ASHES_CAPTURE_CALL( CmdSetScissor, Handle, Value, Value, Array< 2 > )
+ASHES_CAPTURE_CALL( CmdSetLineWidth, Handle, Value )
+ASHES_CAPTURE_CALL( CmdSetDepthBias, Handle, Value, Value, Value )
+ASHES_CAPTURE_CALL( CmdSetBlendConstants, Handle, FixedArray< 4 > )
+ASHES_CAPTURE_CALL( CmdSetDepthBounds, Handle, Value, Value )
+ASHES_CAPTURE_CALL( CmdSetStencilCompareMask, Handle, Value, Value )
+ASHES_CAPTURE_CALL( CmdSetStencilWriteMask, Handle, Value, Value )
+ASHES_CAPTURE_CALL( CmdSetStencilReference, Handle, Value, Value )
+ASHES_CAPTURE_CALL( CmdBindDescriptorSets, Handle, Value, Handle, Value, Value, HandleArray< 4 >, Value, Array< 6 > )
+ASHES_CAPTURE_CALL( CmdBindIndexBuffer, Handle, Handle, Value, Value )
+ASHES_CAPTURE_CALL( CmdBindVertexBuffers, Handle, Value, Value, HandleArray< 2 >, Array< 2 > )
+ASHES_CAPTURE_CALL( CmdDraw, Handle, Value, Value, Value, Value )
+ASHES_CAPTURE_CALL( CmdDrawIndexed, Handle, Value, Value, Value, Value, Value )
+ASHES_CAPTURE_CALL( CmdDrawIndirect, Handle, Handle, Value, Value, Value )
+ASHES_CAPTURE_CALL( CmdDrawIndexedIndirect, Handle, Handle, Value, Value, Value )
+ASHES_CAPTURE_CALL( CmdDispatch, Handle, Value, Value, Value )
+ASHES_CAPTURE_CALL( CmdDispatchIndirect, Handle, Handle, Value )
+ASHES_CAPTURE_CALL( CmdCopyBuffer, Handle, Handle, Handle, Value, Array< 3 > )
+ASHES_CAPTURE_CALL( CmdCopyImage, Handle, Handle, Value, Handle, Value, Value, Array< 5 > )
+ASHES_CAPTURE_CALL( CmdBlitImage, Handle, Handle, Value, Handle, Value, Value, Array< 5 >, Value )
+ASHES_CAPTURE_CALL( CmdCopyBufferToImage, Handle, Handle, Handle, Value, Value, Array< 4 > )
+ASHES_CAPTURE_CALL( CmdCopyImageToBuffer, Handle, Handle, Value, Handle, Value, Array< 4 > )
+ASHES_CAPTURE_CALL( CmdUpdateBuffer, Handle, Handle, Value, Value, Bytes< 3 > )
+ASHES_CAPTURE_CALL( CmdFillBuffer, Handle, Handle, Value, Value, Value )
+ASHES_CAPTURE_CALL( CmdClearColorImage, Handle, Handle, Value, Struct, Value, Array< 4 > )
+ASHES_CAPTURE_CALL( CmdClearDepthStencilImage, Handle, Handle, Value, Struct, Value, Array< 4 > )
+ASHES_CAPTURE_CALL( CmdClearAttachments, Handle, Value, Array< 1 >, Value, Array< 3 > )
+ASHES_CAPTURE_CALL( CmdResolveImage, Handle, Handle, Value, Handle, Value, Value, Array< 5 > )
+ASHES_CAPTURE_CALL( CmdSetEvent, Handle, Handle, Value )
+ASHES_CAPTURE_CALL( CmdResetEvent, Handle, Handle, Value )
+ASHES_CAPTURE_CALL( CmdWaitEvents, Handle, Value, HandleArray< 1 >, Value, Value, Value, Array< 5 >, Value, Array< 7 >, Value, Array< 9 > )
+ASHES_CAPTURE_CALL( CmdPipelineBarrier, Handle, Value, Value, Value, Value, Array< 4 >, Value, Array< 6 >, Value, Array< 8 > )
+ASHES_CAPTURE_CALL( CmdBeginQuery, Handle, Handle, Value, Value )
+ASHES_CAPTURE_CALL( CmdEndQuery, Handle, Handle, Value )
+ASHES_CAPTURE_CALL( CmdResetQueryPool, Handle, Handle, Value, Value )
+ASHES_CAPTURE_CALL( CmdWriteTimestamp, Handle, Value, Handle, Value )
+ASHES_CAPTURE_CALL( CmdCopyQueryPoolResults, Handle, Handle, Value, Value, Handle, Value, Value, Value )
+ASHES_CAPTURE_CALL( CmdPushConstants, Handle, Handle, Value, Value, Value, Bytes< 4 > )
+ASHES_CAPTURE_CALL( CmdBeginRenderPass, Handle, Struct, Value )
+ASHES_CAPTURE_CALL( CmdNextSubpass, Handle, Value )
+ASHES_CAPTURE_CALL( CmdEndRenderPass, Handle )
+ASHES_CAPTURE_CALL( CmdExecuteCommands, Handle, Value, HandleArray< 1 > )
+ASHES_CAPTURE_CALL( CreateSwapchainKHR, Handle, Struct, Ignored, Created )
+ASHES_CAPTURE_CALL( DestroySwapchainKHR, Handle, Destroyed, Ignored )
+ASHES_CAPTURE_EXT_CALL( GetSwapchainImagesKHR, Handle, Handle, Count, Enumerated< 2 > )
+ASHES_CAPTURE_EXT_CALL( AcquireNextImageKHR, Handle, Handle, Value, Handle, Handle, Returned )
+ASHES_CAPTURE_EXT_CALL( QueuePresentKHR, Handle, Struct )
+
+#undef ASHES_CAPTURE_CALL
+#undef ASHES_CAPTURE_EXT_CALL
@@ -0,0 +1,579 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "CaptureStructs.hpp"
+
+#include <tuple>
+
+namespace ashes::capture
+{
+	/**
+	*\brief
+	*	The parameters codecs, used in CaptureCallsList.inl.
+	*\remarks
+	*	Each codec is given its parameter's index, and the whole parameters tuple,
+	*	so that it can access the count parameters.
+	*	encode is called after the captured call, with its parameters.
+	*	decode fills the replay parameters, complete is called after the replayed call,
+	*	to map the created handles ids, or forget the destroyed ones.
+	*/
+	struct NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void complete( Decoder &, ArgsT & )
+		{
+		}
+	};
+	/**
+	*\brief
+	*	A value, a structure given by value, or an enumeration.
+	*/
+	struct Value
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			serialize( ar, std::get< Index >( args ) );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			serialize( ar, std::get< Index >( args ) );
+		}
+	};
+	/**
+	*\brief
+	*	A handle used by the call.
+	*/
+	struct Handle
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			ar.handle( std::get< Index >( args ) );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			ar.handle( std::get< Index >( args ) );
+		}
+	};
+	/**
+	*\brief
+	*	A pointer to a single structure, nullptr allowed.
+	*/
+	struct Struct
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			ar.pointer( std::get< Index >( args ) );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			ar.pointer( std::get< Index >( args ) );
+		}
+	};
+	/**
+	*\brief
+	*	A parameter that isn't replayed (allocation callbacks, pipeline caches),
+	*	it is given a default value.
+	*/
+	struct Ignored
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder &, ArgsT & )
+		{
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder &, ArgsT & args )
+		{
+			std::get< Index >( args ) = {};
+		}
+	};
+	/**
+	*\brief
+	*	An array of values or structures, sized by the parameter at CountIndex.
+	*/
+	template< size_t CountIndex >
+	struct Array
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			ar.array( std::get< Index >( args ), std::get< CountIndex >( args ) );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			ar.array( std::get< Index >( args ), std::get< CountIndex >( args ) );
+		}
+	};
+	/**
+	*\brief
+	*	An array of Count values.
+	*/
+	template< uint32_t Count >
+	struct FixedArray
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			ar.array( std::get< Index >( args ), Count );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			ar.array( std::get< Index >( args ), Count );
+		}
+	};
+	/**
+	*\brief
+	*	An array of handles, sized by the parameter at CountIndex.
+	*/
+	template< size_t CountIndex >
+	struct HandleArray
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			ar.handles( std::get< Index >( args ), std::get< CountIndex >( args ) );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			ar.handles( std::get< Index >( args ), std::get< CountIndex >( args ) );
+		}
+	};
+	/**
+	*\brief
+	*	Raw data, sized in bytes by the parameter at SizeIndex.
+	*/
+	template< size_t SizeIndex >
+	struct Bytes
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			ar.bytes( std::get< Index >( args ), std::get< SizeIndex >( args ) );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			ar.bytes( std::get< Index >( args ), std::get< SizeIndex >( args ) );
+		}
+	};
+	/**
+	*\brief
+	*	Storage written by the call, sized in bytes by the parameter at SizeIndex, its content isn't captured.
+	*/
+	template< size_t SizeIndex >
+	struct OutBytes
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder &, ArgsT & )
+		{
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			std::get< Index >( args ) = ar.allocateOutput< uint8_t >( size_t( std::get< SizeIndex >( args ) ) );
+		}
+	};
+	/**
+	*\brief
+	*	The mapped pointer of vkMapMemory.
+	*/
+	struct Mapped
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder &, ArgsT & )
+		{
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			std::get< Index >( args ) = ar.allocateOutput< void * >( 1u );
+		}
+	};
+	/**
+	*\brief
+	*	A value written by the call, captured so that the replay can use it (e.g. the acquired image index).
+	*/
+	struct Returned
+		: NoCompletion
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			ar.value( *std::get< Index >( args ) );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			using ValueT = std::remove_pointer_t< std::remove_reference_t< decltype( std::get< Index >( args ) ) > >;
+			auto result = ar.allocateOutput< ValueT >( 1u );
+			ar.value( *result );
+			std::get< Index >( args ) = result;
+		}
+	};
+	/**
+	*\brief
+	*	The count of an enumeration, as written by the call.
+	*/
+	struct Count
+		: Returned
+	{
+	};
+	/**
+	*\brief
+	*	A handle created by the call.
+	*/
+	struct Created
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			ar.created( *std::get< Index >( args ) );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			using HandleT = std::remove_pointer_t< std::remove_reference_t< decltype( std::get< Index >( args ) ) > >;
+			ar.pushPending( ar.varint() );
+			std::get< Index >( args ) = ar.allocateOutput< HandleT >( 1u );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void complete( Decoder & ar, ArgsT & args )
+		{
+			ar.registerHandle( ar.popPending(), toHandleValue( *std::get< Index >( args ) ) );
+		}
+	};
+	/**
+	*\brief
+	*	Handles created by the call, counted by the given function of the parameters.
+	*/
+	template< typename CounterT >
+	struct CreatedHandles
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			auto data = std::get< Index >( args );
+			auto count = CounterT::get( args );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				ar.created( data[i] );
+			}
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			using HandleT = std::remove_pointer_t< std::remove_reference_t< decltype( std::get< Index >( args ) ) > >;
+			auto count = CounterT::get( args );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				ar.pushPending( ar.varint() );
+			}
+
+			std::get< Index >( args ) = ar.isValid()
+				? ar.allocateOutput< HandleT >( count )
+				: nullptr;
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void complete( Decoder & ar, ArgsT & args )
+		{
+			auto data = std::get< Index >( args );
+			auto count = CounterT::get( args );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				ar.registerHandle( ar.popPending(), toHandleValue( data[i] ) );
+			}
+		}
+	};
+
+	template< size_t CountIndex >
+	struct CountParam
+	{
+		template< typename ArgsT >
+		static uint32_t get( ArgsT & args )
+		{
+			return std::get< CountIndex >( args );
+		}
+	};
+
+	template< size_t InfoIndex, auto Member >
+	struct CountMember
+	{
+		template< typename ArgsT >
+		static uint32_t get( ArgsT & args )
+		{
+			auto info = std::get< InfoIndex >( args );
+			return info
+				? ( *info ).*Member
+				: 0u;
+		}
+	};
+	/**
+	*\brief
+	*	Handles created by the call, counted by the parameter at CountIndex.
+	*/
+	template< size_t CountIndex >
+	using CreatedArray = CreatedHandles< CountParam< CountIndex > >;
+	/**
+	*\brief
+	*	Handles created by the call, counted by a member of the structure at InfoIndex.
+	*/
+	template< size_t InfoIndex, auto Member >
+	using CreatedArrayIn = CreatedHandles< CountMember< InfoIndex, Member > >;
+	/**
+	*\brief
+	*	Handles enumerated by the call, counted by the Count parameter at CountIndex.
+	*\remarks
+	*	Each enumeration gives new ids, when replaying, the ids are mapped to the handles
+	*	the replay enumerates, in order.
+	*/
+	template< size_t CountIndex >
+	struct Enumerated
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			auto data = std::get< Index >( args );
+			auto count = *std::get< CountIndex >( args );
+			ar.varint( data ? 1u : 0u );
+
+			if ( data )
+			{
+				for ( uint32_t i = 0u; i < count; ++i )
+				{
+					ar.created( data[i] );
+				}
+			}
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			using HandleT = std::remove_pointer_t< std::remove_reference_t< decltype( std::get< Index >( args ) ) > >;
+			std::get< Index >( args ) = nullptr;
+
+			if ( ar.varint() )
+			{
+				auto count = *std::get< CountIndex >( args );
+
+				for ( uint32_t i = 0u; i < count; ++i )
+				{
+					ar.pushPending( ar.varint() );
+				}
+
+				if ( ar.isValid() )
+				{
+					std::get< Index >( args ) = ar.allocateOutput< HandleT >( count );
+				}
+			}
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void complete( Decoder & ar, ArgsT & args )
+		{
+			auto data = std::get< Index >( args );
+
+			if ( data )
+			{
+				// The replay may enumerate less handles than the capture did.
+				auto count = *std::get< CountIndex >( args );
+
+				for ( uint32_t i = 0u; i < count; ++i )
+				{
+					ar.registerHandle( ar.popPending(), toHandleValue( data[i] ) );
+				}
+			}
+		}
+	};
+	/**
+	*\brief
+	*	A handle destroyed by the call.
+	*/
+	struct Destroyed
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			ar.destroyed( std::get< Index >( args ) );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			using HandleT = std::remove_reference_t< decltype( std::get< Index >( args ) ) >;
+			auto id = ar.varint();
+			ar.pushPending( id );
+			std::get< Index >( args ) = fromHandleValue< HandleT >( ar.resolve( id ) );
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void complete( Decoder & ar, ArgsT & )
+		{
+			ar.releaseHandle( ar.popPending() );
+		}
+	};
+	/**
+	*\brief
+	*	Handles destroyed by the call, counted by the parameter at CountIndex.
+	*/
+	template< size_t CountIndex >
+	struct DestroyedArray
+	{
+		template< size_t Index, typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			auto data = std::get< Index >( args );
+			auto count = std::get< CountIndex >( args );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				ar.destroyed( data[i] );
+			}
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			using HandleT = std::remove_const_t< std::remove_pointer_t< std::remove_reference_t< decltype( std::get< Index >( args ) ) > > >;
+			auto count = std::get< CountIndex >( args );
+			auto data = ar.allocate< HandleT >( count );
+			std::get< Index >( args ) = data;
+
+			for ( uint32_t i = 0u; data && i < count; ++i )
+			{
+				auto id = ar.varint();
+				ar.pushPending( id );
+				data[i] = fromHandleValue< HandleT >( ar.resolve( id ) );
+			}
+		}
+
+		template< size_t Index, typename ArgsT >
+		static void complete( Decoder & ar, ArgsT & args )
+		{
+			auto count = std::get< CountIndex >( args );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				ar.releaseHandle( ar.popPending() );
+			}
+		}
+	};
+	/**
+	*\brief
+	*	Encodes the parameters of a call, with the given codecs.
+	*/
+	template< typename ... CodecsT, typename ArgsT, size_t ... Indices >
+	void encodeArgs( Encoder & ar
+		, ArgsT & args
+		, std::index_sequence< Indices... > )
+	{
+		( CodecsT::template encode< Indices >( ar, args ), ... );
+	}
+	/**
+	*\brief
+	*	Decodes the parameters of a call, with the given codecs.
+	*/
+	template< typename ... CodecsT, typename ArgsT, size_t ... Indices >
+	void decodeArgs( Decoder & ar
+		, ArgsT & args
+		, std::index_sequence< Indices... > )
+	{
+		( CodecsT::template decode< Indices >( ar, args ), ... );
+	}
+	/**
+	*\brief
+	*	Completes the replay of a call, with the given codecs.
+	*/
+	template< typename ... CodecsT, typename ArgsT, size_t ... Indices >
+	void completeArgs( Decoder & ar
+		, ArgsT & args
+		, std::index_sequence< Indices... > )
+	{
+		( CodecsT::template complete< Indices >( ar, args ), ... );
+	}
+	/**
+	*\brief
+	*	The codecs of a call's parameters, in parameters order.
+	*/
+	template< typename ... CodecsT >
+	struct CodecList
+	{
+		template< typename ArgsT >
+		static void encode( Encoder & ar, ArgsT & args )
+		{
+			static_assert( sizeof...( CodecsT ) == std::tuple_size_v< ArgsT > );
+			encodeArgs< CodecsT... >( ar, args, std::index_sequence_for< CodecsT... >{} );
+		}
+
+		template< typename ArgsT >
+		static void decode( Decoder & ar, ArgsT & args )
+		{
+			static_assert( sizeof...( CodecsT ) == std::tuple_size_v< ArgsT > );
+			decodeArgs< CodecsT... >( ar, args, std::index_sequence_for< CodecsT... >{} );
+		}
+
+		template< typename ArgsT >
+		static void complete( Decoder & ar, ArgsT & args )
+		{
+			completeArgs< CodecsT... >( ar, args, std::index_sequence_for< CodecsT... >{} );
+		}
+	};
+	/**
+	*\brief
+	*	The codecs of each captured call, from CaptureCallsList.inl.
+	*/
+	template< CallId Id >
+	struct CallCodecs;
+
+#define ASHES_CAPTURE_CALL( name, ... )\
+	template<>\
+	struct CallCodecs< CallId::e##name >\
+	{\
+		using Type = CodecList< __VA_ARGS__ >;\
+	};
+#define ASHES_CAPTURE_EXT_CALL( name, ... )\
+	template<>\
+	struct CallCodecs< CallId::e##name >\
+	{\
+		using Type = CodecList< __VA_ARGS__ >;\
+	};
+#include "CaptureCallsList.inl"
+}
@@ -0,0 +1,69 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include <cstdint>
+
+namespace ashes::capture
+{
+	/**
+	*\brief
+	*	The binary Vulkan calls capture file layout, shared with the replay tool.
+	*\remarks
+	*	A capture file is made of a CaptureHeader, followed by records, until the end of the file.
+	*	Each record is a LEB128 CallId, a LEB128 payload size, then the payload.
+	*	The payload holds the call's parameters, encoded by the codecs given in CaptureCallsList.inl.
+	*	The handles are replaced by ids, unique in the file, zero being VK_NULL_HANDLE.
+	*	The calls made before the captured frames range are recorded too, so that
+	*	the objects used by the captured frames exist when they are replayed.
+	*/
+	static char constexpr CaptureMagic[8]{ 'A', 'S', 'H', 'C', 'A', 'P', 'T', 'R' };
+	static uint32_t constexpr CaptureVersion = 1u;
+
+	struct CaptureHeader
+	{
+		char magic[8];
+		uint32_t version;
+		// sizeof( void * ) of the capturing process, the POD structures are stored as is.
+		uint32_t pointerSize;
+		uint32_t firstFrame;
+		uint32_t lastFrame;
+	};
+
+	enum class CallId : uint32_t
+	{
+		// Memory id, offset, size, content, and whether it was written at a submit rather than at a flush/unmap.
+		eMemoryWrite,
+		// Frame index.
+		eFrameBegin,
+		// Frame index.
+		eFrameEnd,
+#define ASHES_CAPTURE_CALL( name, ... )\
+		e##name,
+#define ASHES_CAPTURE_EXT_CALL( name, ... )\
+		e##name,
+#include "CaptureCallsList.inl"
+		eCount,
+	};
+
+	inline char const * getCallName( CallId id )
+	{
+		static char const * const names[]
+		{
+			"MemoryWrite",
+			"FrameBegin",
+			"FrameEnd",
+#define ASHES_CAPTURE_CALL( name, ... )\
+			"vk"#name,
+#define ASHES_CAPTURE_EXT_CALL( name, ... )\
+			"vk"#name,
+#include "CaptureCallsList.inl"
+		};
+		static_assert( sizeof( names ) / sizeof( *names ) == size_t( CallId::eCount ) );
+		return id < CallId::eCount
+			? names[size_t( id )]
+			: "Unknown";
+	}
+}
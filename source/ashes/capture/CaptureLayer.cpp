@@ -0,0 +1,697 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "capture/CaptureLayer.hpp"
+
+#include "capture/CaptureCodecs.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ashes::capture
+{
+	namespace
+	{
+		char const * const CaptureFileEnvVar = "ASHES_CAPTURE_FILE";
+		char const * const CaptureFramesEnvVar = "ASHES_CAPTURE_FRAMES";
+		size_t constexpr FlushThreshold = 4u * 1024u * 1024u;
+		// Mapped memory is compared to its shadow copy per block, consecutive modified blocks are written as one range.
+		VkDeviceSize constexpr MemoryBlockSize = 256u;
+
+		// The device functions only reachable through vkGetDeviceProcAddr.
+		struct ExtensionFunctions
+		{
+#define ASHES_CAPTURE_EXT_CALL( name, ... )\
+			PFN_vk##name name;
+#include "CaptureCallsList.inl"
+		};
+
+		struct MemoryState
+		{
+			VkDeviceSize size{};
+			uint8_t const * mapped{};
+			VkDeviceSize mappedOffset{};
+			VkDeviceSize mappedSize{};
+			// What the replay's memory holds, allocated on first map.
+			std::vector< uint8_t > shadow;
+		};
+
+		struct HookEntry
+		{
+			using SetNext = void( * )( ExtensionFunctions &, PFN_vkVoidFunction );
+
+			PFN_vkVoidFunction hook;
+			// Only for the extension functions, stores the captured function.
+			SetNext setNext;
+		};
+
+		class Capture
+		{
+		public:
+			Capture()
+			{
+				auto path = std::getenv( CaptureFileEnvVar );
+
+				if ( !path || !*path )
+				{
+					return;
+				}
+
+				m_file = std::fopen( path, "wb" );
+
+				if ( !m_file )
+				{
+					std::cerr << "[Ashes capture] Couldn't open " << path << std::endl;
+					return;
+				}
+
+				m_path = path;
+
+				doParseFrames( std::getenv( CaptureFramesEnvVar ) );
+				CaptureHeader header{};
+				std::memcpy( header.magic, CaptureMagic, sizeof( header.magic ) );
+				header.version = CaptureVersion;
+				header.pointerSize = uint32_t( sizeof( void * ) );
+				header.firstFrame = m_firstFrame;
+				header.lastFrame = m_lastFrame;
+				std::fwrite( &header, sizeof( header ), 1u, m_file );
+				m_recording = true;
+
+				if ( m_firstFrame == 0u )
+				{
+					doWriteFrameMarker( CallId::eFrameBegin );
+				}
+			}
+
+			~Capture()
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				doClose();
+			}
+
+			// Only set when the capture file could be opened.
+			bool isEnabled()const noexcept
+			{
+				return !m_path.empty();
+			}
+
+			bool isRecording()const noexcept
+			{
+				return m_recording.load( std::memory_order_acquire );
+			}
+
+			AshPluginStaticFunction const & getNext()const noexcept
+			{
+				return m_next;
+			}
+
+			ExtensionFunctions const & getExtensions()const noexcept
+			{
+				return m_extensions;
+			}
+
+			PFN_vkGetInstanceProcAddr getNextInstanceProcAddr()const noexcept
+			{
+				return m_nextInstanceProcAddr.load( std::memory_order_relaxed );
+			}
+
+			void setNextInstanceProcAddr( PFN_vkGetInstanceProcAddr value )noexcept
+			{
+				m_nextInstanceProcAddr.store( value, std::memory_order_relaxed );
+			}
+
+			AshPluginStaticFunction wrap( AshPluginStaticFunction const & functions );
+			PFN_vkVoidFunction getHook( char const * name
+				, PFN_vkVoidFunction function );
+
+			template< CallId Id, typename ... ParamsT >
+			void record( ParamsT ... params )
+			{
+				if ( !isRecording() )
+				{
+					return;
+				}
+
+				std::lock_guard< std::mutex > lock{ m_mutex };
+
+				if ( isRecording() )
+				{
+					auto args = std::tie( params... );
+					m_payload.clear();
+					Encoder ar{ m_payload, m_ids, m_lastId, m_memoryProperties };
+					CallCodecs< Id >::Type::encode( ar, args );
+					doWriteRecord( Id );
+				}
+			}
+
+			void onDeviceCreated( VkPhysicalDevice physicalDevice )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				m_next.GetPhysicalDeviceMemoryProperties( physicalDevice, &m_memoryProperties );
+			}
+
+			void onMemoryAllocated( VkDeviceMemory memory
+				, VkDeviceSize size )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				m_memories[memory].size = size;
+			}
+
+			void onMemoryFreed( VkDeviceMemory memory )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				m_memories.erase( memory );
+			}
+
+			void onMemoryMapped( VkDeviceMemory memory
+				, VkDeviceSize offset
+				, VkDeviceSize size
+				, void * data )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				auto it = m_memories.find( memory );
+
+				if ( it == m_memories.end() || !isRecording() )
+				{
+					return;
+				}
+
+				auto & state = it->second;
+				state.mapped = static_cast< uint8_t const * >( data );
+				state.mappedOffset = offset;
+				state.mappedSize = size == VK_WHOLE_SIZE
+					? state.size - offset
+					: std::min( size, state.size - offset );
+				state.shadow.resize( size_t( state.size ) );
+			}
+
+			void onMemoryFlushed( uint32_t count
+				, VkMappedMemoryRange const * ranges )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+
+				for ( uint32_t i = 0u; i < count && isRecording(); ++i )
+				{
+					auto it = m_memories.find( ranges[i].memory );
+
+					if ( it != m_memories.end() )
+					{
+						doWriteMemory( it->first
+							, it->second
+							, ranges[i].offset
+							, ranges[i].size
+							, false );
+					}
+				}
+			}
+
+			void onMemoryUnmapped( VkDeviceMemory memory )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				auto it = m_memories.find( memory );
+
+				if ( it != m_memories.end() )
+				{
+					doWriteMemory( it->first
+						, it->second
+						, it->second.mappedOffset
+						, it->second.mappedSize
+						, false );
+					it->second.mapped = nullptr;
+				}
+			}
+			/**
+			*\brief
+			*	Writes the modifications of the memories that stay mapped,
+			*	which the application may not flush (coherent memory).
+			*/
+			void onSubmit()
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+
+				for ( auto & memory : m_memories )
+				{
+					if ( memory.second.mapped )
+					{
+						doWriteMemory( memory.first
+							, memory.second
+							, memory.second.mappedOffset
+							, memory.second.mappedSize
+							, true );
+					}
+				}
+			}
+
+			void onPresent()
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+
+				if ( !isRecording() )
+				{
+					return;
+				}
+
+				if ( m_frame >= m_firstFrame )
+				{
+					doWriteFrameMarker( CallId::eFrameEnd );
+				}
+
+				++m_frame;
+
+				if ( m_frame > m_lastFrame )
+				{
+					doClose();
+				}
+				else if ( m_frame == m_firstFrame )
+				{
+					doWriteFrameMarker( CallId::eFrameBegin );
+				}
+			}
+
+		private:
+			void doParseFrames( char const * value )
+			{
+				if ( value && *value )
+				{
+					char * end{};
+					m_firstFrame = uint32_t( std::strtoul( value, &end, 10 ) );
+					m_lastFrame = ( *end == '-' )
+						? uint32_t( std::strtoul( end + 1, nullptr, 10 ) )
+						: m_firstFrame;
+					m_lastFrame = std::max( m_firstFrame, m_lastFrame );
+				}
+			}
+
+			void doWriteRecord( CallId id )
+			{
+				Encoder ar{ m_buffer, m_ids, m_lastId, m_memoryProperties };
+				ar.varint( uint64_t( id ) );
+				ar.varint( m_payload.size() );
+				ar.write( m_payload.data(), m_payload.size() );
+				++m_recordCount;
+
+				if ( m_buffer.size() >= FlushThreshold )
+				{
+					doFlush();
+				}
+			}
+
+			void doWriteFrameMarker( CallId id )
+			{
+				m_payload.clear();
+				Encoder ar{ m_payload, m_ids, m_lastId, m_memoryProperties };
+				ar.varint( m_frame );
+				doWriteRecord( id );
+			}
+
+			void doWriteMemory( VkDeviceMemory memory
+				, MemoryState & state
+				, VkDeviceSize offset
+				, VkDeviceSize size
+				, bool atSubmit )
+			{
+				if ( !state.mapped || !isRecording() )
+				{
+					return;
+				}
+
+				// Clamp the range to the mapped one, in bytes from the mapping's start.
+				auto mappedEnd = state.mappedOffset + state.mappedSize;
+				auto begin = std::max( offset, state.mappedOffset );
+				auto end = size == VK_WHOLE_SIZE
+					? mappedEnd
+					: std::min( offset + size, mappedEnd );
+				begin -= state.mappedOffset;
+				end = end > state.mappedOffset
+					? end - state.mappedOffset
+					: 0u;
+				auto shadow = state.shadow.data() + state.mappedOffset;
+				auto block = begin;
+
+				while ( block < end )
+				{
+					auto blockSize = std::min( MemoryBlockSize, end - block );
+
+					if ( std::memcmp( state.mapped + block, shadow + block, size_t( blockSize ) ) == 0 )
+					{
+						block += blockSize;
+						continue;
+					}
+
+					auto runBegin = block;
+
+					do
+					{
+						block += blockSize;
+						blockSize = std::min( MemoryBlockSize, end - block );
+					}
+					while ( block < end
+						&& std::memcmp( state.mapped + block, shadow + block, size_t( blockSize ) ) != 0 );
+
+					auto runSize = block - runBegin;
+					std::memcpy( shadow + runBegin, state.mapped + runBegin, size_t( runSize ) );
+					m_payload.clear();
+					Encoder ar{ m_payload, m_ids, m_lastId, m_memoryProperties };
+					ar.handle( memory );
+					ar.varint( state.mappedOffset + runBegin );
+					ar.varint( runSize );
+					ar.varint( atSubmit ? 1u : 0u );
+					ar.write( shadow + runBegin, size_t( runSize ) );
+					doWriteRecord( CallId::eMemoryWrite );
+					m_memoryBytes += runSize;
+				}
+			}
+
+			void doFlush()
+			{
+				if ( m_file && !m_buffer.empty() )
+				{
+					std::fwrite( m_buffer.data(), 1u, m_buffer.size(), m_file );
+					m_buffer.clear();
+				}
+			}
+
+			void doClose()
+			{
+				if ( !m_file )
+				{
+					return;
+				}
+
+				m_recording = false;
+				doFlush();
+				std::fclose( m_file );
+				m_file = nullptr;
+				std::clog << "[Ashes capture] Wrote " << m_recordCount << " records"
+					<< " (" << m_memoryBytes << " bytes of memory writes)"
+					<< " to " << m_path
+					<< ", frames " << m_firstFrame << " to " << std::min( m_frame, m_lastFrame ) << std::endl;
+
+				if ( auto dropped = Encoder::getDroppedNextCount() )
+				{
+					std::clog << "[Ashes capture] " << dropped << " pNext chains weren't captured" << std::endl;
+				}
+			}
+
+		private:
+			std::string m_path;
+			std::FILE * m_file{};
+			std::atomic_bool m_recording{ false };
+			uint32_t m_firstFrame{};
+			uint32_t m_lastFrame{};
+			AshPluginStaticFunction m_next{};
+			ExtensionFunctions m_extensions{};
+			std::atomic< PFN_vkGetInstanceProcAddr > m_nextInstanceProcAddr{};
+			std::unordered_map< std::string, HookEntry > m_hooks;
+			// Guards everything below.
+			std::mutex m_mutex;
+			uint32_t m_frame{};
+			uint64_t m_recordCount{};
+			uint64_t m_memoryBytes{};
+			std::vector< uint8_t > m_buffer;
+			std::vector< uint8_t > m_payload;
+			HandleMap m_ids;
+			uint64_t m_lastId{};
+			VkPhysicalDeviceMemoryProperties m_memoryProperties{};
+			std::unordered_map< VkDeviceMemory, MemoryState > m_memories;
+		};
+
+		Capture & getCapture()
+		{
+			static Capture result;
+			return result;
+		}
+
+		//*********************************************************************************************
+
+		template< typename FuncT >
+		struct CaptureHook;
+
+		template< typename RetT, typename ... ParamsT >
+		struct CaptureHook< RetT( VKAPI_PTR * )( ParamsT... ) >
+		{
+			using PfnT = RetT( VKAPI_PTR * )( ParamsT... );
+
+			template< typename TableT, PfnT TableT::* Member, CallId Id >
+			static RetT VKAPI_CALL call( ParamsT ... params )
+			{
+				auto & capture = getCapture();
+				PfnT function;
+
+				if constexpr ( std::is_same_v< TableT, AshPluginStaticFunction > )
+				{
+					function = capture.getNext().*Member;
+				}
+				else
+				{
+					function = capture.getExtensions().*Member;
+				}
+
+				if constexpr ( std::is_void_v< RetT > )
+				{
+					function( params... );
+					capture.record< Id >( params... );
+				}
+				else
+				{
+					auto result = function( params... );
+
+					// The failed calls have no effect to replay.
+					if ( result >= VK_SUCCESS )
+					{
+						capture.record< Id >( params... );
+					}
+
+					return result;
+				}
+			}
+		};
+
+		//*********************************************************************************************
+
+		VkResult VKAPI_CALL createDevice( VkPhysicalDevice physicalDevice
+			, VkDeviceCreateInfo const * pCreateInfo
+			, VkAllocationCallbacks const * pAllocator
+			, VkDevice * pDevice )
+		{
+			auto & capture = getCapture();
+			auto result = capture.getNext().CreateDevice( physicalDevice, pCreateInfo, pAllocator, pDevice );
+
+			if ( result == VK_SUCCESS )
+			{
+				// Single device: the memory types written with the allocations are this device's.
+				capture.onDeviceCreated( physicalDevice );
+				capture.record< CallId::eCreateDevice >( physicalDevice, pCreateInfo, pAllocator, pDevice );
+			}
+
+			return result;
+		}
+
+		VkResult VKAPI_CALL allocateMemory( VkDevice device
+			, VkMemoryAllocateInfo const * pAllocateInfo
+			, VkAllocationCallbacks const * pAllocator
+			, VkDeviceMemory * pMemory )
+		{
+			auto & capture = getCapture();
+			auto result = capture.getNext().AllocateMemory( device, pAllocateInfo, pAllocator, pMemory );
+
+			if ( result == VK_SUCCESS )
+			{
+				capture.onMemoryAllocated( *pMemory, pAllocateInfo->allocationSize );
+				capture.record< CallId::eAllocateMemory >( device, pAllocateInfo, pAllocator, pMemory );
+			}
+
+			return result;
+		}
+
+		void VKAPI_CALL freeMemory( VkDevice device
+			, VkDeviceMemory memory
+			, VkAllocationCallbacks const * pAllocator )
+		{
+			auto & capture = getCapture();
+			capture.getNext().FreeMemory( device, memory, pAllocator );
+			capture.onMemoryFreed( memory );
+			capture.record< CallId::eFreeMemory >( device, memory, pAllocator );
+		}
+
+		VkResult VKAPI_CALL mapMemory( VkDevice device
+			, VkDeviceMemory memory
+			, VkDeviceSize offset
+			, VkDeviceSize size
+			, VkMemoryMapFlags flags
+			, void ** ppData )
+		{
+			auto & capture = getCapture();
+			auto result = capture.getNext().MapMemory( device, memory, offset, size, flags, ppData );
+
+			if ( result == VK_SUCCESS )
+			{
+				capture.onMemoryMapped( memory, offset, size, *ppData );
+				capture.record< CallId::eMapMemory >( device, memory, offset, size, flags, ppData );
+			}
+
+			return result;
+		}
+
+		void VKAPI_CALL unmapMemory( VkDevice device
+			, VkDeviceMemory memory )
+		{
+			auto & capture = getCapture();
+			// Written before the call, the replay must see the content before it unmaps.
+			capture.onMemoryUnmapped( memory );
+			capture.getNext().UnmapMemory( device, memory );
+			capture.record< CallId::eUnmapMemory >( device, memory );
+		}
+
+		VkResult VKAPI_CALL flushMappedMemoryRanges( VkDevice device
+			, uint32_t memoryRangeCount
+			, VkMappedMemoryRange const * pMemoryRanges )
+		{
+			auto & capture = getCapture();
+			capture.onMemoryFlushed( memoryRangeCount, pMemoryRanges );
+			auto result = capture.getNext().FlushMappedMemoryRanges( device, memoryRangeCount, pMemoryRanges );
+
+			if ( result == VK_SUCCESS )
+			{
+				capture.record< CallId::eFlushMappedMemoryRanges >( device, memoryRangeCount, pMemoryRanges );
+			}
+
+			return result;
+		}
+
+		VkResult VKAPI_CALL queueSubmit( VkQueue queue
+			, uint32_t submitCount
+			, VkSubmitInfo const * pSubmits
+			, VkFence fence )
+		{
+			auto & capture = getCapture();
+			capture.onSubmit();
+			auto result = capture.getNext().QueueSubmit( queue, submitCount, pSubmits, fence );
+
+			if ( result == VK_SUCCESS )
+			{
+				capture.record< CallId::eQueueSubmit >( queue, submitCount, pSubmits, fence );
+			}
+
+			return result;
+		}
+
+		VkResult VKAPI_CALL queuePresent( VkQueue queue
+			, VkPresentInfoKHR const * pPresentInfo )
+		{
+			auto & capture = getCapture();
+			auto result = capture.getExtensions().QueuePresentKHR( queue, pPresentInfo );
+			// Recorded even when the swapchain is out of date, the frame ends anyway.
+			capture.record< CallId::eQueuePresentKHR >( queue, pPresentInfo );
+			capture.onPresent();
+			return result;
+		}
+
+		PFN_vkVoidFunction VKAPI_CALL getDeviceProcAddr( VkDevice device
+			, char const * pName )
+		{
+			auto & capture = getCapture();
+			auto result = capture.getNext().GetDeviceProcAddr( device, pName );
+			return result
+				? capture.getHook( pName, result )
+				: result;
+		}
+
+		PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddrHook( VkInstance instance
+			, char const * pName )
+		{
+			auto next = getCapture().getNextInstanceProcAddr();
+			return next
+				? getInstanceProcAddr( next, instance, pName )
+				: nullptr;
+		}
+
+		//*********************************************************************************************
+
+		AshPluginStaticFunction Capture::wrap( AshPluginStaticFunction const & functions )
+		{
+			m_next = functions;
+			// The functions that aren't captured are called directly.
+			AshPluginStaticFunction result = functions;
+#define ASHES_CAPTURE_CALL( name, ... )\
+			result.name = &CaptureHook< PFN_vk##name >::call< AshPluginStaticFunction, &AshPluginStaticFunction::name, CallId::e##name >;
+#include "CaptureCallsList.inl"
+			result.CreateDevice = &createDevice;
+			result.AllocateMemory = &allocateMemory;
+			result.FreeMemory = &freeMemory;
+			result.MapMemory = &mapMemory;
+			result.UnmapMemory = &unmapMemory;
+			result.FlushMappedMemoryRanges = &flushMappedMemoryRanges;
+			result.QueueSubmit = &queueSubmit;
+			result.GetDeviceProcAddr = &getDeviceProcAddr;
+
+			m_hooks.clear();
+#define ASHES_CAPTURE_CALL( name, ... )\
+			m_hooks.emplace( "vk"#name, HookEntry{ PFN_vkVoidFunction( result.name ), nullptr } );
+#define ASHES_CAPTURE_EXT_CALL( name, ... )\
+			m_hooks.emplace( "vk"#name\
+				, HookEntry{ PFN_vkVoidFunction( &CaptureHook< PFN_vk##name >::call< ExtensionFunctions, &ExtensionFunctions::name, CallId::e##name > )\
+					, []( ExtensionFunctions & extensions, PFN_vkVoidFunction function )\
+					{\
+						extensions.name = PFN_vk##name( function );\
+					} } );
+#include "CaptureCallsList.inl"
+			m_hooks["vkQueuePresentKHR"].hook = PFN_vkVoidFunction( &queuePresent );
+			m_hooks.emplace( "vkGetDeviceProcAddr", HookEntry{ PFN_vkVoidFunction( result.GetDeviceProcAddr ), nullptr } );
+			m_hooks.emplace( "vkGetInstanceProcAddr", HookEntry{ PFN_vkVoidFunction( &getInstanceProcAddrHook ), nullptr } );
+			return result;
+		}
+
+		PFN_vkVoidFunction Capture::getHook( char const * name
+			, PFN_vkVoidFunction function )
+		{
+			auto it = m_hooks.find( name );
+
+			if ( it == m_hooks.end() )
+			{
+				return function;
+			}
+
+			if ( it->second.setNext )
+			{
+				it->second.setNext( m_extensions, function );
+			}
+
+			return it->second.hook;
+		}
+	}
+
+	//*********************************************************************************************
+
+	AshPluginStaticFunction wrap( AshPluginStaticFunction const & functions )
+	{
+		auto & capture = getCapture();
+		return capture.isEnabled()
+			? capture.wrap( functions )
+			: functions;
+	}
+
+	PFN_vkVoidFunction getInstanceProcAddr( PFN_vkGetInstanceProcAddr next
+		, VkInstance instance
+		, char const * name )
+	{
+		auto result = next( instance, name );
+		auto & capture = getCapture();
+
+		if ( result && capture.isEnabled() )
+		{
+			capture.setNextInstanceProcAddr( next );
+			result = capture.getHook( name, result );
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,32 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#ifndef VK_NO_PROTOTYPES
+#	define VK_NO_PROTOTYPES
+#endif
+#include "ashes/ashes.h"
+
+namespace ashes::capture
+{
+	/**
+	*\brief
+	*	Wraps a plugin's functions table with the capture hooks.
+	*\remarks
+	*	The capture is enabled by setting ASHES_CAPTURE_FILE to the capture file path,
+	*	ASHES_CAPTURE_FRAMES selects the captured frames, as "first[-last]" (defaults to "0").
+	*	The frames are delimited by vkQueuePresentKHR.
+	*\return
+	*	The hooks forwarding to the given functions, or the given functions when the capture isn't enabled.
+	*/
+	AshPluginStaticFunction wrap( AshPluginStaticFunction const & functions );
+	/**
+	*\brief
+	*	vkGetInstanceProcAddr, returning the capture hooks instead of the captured functions.
+	*/
+	PFN_vkVoidFunction getInstanceProcAddr( PFN_vkGetInstanceProcAddr next
+		, VkInstance instance
+		, char const * name );
+}
@@ -0,0 +1,760 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "CaptureArchive.hpp"
+
+namespace ashes::capture
+{
+	/**
+	*\brief
+	*	The Vulkan structures serialisation, shared by the Encoder and the Decoder.
+	*\remarks
+	*	The counts are always serialised before the arrays they size.
+	*	The structures without pointers nor handles are stored as is.
+	*/
+	template< typename ArchiveT, typename T >
+	void serialize( ArchiveT & ar, T & value )
+	{
+		static_assert( std::is_arithmetic_v< T > || std::is_enum_v< T >
+			, "Missing serialize overload for a structure" );
+		ar.value( value );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, char const *& value )
+	{
+		ar.string( value );
+	}
+
+#define ASHES_CAPTURE_RAW( type )\
+	template< typename ArchiveT >\
+	void serialize( ArchiveT & ar, type & value )\
+	{\
+		ar.raw( value );\
+	}
+
+	ASHES_CAPTURE_RAW( VkPhysicalDeviceFeatures )
+	ASHES_CAPTURE_RAW( VkExtent2D )
+	ASHES_CAPTURE_RAW( VkExtent3D )
+	ASHES_CAPTURE_RAW( VkOffset3D )
+	ASHES_CAPTURE_RAW( VkRect2D )
+	ASHES_CAPTURE_RAW( VkViewport )
+	ASHES_CAPTURE_RAW( VkComponentMapping )
+	ASHES_CAPTURE_RAW( VkImageSubresourceRange )
+	ASHES_CAPTURE_RAW( VkStencilOpState )
+	ASHES_CAPTURE_RAW( VkSpecializationMapEntry )
+	ASHES_CAPTURE_RAW( VkVertexInputBindingDescription )
+	ASHES_CAPTURE_RAW( VkVertexInputAttributeDescription )
+	ASHES_CAPTURE_RAW( VkPipelineColorBlendAttachmentState )
+	ASHES_CAPTURE_RAW( VkPushConstantRange )
+	ASHES_CAPTURE_RAW( VkDescriptorPoolSize )
+	ASHES_CAPTURE_RAW( VkAttachmentDescription )
+	ASHES_CAPTURE_RAW( VkAttachmentReference )
+	ASHES_CAPTURE_RAW( VkSubpassDependency )
+	ASHES_CAPTURE_RAW( VkBufferCopy )
+	ASHES_CAPTURE_RAW( VkImageCopy )
+	ASHES_CAPTURE_RAW( VkImageBlit )
+	ASHES_CAPTURE_RAW( VkBufferImageCopy )
+	ASHES_CAPTURE_RAW( VkImageResolve )
+	ASHES_CAPTURE_RAW( VkClearValue )
+	ASHES_CAPTURE_RAW( VkClearColorValue )
+	ASHES_CAPTURE_RAW( VkClearDepthStencilValue )
+	ASHES_CAPTURE_RAW( VkClearAttachment )
+	ASHES_CAPTURE_RAW( VkClearRect )
+
+#undef ASHES_CAPTURE_RAW
+
+	//*********************************************************************************************
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkApplicationInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.string( value.pApplicationName );
+		ar.value( value.applicationVersion );
+		ar.string( value.pEngineName );
+		ar.value( value.engineVersion );
+		ar.value( value.apiVersion );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkInstanceCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.pointer( value.pApplicationInfo );
+		ar.value( value.enabledLayerCount );
+		ar.array( value.ppEnabledLayerNames, value.enabledLayerCount );
+		ar.value( value.enabledExtensionCount );
+		ar.array( value.ppEnabledExtensionNames, value.enabledExtensionCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkDeviceQueueCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.queueFamilyIndex );
+		ar.value( value.queueCount );
+		ar.array( value.pQueuePriorities, value.queueCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkDeviceCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.queueCreateInfoCount );
+		ar.array( value.pQueueCreateInfos, value.queueCreateInfoCount );
+		ar.value( value.enabledLayerCount );
+		ar.array( value.ppEnabledLayerNames, value.enabledLayerCount );
+		ar.value( value.enabledExtensionCount );
+		ar.array( value.ppEnabledExtensionNames, value.enabledExtensionCount );
+		ar.pointer( value.pEnabledFeatures );
+	}
+
+	//*********************************************************************************************
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkSubmitInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.waitSemaphoreCount );
+		ar.handles( value.pWaitSemaphores, value.waitSemaphoreCount );
+		ar.array( value.pWaitDstStageMask, value.waitSemaphoreCount );
+		ar.value( value.commandBufferCount );
+		ar.handles( value.pCommandBuffers, value.commandBufferCount );
+		ar.value( value.signalSemaphoreCount );
+		ar.handles( value.pSignalSemaphores, value.signalSemaphoreCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkMemoryAllocateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.allocationSize );
+		ar.memoryType( value.memoryTypeIndex );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkMappedMemoryRange & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.handle( value.memory );
+		ar.value( value.offset );
+		ar.value( value.size );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkFenceCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkSemaphoreCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkEventCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkQueryPoolCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.queryType );
+		ar.value( value.queryCount );
+		ar.value( value.pipelineStatistics );
+	}
+
+	//*********************************************************************************************
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkBufferCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.size );
+		ar.value( value.usage );
+		ar.value( value.sharingMode );
+		ar.value( value.queueFamilyIndexCount );
+		ar.array( value.pQueueFamilyIndices, value.queueFamilyIndexCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkBufferViewCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.handle( value.buffer );
+		ar.value( value.format );
+		ar.value( value.offset );
+		ar.value( value.range );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkImageCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.imageType );
+		ar.value( value.format );
+		serialize( ar, value.extent );
+		ar.value( value.mipLevels );
+		ar.value( value.arrayLayers );
+		ar.value( value.samples );
+		ar.value( value.tiling );
+		ar.value( value.usage );
+		ar.value( value.sharingMode );
+		ar.value( value.queueFamilyIndexCount );
+		ar.array( value.pQueueFamilyIndices, value.queueFamilyIndexCount );
+		ar.value( value.initialLayout );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkImageViewCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.handle( value.image );
+		ar.value( value.viewType );
+		ar.value( value.format );
+		serialize( ar, value.components );
+		serialize( ar, value.subresourceRange );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkShaderModuleCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.codeSize );
+		ar.bytes( value.pCode, value.codeSize );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkSamplerCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.magFilter );
+		ar.value( value.minFilter );
+		ar.value( value.mipmapMode );
+		ar.value( value.addressModeU );
+		ar.value( value.addressModeV );
+		ar.value( value.addressModeW );
+		ar.value( value.mipLodBias );
+		ar.value( value.anisotropyEnable );
+		ar.value( value.maxAnisotropy );
+		ar.value( value.compareEnable );
+		ar.value( value.compareOp );
+		ar.value( value.minLod );
+		ar.value( value.maxLod );
+		ar.value( value.borderColor );
+		ar.value( value.unnormalizedCoordinates );
+	}
+
+	//*********************************************************************************************
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkSpecializationInfo & value )
+	{
+		ar.value( value.mapEntryCount );
+		ar.array( value.pMapEntries, value.mapEntryCount );
+		ar.value( value.dataSize );
+		ar.bytes( value.pData, value.dataSize );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineShaderStageCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.stage );
+		ar.handle( value.module );
+		ar.string( value.pName );
+		ar.pointer( value.pSpecializationInfo );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineVertexInputStateCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.vertexBindingDescriptionCount );
+		ar.array( value.pVertexBindingDescriptions, value.vertexBindingDescriptionCount );
+		ar.value( value.vertexAttributeDescriptionCount );
+		ar.array( value.pVertexAttributeDescriptions, value.vertexAttributeDescriptionCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineInputAssemblyStateCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.topology );
+		ar.value( value.primitiveRestartEnable );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineTessellationStateCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.patchControlPoints );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineViewportStateCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.viewportCount );
+		ar.array( value.pViewports, value.viewportCount );
+		ar.value( value.scissorCount );
+		ar.array( value.pScissors, value.scissorCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineRasterizationStateCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.depthClampEnable );
+		ar.value( value.rasterizerDiscardEnable );
+		ar.value( value.polygonMode );
+		ar.value( value.cullMode );
+		ar.value( value.frontFace );
+		ar.value( value.depthBiasEnable );
+		ar.value( value.depthBiasConstantFactor );
+		ar.value( value.depthBiasClamp );
+		ar.value( value.depthBiasSlopeFactor );
+		ar.value( value.lineWidth );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineMultisampleStateCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.rasterizationSamples );
+		ar.value( value.sampleShadingEnable );
+		ar.value( value.minSampleShading );
+		ar.array( value.pSampleMask, ( uint32_t( value.rasterizationSamples ) + 31u ) / 32u );
+		ar.value( value.alphaToCoverageEnable );
+		ar.value( value.alphaToOneEnable );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineDepthStencilStateCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.depthTestEnable );
+		ar.value( value.depthWriteEnable );
+		ar.value( value.depthCompareOp );
+		ar.value( value.depthBoundsTestEnable );
+		ar.value( value.stencilTestEnable );
+		serialize( ar, value.front );
+		serialize( ar, value.back );
+		ar.value( value.minDepthBounds );
+		ar.value( value.maxDepthBounds );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineColorBlendStateCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.logicOpEnable );
+		ar.value( value.logicOp );
+		ar.value( value.attachmentCount );
+		ar.array( value.pAttachments, value.attachmentCount );
+
+		for ( auto & constant : value.blendConstants )
+		{
+			ar.value( constant );
+		}
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineDynamicStateCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.dynamicStateCount );
+		ar.array( value.pDynamicStates, value.dynamicStateCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkGraphicsPipelineCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.stageCount );
+		ar.array( value.pStages, value.stageCount );
+		ar.pointer( value.pVertexInputState );
+		ar.pointer( value.pInputAssemblyState );
+		ar.pointer( value.pTessellationState );
+		ar.pointer( value.pViewportState );
+		ar.pointer( value.pRasterizationState );
+		ar.pointer( value.pMultisampleState );
+		ar.pointer( value.pDepthStencilState );
+		ar.pointer( value.pColorBlendState );
+		ar.pointer( value.pDynamicState );
+		ar.handle( value.layout );
+		ar.handle( value.renderPass );
+		ar.value( value.subpass );
+		ar.handle( value.basePipelineHandle );
+		ar.value( value.basePipelineIndex );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkComputePipelineCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		serialize( ar, value.stage );
+		ar.handle( value.layout );
+		ar.handle( value.basePipelineHandle );
+		ar.value( value.basePipelineIndex );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPipelineLayoutCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.setLayoutCount );
+		ar.handles( value.pSetLayouts, value.setLayoutCount );
+		ar.value( value.pushConstantRangeCount );
+		ar.array( value.pPushConstantRanges, value.pushConstantRangeCount );
+	}
+
+	//*********************************************************************************************
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkDescriptorSetLayoutBinding & value )
+	{
+		ar.value( value.binding );
+		ar.value( value.descriptorType );
+		ar.value( value.descriptorCount );
+		ar.value( value.stageFlags );
+		ar.handles( value.pImmutableSamplers, value.descriptorCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkDescriptorSetLayoutCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.bindingCount );
+		ar.array( value.pBindings, value.bindingCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkDescriptorPoolCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.maxSets );
+		ar.value( value.poolSizeCount );
+		ar.array( value.pPoolSizes, value.poolSizeCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkDescriptorSetAllocateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.handle( value.descriptorPool );
+		ar.value( value.descriptorSetCount );
+		ar.handles( value.pSetLayouts, value.descriptorSetCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkDescriptorImageInfo & value )
+	{
+		ar.handle( value.sampler );
+		ar.handle( value.imageView );
+		ar.value( value.imageLayout );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkDescriptorBufferInfo & value )
+	{
+		ar.handle( value.buffer );
+		ar.value( value.offset );
+		ar.value( value.range );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkWriteDescriptorSet & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.handle( value.dstSet );
+		ar.value( value.dstBinding );
+		ar.value( value.dstArrayElement );
+		ar.value( value.descriptorCount );
+		ar.value( value.descriptorType );
+
+		// Only the array matching the descriptor type is valid, the others may hold garbage.
+		switch ( value.descriptorType )
+		{
+		case VK_DESCRIPTOR_TYPE_SAMPLER:
+		case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+		case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+		case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+		case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+			ar.array( value.pImageInfo, value.descriptorCount );
+			break;
+		case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+		case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+		case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+		case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+			ar.array( value.pBufferInfo, value.descriptorCount );
+			break;
+		case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+		case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+			ar.handles( value.pTexelBufferView, value.descriptorCount );
+			break;
+		default:
+			break;
+		}
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkCopyDescriptorSet & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.handle( value.srcSet );
+		ar.value( value.srcBinding );
+		ar.value( value.srcArrayElement );
+		ar.handle( value.dstSet );
+		ar.value( value.dstBinding );
+		ar.value( value.dstArrayElement );
+		ar.value( value.descriptorCount );
+	}
+
+	//*********************************************************************************************
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkFramebufferCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.handle( value.renderPass );
+		ar.value( value.attachmentCount );
+		ar.handles( value.pAttachments, value.attachmentCount );
+		ar.value( value.width );
+		ar.value( value.height );
+		ar.value( value.layers );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkSubpassDescription & value )
+	{
+		ar.value( value.flags );
+		ar.value( value.pipelineBindPoint );
+		ar.value( value.inputAttachmentCount );
+		ar.array( value.pInputAttachments, value.inputAttachmentCount );
+		ar.value( value.colorAttachmentCount );
+		ar.array( value.pColorAttachments, value.colorAttachmentCount );
+		ar.array( value.pResolveAttachments, value.colorAttachmentCount );
+		ar.pointer( value.pDepthStencilAttachment );
+		ar.value( value.preserveAttachmentCount );
+		ar.array( value.pPreserveAttachments, value.preserveAttachmentCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkRenderPassCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.attachmentCount );
+		ar.array( value.pAttachments, value.attachmentCount );
+		ar.value( value.subpassCount );
+		ar.array( value.pSubpasses, value.subpassCount );
+		ar.value( value.dependencyCount );
+		ar.array( value.pDependencies, value.dependencyCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkRenderPassBeginInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.handle( value.renderPass );
+		ar.handle( value.framebuffer );
+		serialize( ar, value.renderArea );
+		ar.value( value.clearValueCount );
+		ar.array( value.pClearValues, value.clearValueCount );
+	}
+
+	//*********************************************************************************************
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkCommandPoolCreateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.value( value.queueFamilyIndex );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkCommandBufferAllocateInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.handle( value.commandPool );
+		ar.value( value.level );
+		ar.value( value.commandBufferCount );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkCommandBufferInheritanceInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.handle( value.renderPass );
+		ar.value( value.subpass );
+		ar.handle( value.framebuffer );
+		ar.value( value.occlusionQueryEnable );
+		ar.value( value.queryFlags );
+		ar.value( value.pipelineStatistics );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkCommandBufferBeginInfo & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.pointer( value.pInheritanceInfo );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkMemoryBarrier & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.srcAccessMask );
+		ar.value( value.dstAccessMask );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkBufferMemoryBarrier & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.srcAccessMask );
+		ar.value( value.dstAccessMask );
+		ar.value( value.srcQueueFamilyIndex );
+		ar.value( value.dstQueueFamilyIndex );
+		ar.handle( value.buffer );
+		ar.value( value.offset );
+		ar.value( value.size );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkImageMemoryBarrier & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.srcAccessMask );
+		ar.value( value.dstAccessMask );
+		ar.value( value.oldLayout );
+		ar.value( value.newLayout );
+		ar.value( value.srcQueueFamilyIndex );
+		ar.value( value.dstQueueFamilyIndex );
+		ar.handle( value.image );
+		serialize( ar, value.subresourceRange );
+	}
+
+	//*********************************************************************************************
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkSwapchainCreateInfoKHR & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.flags );
+		ar.handle( value.surface );
+		ar.value( value.minImageCount );
+		ar.value( value.imageFormat );
+		ar.value( value.imageColorSpace );
+		serialize( ar, value.imageExtent );
+		ar.value( value.imageArrayLayers );
+		ar.value( value.imageUsage );
+		ar.value( value.imageSharingMode );
+		ar.value( value.queueFamilyIndexCount );
+		ar.array( value.pQueueFamilyIndices, value.queueFamilyIndexCount );
+		ar.value( value.preTransform );
+		ar.value( value.compositeAlpha );
+		ar.value( value.presentMode );
+		ar.value( value.clipped );
+		ar.handle( value.oldSwapchain );
+	}
+
+	template< typename ArchiveT >
+	void serialize( ArchiveT & ar, VkPresentInfoKHR & value )
+	{
+		ar.value( value.sType );
+		ar.next( value.pNext );
+		ar.value( value.waitSemaphoreCount );
+		ar.handles( value.pWaitSemaphores, value.waitSemaphoreCount );
+		ar.value( value.swapchainCount );
+		ar.handles( value.pSwapchains, value.swapchainCount );
+		ar.array( value.pImageIndices, value.swapchainCount );
+		// pResults is an output, left to nullptr when decoding.
+	}
+}
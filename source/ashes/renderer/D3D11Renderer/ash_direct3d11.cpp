@@ -8,6 +8,8 @@
 
 #include "ashesd3d11_api.hpp"
 
+#include <renderer/RendererCommon/ProcAddrTable.hpp>
+
 #include <ashes/common/Exception.hpp>
 
 #include <cstring>
@@ -4287,6 +4289,20 @@ namespace ashes::d3d11
 	}
 
 #	endif
+#endif
+#pragma endregion
+#pragma region VK_EXT_headless_surface
+#ifdef VK_EXT_headless_surface
+
+	VkResult VKAPI_CALL vkCreateHeadlessSurfaceEXT(
+		VkInstance instance,
+		const VkHeadlessSurfaceCreateInfoEXT* pCreateInfo,
+		const VkAllocationCallbacks* pAllocator,
+		VkSurfaceKHR* pSurface )
+	{
+		return reportUnsupported( instance, "vkCreateHeadlessSurfaceEXT" );
+	}
+
 #endif
 #pragma endregion
 #pragma region VK_KHR_win32_surface
@@ -4476,97 +4492,77 @@ namespace ashes::d3d11
 			&& get( device )->hasExtension( extension.data() );
 	}
 
-	using InstanceFunctions = std::map< std::string, PFN_vkVoidFunction >;
-
 #pragma warning( push )
 #pragma warning( disable: 4191 )
 
-	InstanceFunctions const & getFunctions( VkInstance instance )
+	ProcAddrTable const & getFunctions( VkInstance instance )
 	{
-		static std::map< VkInstance, InstanceFunctions > functions;
+		static std::map< VkInstance, ProcAddrTable > functions;
 		auto it = functions.insert( { instance, {} } );
 
 		if ( it.second )
 		{
+			auto & table = it.first->second;
+
 			if ( instance != nullptr )
 			{
-				it.first->second =
-				{
 #define VK_LIB_GLOBAL_FUNCTION( v, x )\
-					{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+				table[ashesFunctionIndex( "vk"#x )] = checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_GLOBAL_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+				table[ashesFunctionIndex( "vk"#x )] = checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_INSTANCE_FUNCTION( v, x )\
-					{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+				table[ashesFunctionIndex( "vk"#x )] = checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_INSTANCE_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+				table[ashesFunctionIndex( "vk"#x )] = checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_DEVICE_FUNCTION( v, x )\
-					{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+				table[ashesFunctionIndex( "vk"#x )] = checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+				table[ashesFunctionIndex( "vk"#x )] = checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #include <ashes/ashes_functions_list.hpp>
-				};
 			}
 			else
 			{
-				it.first->second =
-				{
 #define VK_LIB_GLOBAL_FUNCTION( v, x )\
-					{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
+				table[ashesFunctionIndex( "vk"#x )] = PFN_vkVoidFunction( vk##x );
 #define VK_LIB_INSTANCE_FUNCTION( v, x )\
-					{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
+				table[ashesFunctionIndex( "vk"#x )] = PFN_vkVoidFunction( vk##x );
 #define VK_LIB_DEVICE_FUNCTION( v, x )\
-					{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
+				table[ashesFunctionIndex( "vk"#x )] = PFN_vkVoidFunction( vk##x );
 #define VK_LIB_GLOBAL_FUNCTION_EXT( v, n, x )
 #define VK_LIB_INSTANCE_FUNCTION_EXT( v, n, x )
 #define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )
 #include <ashes/ashes_functions_list.hpp>
-				};
 			}
 		}
 
 		return it.first->second;
 	}
 
+	ProcAddrTable makeDeviceFunctions( VkDevice device )
+	{
+		ProcAddrTable result{};
+		result[ashesFunctionIndex( "vkGetDeviceProcAddr" )] = PFN_vkVoidFunction( vkGetDeviceProcAddr );
+#define VK_LIB_DEVICE_FUNCTION( v, x )\
+		result[ashesFunctionIndex( "vk"#x )] = checkVersion( device, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
+#define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
+		result[ashesFunctionIndex( "vk"#x )] = checkVersionExt( device, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
+#include <ashes/ashes_functions_list.hpp>
+		return result;
+	}
+
 	PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(
 		VkInstance instance,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		auto & functions = getFunctions( instance );
-		auto it = functions.find( pName );
-
-		if ( it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		return getProcAddr( getFunctions( instance ), pName );
 	}
 
 	PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(
 		VkDevice device,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		static std::map< std::string, PFN_vkVoidFunction > functions
-		{
-			{ "vkGetDeviceProcAddr", PFN_vkVoidFunction( vkGetDeviceProcAddr ) },
-#define VK_LIB_DEVICE_FUNCTION( v, x )\
-			{ "vk"#x, checkVersion( device, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-			{ "vk"#x, checkVersionExt( device, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#include <ashes/ashes_functions_list.hpp>
-		};
-
-		auto it = functions.find( pName );
-
-		if ( it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		static ProcAddrTable const functions = makeDeviceFunctions( device );
+		return getProcAddr( functions, pName );
 	}
 
 #pragma warning( pop )
@@ -2706,6 +2706,17 @@ namespace ashes::d3d11
 		struct wl_display * display );
 
 #	endif
+#endif
+#pragma endregion
+#pragma region VK_EXT_headless_surface
+#ifdef VK_EXT_headless_surface
+
+	VkResult VKAPI_CALL vkCreateHeadlessSurfaceEXT(
+		VkInstance instance,
+		const VkHeadlessSurfaceCreateInfoEXT * pCreateInfo,
+		const VkAllocationCallbacks * pAllocator,
+		VkSurfaceKHR * pSurface );
+
 #endif
 #pragma endregion
 #pragma region VK_KHR_win32_surface
@@ -250,6 +250,7 @@ namespace ashes::gl
 			, glGenVertexArrays
 			, 1
 			, &m_vao );
+		RendererStatistics::addVertexArray();
 
 		if ( m_vao == GL_INVALID_INDEX )
 		{
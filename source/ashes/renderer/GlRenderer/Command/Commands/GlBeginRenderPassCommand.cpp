@@ -17,6 +17,25 @@ namespace ashes::gl
 {
 	namespace
 	{
+		void invalidateAttach( FboAttachment attach
+			, VkAttachmentReference const & reference
+			, VkRenderPass renderPass
+			, CmdList & list )
+		{
+			// The previous contents of DONT_CARE attachments need not be loaded.
+			auto & attachDesc = get( renderPass )->getAttachment( reference );
+			auto point = getInvalidatedPoint( attach
+				, 0u
+				, attachDesc.loadOp == VK_ATTACHMENT_LOAD_OP_DONT_CARE
+				, attachDesc.stencilLoadOp == VK_ATTACHMENT_LOAD_OP_DONT_CARE );
+
+			if ( point )
+			{
+				list.push_back( makeCmd< OpType::eInvalidateFramebuffer >( GL_FRAMEBUFFER
+					, *point ) );
+			}
+		}
+
 		void clearAttach( FboAttachment attach
 			, VkAttachmentReference const & reference
 			, VkRenderPass renderPass
@@ -117,6 +136,7 @@ namespace ashes::gl
 				if ( attach.point )
 				{
 					attach.bindDraw( stack, 0u, GL_FRAMEBUFFER, list );
+					invalidateAttach( attach, reference, renderPass, list );
 					clearAttach( attach, reference, renderPass, rtClearValues, dsClearValue, list, clearIndex );
 				}
 			}
@@ -56,6 +56,161 @@ namespace ashes::gl
 			result.imageSubresource = copyInfo.dstSubresource;
 			return result;
 		}
+
+		bool isBlitKernelFormat( VkFormat format )
+		{
+			return !isDepthOrStencilFormat( format )
+				&& !isSIntFormat( format )
+				&& !isUIntFormat( format );
+		}
+
+		bool canUseBlitKernel( VkDevice device
+			, VkImage srcImage
+			, VkImage dstImage
+			, VkImageBlit const & region )
+		{
+			auto dim = getKernelDim( get( srcImage )->getTarget() );
+			return get( device )->getTransferKernels().isAvailable()
+				&& dim == getKernelDim( get( dstImage )->getTarget() )
+				&& ( dim == TransferKernelDim::e3D
+					|| ( dim == TransferKernelDim::e2DArray && region.dstSubresource.layerCount > 1u ) )
+				&& region.srcSubresource.layerCount == region.dstSubresource.layerCount
+				&& isBlitKernelFormat( get( srcImage )->getFormatVk() )
+				&& isBlitKernelFormat( get( dstImage )->getFormatVk() )
+				&& isKernelStorageFormat( get( dstImage )->getFormatVk() )
+				&& get( srcImage )->getSamples() == VK_SAMPLE_COUNT_1_BIT
+				&& get( dstImage )->getSamples() == VK_SAMPLE_COUNT_1_BIT;
+		}
+
+		void blitImageKernel( VkDevice device
+			, VkImage srcImage
+			, VkImage dstImage
+			, VkImageBlit const & region
+			, VkFilter filter
+			, CmdList & list )
+		{
+			auto & kernels = get( device )->getTransferKernels();
+			auto dim = getKernelDim( get( srcImage )->getTarget() );
+			auto & dst0 = region.dstOffsets[0];
+			auto & dst1 = region.dstOffsets[1];
+			auto depth = dim == TransferKernelDim::e3D
+				? uint32_t( std::abs( dst1.z - dst0.z ) )
+				: region.dstSubresource.layerCount;
+			float srcOffset0[4]{ float( region.srcOffsets[0].x )
+				, float( region.srcOffsets[0].y )
+				, float( region.srcOffsets[0].z )
+				, 0.0f };
+			float srcOffset1[4]{ float( region.srcOffsets[1].x )
+				, float( region.srcOffsets[1].y )
+				, float( region.srcOffsets[1].z )
+				, 0.0f };
+			int32_t dstOffset0[4]{ dst0.x, dst0.y, dst0.z, 0 };
+			int32_t dstOffset1[4]{ dst1.x, dst1.y, dst1.z, 0 };
+			int32_t dstMin[4]{ std::min( dst0.x, dst1.x )
+				, std::min( dst0.y, dst1.y )
+				, dim == TransferKernelDim::e3D ? std::min( dst0.z, dst1.z ) : 0
+				, int32_t( region.srcSubresource.mipLevel ) };
+			int32_t extent[4]{ std::abs( dst1.x - dst0.x )
+				, std::abs( dst1.y - dst0.y )
+				, int32_t( depth )
+				, 0 };
+			int32_t layers[4]{ int32_t( region.srcSubresource.baseArrayLayer )
+				, int32_t( region.dstSubresource.baseArrayLayer )
+				, 0
+				, 0 };
+			list.push_back( makeCmd< OpType::eUseTransferKernel >( makeKernelId( { TransferKernelType::eBlitImage
+				, dim
+				, dim
+				, 0u } ) ) );
+			list.push_back( makeCmd< OpType::eActiveTexture >( kernels.getTextureUnit() ) );
+			list.push_back( makeCmd< OpType::eBindTexture >( get( srcImage )->getTarget()
+				, get( srcImage )->getInternal() ) );
+			list.push_back( makeCmd< OpType::eBindSampler >( kernels.getTextureUnit()
+				, kernels.getSampler( filter ) ) );
+			list.push_back( makeCmd< OpType::eBindImage >( kernels.getDstImageUnit()
+				, get( dstImage )->getInternal()
+				, region.dstSubresource.mipLevel
+				, 1u
+				, 0u
+				, get( dstImage )->getInternalFormat() ) );
+			list.push_back( makeCmd< OpType::eUniform4fv >( 0u, srcOffset0 ) );
+			list.push_back( makeCmd< OpType::eUniform4fv >( 1u, srcOffset1 ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 2u, dstOffset0 ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 3u, dstOffset1 ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 4u, dstMin ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 5u, extent ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 6u, layers ) );
+			list.push_back( makeCmd< OpType::eDispatch >( TransferKernels::getGroupCount( uint32_t( extent[0] ) )
+				, TransferKernels::getGroupCount( uint32_t( extent[1] ) )
+				, depth ) );
+			list.push_back( makeCmd< OpType::eMemoryBarrier >( GL_MEMORY_BARRIER_ALL ) );
+			list.push_back( makeCmd< OpType::eBindSampler >( kernels.getTextureUnit()
+				, 0u ) );
+			list.push_back( makeCmd< OpType::eBindTexture >( get( srcImage )->getTarget()
+				, 0u ) );
+			// Transfer kernels are only available with program pipelines, the bound one takes over again.
+			list.push_back( makeCmd< OpType::eUseProgram >( 0u ) );
+		}
+
+		void buildFramebufferBlit( ContextStateStack & stack
+			, VkDevice device
+			, VkImage srcImage
+			, VkImage dstImage
+			, VkImageBlit const & region
+			, VkFilter filter
+			, CmdList & list )
+		{
+			auto srcLayerCount = region.srcSubresource.layerCount;
+			auto dstLayerCount = region.dstSubresource.layerCount;
+			auto srcSliceCount = region.srcOffsets[1].z;
+			auto dstSliceCount = region.dstOffsets[1].z;
+			float sliceRatio = float( srcSliceCount ) / float( dstSliceCount );
+			auto layerCount = std::max( std::max( srcLayerCount, dstLayerCount )
+				, uint32_t( std::min( srcSliceCount, dstSliceCount ) ) );
+			auto srcBaseArrayLayer = region.srcSubresource.baseArrayLayer;
+			auto dstBaseArrayLayer = region.dstSubresource.baseArrayLayer;
+			auto srcBaseSlice = region.srcOffsets[0].z;
+			auto dstBaseSlice = region.dstOffsets[0].z;
+
+			for ( uint32_t layer = 0u; layer < layerCount; ++layer )
+			{
+				LayerCopy layerCopy{ device
+					, region
+					, srcImage
+					, dstImage };
+
+				layerCopy.bindSrc( stack
+					, srcBaseArrayLayer + layer
+					, uint32_t( float( srcBaseSlice + layer ) * sliceRatio )
+					, GL_READ_FRAMEBUFFER
+					, list );
+				layerCopy.bindDst( stack
+					, dstBaseArrayLayer + layer
+					, dstBaseSlice + layer
+					, GL_DRAW_FRAMEBUFFER
+					, list );
+				list.push_back( makeCmd< OpType::eBlitFramebuffer >( layerCopy.region.srcOffsets[0].x
+					, layerCopy.region.srcOffsets[0].y
+					, layerCopy.region.srcOffsets[1].x
+					, layerCopy.region.srcOffsets[1].y
+					, layerCopy.region.dstOffsets[0].x
+					, layerCopy.region.dstOffsets[0].y
+					, layerCopy.region.dstOffsets[1].x
+					, layerCopy.region.dstOffsets[1].y
+					, getMask( get( srcImage )->getFormatVk() )
+					, convert( filter ) ) );
+			}
+
+			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
+				, nullptr ) );
+			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_DRAW_FRAMEBUFFER
+				, nullptr ) );
+
+			if ( stack.hasCurrentFramebuffer() )
+			{
+				stack.setCurrentFramebuffer( nullptr );
+			}
+		}
 	}
 
 	void buildBlitImageCommand( ContextStateStack & stack
@@ -71,56 +226,24 @@ namespace ashes::gl
 			|| region.srcSubresource.layerCount == uint32_t( region.dstOffsets[1].z )
 			|| region.dstSubresource.layerCount == uint32_t( region.srcOffsets[1].z ) );
 
-		auto srcLayerCount = region.srcSubresource.layerCount;
-		auto dstLayerCount = region.dstSubresource.layerCount;
-		auto srcSliceCount = region.srcOffsets[1].z;
-		auto dstSliceCount = region.dstOffsets[1].z;
-		float sliceRatio = float( srcSliceCount ) / float( dstSliceCount );
-		auto layerCount = std::max( std::max( srcLayerCount, dstLayerCount )
-			, uint32_t( std::min( srcSliceCount, dstSliceCount ) ) );
-		auto srcBaseArrayLayer = region.srcSubresource.baseArrayLayer;
-		auto dstBaseArrayLayer = region.dstSubresource.baseArrayLayer;
-		auto srcBaseSlice = region.srcOffsets[0].z;
-		auto dstBaseSlice = region.dstOffsets[0].z;
-
-		for ( uint32_t layer = 0u; layer < layerCount; ++layer )
+		if ( canUseBlitKernel( device, srcImage, dstImage, region ) )
 		{
-			LayerCopy layerCopy{ device
-				, region
+			blitImageKernel( device
 				, srcImage
-				, dstImage };
-
-			list.push_back( makeCmd< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER ) );
-			layerCopy.bindSrc( stack
-				, srcBaseArrayLayer + layer
-				, uint32_t( float( srcBaseSlice + layer ) * sliceRatio )
-				, GL_READ_FRAMEBUFFER
+				, dstImage
+				, region
+				, filter
 				, list );
-			list.push_back( makeCmd< OpType::eBindDstFramebuffer >( GL_DRAW_FRAMEBUFFER ) );
-			layerCopy.bindDst( stack
-				, dstBaseArrayLayer + layer
-				, dstBaseSlice + layer
-				, GL_DRAW_FRAMEBUFFER
+		}
+		else
+		{
+			buildFramebufferBlit( stack
+				, device
+				, srcImage
+				, dstImage
+				, region
+				, filter
 				, list );
-			list.push_back( makeCmd< OpType::eBlitFramebuffer >( layerCopy.region.srcOffsets[0].x
-				, layerCopy.region.srcOffsets[0].y
-				, layerCopy.region.srcOffsets[1].x
-				, layerCopy.region.srcOffsets[1].y
-				, layerCopy.region.dstOffsets[0].x
-				, layerCopy.region.dstOffsets[0].y
-				, layerCopy.region.dstOffsets[1].x
-				, layerCopy.region.dstOffsets[1].y
-				, getMask( get( srcImage )->getFormatVk() )
-				, convert( filter ) ) );
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
-				, nullptr ) );
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_DRAW_FRAMEBUFFER
-				, nullptr ) );
-
-			if ( stack.hasCurrentFramebuffer() )
-			{
-				stack.setCurrentFramebuffer( nullptr );
-			}
 		}
 
 		if ( get( get( dstImage )->getMemoryBinding().getParent() )->getInternal() != GL_INVALID_INDEX )
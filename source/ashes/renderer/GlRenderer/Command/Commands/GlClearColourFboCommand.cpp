@@ -33,7 +33,6 @@ namespace ashes::gl
 		}
 
 		bool hadFbo = stack.hasCurrentFramebuffer();
-		list.push_back( makeCmd< OpType::eBindDstFramebuffer >( GL_FRAMEBUFFER ) );
 		auto point = getAttachmentPoint( glimage.getFormatVk() );
 
 		for ( auto range : ranges )
@@ -45,7 +44,7 @@ namespace ashes::gl
 
 			if ( range.layerCount == RemainingArrayLayers )
 			{
-				range.layerCount = get( device )->getLimits().maxImageArrayLayers;
+				range.layerCount = glimage.getArrayLayers() - range.baseArrayLayer;
 			}
 
 			for ( auto level = range.baseMipLevel; level < range.baseMipLevel + range.levelCount; ++level )
@@ -54,24 +53,24 @@ namespace ashes::gl
 				{
 					for ( auto layer = range.baseArrayLayer; layer < range.baseArrayLayer + range.layerCount; ++layer )
 					{
-						list.push_back( makeCmd< OpType::eFramebufferTextureLayer >( GL_FRAMEBUFFER
+						list.push_back( makeCmd< OpType::eBindCachedFramebuffer >( GL_FRAMEBUFFER
 							, point
-							, get( image )->getInternal()
+							, glimage.getTarget()
+							, glimage.getInternal()
 							, level
 							, layer ) );
-						list.push_back( makeCmd< OpType::eDrawBuffers >( point ) );
 						list.push_back( makeCmd< OpType::eClearColour >( value
 							, 0u ) );
 					}
 				}
 				else
 				{
-					list.push_back( makeCmd< OpType::eFramebufferTexture2D >( GL_FRAMEBUFFER
+					list.push_back( makeCmd< OpType::eBindCachedFramebuffer >( GL_FRAMEBUFFER
 						, point
 						, target
-						, get( image )->getInternal()
-						, level ) );
-					list.push_back( makeCmd< OpType::eDrawBuffers >( point ) );
+						, glimage.getInternal()
+						, level
+						, 0u ) );
 					list.push_back( makeCmd< OpType::eClearColour >( value
 						, 0u ) );
 				}
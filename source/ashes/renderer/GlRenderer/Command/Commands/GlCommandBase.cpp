@@ -6,7 +6,11 @@ See LICENSE file in root folder.
 
 #include "Core/GlContextLock.hpp"
 #include "Miscellaneous/GlDeviceMemory.hpp"
+#include "Miscellaneous/GlGpuProfiler.hpp"
+#include "Miscellaneous/GlQueryPool.hpp"
 #include "RenderPass/GlFrameBuffer.hpp"
+#include "RenderPass/GlFramebufferCache.hpp"
+#include "Shader/GlTransferKernels.hpp"
 
 #include "ashesgl_api.hpp"
 
@@ -82,6 +86,53 @@ namespace ashes::gl
 			, cmd.viewports.data() );
 	}
 
+	void apply( ContextLock const & context
+		, CmdBeginConditionalRenderBuffer const & cmd )
+	{
+		auto query = get( context.getDevice() )->getQueryResultLinks().find( cmd.buffer
+			, cmd.offset );
+
+		if ( query != GL_INVALID_INDEX )
+		{
+			// The predicate still holds this occlusion query's result, GL evaluates it without any readback.
+			context->setConditionalQuery( query, cmd.inverted != 0u );
+			glLogCall( context
+				, glBeginConditionalRender
+				, query
+				, ( cmd.inverted
+					? GL_CONDITIONAL_RENDER_QUERY_WAIT_INVERTED
+					: GL_CONDITIONAL_RENDER_QUERY_WAIT ) );
+			return;
+		}
+
+		// Otherwise the predicate is read back, and the device's never passing query
+		// is used to discard (or not) the draws and clears.
+		uint32_t value{};
+		glLogCall( context
+			, glBindBuffer
+			, GL_BUFFER_TARGET_COPY_READ
+			, cmd.buffer );
+		glLogCall( context
+			, glGetBufferSubData
+			, GL_BUFFER_TARGET_COPY_READ
+			, GLintptr( cmd.offset )
+			, GLsizeiptr( sizeof( uint32_t ) )
+			, &value );
+		glLogCall( context
+			, glBindBuffer
+			, GL_BUFFER_TARGET_COPY_READ
+			, 0u );
+		auto discard = ( value == 0u ) != ( cmd.inverted != 0u );
+		// GL conditional rendering doesn't apply to compute dispatches, they check this instead.
+		context->setConditionalDiscard( discard );
+		glLogCall( context
+			, glBeginConditionalRender
+			, get( context.getDevice() )->getNeverPassingQuery()
+			, ( discard
+				? GL_CONDITIONAL_RENDER_QUERY_WAIT
+				: GL_CONDITIONAL_RENDER_QUERY_WAIT_INVERTED ) );
+	}
+
 	void apply( ContextLock const & context
 		, CmdBeginQuery const & cmd )
 	{
@@ -138,37 +189,15 @@ namespace ashes::gl
 	}
 
 	void apply( ContextLock const & context
-		, CmdBindSrcFramebuffer const & cmd )
-	{
-		if ( get( get( context.getDevice() )->getBlitSrcFbo() )->getInternal() == GL_INVALID_INDEX )
-		{
-			glLogCall( context
-				, glGenFramebuffers
-				, 1
-				, &get( get( context.getDevice() )->getBlitSrcFbo() )->getInternal() );
-		}
-
-		glLogCall( context
-			, glBindFramebuffer
-			, cmd.target
-			, get( get( context.getDevice() )->getBlitSrcFbo() )->getInternal() );
-	}
-
-	void apply( ContextLock const & context
-		, CmdBindDstFramebuffer const & cmd )
+		, CmdBindCachedFramebuffer const & cmd )
 	{
-		if ( get( get( context.getDevice() )->getBlitDstFbo() )->getInternal() == GL_INVALID_INDEX )
-		{
-			glLogCall( context
-				, glGenFramebuffers
-				, 1
-				, &get( get( context.getDevice() )->getBlitDstFbo() )->getInternal() );
-		}
-
-		glLogCall( context
-			, glBindFramebuffer
+		get( context.getDevice() )->getFramebufferCache().bind( context
 			, cmd.target
-			, get( get( context.getDevice() )->getBlitDstFbo() )->getInternal() );
+			, FboCacheKey{ cmd.object
+				, cmd.texTarget
+				, cmd.point
+				, cmd.mipLevel
+				, cmd.layer } );
 	}
 
 	void apply( ContextLock const & context
@@ -608,9 +637,34 @@ namespace ashes::gl
 			, cmd.value );
 	}
 
+	namespace
+	{
+		// GL conditional rendering doesn't apply to compute dispatches, they check the predicate themselves.
+		bool isConditionallyDiscarded( ContextLock const & context )
+		{
+			if ( auto query = context->getConditionalQuery() )
+			{
+				GLuint value{};
+				glLogCall( context
+					, glGetQueryObjectuiv
+					, query
+					, GL_QUERY_RESULT
+					, &value );
+				context->setConditionalDiscard( ( value == 0u ) != context->isConditionalInverted() );
+			}
+
+			return context->isConditionalDiscard();
+		}
+	}
+
 	void apply( ContextLock const & context
 		, CmdDispatch const & cmd )
 	{
+		if ( isConditionallyDiscarded( context ) )
+		{
+			return;
+		}
+
 		glLogCall( context
 			, glDispatchCompute
 			, cmd.groupCountX
@@ -621,6 +675,11 @@ namespace ashes::gl
 	void apply( ContextLock const & context
 		, CmdDispatchIndirect const & cmd )
 	{
+		if ( isConditionallyDiscarded( context ) )
+		{
+			return;
+		}
+
 		glLogCall( context
 			, glDispatchComputeIndirect
 			, GLintptr( getBufferOffset( intptr_t( cmd.offset ) ) ) );
@@ -732,6 +791,14 @@ namespace ashes::gl
 			, cmd.value );
 	}
 
+	void apply( ContextLock const & context
+		, CmdEndConditionalRender const & cmd )
+	{
+		context->setConditionalDiscard( false );
+		glLogEmptyCall( context
+			, glEndConditionalRender );
+	}
+
 	void apply( ContextLock const & context
 		, CmdEndQuery const & cmd )
 	{
@@ -842,13 +909,46 @@ namespace ashes::gl
 	void apply( ContextLock const & context
 		, CmdGetQueryResults const & cmd )
 	{
-		get( cmd.queryPool )->getResults( context
+		get( cmd.queryPool )->copyResults( context
 			, cmd.firstQuery
 			, cmd.queryCount
 			, cmd.stride
-			, 0u
 			, cmd.flags
-			, getBufferOffset( intptr_t( cmd.bufferOffset ) ) );
+			, cmd.bufferOffset );
+
+		if ( !cmd.queryCount )
+		{
+			return;
+		}
+
+		auto & links = get( context.getDevice() )->getQueryResultLinks();
+		auto buffer = get( cmd.memory )->getInternal();
+		// Any link in the written range is stale, the last query's values end it.
+		VkDeviceSize valueSize = checkFlag( cmd.flags, VK_QUERY_RESULT_64_BIT )
+			? sizeof( uint64_t )
+			: sizeof( uint32_t );
+		VkDeviceSize valueCount = ( get( cmd.queryPool )->getType() == VK_QUERY_TYPE_PIPELINE_STATISTICS
+				? get( cmd.queryPool )->getTypes().size()
+				: 1u )
+			+ ( checkFlag( cmd.flags, VK_QUERY_RESULT_WITH_AVAILABILITY_BIT ) ? 1u : 0u );
+		VkDeviceSize lastSize = valueSize * valueCount;
+		links.unlink( buffer
+			, cmd.bufferOffset
+			, ( cmd.queryCount - 1u ) * cmd.stride + lastSize );
+
+		// Without waiting, an unavailable result isn't written, and partial results
+		// may differ from the final ones, so only the waited full results are linked.
+		if ( get( cmd.queryPool )->getType() == VK_QUERY_TYPE_OCCLUSION
+			&& checkFlag( cmd.flags, VK_QUERY_RESULT_WAIT_BIT )
+			&& !checkFlag( cmd.flags, VK_QUERY_RESULT_PARTIAL_BIT ) )
+		{
+			for ( uint32_t query = 0u; query < cmd.queryCount; ++query )
+			{
+				links.link( buffer
+					, cmd.bufferOffset + query * cmd.stride
+					, *( get( cmd.queryPool )->begin() + cmd.firstQuery + query ) );
+			}
+		}
 	}
 
 	void apply( ContextLock const & context
@@ -863,6 +963,19 @@ namespace ashes::gl
 			, getBufferOffset( cmd.offset ) );
 	}
 
+	void apply( ContextLock const & context
+		, CmdInvalidateFramebuffer const & cmd )
+	{
+		if ( context->hasInvalidateFramebuffer() )
+		{
+			glLogCall( context
+				, glInvalidateFramebuffer
+				, cmd.target
+				, GLsizei( cmd.count )
+				, cmd.points.data() );
+		}
+	}
+
 	void apply( ContextLock const & context
 		, CmdLineWidth const & cmd )
 	{
@@ -941,6 +1054,11 @@ namespace ashes::gl
 	void apply( ContextLock const & context
 		, CmdPopDebugGroup const & cmd )
 	{
+		if ( GpuProfiler::isEnabled() )
+		{
+			GpuProfiler::endGpuRegion( context );
+		}
+
 		glLogEmptyCall( context
 			, glPopDebugGroup );
 		popDebugBlock();
@@ -1134,6 +1252,10 @@ namespace ashes::gl
 			, cmd.length
 			, cmd.message );
 
+		if ( GpuProfiler::isEnabled() )
+		{
+			GpuProfiler::beginGpuRegion( context, "label", cmd.message );
+		}
 	}
 
 	void apply( ContextLock const & context
@@ -1430,9 +1552,29 @@ namespace ashes::gl
 			, cmd.buffer );
 	}
 
+	void apply( ContextLock const & context
+		, CmdUnlinkQueries const & cmd )
+	{
+		get( context.getDevice() )->getQueryResultLinks().unlinkQueries( &*( get( cmd.queryPool )->begin() + cmd.firstQuery )
+			, cmd.queryCount );
+	}
+
+	void apply( ContextLock const & context
+		, CmdUnlinkQueryResults const & cmd )
+	{
+		get( context.getDevice() )->getQueryResultLinks().unlink( ( cmd.memory
+				? get( cmd.memory )->getInternal()
+				: 0u )
+			, cmd.offset
+			, cmd.size );
+	}
+
 	void apply( ContextLock const & context
 		, CmdUpdateBuffer const & cmd )
 	{
+		get( context.getDevice() )->getQueryResultLinks().unlink( get( cmd.memory )->getInternal()
+			, cmd.memoryOffset
+			, cmd.dataSize );
 		glLogCall( context
 			, glBindBuffer
 			, GL_BUFFER_TARGET_COPY_WRITE
@@ -1473,6 +1615,13 @@ namespace ashes::gl
 			, cmd.program );
 	}
 
+	void apply( ContextLock const & context
+		, CmdUseTransferKernel const & cmd )
+	{
+		get( context.getDevice() )->getTransferKernels().use( context
+			, cmd.kernelId );
+	}
+
 	void apply( ContextLock const & context
 		, CmdWaitEvents const & cmd )
 	{
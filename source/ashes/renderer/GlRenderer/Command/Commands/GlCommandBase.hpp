@@ -27,13 +27,13 @@ namespace ashes::gl
 		eApplyScissors,
 		eApplyViewport,
 		eApplyViewports,
+		eBeginConditionalRenderBuffer,
 		eBeginQuery,
 		eBindBuffer,
 		eBindBufferRange,
 		eBindContextState,
 		eBindFramebuffer,
-		eBindSrcFramebuffer,
-		eBindDstFramebuffer,
+		eBindCachedFramebuffer,
 		eBindImage,
 		eBindSampler,
 		eBindTexture,
@@ -83,6 +83,7 @@ namespace ashes::gl
 		eDrawIndexedIndirect,
 		eDrawIndirect,
 		eEnable,
+		eEndConditionalRender,
 		eEndQuery,
 		eFillBuffer,
 		eFramebufferTexture,
@@ -95,6 +96,7 @@ namespace ashes::gl
 		eGetCompressedTexImage,
 		eGetQueryResults,
 		eGetTexImage,
+		eInvalidateFramebuffer,
 		eLineWidth,
 		eLogCommand,
 		eLogicOp,
@@ -150,12 +152,16 @@ namespace ashes::gl
 		eUniformMatrix2fv,
 		eUniformMatrix3fv,
 		eUniformMatrix4fv,
+		eUnlinkQueries,
+		eUnlinkQueryResults,
 		eUpdateBuffer,
 		eUploadMemory,
 		eUseProgram,
 		eUseProgramPipeline,
+		eUseTransferKernel,
 		eWaitEvents,
 		eWriteTimestamp,
+		eCount,
 	};
 
 	struct Op
@@ -446,6 +452,31 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBeginConditionalRenderBuffer >
+	{
+		inline CmdT( uint32_t buffer
+			, VkDeviceSize offset
+			, bool inverted )
+			: cmd{ { OpType::eBeginConditionalRenderBuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, buffer{ std::move( buffer ) }
+			, inverted{ inverted ? 1u : 0u }
+			, offset{ std::move( offset ) }
+		{
+		}
+
+		Command cmd;
+		uint32_t buffer;
+		uint32_t inverted;
+		VkDeviceSize offset;
+	};
+	using CmdBeginConditionalRenderBuffer = CmdT< OpType::eBeginConditionalRenderBuffer >;
+
+	void apply( ContextLock const & context
+		, CmdBeginConditionalRenderBuffer const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eBeginQuery >
 	{
@@ -513,40 +544,36 @@ namespace ashes::gl
 	//*************************************************************************
 
 	template<>
-	struct alignas( uint64_t ) CmdT< OpType::eBindSrcFramebuffer >
+	struct alignas( uint64_t ) CmdT< OpType::eBindCachedFramebuffer >
 	{
-		inline CmdT( GlFrameBufferTarget target )
-			: cmd{ { OpType::eBindSrcFramebuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
-			, target{ std::move( target ) }
-		{
-		}
-
-		Command cmd;
-		GlFrameBufferTarget target;
-	};
-	using CmdBindSrcFramebuffer = CmdT< OpType::eBindSrcFramebuffer >;
-
-	void apply( ContextLock const & context
-		, CmdBindSrcFramebuffer const & cmd );
-
-	//*************************************************************************
-
-	template<>
-	struct alignas( uint64_t ) CmdT< OpType::eBindDstFramebuffer >
-	{
-		inline CmdT( GlFrameBufferTarget target )
-			: cmd{ { OpType::eBindDstFramebuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
+		inline CmdT( GlFrameBufferTarget target
+			, GlAttachmentPoint point
+			, GlTextureType texTarget
+			, uint32_t object
+			, uint32_t mipLevel
+			, uint32_t layer )
+			: cmd{ { OpType::eBindCachedFramebuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
 			, target{ std::move( target ) }
+			, point{ std::move( point ) }
+			, texTarget{ std::move( texTarget ) }
+			, object{ std::move( object ) }
+			, mipLevel{ std::move( mipLevel ) }
+			, layer{ std::move( layer ) }
 		{
 		}
 
 		Command cmd;
 		GlFrameBufferTarget target;
+		GlAttachmentPoint point;
+		GlTextureType texTarget;
+		uint32_t object;
+		uint32_t mipLevel;
+		uint32_t layer;
 	};
-	using CmdBindDstFramebuffer = CmdT< OpType::eBindDstFramebuffer >;
+	using CmdBindCachedFramebuffer = CmdT< OpType::eBindCachedFramebuffer >;
 
 	void apply( ContextLock const & context
-		, CmdBindDstFramebuffer const & cmd );
+		, CmdBindCachedFramebuffer const & cmd );
 
 	//*************************************************************************
 
@@ -1973,6 +2000,23 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eEndConditionalRender >
+	{
+		inline CmdT()
+			: cmd{ { OpType::eEndConditionalRender, sizeof( CmdT ) / sizeof( uint32_t ) } }
+		{
+		}
+
+		Command cmd;
+	};
+	using CmdEndConditionalRender = CmdT< OpType::eEndConditionalRender >;
+
+	void apply( ContextLock const & context
+		, CmdEndConditionalRender const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eEndQuery >
 	{
@@ -2246,6 +2290,7 @@ namespace ashes::gl
 			, uint32_t queryCount
 			, VkDeviceSize stride
 			, VkQueryResultFlags flags
+			, VkDeviceMemory memory
 			, VkDeviceSize bufferOffset )
 			: cmd{ { OpType::eGetQueryResults, sizeof( CmdT ) / sizeof( uint32_t ) } }
 			, queryPool{ queryPool }
@@ -2253,6 +2298,7 @@ namespace ashes::gl
 			, queryCount{ queryCount }
 			, stride{ stride }
 			, flags{ flags }
+			, memory{ memory }
 			, bufferOffset{ bufferOffset }
 		{
 		}
@@ -2263,6 +2309,7 @@ namespace ashes::gl
 		uint32_t queryCount;
 		VkDeviceSize stride;
 		VkQueryResultFlags flags;
+		VkDeviceMemory memory;
 		VkDeviceSize bufferOffset;
 	};
 	using CmdGetQueryResults = CmdT< OpType::eGetQueryResults >;
@@ -2303,6 +2350,43 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eInvalidateFramebuffer >
+	{
+		static uint32_t constexpr MaxElems = 18u;
+
+		inline CmdT( GlFrameBufferTarget target
+			, GlAttachmentPoint point )
+			: cmd{ { OpType::eInvalidateFramebuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, target{ std::move( target ) }
+			, count{ 1u }
+		{
+			points[0] = point;
+		}
+
+		inline CmdT( GlFrameBufferTarget target
+			, std::vector< GlAttachmentPoint > const & points )
+			: cmd{ { OpType::eInvalidateFramebuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, target{ std::move( target ) }
+			, count{ std::min( MaxElems, uint32_t( points.size() ) ) }
+		{
+			std::copy( points.begin()
+				, points.begin() + count
+				, this->points.begin() );
+		}
+
+		Command cmd;
+		GlFrameBufferTarget target;
+		uint32_t count;
+		std::array< GlAttachmentPoint, MaxElems > points{ GlAttachmentPoint( 0u ) };
+	};
+	using CmdInvalidateFramebuffer = CmdT< OpType::eInvalidateFramebuffer >;
+
+	void apply( ContextLock const & context
+		, CmdInvalidateFramebuffer const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eLineWidth >
 	{
@@ -3674,6 +3758,57 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eUnlinkQueries >
+	{
+		inline CmdT( VkQueryPool queryPool
+			, uint32_t firstQuery
+			, uint32_t queryCount )
+			: cmd{ { OpType::eUnlinkQueries, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, queryPool{ queryPool }
+			, firstQuery{ firstQuery }
+			, queryCount{ queryCount }
+		{
+		}
+
+		Command cmd;
+		VkQueryPool queryPool;
+		uint32_t firstQuery;
+		uint32_t queryCount;
+	};
+	using CmdUnlinkQueries = CmdT< OpType::eUnlinkQueries >;
+
+	void apply( ContextLock const & context
+		, CmdUnlinkQueries const & cmd );
+
+	//*************************************************************************
+
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eUnlinkQueryResults >
+	{
+		inline CmdT( VkDeviceMemory memory
+			, VkDeviceSize offset
+			, VkDeviceSize size )
+			: cmd{ { OpType::eUnlinkQueryResults, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, memory{ memory }
+			, offset{ offset }
+			, size{ size }
+		{
+		}
+
+		Command cmd;
+		// VK_NULL_HANDLE for all memories.
+		VkDeviceMemory memory;
+		VkDeviceSize offset;
+		VkDeviceSize size;
+	};
+	using CmdUnlinkQueryResults = CmdT< OpType::eUnlinkQueryResults >;
+
+	void apply( ContextLock const & context
+		, CmdUnlinkQueryResults const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eUpdateBuffer >
 	{
@@ -3765,6 +3900,25 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eUseTransferKernel >
+	{
+		inline CmdT( uint32_t kernelId )
+			: cmd{ { OpType::eUseTransferKernel, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, kernelId{ std::move( kernelId ) }
+		{
+		}
+
+		Command cmd;
+		uint32_t kernelId;
+	};
+	using CmdUseTransferKernel = CmdT< OpType::eUseTransferKernel >;
+
+	void apply( ContextLock const & context
+		, CmdUseTransferKernel const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eWaitEvents >
 	{
@@ -34,6 +34,9 @@ namespace ashes::gl
 				, get( dst )->getMemoryBinding().getSize() );
 		}
 
+		list.push_back( makeCmd< OpType::eUnlinkQueryResults >( get( dst )->getMemoryBinding().getParent()
+			, copyInfo.dstOffset
+			, copyInfo.size ) );
 		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
 			, get( src )->getInternal() ) );
 		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
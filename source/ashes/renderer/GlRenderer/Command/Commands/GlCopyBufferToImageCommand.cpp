@@ -133,6 +133,24 @@ namespace ashes::gl
 		}
 		else
 		{
+			// GL reads the rows with the buffer's own pitch, no repacking is needed.
+			auto rowLength = ( copyInfo.bufferRowLength == copyInfo.imageExtent.width )
+				? 0u
+				: copyInfo.bufferRowLength;
+			auto imageHeight = ( copyInfo.bufferImageHeight == copyInfo.imageExtent.height )
+				? 0u
+				: copyInfo.bufferImageHeight;
+
+			if ( rowLength )
+			{
+				list.push_back( makeCmd< OpType::ePixelStore >( GL_UNPACK_ROW_LENGTH, int32_t( rowLength ) ) );
+			}
+
+			if ( imageHeight )
+			{
+				list.push_back( makeCmd< OpType::ePixelStore >( GL_UNPACK_IMAGE_HEIGHT, int32_t( imageHeight ) ) );
+			}
+
 			switch ( copyTarget )
 			{
 			case GL_TEXTURE_1D:
@@ -227,6 +245,16 @@ namespace ashes::gl
 				// Noop
 				break;
 			}
+
+			if ( rowLength )
+			{
+				list.push_back( makeCmd< OpType::ePixelStore >( GL_UNPACK_ROW_LENGTH, 0 ) );
+			}
+
+			if ( imageHeight )
+			{
+				list.push_back( makeCmd< OpType::ePixelStore >( GL_UNPACK_IMAGE_HEIGHT, 0 ) );
+			}
 		}
 
 		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_UNPACK
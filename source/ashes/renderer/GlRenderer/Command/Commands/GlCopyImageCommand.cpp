@@ -4,6 +4,7 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/GlCopyImageCommand.hpp"
 #include "Command/Commands/GlCopyImageToBufferCommand.hpp"
+#include "Core/GlDevice.hpp"
 #include "Miscellaneous/GlImageMemoryBinding.hpp"
 
 #include "Image/GlImage.hpp"
@@ -49,6 +50,81 @@ namespace ashes::gl
 			result.imageSubresource = copyInfo.dstSubresource;
 			return result;
 		}
+
+		bool canUseCopyKernel( VkDevice device
+			, VkImage srcImage
+			, VkImage dstImage )
+		{
+			auto srcFormat = get( srcImage )->getFormatVk();
+			auto dstFormat = get( dstImage )->getFormatVk();
+			return get( device )->getTransferKernels().isAvailable()
+				&& isKernelStorageFormat( srcFormat )
+				&& isKernelStorageFormat( dstFormat )
+				&& getMinimalSize( srcFormat ) == getMinimalSize( dstFormat )
+				&& get( srcImage )->getSamples() == VK_SAMPLE_COUNT_1_BIT
+				&& get( dstImage )->getSamples() == VK_SAMPLE_COUNT_1_BIT
+				&& getKernelDim( get( srcImage )->getTarget() ) != TransferKernelDim::eUnsupported
+				&& getKernelDim( get( dstImage )->getTarget() ) != TransferKernelDim::eUnsupported;
+		}
+
+		int32_t getKernelZ( VkImage image
+			, VkImageSubresourceLayers const & subresource
+			, VkOffset3D const & offset )
+		{
+			return get( image )->getType() == VK_IMAGE_TYPE_3D
+				? offset.z
+				: int32_t( subresource.baseArrayLayer );
+		}
+
+		void copyImageKernel( VkDevice device
+			, VkImageCopy const & copyInfo
+			, VkImage srcImage
+			, VkImage dstImage
+			, CmdList & list )
+		{
+			auto & kernels = get( device )->getTransferKernels();
+			auto texelSize = uint32_t( getMinimalSize( get( srcImage )->getFormatVk() ) );
+			auto texelFormat = getKernelTexelFormat( texelSize );
+			auto layerCount = std::max( copyInfo.srcSubresource.layerCount
+				, copyInfo.extent.depth );
+			int32_t srcOffset[4]{ copyInfo.srcOffset.x
+				, copyInfo.srcOffset.y
+				, getKernelZ( srcImage, copyInfo.srcSubresource, copyInfo.srcOffset )
+				, 0 };
+			int32_t dstOffset[4]{ copyInfo.dstOffset.x
+				, copyInfo.dstOffset.y
+				, getKernelZ( dstImage, copyInfo.dstSubresource, copyInfo.dstOffset )
+				, 0 };
+			int32_t extent[4]{ int32_t( copyInfo.extent.width )
+				, int32_t( copyInfo.extent.height )
+				, int32_t( layerCount )
+				, 0 };
+			list.push_back( makeCmd< OpType::eUseTransferKernel >( makeKernelId( { TransferKernelType::eCopyImage
+				, getKernelDim( get( srcImage )->getTarget() )
+				, getKernelDim( get( dstImage )->getTarget() )
+				, uint8_t( texelSize ) } ) ) );
+			list.push_back( makeCmd< OpType::eBindImage >( kernels.getSrcImageUnit()
+				, get( srcImage )->getInternal()
+				, copyInfo.srcSubresource.mipLevel
+				, 1u
+				, 0u
+				, texelFormat ) );
+			list.push_back( makeCmd< OpType::eBindImage >( kernels.getDstImageUnit()
+				, get( dstImage )->getInternal()
+				, copyInfo.dstSubresource.mipLevel
+				, 1u
+				, 0u
+				, texelFormat ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 0u, srcOffset ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 1u, dstOffset ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 2u, extent ) );
+			list.push_back( makeCmd< OpType::eDispatch >( TransferKernels::getGroupCount( copyInfo.extent.width )
+				, TransferKernels::getGroupCount( copyInfo.extent.height )
+				, layerCount ) );
+			list.push_back( makeCmd< OpType::eMemoryBarrier >( GL_MEMORY_BARRIER_ALL ) );
+			// Transfer kernels are only available with program pipelines, the bound one takes over again.
+			list.push_back( makeCmd< OpType::eUseProgram >( 0u ) );
+		}
 	}
 
 	void buildCopyImageCommand( ContextStateStack & stack
@@ -80,6 +156,14 @@ namespace ashes::gl
 				, dstTarget
 				, copyInfo ) );
 		}
+		else if ( canUseCopyKernel( device, srcImage, dstImage ) )
+		{
+			copyImageKernel( device
+				, copyInfo
+				, srcImage
+				, dstImage
+				, list );
+		}
 		else
 		{
 			auto layerCount = std::max( copyInfo.srcSubresource.layerCount
@@ -97,12 +181,10 @@ namespace ashes::gl
 					, srcImage
 					, dstImage };
 
-				list.push_back( makeCmd< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER ) );
 				layerCopy.bindSrc( stack
 					, srcBaseArrayLayer + layer
 					, GL_READ_FRAMEBUFFER
 					, list );
-				list.push_back( makeCmd< OpType::eBindDstFramebuffer >( GL_DRAW_FRAMEBUFFER ) );
 				layerCopy.bindDst( stack
 					, dstBaseArrayLayer + layer
 					, GL_DRAW_FRAMEBUFFER
@@ -117,15 +199,16 @@ namespace ashes::gl
 					, layerCopy.region.dstOffsets[1].y
 					, getMask( get( srcImage )->getFormatVk() )
 					, GL_FILTER_NEAREST ) );
-				list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
-					, nullptr ) );
-				list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_DRAW_FRAMEBUFFER
-					, nullptr ) );
-
-				if ( stack.hasCurrentFramebuffer() )
-				{
-					stack.setCurrentFramebuffer( nullptr );
-				}
+			}
+
+			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
+				, nullptr ) );
+			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_DRAW_FRAMEBUFFER
+				, nullptr ) );
+
+			if ( stack.hasCurrentFramebuffer() )
+			{
+				stack.setCurrentFramebuffer( nullptr );
 			}
 		}
 
@@ -34,8 +34,7 @@ namespace ashes::gl
 			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK
 				, dst ) );
 			stack.applyPackAlign( list, 1 );
-			list.push_back( makeCmd< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER ) );
-			srcAttach.bindRead( stack
+			srcAttach.bindCached( stack
 				, copyInfo.imageSubresource.mipLevel
 				, baseArrayLayer
 				, GL_READ_FRAMEBUFFER, list );
@@ -248,6 +247,70 @@ namespace ashes::gl
 			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
 				, 0u ) );
 		}
+
+		bool canUseCopyKernel( VkDevice device
+			, VkBufferImageCopy const & copyInfo
+			, VkImage src )
+		{
+			auto format = get( src )->getFormatVk();
+			auto texelSize = getMinimalSize( format );
+			return get( device )->getTransferKernels().isAvailable()
+				&& isKernelStorageFormat( format )
+				&& ( texelSize == 4u || texelSize == 8u || texelSize == 16u )
+				&& ( copyInfo.bufferOffset % 4u ) == 0u
+				&& get( src )->getSamples() == VK_SAMPLE_COUNT_1_BIT
+				&& getKernelDim( get( src )->getTarget() ) != TransferKernelDim::eUnsupported;
+		}
+
+		void copyImageKernel( VkDevice device
+			, VkBufferImageCopy const & copyInfo
+			, VkImage src
+			, DeviceMemoryBinding const & dst
+			, CmdList & list )
+		{
+			auto & kernels = get( device )->getTransferKernels();
+			auto texelSize = uint32_t( getMinimalSize( get( src )->getFormatVk() ) );
+			auto layerCount = std::max( copyInfo.imageSubresource.layerCount
+				, copyInfo.imageExtent.depth );
+			int32_t srcOffset[4]{ copyInfo.imageOffset.x
+				, copyInfo.imageOffset.y
+				, ( get( src )->getType() == VK_IMAGE_TYPE_3D
+					? copyInfo.imageOffset.z
+					: int32_t( copyInfo.imageSubresource.baseArrayLayer ) )
+				, 0 };
+			int32_t extent[4]{ int32_t( copyInfo.imageExtent.width )
+				, int32_t( copyInfo.imageExtent.height )
+				, int32_t( layerCount )
+				, 0 };
+			int32_t layout[4]{ int32_t( copyInfo.bufferOffset / 4u )
+				, int32_t( copyInfo.bufferRowLength ? copyInfo.bufferRowLength : copyInfo.imageExtent.width )
+				, int32_t( copyInfo.bufferImageHeight ? copyInfo.bufferImageHeight : copyInfo.imageExtent.height )
+				, 0 };
+			list.push_back( makeCmd< OpType::eUseTransferKernel >( makeKernelId( { TransferKernelType::eImageToBuffer
+				, getKernelDim( get( src )->getTarget() )
+				, TransferKernelDim::eUnsupported
+				, uint8_t( texelSize ) } ) ) );
+			list.push_back( makeCmd< OpType::eBindImage >( kernels.getSrcImageUnit()
+				, get( src )->getInternal()
+				, copyInfo.imageSubresource.mipLevel
+				, 1u
+				, 0u
+				, getKernelTexelFormat( texelSize ) ) );
+			list.push_back( makeCmd< OpType::eBindBufferRange >( kernels.getBufferBinding()
+				, GL_BUFFER_TARGET_SHADER_STORAGE
+				, get( dst.getParent() )->getInternal()
+				, 0
+				, int64_t( get( dst.getParent() )->getSize() ) ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 0u, srcOffset ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 2u, extent ) );
+			list.push_back( makeCmd< OpType::eUniform4iv >( 3u, layout ) );
+			list.push_back( makeCmd< OpType::eDispatch >( TransferKernels::getGroupCount( copyInfo.imageExtent.width )
+				, TransferKernels::getGroupCount( copyInfo.imageExtent.height )
+				, layerCount ) );
+			list.push_back( makeCmd< OpType::eMemoryBarrier >( GL_MEMORY_BARRIER_ALL ) );
+			// Transfer kernels are only available with program pipelines, the bound one takes over again.
+			list.push_back( makeCmd< OpType::eUseProgram >( 0u ) );
+		}
 	}
 
 	void buildCopyImageToBufferCommand( ContextStateStack & stack
@@ -258,6 +321,9 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "CopyImageToBufferCommand" );
+		list.push_back( makeCmd< OpType::eUnlinkQueryResults >( dst.getParent()
+			, dst.getOffset()
+			, dst.getSize() ) );
 		copyInfo.bufferOffset += dst.getOffset();
 		auto layerCount = std::max( copyInfo.imageSubresource.layerCount
 			, copyInfo.imageExtent.depth );
@@ -282,6 +348,14 @@ namespace ashes::gl
 				, srcBinding
 				, list );
 		}
+		else if ( canUseCopyKernel( device, copyInfo, src ) )
+		{
+			copyImageKernel( device
+				, copyInfo
+				, src
+				, dst
+				, list );
+		}
 		else
 		{
 			auto srcBufferOffset = getTextureImage( stack, copyInfo, src, list );
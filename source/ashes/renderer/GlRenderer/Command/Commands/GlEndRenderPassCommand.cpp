@@ -5,14 +5,143 @@ See LICENSE file in root folder.
 #include "Command/Commands/GlEndRenderPassCommand.hpp"
 
 #include "RenderPass/GlFrameBuffer.hpp"
+#include "RenderPass/GlRenderPass.hpp"
 
 #include "ashesgl_api.hpp"
 
 namespace ashes::gl
 {
+	namespace
+	{
+		bool isDiscarded( VkRenderPass renderPass
+			, VkFramebuffer frameBuffer
+			, VkAttachmentReference const & reference
+			, bool & discardMain
+			, bool & discardStencil )
+		{
+			auto & attachDesc = get( renderPass )->getAttachment( reference );
+
+			if ( get( frameBuffer )->isTransient( reference ) )
+			{
+				// Transient attachments never outlive the render pass.
+				discardMain = true;
+				discardStencil = true;
+			}
+			else
+			{
+				discardMain = attachDesc.storeOp == VK_ATTACHMENT_STORE_OP_DONT_CARE;
+				discardStencil = attachDesc.stencilStoreOp == VK_ATTACHMENT_STORE_OP_DONT_CARE;
+			}
+
+			return discardMain || discardStencil;
+		}
+
+		bool findBoundIndex( VkSubpassDescription const & subpass
+			, VkFramebuffer frameBuffer
+			, VkAttachmentReference const & reference
+			, uint32_t & index )
+		{
+			index = 0u;
+
+			for ( auto & colourRef : makeArrayView( subpass.pColorAttachments, subpass.colorAttachmentCount ) )
+			{
+				if ( colourRef.attachment != VK_ATTACHMENT_UNUSED )
+				{
+					if ( colourRef.attachment == reference.attachment )
+					{
+						return true;
+					}
+
+					if ( !get( frameBuffer )->getAttachment( colourRef ).isDepthOrStencil() )
+					{
+						++index;
+					}
+				}
+			}
+
+			index = 0u;
+			return subpass.pDepthStencilAttachment
+				&& subpass.pDepthStencilAttachment->attachment == reference.attachment;
+		}
+
+		void invalidateAttaches( VkRenderPass renderPass
+			, VkFramebuffer frameBuffer
+			, VkSubpassDescription const & subpass
+			, CmdList & list )
+		{
+			std::vector< GlAttachmentPoint > boundPoints;
+			std::vector< std::pair< FboAttachment, GlAttachmentPoint > > unboundAttaches;
+
+			for ( auto & reference : get( renderPass )->getFboAttachable() )
+			{
+				auto attach = get( frameBuffer )->getAttachment( reference );
+				bool discardMain{};
+				bool discardStencil{};
+
+				if ( !attach.point
+					|| !isDiscarded( renderPass, frameBuffer, reference, discardMain, discardStencil ) )
+				{
+					continue;
+				}
+
+				uint32_t index{};
+				bool bound = findBoundIndex( subpass, frameBuffer, reference, index );
+				auto point = getInvalidatedPoint( attach
+					, index
+					, discardMain
+					, discardStencil );
+
+				if ( point )
+				{
+					if ( bound )
+					{
+						boundPoints.push_back( *point );
+					}
+					else
+					{
+						unboundAttaches.emplace_back( attach, *point );
+					}
+				}
+			}
+
+			if ( boundPoints.empty() && unboundAttaches.empty() )
+			{
+				return;
+			}
+
+			// Resolve blits may have left another framebuffer bound.
+			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
+				, frameBuffer ) );
+
+			if ( !boundPoints.empty() )
+			{
+				list.push_back( makeCmd< OpType::eInvalidateFramebuffer >( GL_FRAMEBUFFER
+					, boundPoints ) );
+			}
+
+			// Attachments that were only used by previous subpasses are bound again,
+			// to colour point 0 or to their depth/stencil point, for invalidation.
+			for ( auto & unbound : unboundAttaches )
+			{
+				unbound.first.bind( 0u, GL_FRAMEBUFFER, list );
+				list.push_back( makeCmd< OpType::eInvalidateFramebuffer >( GL_FRAMEBUFFER
+					, unbound.second ) );
+			}
+		}
+	}
+
 	void buildEndRenderPassCommand( ContextStateStack & stack
+		, VkRenderPass renderPass
+		, VkFramebuffer frameBuffer
+		, VkSubpassDescription const & subpass
 		, CmdList & list )
 	{
+		if ( get( frameBuffer )->getInternal() != GL_INVALID_INDEX
+			&& !get( frameBuffer )->isEmpty() )
+		{
+			invalidateAttaches( renderPass, frameBuffer, subpass, list );
+		}
+
 		if ( stack.hasCurrentFramebuffer() )
 		{
 			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
@@ -9,5 +9,8 @@ See LICENSE file in root folder
 namespace ashes::gl
 {
 	void buildEndRenderPassCommand( ContextStateStack & stack
+		, VkRenderPass renderPass
+		, VkFramebuffer frameBuffer
+		, VkSubpassDescription const & subpass
 		, CmdList & list );
 }
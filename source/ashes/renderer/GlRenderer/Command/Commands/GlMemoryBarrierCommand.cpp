@@ -75,6 +75,20 @@ namespace ashes::gl
 
 			return result;
 		}
+
+		// Shader writes aren't tracked, so the query results they may overwrite are forgotten
+		// when they are made visible to the conditional rendering.
+		bool overwritesPredicates( VkAccessFlags srcAccessMask
+			, VkAccessFlags dstAccessMask )
+		{
+#if VK_EXT_conditional_rendering
+			return checkFlag( dstAccessMask, VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT )
+				&& ( checkFlag( srcAccessMask, VK_ACCESS_SHADER_WRITE_BIT )
+					|| checkFlag( srcAccessMask, VK_ACCESS_MEMORY_WRITE_BIT ) );
+#else
+			return false;
+#endif
+		}
 	}
 
 	void buildMemoryBarrierCommand( VkPipelineStageFlags after
@@ -90,6 +104,29 @@ namespace ashes::gl
 		glLogCommand( list, "MemoryBarrierCommand" );
 		bool hasMapped = false;
 
+		for ( auto & barrier : memoryBarriers )
+		{
+			if ( overwritesPredicates( barrier.srcAccessMask, barrier.dstAccessMask ) )
+			{
+				list.push_back( makeCmd< OpType::eUnlinkQueryResults >( VkDeviceMemory( VK_NULL_HANDLE )
+					, 0u
+					, WholeSize ) );
+			}
+		}
+
+		for ( auto & barrier : bufferMemoryBarriers )
+		{
+			if ( overwritesPredicates( barrier.srcAccessMask, barrier.dstAccessMask ) )
+			{
+				auto & binding = get( barrier.buffer )->getMemoryBinding();
+				list.push_back( makeCmd< OpType::eUnlinkQueryResults >( binding.getParent()
+					, binding.getOffset() + barrier.offset
+					, ( barrier.size == WholeSize
+						? binding.getSize() - barrier.offset
+						: barrier.size ) ) );
+			}
+		}
+
 		for ( auto & barrier : bufferMemoryBarriers )
 		{
 			hasMapped = bindPreBarrier( get( barrier.buffer )->getMemoryBinding()
@@ -12,5 +12,9 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "ResetQueryPoolCommand" );
+		// The GL queries are reused, so their results can't stand for the copied ones anymore.
+		list.push_back( makeCmd< OpType::eUnlinkQueries >( pool
+			, firstQuery
+			, queryCount ) );
 	}
 }
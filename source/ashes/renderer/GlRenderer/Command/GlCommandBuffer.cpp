@@ -12,6 +12,7 @@ See LICENSE file in root folder.
 #include "Image/GlImage.hpp"
 #include "Image/GlImageView.hpp"
 #include "Miscellaneous/GlCallLogger.hpp"
+#include "Miscellaneous/GlGpuProfiler.hpp"
 #include "Pipeline/GlPipeline.hpp"
 #include "Pipeline/GlPipelineLayout.hpp"
 #include "RenderPass/GlFrameBuffer.hpp"
@@ -220,6 +221,11 @@ namespace ashes::gl
 		m_state.stack = std::make_unique< ContextStateStack >( m_device );
 		m_state.beginFlags = info.flags;
 
+		if ( GpuProfiler::isEnabled() )
+		{
+			m_state.recordBegin = GpuProfiler::getCpuTimestamp();
+		}
+
 		if ( checkFlag( m_state.beginFlags, VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT ) )
 		{
 			if ( info.pInheritanceInfo
@@ -256,6 +262,14 @@ namespace ashes::gl
 			mergeList( m_cmdAfterSubmit, m_cmdsAfterSubmit );
 		}
 
+		if ( GpuProfiler::isEnabled() )
+		{
+			GpuProfiler::addCpuEvent( "record"
+				, GpuProfiler::getObjectName( "CommandBuffer", get( this ) )
+				, m_state.recordBegin
+				, GpuProfiler::getCpuTimestamp() );
+		}
+
 		return VK_SUCCESS;
 	}
 
@@ -315,6 +329,9 @@ namespace ashes::gl
 			, m_cmdList
 			, m_preExecuteActions );
 		buildEndRenderPassCommand( *m_state.stack
+			, m_state.currentRenderPass
+			, m_state.currentFrameBuffer
+			, *m_state.currentSubpass
 			, m_cmdList );
 		m_state.boundVbos.clear();
 		m_state.boundDescriptors.clear();
@@ -972,6 +989,7 @@ namespace ashes::gl
 				, queryCount
 				, stride
 				, flags
+				, get( dstBuffer )->getMemoryBinding().getParent()
 				, dstOffset + get( dstBuffer )->getOffset() ) );
 			m_cmdList.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_QUERY
 				, 0u ) );
@@ -1181,6 +1199,23 @@ namespace ashes::gl
 		}
 	}
 
+#if VK_EXT_conditional_rendering
+
+	void CommandBuffer::beginConditionalRendering( VkConditionalRenderingBeginInfoEXT const & beginInfo )const
+	{
+		// The predicate is resolved when the command is executed: from the occlusion query whose
+		// result was last copied there if any, else from the buffer contents.
+		m_cmdList.push_back( makeCmd< OpType::eBeginConditionalRenderBuffer >( get( beginInfo.buffer )->getInternal()
+			, beginInfo.offset + get( beginInfo.buffer )->getOffset()
+			, checkFlag( beginInfo.flags, VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT ) ) );
+	}
+
+	void CommandBuffer::endConditionalRendering()const
+	{
+		m_cmdList.push_back( makeCmd< OpType::eEndConditionalRender >() );
+	}
+
+#endif
 #if VK_EXT_debug_utils
 
 	void CommandBuffer::beginDebugUtilsLabel( VkDebugUtilsLabelEXT const & labelInfo )const
@@ -165,6 +165,10 @@ namespace ashes::gl
 			, ArrayView< VkImageMemoryBarrier const > imageMemoryBarriers )const;
 
 		void generateMipmaps( VkImage texture );
+#if VK_EXT_conditional_rendering
+		void beginConditionalRendering( VkConditionalRenderingBeginInfoEXT const & beginInfo )const;
+		void endConditionalRendering()const;
+#endif
 #if VK_EXT_debug_utils
 		void beginDebugUtilsLabel( VkDebugUtilsLabelEXT const & labelInfo )const;
 		void endDebugUtilsLabel()const;
@@ -266,6 +270,7 @@ namespace ashes::gl
 			GeometryBuffersRefArray vaos;
 			std::map< uint32_t, VkDescriptorSet > boundDescriptors;
 			std::map< uint32_t, std::function< VkDescriptorSet( VkDescriptorSet, uint32_t & ) > > waitingDescriptors;
+			uint64_t recordBegin{ 0u };
 		};
 		mutable State m_state;
 		mutable Optional< DebugLabel > m_label;
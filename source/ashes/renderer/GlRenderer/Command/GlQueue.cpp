@@ -5,6 +5,8 @@ See LICENSE file in root folder.
 #include "Command/GlQueue.hpp"
 
 #include "Miscellaneous/GlCallLogger.hpp"
+#include "Miscellaneous/GlGpuProfiler.hpp"
+#include "Miscellaneous/GlRendererStatistics.hpp"
 
 #include "Command/GlCommandBuffer.hpp"
 #include "Command/Commands/GlBeginQueryCommand.hpp"
@@ -73,6 +75,9 @@ namespace ashes::gl
 			case OpType::eApplyViewports:
 				apply( lock, map< OpType::eApplyViewports >( cmd ) );
 				break;
+			case OpType::eBeginConditionalRenderBuffer:
+				apply( lock, map< OpType::eBeginConditionalRenderBuffer >( cmd ) );
+				break;
 			case OpType::eBeginQuery:
 				apply( lock, map< OpType::eBeginQuery >( cmd ) );
 				break;
@@ -88,11 +93,8 @@ namespace ashes::gl
 			case OpType::eBindFramebuffer:
 				apply( lock, map< OpType::eBindFramebuffer >( cmd ) );
 				break;
-			case OpType::eBindSrcFramebuffer:
-				apply( lock, map< OpType::eBindSrcFramebuffer >( cmd ) );
-				break;
-			case OpType::eBindDstFramebuffer:
-				apply( lock, map< OpType::eBindDstFramebuffer >( cmd ) );
+			case OpType::eBindCachedFramebuffer:
+				apply( lock, map< OpType::eBindCachedFramebuffer >( cmd ) );
 				break;
 			case OpType::eBindImage:
 				apply( lock, map< OpType::eBindImage >( cmd ) );
@@ -235,6 +237,9 @@ namespace ashes::gl
 			case OpType::eEnable:
 				apply( lock, map< OpType::eEnable >( cmd ) );
 				break;
+			case OpType::eEndConditionalRender:
+				apply( lock, map< OpType::eEndConditionalRender >( cmd ) );
+				break;
 			case OpType::eEndQuery:
 				apply( lock, map< OpType::eEndQuery >( cmd ) );
 				break;
@@ -271,6 +276,9 @@ namespace ashes::gl
 			case OpType::eGetQueryResults:
 				apply( lock, map< OpType::eGetQueryResults >( cmd ) );
 				break;
+			case OpType::eInvalidateFramebuffer:
+				apply( lock, map< OpType::eInvalidateFramebuffer >( cmd ) );
+				break;
 			case OpType::eLineWidth:
 				apply( lock, map< OpType::eLineWidth >( cmd ) );
 				break;
@@ -436,6 +444,12 @@ namespace ashes::gl
 			case OpType::eUniformMatrix4fv:
 				apply( lock, map< OpType::eUniformMatrix4fv >( cmd ) );
 				break;
+			case OpType::eUnlinkQueries:
+				apply( lock, map< OpType::eUnlinkQueries >( cmd ) );
+				break;
+			case OpType::eUnlinkQueryResults:
+				apply( lock, map< OpType::eUnlinkQueryResults >( cmd ) );
+				break;
 			case OpType::eUpdateBuffer:
 				apply( lock, map< OpType::eUpdateBuffer >( cmd ) );
 				break;
@@ -448,6 +462,9 @@ namespace ashes::gl
 			case OpType::eUseProgramPipeline:
 				apply( lock, map< OpType::eUseProgramPipeline >( cmd ) );
 				break;
+			case OpType::eUseTransferKernel:
+				apply( lock, map< OpType::eUseTransferKernel >( cmd ) );
+				break;
 			case OpType::eWaitEvents:
 				apply( lock, map< OpType::eWaitEvents >( cmd ) );
 				break;
@@ -459,11 +476,20 @@ namespace ashes::gl
 				break;
 			}
 		}
+
+		void applyCountedCmd( ContextLock const & lock, Command const & cmd )
+		{
+			auto begin = RendererStatistics::getCpuTimestamp();
+			applyCmd( lock, cmd );
+			RendererStatistics::addOperation( cmd.op.type
+				, RendererStatistics::getCpuTimestamp() - begin );
+		}
 	}
 
 	void applyList( ContextLock const & lock
 		, CmdList const & cmds )
 	{
+		auto counted = RendererStatistics::isEnabled();
 		Command const * pCmd = nullptr;
 
 		for ( CmdBuffer const & cmdBuf : cmds )
@@ -473,7 +499,15 @@ namespace ashes::gl
 			if ( map( it, cmdBuf.end(), pCmd ) )
 			{
 				auto & cmd = *pCmd;
-				applyCmd( lock, cmd );
+
+				if ( counted )
+				{
+					applyCountedCmd( lock, cmd );
+				}
+				else
+				{
+					applyCmd( lock, cmd );
+				}
 			}
 		}
 	}
@@ -485,11 +519,24 @@ namespace ashes::gl
 		auto end = cmds.end();
 		Command const * pCmd = nullptr;
 
-		while ( map( it, end, pCmd ) )
+		// Checked once per buffer, the disabled statistics then cost a single branch.
+		if ( RendererStatistics::isEnabled() )
 		{
-			auto & cmd = *pCmd;
-			it += cmd.op.size;
-			applyCmd( lock, cmd );
+			while ( map( it, end, pCmd ) )
+			{
+				auto & cmd = *pCmd;
+				it += cmd.op.size;
+				applyCountedCmd( lock, cmd );
+			}
+		}
+		else
+		{
+			while ( map( it, end, pCmd ) )
+			{
+				auto & cmd = *pCmd;
+				it += cmd.op.size;
+				applyCmd( lock, cmd );
+			}
 		}
 	}
 
@@ -513,15 +560,55 @@ namespace ashes::gl
 		try
 		{
 			auto context = get( m_device )->getContext();
+			auto counted = RendererStatistics::isEnabled();
+			RendererStatistics::SubmitBegin submitBegin{};
+
+			if ( counted )
+			{
+				submitBegin = RendererStatistics::beginSubmit( context );
+			}
 
 			for ( auto & value : values )
 			{
 				for ( auto commandBuffer : makeArrayView( value.pCommandBuffers, value.commandBufferCount ) )
 				{
 					auto & glCommandBuffer = *get( commandBuffer );
+					auto profiled = GpuProfiler::isEnabled();
+					uint64_t cpuBegin{};
+
+					if ( profiled )
+					{
+						cpuBegin = GpuProfiler::getCpuTimestamp();
+						GpuProfiler::beginGpuRegion( context
+							, "submit"
+							, GpuProfiler::getObjectName( "CommandBuffer", commandBuffer ) );
+					}
+
 					glCommandBuffer.initialiseGeometryBuffers( context );
 					applyBuffer( context, glCommandBuffer.getCmds() );
 					applyBuffer( context, glCommandBuffer.getCmdsAfterSubmit() );
+
+					if ( profiled )
+					{
+						GpuProfiler::endGpuRegion( context );
+						GpuProfiler::addCpuEvent( "submit"
+							, GpuProfiler::getObjectName( "CommandBuffer", commandBuffer )
+							, cpuBegin
+							, GpuProfiler::getCpuTimestamp() );
+					}
+
+					if ( context->getErrorCheckPolicy() == GlErrorCheckPolicy::ePerSubmit
+						&& !glDrainErrors( context ) )
+					{
+						throw Exception{ VK_ERROR_OUT_OF_DEVICE_MEMORY, "vkQueueSubmit" };
+					}
+
+					// The KHR_debug callback only latches the error, the GL calls don't check it.
+					if ( context->getErrorCheckPolicy() == GlErrorCheckPolicy::eAsync
+						&& context->isOutOfMemory() )
+					{
+						throw Exception{ VK_ERROR_OUT_OF_DEVICE_MEMORY, "vkQueueSubmit" };
+					}
 				}
 			}
 
@@ -530,6 +617,16 @@ namespace ashes::gl
 				get( fence )->insert( context );
 			}
 
+			if ( GpuProfiler::isEnabled() )
+			{
+				GpuProfiler::collect( context );
+			}
+
+			if ( counted )
+			{
+				RendererStatistics::endSubmit( context, submitBegin );
+			}
+
 			return VK_SUCCESS;
 		}
 		catch ( Exception & exc )
@@ -616,10 +713,22 @@ namespace ashes::gl
 			{ labelInfo.color[0], labelInfo.color[1], labelInfo.color[2], labelInfo.color[3] },
 			labelInfo.pLabelName,
 		};
+
+		if ( GpuProfiler::isEnabled() )
+		{
+			GpuProfiler::beginGpuRegion( get( m_device )->getContext()
+				, "queue label"
+				, labelInfo.pLabelName );
+		}
 	}
 
 	void Queue::endDebugUtilsLabel()const
 	{
+		if ( GpuProfiler::isEnabled() )
+		{
+			GpuProfiler::endGpuRegion( get( m_device )->getContext() );
+		}
+
 		m_label = ashes::nullopt;
 	}
 
@@ -2,6 +2,7 @@
 
 #include "Core/GlContextLock.hpp"
 #include "Core/GlSurface.hpp"
+#include "Miscellaneous/GlGpuProfiler.hpp"
 
 #include "ashesgl_api.hpp"
 
@@ -9,6 +10,7 @@
 #	include <gl/GL.h>
 #endif
 
+#include <cstring>
 #include <iostream>
 #include <locale>
 
@@ -92,12 +94,17 @@ namespace ashes::gl
 		m_impl->preInitialise( MinMajor, MinMinor );
 		m_impl->enable();
 		loadBaseFunctions();
+		initialiseErrorCheck();
 		m_impl->disable();
 		m_impl->postInitialise();
 	}
 
 	Context::~Context()
 	{
+		if ( GpuProfiler::isEnabled() )
+		{
+			GpuProfiler::releaseContext( *this );
+		}
 	}
 
 #if _WIN32
@@ -144,6 +151,14 @@ namespace ashes::gl
 				, get( surface )->getWaylandCreateInfo()
 				, &get( instance )->getCurrentContext() );
 		}
+#	if Ashes_GlHeadlessSurface
+		else if ( get( surface )->isHeadless() )
+		{
+			return create( instance
+				, get( surface )->getHeadlessCreateInfo()
+				, &get( instance )->getCurrentContext() );
+		}
+#	endif
 		else if ( get( surface )->isDisplay() )
 		{
 			return create( instance
@@ -423,11 +438,51 @@ namespace ashes::gl
 			} );
 	}
 
-	void Context::checkOutOfMemory()const
+	void Context::onDebugCallbackReplaced()
+	{
+		if ( m_errorCheckPolicy == GlErrorCheckPolicy::eAsync )
+		{
+			m_errorCheckPolicy = GlErrorCheckPolicy::ePerSubmit;
+		}
+	}
+
+	void Context::initialiseErrorCheck()
+	{
+		m_errorCheckPolicy = getErrorCheckPolicy();
+
+		if ( m_errorCheckPolicy == GlErrorCheckPolicy::eAsync )
+		{
+			if ( m_glDebugMessageCallback )
+			{
+				m_glDebugMessageCallback( &Context::onDebugMessage, this );
+				m_glEnable( GL_DEBUG_OUTPUT );
+			}
+			else
+			{
+				m_errorCheckPolicy = GlErrorCheckPolicy::ePerSubmit;
+			}
+		}
+	}
+
+	void Context::throwOutOfMemory()const
+	{
+		throw Exception{ VK_ERROR_OUT_OF_DEVICE_MEMORY, "" };
+	}
+
+	void GLAPIENTRY Context::onDebugMessage( uint32_t source
+		, uint32_t type
+		, uint32_t id
+		, uint32_t severity
+		, int length
+		, const char * message
+		, void * userParam )
 	{
-		if ( m_outOfMemory )
+		// The message IDs are implementation defined, most of them use the error code for API errors.
+		if ( type == GL_DEBUG_TYPE_ERROR
+			&& ( id == GL_ERROR_OUT_OF_MEMORY
+				|| ( message && std::strstr( message, "GL_OUT_OF_MEMORY" ) ) ) )
 		{
-			throw Exception{ VK_ERROR_OUT_OF_DEVICE_MEMORY, "" };
+			static_cast< Context * >( userParam )->setOutOfMemory();
 		}
 	}
 
@@ -61,6 +61,96 @@ namespace ashes::gl
 		{
 			m_outOfMemory = true;
 		}
+		/**
+		*\brief
+		*	Tells if an out of memory error has been latched, by the error checks or by the
+		*	KHR_debug callback installed for GlErrorCheckPolicy::eAsync.
+		*/
+		bool isOutOfMemory()const
+		{
+			return m_outOfMemory.load( std::memory_order_relaxed );
+		}
+		/**
+		*\brief
+		*	Throws VK_ERROR_OUT_OF_DEVICE_MEMORY if an out of memory error has been latched.
+		*/
+		void checkOutOfMemory()const
+		{
+			if ( isOutOfMemory() )
+			{
+				throwOutOfMemory();
+			}
+		}
+
+		GlErrorCheckPolicy getErrorCheckPolicy()const
+		{
+			return m_errorCheckPolicy;
+		}
+
+		bool isErrorCheckedPerCall()const
+		{
+			return m_errorCheckPolicy == GlErrorCheckPolicy::ePerCall;
+		}
+		/**
+		*\brief
+		*	Counts a GL call, for the renderer statistics.
+		*\remarks
+		*	A plain increment, cheaper than checking whether the statistics are enabled.
+		*/
+		void countCall()const noexcept
+		{
+			++m_callCount;
+		}
+
+		uint64_t getCallCount()const noexcept
+		{
+			return m_callCount;
+		}
+		/**
+		*\brief
+		*	Sets whether the active conditional rendering discards the commands.
+		*\remarks
+		*	GL conditional rendering doesn't cover the compute dispatches, which check this flag instead.
+		*/
+		void setConditionalDiscard( bool value )const noexcept
+		{
+			m_conditionalQuery = 0u;
+			m_conditionalDiscard = value;
+		}
+		/**
+		*\brief
+		*	Sets the occlusion query the active conditional rendering uses, its result is only
+		*	retrieved if a compute dispatch needs it.
+		*/
+		void setConditionalQuery( GLuint query
+			, bool inverted )const noexcept
+		{
+			m_conditionalQuery = query;
+			m_conditionalInverted = inverted;
+			m_conditionalDiscard = false;
+		}
+
+		GLuint getConditionalQuery()const noexcept
+		{
+			return m_conditionalQuery;
+		}
+
+		bool isConditionalInverted()const noexcept
+		{
+			return m_conditionalInverted;
+		}
+
+		bool isConditionalDiscard()const noexcept
+		{
+			return m_conditionalDiscard;
+		}
+		/**
+		*\brief
+		*	To call when another KHR_debug callback replaces the one installed for GlErrorCheckPolicy::eAsync.
+		*\remarks
+		*	The errors are then drained at submit time.
+		*/
+		void onDebugCallbackReplaced();
 
 		template< typename SurfaceCreateInfo >
 		static ContextPtr create( VkInstance instance
@@ -84,6 +174,18 @@ namespace ashes::gl
 		{
 			m_impl->swapBuffers();
 		}
+		/**
+		*\remarks
+		*	The context must be current, the value is only forwarded when it changes.
+		*/
+		void setSwapInterval( int interval )const
+		{
+			if ( interval != m_swapInterval )
+			{
+				m_impl->setSwapInterval( interval );
+				m_swapInterval = interval;
+			}
+		}
 
 		bool isEnabled()const
 		{
@@ -159,7 +261,16 @@ namespace ashes::gl
 		BufferAllocCont::iterator findBuffer( GLuint buffer );
 		BufferAllocCont::iterator findBuffer( GLuint buffer
 			, GLsizeiptr size );
-		void checkOutOfMemory()const;
+		void initialiseErrorCheck();
+		void throwOutOfMemory()const;
+
+		static void GLAPIENTRY onDebugMessage( uint32_t source
+			, uint32_t type
+			, uint32_t id
+			, uint32_t severity
+			, int length
+			, const char * message
+			, void * userParam );
 
 	private:
 		gl::ContextImplPtr m_impl;
@@ -172,5 +283,12 @@ namespace ashes::gl
 		std::map< std::thread::id, std::unique_ptr< gl::ContextState > > m_state;
 		BufferAllocCont m_buffers;
 		std::atomic< bool > m_outOfMemory{ false };
+		GlErrorCheckPolicy m_errorCheckPolicy{ GlErrorCheckPolicy::ePerCall };
+		// All platform contexts are created with vsync disabled.
+		mutable int m_swapInterval{ 0 };
+		mutable uint64_t m_callCount{};
+		mutable GLuint m_conditionalQuery{};
+		mutable bool m_conditionalInverted{ false };
+		mutable bool m_conditionalDiscard{ false };
 	};
 }
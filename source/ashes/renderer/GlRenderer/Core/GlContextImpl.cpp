@@ -4,6 +4,7 @@
 #	include "Platform/GlMswContext.hpp"
 #elif __linux__
 #	include "Platform/GlEglContext.hpp"
+#	include "Platform/GlHeadlessContext.hpp"
 #	include "Platform/GlWaylandContext.hpp"
 #	include "Platform/GlXcbContext.hpp"
 #	if ASHES_USE_XLIB_EGL
@@ -52,6 +53,19 @@ namespace ashes::gl
 			, mainContext );
 	}
 
+#	if Ashes_GlHeadlessSurface
+
+	ContextImplPtr ContextImpl::create( VkInstance instance
+		, VkHeadlessSurfaceCreateInfoEXT createInfo
+		, ContextImpl const * mainContext )
+	{
+		return std::make_unique< HeadlessContext >( instance
+			, std::move( createInfo )
+			, mainContext );
+	}
+
+#	endif
+
 #	ifdef VK_KHR_display
 
 	ContextImplPtr ContextImpl::create( VkInstance instance
@@ -24,6 +24,7 @@ namespace ashes::gl
 		virtual void enable()const = 0;
 		virtual void disable()const = 0;
 		virtual void swapBuffers()const = 0;
+		virtual void setSwapInterval( int interval )const = 0;
 		virtual VkExtent2D getExtent()const = 0;
 
 #ifdef _WIN32
@@ -40,6 +41,11 @@ namespace ashes::gl
 		static ContextImplPtr create( VkInstance instance
 			, VkWaylandSurfaceCreateInfoKHR createInfo
 			, ContextImpl const * mainContext );
+#	if Ashes_GlHeadlessSurface
+		static ContextImplPtr create( VkInstance instance
+			, VkHeadlessSurfaceCreateInfoEXT createInfo
+			, ContextImpl const * mainContext );
+#	endif
 #elif __APPLE__
 		static ContextImplPtr create( VkInstance instance
 			, VkMacOSSurfaceCreateInfoMVK createInfo
@@ -292,7 +292,7 @@ namespace ashes::gl
 			}
 		}
 
-		reportRegisteredObjects();
+		m_objects.reportLeaks();
 		get( m_instance )->unregisterDevice( get( this ) );
 	}
 
@@ -304,23 +304,12 @@ namespace ashes::gl
 		}
 	}
 
-	void Device::cleanupBlitSrcFbo()
+	void Device::evictCachedFramebuffers( ContextLock const & context
+		, GLuint object )const
 	{
-		if ( m_blitFbos[0] )
+		if ( m_fboCache )
 		{
-			deallocate( m_blitFbos[0]
-				, getAllocationCallbacks() );
-			m_blitFbos[0] = nullptr;
-		}
-	}
-
-	void Device::cleanupBlitDstFbo()
-	{
-		if ( m_blitFbos[1] )
-		{
-			deallocate( m_blitFbos[1]
-				, getAllocationCallbacks() );
-			m_blitFbos[1] = nullptr;
+			m_fboCache->evict( context, object );
 		}
 	}
 
@@ -668,14 +657,24 @@ namespace ashes::gl
 	void Device::doInitialiseContextDependent()
 	{
 		auto lock = getContext();
-		allocate( m_blitFbos[0]
-			, getAllocationCallbacks()
-			, get( this )
-			, GL_INVALID_INDEX );
-		allocate( m_blitFbos[1]
-			, getAllocationCallbacks()
-			, get( this )
-			, GL_INVALID_INDEX );
+		m_fboCache = std::make_unique< FramebufferCache >( get( this ) );
+		m_transferKernels = std::make_unique< TransferKernels >( get( this ), lock );
+
+		if ( hasConditionalRenderInverted( m_physicalDevice ) )
+		{
+			glLogCall( lock
+				, glGenQueries
+				, 1
+				, &m_neverPassingQuery );
+			glLogCall( lock
+				, glBeginQuery
+				, GL_QUERY_TYPE_SAMPLES_PASSED
+				, m_neverPassingQuery );
+			glLogCall( lock
+				, glEndQuery
+				, GL_QUERY_TYPE_SAMPLES_PASSED );
+		}
+
 		allocate( m_sampler
 			, getAllocationCallbacks()
 			, get( this )
@@ -711,49 +710,33 @@ namespace ashes::gl
 			m_sampler = nullptr;
 		}
 
-		cleanupBlitSrcFbo();
-		cleanupBlitDstFbo();
-	}
-
-	Device * Device::getDevice( VkDevice device )
-	{
-		return get( device );
-	}
-
-#if VK_EXT_debug_utils || VK_EXT_debug_marker
-
-	void Device::doRegisterObject( uint64_t object
-		, uint32_t objectType
-		, std::string const & typeName )const
-	{
-		std::stringstream stream;
-		stream.imbue( std::locale{ "C" } );
-		stream << "Created " << typeName
-			<< " [0x" << std::hex << std::setw( 8u ) << std::setfill( '0' ) << object << "]";
-		m_allocated.emplace( object
-			, ObjectAllocation{
-				typeName
-			} );
-	}
+		if ( m_fboCache )
+		{
+			m_fboCache->cleanup( getContext() );
+			m_fboCache.reset();
+		}
 
-	void Device::doUnregisterObject( uint64_t object )const
-	{
-		auto it = m_allocated.find( object );
-		assert( it != m_allocated.end() );
-		m_allocated.erase( it );
-	}
+		if ( m_transferKernels )
+		{
+			m_transferKernels->cleanup( getContext() );
+			m_transferKernels.reset();
+		}
 
-	void Device::doReportRegisteredObjects()const
-	{
-		for ( auto & alloc : m_allocated )
+		if ( m_neverPassingQuery )
 		{
-			std::stringstream stream;
-			stream << "Leaked [" << alloc.second.type << "]";
-			logError( stream.str().c_str() );
+			auto context = getContext();
+			glLogCall( context
+				, glDeleteQueries
+				, 1
+				, &m_neverPassingQuery );
+			m_neverPassingQuery = 0u;
 		}
 	}
 
-#endif
+	Device * Device::getDevice( VkDevice device )
+	{
+		return get( device );
+	}
 
 	bool has420PackExtensions( VkDevice device )
 	{
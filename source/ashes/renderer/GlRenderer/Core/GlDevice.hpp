@@ -7,8 +7,10 @@ See LICENSE file in root folder
 #include "renderer/GlRenderer/Command/GlCommandBuffer.hpp"
 #include "renderer/GlRenderer/Core/GlContextLock.hpp"
 #include "renderer/GlRenderer/Core/GlPhysicalDevice.hpp"
-
-#include <unordered_map>
+#include "renderer/GlRenderer/Miscellaneous/GlObjectTracker.hpp"
+#include "renderer/GlRenderer/Miscellaneous/GlQueryResultLinks.hpp"
+#include "renderer/GlRenderer/RenderPass/GlFramebufferCache.hpp"
+#include "renderer/GlRenderer/Shader/GlTransferKernels.hpp"
 
 namespace ashes::gl
 {
@@ -647,8 +649,8 @@ namespace ashes::gl
 		~Device();
 
 		void cleanupContextDependent( Context const & context );
-		void cleanupBlitSrcFbo();
-		void cleanupBlitDstFbo();
+		void evictCachedFramebuffers( ContextLock const & context
+			, GLuint object )const;
 		bool hasExtension( std::string_view extension )const;
 		VkPhysicalDeviceLimits const & getLimits()const;
 		void getImageSubresourceLayout( VkImage image
@@ -700,14 +702,32 @@ namespace ashes::gl
 			return m_dummyIndexed.indexBuffer;
 		}
 
-		inline VkFramebuffer getBlitSrcFbo()const
+		inline FramebufferCache & getFramebufferCache()const
 		{
-			return m_blitFbos[0];
+			assert( m_fboCache );
+			return *m_fboCache;
 		}
 
-		inline VkFramebuffer getBlitDstFbo()const
+		inline TransferKernels & getTransferKernels()const
+		{
+			assert( m_transferKernels );
+			return *m_transferKernels;
+		}
+		/**
+		*\return
+		*	An occlusion query that ended without any draw, used as a constant conditional rendering predicate.
+		*/
+		inline GLuint getNeverPassingQuery()const
 		{
-			return m_blitFbos[1];
+			return m_neverPassingQuery;
+		}
+		/**
+		*\return
+		*	The occlusion queries whose results were copied to memory, usable as conditional rendering predicates.
+		*/
+		inline QueryResultLinks & getQueryResultLinks()const
+		{
+			return m_queryResultLinks;
 		}
 
 		inline VkInstance getInstance()const
@@ -774,65 +794,61 @@ namespace ashes::gl
 			VkDeviceMemory vertexMemory{};
 			GeometryBuffersPtr geometryBuffers;
 		} m_dummyIndexed;
-		mutable VkFramebuffer m_blitFbos[2]{};
+		std::unique_ptr< FramebufferCache > m_fboCache;
+		std::unique_ptr< TransferKernels > m_transferKernels;
+		GLuint m_neverPassingQuery{};
+		mutable QueryResultLinks m_queryResultLinks;
 		mutable VkSampler m_sampler{};
 		VkPipelineColorBlendAttachmentStateArray m_cbStateAttachments;
 		VkDynamicStateArray m_dyState;
 
-		struct ObjectAllocation
-		{
-			std::string type;
-		};
-
-		mutable std::unordered_map< size_t, ObjectAllocation > m_allocated;
+		ObjectTracker m_objects;
 
 	public:
 		template< typename AshesType >
 		static inline void stRegisterObject( VkDevice device
 			, AshesType & object )
 		{
-			using DebugTypeTraits = AshesDebugTypeTraits< AshesType >;
-			getDevice( device )->doRegisterObject( uint64_t( get( &object ) )
-#if VK_EXT_debug_utils
-				, uint32_t( DebugTypeTraits::UtilsValue )
-#elif VK_EXT_debug_marker
-				, uint32_t( DebugTypeTraits::ReportValue )
-#endif
-				, DebugTypeTraits::getName() );
+			getDevice( device )->m_objects.registerObject( uint64_t( get( &object ) )
+				, getObjectTypeIndex< AshesType >() );
 		}
 
 		template< typename AshesType >
 		static inline void stUnregisterObject( VkDevice device
 			, AshesType & object )
 		{
-			getDevice( device )->doUnregisterObject( uint64_t( get( &object ) ) );
+			getDevice( device )->m_objects.unregisterObject( uint64_t( get( &object ) )
+				, getObjectTypeIndex< AshesType >() );
+		}
+
+		inline VkResult getObjectStatistics( uint32_t & count
+			, AshObjectTypeStatistics * statistics )const
+		{
+			return m_objects.getStatistics( count, statistics );
 		}
 
 	private:
 		static Device * getDevice( VkDevice device );
-		void doRegisterObject( uint64_t object
-			, uint32_t objectType
-			, std::string const & typeName )const;
-		void doUnregisterObject( uint64_t object )const;
-		void doReportRegisteredObjects()const;
-
-#ifndef NDEBUG
-#	define reportRegisteredObjects()\
-	doReportRegisteredObjects()
+
+		template< typename AshesType >
+		static inline uint32_t getObjectTypeIndex()
+		{
+			using DebugTypeTraits = AshesDebugTypeTraits< AshesType >;
+			static uint32_t const result = ObjectTracker::registerType(
+#if VK_EXT_debug_utils
+				DebugTypeTraits::UtilsValue
 #else
-#	define reportRegisteredObjects()
+				VK_OBJECT_TYPE_UNKNOWN
 #endif
+				, DebugTypeTraits::getName().c_str() );
+			return result;
+		}
 	};
 
-#ifndef NDEBUG
-#	define registerObject( Dev, Object )\
+#define registerObject( Dev, Object )\
 	Device::stRegisterObject( Dev, Object )
-#	define unregisterObject( Dev, Object )\
+#define unregisterObject( Dev, Object )\
 	Device::stUnregisterObject( Dev, Object )
-#else
-#	define registerObject( Dev, Object )
-#	define unregisterObject( Dev, Object )
-#endif
 
 
 	bool has420PackExtensions( VkDevice device );
@@ -5,6 +5,7 @@
 #include "Core/GlDevice.hpp"
 #include "Core/GlPhysicalDevice.hpp"
 #include "Core/GlSurface.hpp"
+#include "Miscellaneous/GlPluginCache.hpp"
 #include "Miscellaneous/GlWindow.hpp"
 
 #include <algorithm>
@@ -108,6 +109,7 @@ namespace ashes::gl
 		, m_window{ new gl::RenderWindow( MinMajor, MinMinor, "GlInstance" ) }
 	{
 		m_extensions.initialise();
+		PluginCache::update( m_extensions );
 		m_features = m_extensions.getFeatures();
 		m_hasViewportArray = m_extensions.find( ARB_viewport_array );
 		auto it = std::find_if( m_enabledLayerNames.begin()
@@ -117,9 +119,7 @@ namespace ashes::gl
 				return lookup == "validation";
 			} );
 		m_validationEnabled = it != m_enabledLayerNames.end();
-		m_context = Context::create( get( this )
-			, m_window->getCreateInfo()
-			, nullptr );
+		m_context = doCreateWindowContext();
 		ContextLock context{ *m_context };
 		glCheckError( context, "ContextInitialisation", true );
 		m_physicalDevices.emplace_back( VkPhysicalDevice( new PhysicalDevice{ VkInstance( this ) } ) );
@@ -186,9 +186,7 @@ namespace ashes::gl
 		if ( m_surfaces.empty() )
 		{
 			m_firstSurfaceContext = nullptr;
-			m_context = Context::create( get( this )
-				, m_window->getCreateInfo()
-				, nullptr );
+			m_context = doCreateWindowContext();
 
 			for ( auto & device : m_devices )
 			{
@@ -252,6 +250,14 @@ namespace ashes::gl
 				, glSurface->getWaylandCreateInfo()
 				, nullptr );
 		}
+#	if Ashes_GlHeadlessSurface
+		else if ( glSurface->isHeadless() )
+		{
+			result = Context::create( get( this )
+				, glSurface->getHeadlessCreateInfo()
+				, nullptr );
+		}
+#	endif
 
 #elif __APPLE__
 
@@ -277,6 +283,22 @@ namespace ashes::gl
 		return result;
 	}
 
+	ContextPtr Instance::doCreateWindowContext()
+	{
+#if Ashes_GlHeadlessSurface
+		if ( m_window->isHeadless() )
+		{
+			return Context::create( get( this )
+				, m_window->getHeadlessCreateInfo()
+				, nullptr );
+		}
+#endif
+
+		return Context::create( get( this )
+			, m_window->getCreateInfo()
+			, nullptr );
+	}
+
 	VkPhysicalDeviceArray Instance::enumeratePhysicalDevices()const
 	{
 		return m_physicalDevices;
@@ -377,6 +399,7 @@ namespace ashes::gl
 			glLogCall( context
 				, glEnable
 				, GL_DEBUG_OUTPUT_SYNC );
+			context->onDebugCallbackReplaced();
 		}
 	}
 
@@ -439,6 +462,7 @@ namespace ashes::gl
 			glLogCall( context
 				, glEnable
 				, GL_DEBUG_OUTPUT_SYNC );
+			context->onDebugCallbackReplaced();
 		}
 	}
 
@@ -506,6 +530,7 @@ namespace ashes::gl
 				, glDebugMessageCallback
 				, callback.callback
 				, callback.userParam );
+			lock->onDebugCallbackReplaced();
 		}
 
 		for ( auto & callback : m_debugAMDMessengers )
@@ -525,6 +550,7 @@ namespace ashes::gl
 				, glDebugMessageCallback
 				, callback.callback
 				, callback.userParam );
+			lock->onDebugCallbackReplaced();
 		}
 
 		for ( auto & callback : m_debugAMDCallbacks )
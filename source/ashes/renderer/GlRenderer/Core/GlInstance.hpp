@@ -160,6 +160,9 @@ namespace ashes::gl
 			return ashes::makeVersion( getDefaultMajor(), getDefaultMinor(), 0 );
 		}
 
+	private:
+		ContextPtr doCreateWindowContext();
+
 	private:
 		VkApplicationInfo m_applicationInfo;
 		StringArray m_enabledLayerNames;
@@ -160,7 +160,14 @@ namespace ashes::gl
 			VkExtensionProperties{ VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME, VK_KHR_PORTABILITY_SUBSET_SPEC_VERSION },
 #endif
 		};
-		return extensions;
+		auto result = extensions;
+#if VK_EXT_conditional_rendering
+		if ( m_glFeatures.hasConditionalRenderInverted )
+		{
+			result.push_back( VkExtensionProperties{ VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME, VK_EXT_CONDITIONAL_RENDERING_SPEC_VERSION } );
+		}
+#endif
+		return result;
 	}
 
 	VkPhysicalDeviceProperties const & PhysicalDevice::getProperties()const
@@ -886,6 +893,7 @@ namespace ashes::gl
 		m_glFeatures.hasTextureViews = find( ARB_texture_view );
 		m_glFeatures.hasViewportArrays = find( ARB_viewport_array );
 		m_glFeatures.hasProgramInterfaceQuery = find( ARB_program_interface_query );
+		m_glFeatures.hasConditionalRenderInverted = find( ARB_conditional_render_inverted );
 
 		ContextLock context{ get( m_instance )->getCurrentContext() };
 		doInitialiseMemoryProperties( context );
@@ -896,6 +904,7 @@ namespace ashes::gl
 		doInitialisePortability( context );
 		doInitialiseDriverProperties( context );
 		doInitialiseInlineUniformBlock( context );
+		doInitialiseConditionalRendering( context );
 	}
 
 	void PhysicalDevice::doInitialiseFeatures( ContextLock & context )
@@ -1257,6 +1266,18 @@ namespace ashes::gl
 		m_inlineUniformBlockProperties.maxDescriptorSetUpdateAfterBindInlineUniformBlocks = 4u;
 		m_inlineUniformBlockProperties.maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks = 4u;
 
+#endif
+	}
+
+	void PhysicalDevice::doInitialiseConditionalRendering( ContextLock & context )
+	{
+#if VK_EXT_conditional_rendering
+
+		m_conditionalRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT;
+		m_conditionalRenderingFeatures.pNext = nullptr;
+		m_conditionalRenderingFeatures.conditionalRendering = m_glFeatures.hasConditionalRenderInverted;
+		m_conditionalRenderingFeatures.inheritedConditionalRendering = VK_FALSE;
+
 #endif
 	}
 
@@ -1299,4 +1320,9 @@ namespace ashes::gl
 	{
 		return get( physicalDevice )->getGlFeatures().hasProgramInterfaceQuery != 0;
 	}
+
+	bool hasConditionalRenderInverted( VkPhysicalDevice physicalDevice )
+	{
+		return get( physicalDevice )->getGlFeatures().hasConditionalRenderInverted != 0;
+	}
 }
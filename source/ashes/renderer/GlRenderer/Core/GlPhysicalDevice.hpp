@@ -68,6 +68,12 @@ namespace ashes::gl
 			return m_inlineUniformBlockProperties;
 		}
 #endif
+#if VK_EXT_conditional_rendering
+		VkPhysicalDeviceConditionalRenderingFeaturesEXT getConditionalRenderingFeatures()const
+		{
+			return m_conditionalRenderingFeatures;
+		}
+#endif
 
 		bool find( VkExtensionProperties const & name )const;
 		bool findAny( VkExtensionPropertiesArray const & names )const;
@@ -95,6 +101,7 @@ namespace ashes::gl
 		void doInitialiseDriverProperties( ContextLock & context );
 		void doInitialisePortability( ContextLock & context );
 		void doInitialiseInlineUniformBlock( ContextLock & context );
+		void doInitialiseConditionalRendering( ContextLock & context );
 
 	private:
 		VkInstance m_instance;
@@ -117,6 +124,9 @@ namespace ashes::gl
 		VkPhysicalDeviceInlineUniformBlockFeaturesEXT m_inlineUniformBlockFeatures{};
 		VkPhysicalDeviceInlineUniformBlockPropertiesEXT m_inlineUniformBlockProperties{};
 #endif
+#if VK_EXT_conditional_rendering
+		VkPhysicalDeviceConditionalRenderingFeaturesEXT m_conditionalRenderingFeatures{};
+#endif
 #ifdef VK_KHR_display
 		std::vector< std::string > m_displayNames;
 		std::vector< VkDisplayPropertiesKHR >m_displays;
@@ -132,4 +142,5 @@ namespace ashes::gl
 	bool hasTextureViews( VkPhysicalDevice physicalDevice );
 	bool hasViewportArrays( VkPhysicalDevice physicalDevice );
 	bool hasProgramInterfaceQuery( VkPhysicalDevice physicalDevice );
+	bool hasConditionalRenderInverted( VkPhysicalDevice physicalDevice );
 }
@@ -20,8 +20,7 @@ namespace ashes::gl
 		, m_win32CreateInfo{ createInfo }
 	{
 		m_context = get( m_instance )->registerSurface( get( this ) );
-		m_presentModes.push_back( VK_PRESENT_MODE_FIFO_KHR );
-		getDefaultSurfaceInfos( m_surfaceFormats, m_surfaceCapabilities );
+		getDefaultSurfaceInfos( m_surfaceFormats, m_presentModes, m_surfaceCapabilities );
 		updateSurfaceInfos();
 	}
 
@@ -34,8 +33,7 @@ namespace ashes::gl
 		, m_xlibCreateInfo{ createInfo }
 	{
 		m_context = get( m_instance )->registerSurface( get( this ) );
-		m_presentModes.push_back( VK_PRESENT_MODE_FIFO_KHR );
-		getDefaultSurfaceInfos( m_surfaceFormats, m_surfaceCapabilities );
+		getDefaultSurfaceInfos( m_surfaceFormats, m_presentModes, m_surfaceCapabilities );
 		updateSurfaceInfos();
 	}
 
@@ -46,8 +44,7 @@ namespace ashes::gl
 		, m_xcbCreateInfo{ createInfo }
 	{
 		m_context = get( m_instance )->registerSurface( get( this ) );
-		m_presentModes.push_back( VK_PRESENT_MODE_FIFO_KHR );
-		getDefaultSurfaceInfos( m_surfaceFormats, m_surfaceCapabilities );
+		getDefaultSurfaceInfos( m_surfaceFormats, m_presentModes, m_surfaceCapabilities );
 		updateSurfaceInfos();
 	}
 
@@ -58,11 +55,24 @@ namespace ashes::gl
 		, m_waylandCreateInfo{ createInfo }
 	{
 		m_context = get( m_instance )->registerSurface( get( this ) );
-		m_presentModes.push_back( VK_PRESENT_MODE_FIFO_KHR );
-		getDefaultSurfaceInfos( m_surfaceFormats, m_surfaceCapabilities );
+		getDefaultSurfaceInfos( m_surfaceFormats, m_presentModes, m_surfaceCapabilities );
 		updateSurfaceInfos();
 	}
 
+#	if Ashes_GlHeadlessSurface
+
+	SurfaceKHR::SurfaceKHR( VkAllocationCallbacks const * allocInfo
+		, VkInstance instance
+		, VkHeadlessSurfaceCreateInfoEXT createInfo )
+		: m_instance{ instance }
+		, m_headlessCreateInfo{ createInfo }
+	{
+		m_context = get( m_instance )->registerSurface( get( this ) );
+		getDefaultSurfaceInfos( m_surfaceFormats, m_presentModes, m_surfaceCapabilities );
+	}
+
+#	endif
+
 #elif __APPLE__
 
 	SurfaceKHR::SurfaceKHR( VkAllocationCallbacks const * allocInfo
@@ -72,8 +82,7 @@ namespace ashes::gl
 		, m_macOSCreateInfo{ createInfo }
 	{
 		m_context = get( m_instance )->registerSurface( get( this ) );
-		m_presentModes.push_back( VK_PRESENT_MODE_FIFO_KHR );
-		getDefaultSurfaceInfos( m_surfaceFormats, m_surfaceCapabilities );
+		getDefaultSurfaceInfos( m_surfaceFormats, m_presentModes, m_surfaceCapabilities );
 		updateSurfaceInfos();
 	}
 
@@ -88,8 +97,7 @@ namespace ashes::gl
 	{
 		m_context = get( m_instance )->registerSurface( get( this ) );
 		m_displayCreateInfo.imageExtent = m_context->getExtent();
-		m_presentModes.push_back( VK_PRESENT_MODE_FIFO_KHR );
-		getDefaultSurfaceInfos( m_surfaceFormats, m_surfaceCapabilities );
+		getDefaultSurfaceInfos( m_surfaceFormats, m_presentModes, m_surfaceCapabilities );
 		updateSurfaceInfos();
 	}
 
@@ -102,16 +110,29 @@ namespace ashes::gl
 
 	void SurfaceKHR::updateSurfaceInfos()
 	{
+#if Ashes_GlHeadlessSurface
+		// A headless surface has no extent, the swapchain's one is used.
+		if ( isHeadless() )
+		{
+			return;
+		}
+#endif
+
 		m_surfaceCapabilities.currentExtent = m_context->getExtent();
 	}
 
 	void SurfaceKHR::getDefaultSurfaceInfos( VkSurfaceFormatArrayKHR & formats
+		, VkPresentModeArrayKHR & presentModes
 		, VkSurfaceCapabilitiesKHR & capabilities )
 	{
 		formats.push_back( { VK_FORMAT_R8G8B8A8_UNORM, VK_COLORSPACE_SRGB_NONLINEAR_KHR } );
+		// Present modes are mapped to the context's swap interval.
+		presentModes.push_back( VK_PRESENT_MODE_FIFO_KHR );
+		presentModes.push_back( VK_PRESENT_MODE_MAILBOX_KHR );
+		presentModes.push_back( VK_PRESENT_MODE_IMMEDIATE_KHR );
 
 		capabilities.minImageCount = 1u;
-		capabilities.maxImageCount = 1u;
+		capabilities.maxImageCount = 3u;
 		capabilities.currentExtent.width = ~( 0u );
 		capabilities.currentExtent.height = ~( 0u );
 		capabilities.minImageExtent = { 1u, 1u };
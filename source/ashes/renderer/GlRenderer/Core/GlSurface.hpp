@@ -26,6 +26,11 @@ namespace ashes::gl
 		SurfaceKHR( VkAllocationCallbacks const * allocInfo
 			, VkInstance instance
 			, VkWaylandSurfaceCreateInfoKHR createInfo );
+#	if Ashes_GlHeadlessSurface
+		SurfaceKHR( VkAllocationCallbacks const * allocInfo
+			, VkInstance instance
+			, VkHeadlessSurfaceCreateInfoEXT createInfo );
+#	endif
 #elif __APPLE__
 		SurfaceKHR( VkAllocationCallbacks const * allocInfo
 			, VkInstance instance
@@ -103,6 +108,20 @@ namespace ashes::gl
 			return m_waylandCreateInfo.sType != 0;
 		}
 
+#	if Ashes_GlHeadlessSurface
+
+		inline VkHeadlessSurfaceCreateInfoEXT getHeadlessCreateInfo()const
+		{
+			return m_headlessCreateInfo;
+		}
+
+		inline bool isHeadless()const
+		{
+			return m_headlessCreateInfo.sType != 0;
+		}
+
+#	endif
+
 #elif __APPLE__
 
 		inline VkMacOSSurfaceCreateInfoMVK getMacOSCreateInfo()const
@@ -138,6 +157,7 @@ namespace ashes::gl
 	private:
 		void updateSurfaceInfos();
 		static void getDefaultSurfaceInfos( VkSurfaceFormatArrayKHR & formats
+			, VkPresentModeArrayKHR & presentModes
 			, VkSurfaceCapabilitiesKHR & capabilities );
 
 	private:
@@ -148,6 +168,9 @@ namespace ashes::gl
 		VkXlibSurfaceCreateInfoKHR m_xlibCreateInfo{};
 		VkXcbSurfaceCreateInfoKHR m_xcbCreateInfo{};
 		VkWaylandSurfaceCreateInfoKHR m_waylandCreateInfo{};
+#	if Ashes_GlHeadlessSurface
+		VkHeadlessSurfaceCreateInfoEXT m_headlessCreateInfo{};
+#	endif
 #elif __APPLE__
 		VkMacOSSurfaceCreateInfoMVK m_macOSCreateInfo{};
 #endif
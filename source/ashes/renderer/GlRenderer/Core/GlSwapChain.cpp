@@ -5,6 +5,7 @@
 #include "Image/GlImageView.hpp"
 #include "Miscellaneous/GlCallLogger.hpp"
 #include "RenderPass/GlFrameBuffer.hpp"
+#include "Sync/GlFence.hpp"
 
 #include "ashesgl_api.hpp"
 
@@ -135,6 +136,22 @@ namespace ashes::gl
 
 			return result;
 		}
+
+		int getSwapInterval( VkPresentModeKHR presentMode )
+		{
+			switch ( presentMode )
+			{
+			case VK_PRESENT_MODE_IMMEDIATE_KHR:
+				return 0;
+			case VK_PRESENT_MODE_MAILBOX_KHR:
+				// GL can't replace a queued frame, the closest behaviour is not to wait for vblank.
+				return 0;
+			case VK_PRESENT_MODE_FIFO_RELAXED_KHR:
+				return -1;
+			default:
+				return 1;
+			}
+		}
 	}
 
 	SwapchainKHR::SwapchainKHR( VkAllocationCallbacks const * allocInfo
@@ -147,37 +164,42 @@ namespace ashes::gl
 		get( m_device )->link( m_createInfo.surface );
 		m_createInfo.imageExtent.height = std::max( 1u, m_createInfo.imageExtent.height );
 		m_createInfo.imageExtent.width = std::max( 1u, m_createInfo.imageExtent.width );
+		auto maxImageCount = get( m_createInfo.surface )->getCapabilities().maxImageCount;
+		m_images.resize( std::min( std::max( 1u, m_createInfo.minImageCount ), maxImageCount ) );
+		m_presentFences.resize( m_images.size(), nullptr );
 
-		m_image = createImage( device
-			, m_allocInfo
-			, m_createInfo.imageFormat
-			, m_createInfo.imageExtent
-			, m_deviceMemory );
-
-		if ( hasTextureViews( device ) )
+		try
 		{
-			try
+			for ( auto & image : m_images )
 			{
-				m_view = createImageView( device
+				image.image = createImage( device
 					, m_allocInfo
-					, m_image
-					, m_createInfo.imageFormat );
-			}
-			catch ( ashes::Exception & )
-			{
-				deallocate( m_deviceMemory
-					, m_allocInfo );
-				deallocate( m_image
-					, m_allocInfo );
-				throw;
+					, m_createInfo.imageFormat
+					, m_createInfo.imageExtent
+					, image.memory );
+
+				if ( hasTextureViews( device ) )
+				{
+					image.view = createImageView( device
+						, m_allocInfo
+						, image.image
+						, m_createInfo.imageFormat );
+				}
 			}
 		}
+		catch ( ashes::Exception & )
+		{
+			doCleanup();
+			get( m_device )->unlink( m_createInfo.surface );
+			throw;
+		}
 
 		auto context = get( m_device )->getContext();
 		glLogCall( context
 			, glGenFramebuffers
 			, 1
 			, &m_internal );
+		RendererStatistics::addFramebuffer();
 		glLogCall( context
 			, glBindFramebuffer
 			, GL_FRAMEBUFFER
@@ -187,9 +209,7 @@ namespace ashes::gl
 			, GL_FRAMEBUFFER
 			, GL_ATTACHMENT_POINT_COLOR0
 			, GL_TEXTURE_2D
-			, ( hasTextureViews( device )
-				? get( m_view )->getInternal()
-				: get( m_image )->getInternal() )
+			, doGetTexture( 0u )
 			, 0u );
 		checkCompleteness( get( this )
 			, context->glCheckFramebufferStatus( GL_FRAMEBUFFER ) );
@@ -210,29 +230,35 @@ namespace ashes::gl
 				, 1
 				, &m_internal );
 
-			if ( hasTextureViews( m_device ) )
+			for ( auto & fence : m_presentFences )
 			{
-				deallocate( m_view
-					, m_allocInfo );
+				if ( fence )
+				{
+					glLogCall( context
+						, glDeleteSync
+						, fence );
+				}
 			}
 
-			deallocate( m_deviceMemory
-				, m_allocInfo );
-			deallocate( m_image
-				, m_allocInfo );
+			doCleanup();
 		}
 		get( m_device )->unlink( m_createInfo.surface );
 	}
 
 	uint32_t SwapchainKHR::getImageCount()const
 	{
-		return 1u;
+		return uint32_t( m_images.size() );
 	}
 
 	VkImageArray SwapchainKHR::getImages()const
 	{
 		VkImageArray result;
-		result.emplace_back( m_image );
+
+		for ( auto & image : m_images )
+		{
+			result.emplace_back( image.image );
+		}
+
 		return result;
 	}
 
@@ -241,12 +267,62 @@ namespace ashes::gl
 		, VkFence fence
 		, uint32_t & imageIndex )const
 	{
-		imageIndex = 0u;
+		auto context = get( m_device )->getContext();
+		auto & presentFence = m_presentFences[m_nextImage];
+
+		if ( presentFence )
+		{
+			// Only wait for the presentation blit of this image, not for the whole frame.
+			auto res = glLogNonVoidCall( context
+				, glClientWaitSync
+				, presentFence
+				, GL_WAIT_FLAG_SYNC_FLUSH_COMMANDS_BIT
+				, timeout );
+
+			if ( res == GL_WAIT_RESULT_TIMEOUT_EXPIRED )
+			{
+				return timeout
+					? VK_TIMEOUT
+					: VK_NOT_READY;
+			}
+
+			if ( res != GL_WAIT_RESULT_ALREADY_SIGNALED
+				&& res != GL_WAIT_RESULT_CONDITION_SATISFIED )
+			{
+				return VK_ERROR_DEVICE_LOST;
+			}
+
+			glLogCall( context
+				, glDeleteSync
+				, presentFence );
+			presentFence = nullptr;
+		}
+
+		imageIndex = m_nextImage;
+		m_nextImage = ( m_nextImage + 1u ) % uint32_t( m_images.size() );
+
+		// All the work goes through the same GL context, in submission order,
+		// so the semaphore is implicitly signaled, only the fence needs an actual sync object.
+		if ( fence )
+		{
+			get( fence )->insert( context );
+		}
+
 		return VK_SUCCESS;
 	}
 
 	VkResult SwapchainKHR::present( uint32_t imageIndex )const
 	{
+#if Ashes_GlHeadlessSurface
+		if ( get( m_createInfo.surface )->isHeadless() )
+		{
+			// Nothing is displayed, the image just goes back to the acquirable ones.
+			auto context = get( m_device )->getContext();
+			doInsertPresentFence( context, imageIndex );
+			return VK_SUCCESS;
+		}
+#endif
+
 		auto srcExtent = m_createInfo.imageExtent;
 		auto dstExtent = m_createInfo.imageExtent;
 
@@ -276,9 +352,7 @@ namespace ashes::gl
 			, GL_READ_FRAMEBUFFER
 			, GL_ATTACHMENT_POINT_COLOR0
 			, GL_TEXTURE_2D
-			, ( hasTextureViews( m_device )
-				? get( m_view )->getInternal()
-				: get( m_image )->getInternal() )
+			, doGetTexture( imageIndex )
 			, 0u );
 		glLogCall( context
 			, glReadBuffer
@@ -296,6 +370,9 @@ namespace ashes::gl
 			, glBindFramebuffer
 			, GL_READ_FRAMEBUFFER
 			, 0 );
+
+		doInsertPresentFence( context, imageIndex );
+		context->setSwapInterval( getSwapInterval( m_createInfo.presentMode ) );
 		context->swapBuffers();
 
 		if ( context->hasPushDebugGroup() )
@@ -306,4 +383,56 @@ namespace ashes::gl
 
 		return VK_SUCCESS;
 	}
+
+	void SwapchainKHR::doCleanup()
+	{
+		for ( auto & image : m_images )
+		{
+			if ( image.view )
+			{
+				deallocate( image.view
+					, m_allocInfo );
+			}
+
+			if ( image.memory )
+			{
+				deallocate( image.memory
+					, m_allocInfo );
+			}
+
+			if ( image.image )
+			{
+				deallocate( image.image
+					, m_allocInfo );
+			}
+		}
+
+		m_images.clear();
+	}
+
+	void SwapchainKHR::doInsertPresentFence( ContextLock const & context
+		, uint32_t imageIndex )const
+	{
+		auto & presentFence = m_presentFences[imageIndex];
+
+		if ( presentFence )
+		{
+			glLogCall( context
+				, glDeleteSync
+				, presentFence );
+		}
+
+		presentFence = glLogNonVoidCall( context
+			, glFenceSync
+			, GL_WAIT_FLAG_SYNC_GPU_COMMANDS_COMPLETE
+			, 0u );
+	}
+
+	GLuint SwapchainKHR::doGetTexture( uint32_t imageIndex )const
+	{
+		auto & image = m_images[imageIndex];
+		return hasTextureViews( m_device )
+			? get( image.view )->getInternal()
+			: get( image.image )->getInternal();
+	}
 }
@@ -33,12 +33,26 @@ namespace ashes::gl
 			return m_device;
 		}
 
+	private:
+		struct Image
+		{
+			VkImage image{};
+			VkDeviceMemory memory{};
+			VkImageView view{};
+		};
+
+		void doCleanup();
+		void doInsertPresentFence( ContextLock const & context
+			, uint32_t imageIndex )const;
+		GLuint doGetTexture( uint32_t imageIndex )const;
+
 	private:
 		VkAllocationCallbacks const * m_allocInfo;
 		VkDevice m_device;
 		VkSwapchainCreateInfoKHR m_createInfo;
-		VkImage m_image;
-		VkDeviceMemory m_deviceMemory;
-		VkImageView m_view;
+		std::vector< Image > m_images;
+		// Signaled once the presentation blit has read the image.
+		mutable std::vector< GLsync > m_presentFences;
+		mutable uint32_t m_nextImage{ 0u };
 	};
 }
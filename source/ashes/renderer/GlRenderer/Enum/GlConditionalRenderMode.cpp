@@ -0,0 +1,32 @@
+#include "GlRendererPrerequisites.hpp"
+
+namespace ashes::gl
+{
+	std::string getName( GlConditionalRenderMode value )
+	{
+		switch ( value )
+		{
+		case GL_CONDITIONAL_RENDER_QUERY_WAIT:
+			return "GL_QUERY_WAIT";
+
+		case GL_CONDITIONAL_RENDER_QUERY_NO_WAIT:
+			return "GL_QUERY_NO_WAIT";
+
+		case GL_CONDITIONAL_RENDER_QUERY_BY_REGION_WAIT:
+			return "GL_QUERY_BY_REGION_WAIT";
+
+		case GL_CONDITIONAL_RENDER_QUERY_BY_REGION_NO_WAIT:
+			return "GL_QUERY_BY_REGION_NO_WAIT";
+
+		case GL_CONDITIONAL_RENDER_QUERY_WAIT_INVERTED:
+			return "GL_QUERY_WAIT_INVERTED";
+
+		case GL_CONDITIONAL_RENDER_QUERY_NO_WAIT_INVERTED:
+			return "GL_QUERY_NO_WAIT_INVERTED";
+
+		default:
+			assert( false && "Unsupported GlConditionalRenderMode" );
+			return "GlConditionalRenderMode_UNKNOWN";
+		}
+	}
+}
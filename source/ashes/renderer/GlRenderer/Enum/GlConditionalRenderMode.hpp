@@ -0,0 +1,21 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+namespace ashes::gl
+{
+	enum GlConditionalRenderMode
+		: GLenum
+	{
+		GL_CONDITIONAL_RENDER_QUERY_WAIT = 0x8E13,
+		GL_CONDITIONAL_RENDER_QUERY_NO_WAIT = 0x8E14,
+		GL_CONDITIONAL_RENDER_QUERY_BY_REGION_WAIT = 0x8E15,
+		GL_CONDITIONAL_RENDER_QUERY_BY_REGION_NO_WAIT = 0x8E16,
+		GL_CONDITIONAL_RENDER_QUERY_WAIT_INVERTED = 0x8E17,
+		GL_CONDITIONAL_RENDER_QUERY_NO_WAIT_INVERTED = 0x8E18,
+	};
+	std::string getName( GlConditionalRenderMode value );
+	inline std::string toString( GlConditionalRenderMode value ) { return getName( value ); }
+}
@@ -6,9 +6,15 @@ namespace ashes::gl
 	{
 		switch ( value )
 		{
+		case GL_UNPACK_ROW_LENGTH:
+			return "GL_UNPACK_ROW_LENGTH";
+
 		case GL_UNPACK_ALIGNMENT:
 			return "GL_UNPACK_ALIGNMENT";
 
+		case GL_UNPACK_IMAGE_HEIGHT:
+			return "GL_UNPACK_IMAGE_HEIGHT";
+
 		case GL_PACK_ALIGNMENT:
 			return "GL_PACK_ALIGNMENT";
 
@@ -9,7 +9,9 @@ namespace ashes::gl
 	enum GlPackAlignment
 		: uint32_t
 	{
+		GL_UNPACK_ROW_LENGTH = 0x0CF2,
 		GL_UNPACK_ALIGNMENT = 0x0CF5,
+		GL_UNPACK_IMAGE_HEIGHT = 0x806E,
 		GL_PACK_ALIGNMENT = 0x0D05,
 	};
 	std::string getName( GlPackAlignment value );
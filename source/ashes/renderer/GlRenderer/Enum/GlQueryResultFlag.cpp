@@ -12,6 +12,9 @@ namespace ashes::gl
 		case GL_QUERY_RESULT:
 			return "GL_QUERY_RESULT";
 
+		case GL_QUERY_RESULT_AVAILABLE:
+			return "GL_QUERY_RESULT_AVAILABLE";
+
 		case GL_QUERY_RESULT_NO_WAIT:
 			return "GL_QUERY_RESULT_NO_WAIT";
 
@@ -114,6 +114,9 @@ namespace ashes::gl
 		case GL_DEBUG_OUTPUT_SYNC:
 			return "GL_DEBUG_OUTPUT_SYNCHRONOUS";
 
+		case GL_DEBUG_OUTPUT:
+			return "GL_DEBUG_OUTPUT";
+
 		default:
 			assert( false && "Unsupported GlTweak" );
 			return "GlTweak_UNKNOWN";
@@ -45,6 +45,7 @@ namespace ashes::gl
 		GL_SAMPLE_SHADING = 0x8C36,
 		GL_FRAMEBUFFER_SRGB = 0x8DB9,
 		GL_DEBUG_OUTPUT_SYNC = 0x8242,
+		GL_DEBUG_OUTPUT = 0x92E0,
 	};
 	std::string getName( GlTweak value );
 	inline std::string toString( GlTweak value ) { return getName( value ); }
@@ -290,6 +290,8 @@ namespace ashes::gl
 			return "GL_SMOOTH_LINE_WIDTH_RANGE";
 		case GL_VALUE_NAME_SUBPIXEL_BITS:
 			return "GL_SUBPIXEL_BITS";
+		case GL_VALUE_NAME_TIMESTAMP:
+			return "GL_TIMESTAMP";
 		case GL_VALUE_NAME_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX:
 			return "GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX";
 		case GL_VALUE_NAME_TEXTURE_FREE_MEMORY_ATI:
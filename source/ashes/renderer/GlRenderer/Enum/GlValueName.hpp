@@ -154,6 +154,7 @@ namespace ashes::gl
 		GL_VALUE_NAME_TEXTURE_BUFFER_OFFSET_ALIGNMENT = 0x919F,
 		GL_VALUE_NAME_SMOOTH_LINE_WIDTH_RANGE = 0x0B22,
 		GL_VALUE_NAME_SUBPIXEL_BITS = 0x0D50,
+		GL_VALUE_NAME_TIMESTAMP = 0x8E28,
 		GL_VALUE_NAME_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX = 0x9048,
 		GL_VALUE_NAME_TEXTURE_FREE_MEMORY_ATI = 0x87FC,
 	};
@@ -1,5 +1,7 @@
 #include "GlRendererPrerequisites.hpp"
 
+#include "RenderPass/GlFramebufferCache.hpp"
+
 #include "ashesgl_api.hpp"
 
 namespace ashes::gl
@@ -454,6 +456,81 @@ namespace ashes::gl
 #endif
 	}
 
+	void FboAttachment::bindCached( ContextStateStack & stack
+		, uint32_t pmipLevel
+		, GlFrameBufferTarget fboTarget
+		, CmdList & list )const
+	{
+		doBindCached( stack
+			, pmipLevel
+			, ( ( target == GL_TEXTURE_1D
+					|| target == GL_TEXTURE_2D
+					|| target == GL_TEXTURE_2D_MULTISAMPLE )
+				? 0u
+				: FramebufferCache::LayeredAttachment )
+			, fboTarget
+			, list );
+	}
+
+	void FboAttachment::bindCached( ContextStateStack & stack
+		, uint32_t pmipLevel
+		, uint32_t layer
+		, GlFrameBufferTarget fboTarget
+		, CmdList & list )const
+	{
+		bindCached( stack, pmipLevel, layer, layer, fboTarget, list );
+	}
+
+	void FboAttachment::bindCached( ContextStateStack & stack
+		, uint32_t pmipLevel
+		, uint32_t layer
+		, uint32_t slice
+		, GlFrameBufferTarget fboTarget
+		, CmdList & list )const
+	{
+		uint32_t fboLayer = FramebufferCache::LayeredAttachment;
+
+		if ( target == GL_TEXTURE_1D
+			|| target == GL_TEXTURE_2D
+			|| target == GL_TEXTURE_2D_MULTISAMPLE )
+		{
+			fboLayer = 0u;
+		}
+		else if ( target == GL_TEXTURE_3D )
+		{
+			fboLayer = slice;
+		}
+		else if ( target == GL_TEXTURE_CUBE
+			|| target == GL_TEXTURE_1D_ARRAY
+			|| target == GL_TEXTURE_2D_ARRAY
+			|| target == GL_TEXTURE_2D_MULTISAMPLE_ARRAY
+			|| target == GL_TEXTURE_CUBE_ARRAY )
+		{
+			fboLayer = layer;
+		}
+
+		doBindCached( stack, pmipLevel, fboLayer, fboTarget, list );
+	}
+
+	void FboAttachment::doBindCached( ContextStateStack & stack
+		, uint32_t pmipLevel
+		, uint32_t fboLayer
+		, GlFrameBufferTarget fboTarget
+		, CmdList & list )const
+	{
+		list.push_back( makeCmd< OpType::eBindCachedFramebuffer >( fboTarget
+			, point
+			, target
+			, object
+			, pmipLevel
+			, fboLayer ) );
+
+		if ( isSrgb && !isDepthOrStencil() )
+		{
+			stack.applySRGBStatus( list, isSrgb );
+		}
+	}
+
 	//*********************************************************************************************
 
 	LayerCopy::LayerCopy( VkDevice device
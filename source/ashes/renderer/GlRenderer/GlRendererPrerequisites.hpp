@@ -44,6 +44,12 @@
 
 #define Ashes_GlRemoveExtensions 0
 
+#if defined( __linux__ ) && defined( VK_EXT_headless_surface )
+#	define Ashes_GlHeadlessSurface 1
+#else
+#	define Ashes_GlHeadlessSurface 0
+#endif
+
 namespace ashes::gl
 {
 #if VK_EXT_debug_utils
@@ -168,6 +174,7 @@ namespace ashes::gl
 		VkBool32 hasTextureViews;
 		VkBool32 hasViewportArrays;
 		VkBool32 hasProgramInterfaceQuery;
+		VkBool32 hasConditionalRenderInverted;
 	};
 
 	struct AttachmentDescription
@@ -284,6 +291,21 @@ namespace ashes::gl
 			, CmdList & list )const;
 		void draw( ContextStateStack & stack
 			, CmdList & list )const;
+		void bindCached( ContextStateStack & stack
+			, uint32_t mipLevel
+			, GlFrameBufferTarget fboTarget
+			, CmdList & list )const;
+		void bindCached( ContextStateStack & stack
+			, uint32_t mipLevel
+			, uint32_t layer
+			, GlFrameBufferTarget fboTarget
+			, CmdList & list )const;
+		void bindCached( ContextStateStack & stack
+			, uint32_t mipLevel
+			, uint32_t layer
+			, uint32_t slice
+			, GlFrameBufferTarget fboTarget
+			, CmdList & list )const;
 
 		bool isDepthOrStencil()const
 		{
@@ -291,6 +313,13 @@ namespace ashes::gl
 				|| point == GL_ATTACHMENT_POINT_DEPTH
 				|| point == GL_ATTACHMENT_POINT_STENCIL;
 		}
+
+	private:
+		void doBindCached( ContextStateStack & stack
+			, uint32_t mipLevel
+			, uint32_t fboLayer
+			, GlFrameBufferTarget fboTarget
+			, CmdList & list )const;
 	};
 
 	using FboAttachmentArray = std::vector< FboAttachment >;
@@ -310,7 +339,7 @@ namespace ashes::gl
 			, GlFrameBufferTarget fboTarget
 			, CmdList & list )const
 		{
-			src.bindRead( stack
+			src.bindCached( stack
 				, region.srcSubresource.mipLevel
 				, fboTarget
 				, list );
@@ -320,7 +349,7 @@ namespace ashes::gl
 			, GlFrameBufferTarget fboTarget
 			, CmdList & list )const
 		{
-			dst.bindDraw( stack
+			dst.bindCached( stack
 				, region.dstSubresource.mipLevel
 				, fboTarget
 				, list );
@@ -331,7 +360,7 @@ namespace ashes::gl
 			, GlFrameBufferTarget fboTarget
 			, CmdList & list )const
 		{
-			src.bindRead( stack
+			src.bindCached( stack
 				, region.srcSubresource.mipLevel
 				, layer
 				, fboTarget
@@ -343,7 +372,7 @@ namespace ashes::gl
 			, GlFrameBufferTarget fboTarget
 			, CmdList & list )const
 		{
-			dst.bindDraw( stack
+			dst.bindCached( stack
 				, region.dstSubresource.mipLevel
 				, layer
 				, fboTarget
@@ -356,7 +385,7 @@ namespace ashes::gl
 			, GlFrameBufferTarget fboTarget
 			, CmdList & list )const
 		{
-			src.bindRead( stack
+			src.bindCached( stack
 				, region.srcSubresource.mipLevel
 				, layer
 				, slice
@@ -370,7 +399,7 @@ namespace ashes::gl
 			, GlFrameBufferTarget fboTarget
 			, CmdList & list )const
 		{
-			dst.bindDraw( stack
+			dst.bindCached( stack
 				, region.dstSubresource.mipLevel
 				, layer
 				, slice
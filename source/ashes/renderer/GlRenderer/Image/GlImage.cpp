@@ -237,6 +237,7 @@ namespace ashes::gl
 		}
 
 		auto context = get( m_device )->getContext();
+		get( m_device )->evictCachedFramebuffers( context, m_internal );
 		glLogCall( context
 			, glDeleteTextures
 			, 1
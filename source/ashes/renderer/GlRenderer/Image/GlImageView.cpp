@@ -177,6 +177,7 @@ namespace ashes::gl
 		if ( hasTextureViews( m_device ) )
 		{
 			auto context = get( m_device )->getContext();
+			get( m_device )->evictCachedFramebuffers( context, m_internal );
 			glLogCall( context
 				, glDeleteTextures
 				, 1
@@ -17,6 +17,7 @@ See LICENSE file in root folder
 #include "renderer/GlRenderer/Enum/GlClipInfo.hpp"
 #include "renderer/GlRenderer/Enum/GlCompareOp.hpp"
 #include "renderer/GlRenderer/Enum/GlComponentSwizzle.hpp"
+#include "renderer/GlRenderer/Enum/GlConditionalRenderMode.hpp"
 #include "renderer/GlRenderer/Enum/GlConstantFormat.hpp"
 #include "renderer/GlRenderer/Enum/GlCullModeFlag.hpp"
 #include "renderer/GlRenderer/Enum/GlDebugReportObjectType.hpp"
@@ -57,6 +58,7 @@ See LICENSE file in root folder
 #include "renderer/GlRenderer/Enum/GlTweak.hpp"
 #include "renderer/GlRenderer/Enum/GlValueName.hpp"
 #include "renderer/GlRenderer/Enum/GlWrapMode.hpp"
+#include "renderer/GlRenderer/Miscellaneous/GlCallTracer.hpp"
 
 #pragma warning( push )
 #pragma warning( disable: 4365 )
@@ -415,45 +417,69 @@ namespace ashes::gl
 			, true );
 	}
 
-#if AshesGL_LogCalls && !defined( NDEBUG )
+	/**
+	*\brief
+	*	Release builds only retrieve the error after each call for GlErrorCheckPolicy::ePerCall.
+	*	The call is counted first, for the renderer statistics.
+	*/
+#define glLogCheckOutOfMemory( lock )\
+	( lock->countCall(), ( !lock->isErrorCheckedPerCall() || glCallCheckOutOfMemory( lock ) ) )
+
+#if AshesGL_TraceCalls
+#	define glLogEmptyCall( lock, name )\
+	( ( ashes::gl::traceFunction( ashes::gl::GlCallId::name, lock->m_##name ) ), glLogCheckOutOfMemory( lock ) )
+#	define glLogCall( lock, name, ... )\
+	( ( ashes::gl::traceFunction( ashes::gl::GlCallId::name, lock->m_##name, __VA_ARGS__ ) ), glLogCheckOutOfMemory( lock ) )
+#	define glLogCreateCall( lock, name, ... )\
+	( ( ashes::gl::traceFunction( ashes::gl::GlCallId::name, lock->m_##name, __VA_ARGS__ ) ), glLogCheckOutOfMemory( lock ) )
+#	define glLogNonVoidCall( lock, name, ... )\
+	( ashes::gl::traceFunction( ashes::gl::GlCallId::name, lock->m_##name, __VA_ARGS__ ) );\
+	glLogCheckOutOfMemory( lock )
+#	define glLogNonVoidEmptyCall( lock, name )\
+	( ashes::gl::traceFunction( ashes::gl::GlCallId::name, lock->m_##name ) );\
+	glLogCheckOutOfMemory( lock )
+#	define glLogCommand( list, name )
+#elif AshesGL_LogCalls && !defined( NDEBUG )
 #	define glLogEmptyCall( lock, name )\
-	executeFunction( lock, ashes::gl::getContext( lock ).m_##name, #name )
+	( lock->countCall(), executeFunction( lock, ashes::gl::getContext( lock ).m_##name, #name ) )
 #	define glLogCall( lock, name, ... )\
-	executeFunction( lock, ashes::gl::getContext( lock ).m_##name, #name, __VA_ARGS__ )
+	( lock->countCall(), executeFunction( lock, ashes::gl::getContext( lock ).m_##name, #name, __VA_ARGS__ ) )
 #	define glLogCreateCall( lock, name, ... )\
-	executeCreateFunction( lock, ashes::gl::getContext( lock ).m_##name, #name, __VA_ARGS__ )
+	( lock->countCall(), executeCreateFunction( lock, ashes::gl::getContext( lock ).m_##name, #name, __VA_ARGS__ ) )
 #	define glLogNonVoidCall( lock, name, ... )\
-	executeNonVoidFunction( lock, ashes::gl::getContext( lock ).m_##name, #name, __VA_ARGS__ )
+	( lock->countCall(), executeNonVoidFunction( lock, ashes::gl::getContext( lock ).m_##name, #name, __VA_ARGS__ ) )
 #	define glLogNonVoidEmptyCall( lock, name, ... )\
-	executeNonVoidFunction( lock, ashes::gl::getContext( lock ).m_##name, #name )
+	( lock->countCall(), executeNonVoidFunction( lock, ashes::gl::getContext( lock ).m_##name, #name ) )
 #	define glLogCommand( list, name )\
 	list.push_back( makeCmd< OpType::eLogCommand >( name ) );
 #elif defined( NDEBUG )
 #	define glLogEmptyCall( lock, name )\
-	( ( lock->m_##name() ), glCallCheckOutOfMemory( lock ) )
+	( ( lock->m_##name() ), glLogCheckOutOfMemory( lock ) )
 #	define glLogCall( lock, name, ... )\
-	( ( lock->m_##name( __VA_ARGS__ ) ), glCallCheckOutOfMemory( lock ) )
+	( ( lock->m_##name( __VA_ARGS__ ) ), glLogCheckOutOfMemory( lock ) )
 #	define glLogCreateCall( lock, name, ... )\
-	( ( lock->m_##name( __VA_ARGS__ ) ), glCallCheckOutOfMemory( lock ) )
+	( ( lock->m_##name( __VA_ARGS__ ) ), glLogCheckOutOfMemory( lock ) )
 #	define glLogNonVoidCall( lock, name, ... )\
 	( lock->m_##name( __VA_ARGS__ ) );\
-	glCallCheckOutOfMemory( lock )
+	glLogCheckOutOfMemory( lock )
 #	define glLogNonVoidEmptyCall( lock, name )\
 	( lock->m_##name() );\
-	glCallCheckOutOfMemory( lock )
+	glLogCheckOutOfMemory( lock )
 #	define glLogCommand( list, name )
 #else
 #	define glLogEmptyCall( lock, name )\
-	( ( lock->m_##name() ), glCallCheckError( lock, #name ) )
+	( ( lock->m_##name() ), lock->countCall(), glCallCheckError( lock, #name ) )
 #	define glLogCall( lock, name, ... )\
-	( ( lock->m_##name( __VA_ARGS__ ) ), glCallCheckError( lock, #name, __VA_ARGS__ ) )
+	( ( lock->m_##name( __VA_ARGS__ ) ), lock->countCall(), glCallCheckError( lock, #name, __VA_ARGS__ ) )
 #	define glLogCreateCall( lock, name, ... )\
-	( ( lock->m_##name( __VA_ARGS__ ) ), glCallCheckError( lock, #name, __VA_ARGS__ ) )
+	( ( lock->m_##name( __VA_ARGS__ ) ), lock->countCall(), glCallCheckError( lock, #name, __VA_ARGS__ ) )
 #	define glLogNonVoidCall( lock, name, ... )\
 	( lock->m_##name( __VA_ARGS__ ) );\
+	lock->countCall();\
 	glCallCheckError( lock, #name, __VA_ARGS__ )
 #	define glLogNonVoidEmptyCall( lock, name )\
 	( lock->m_##name() );\
+	lock->countCall();\
 	glCallCheckError( lock, #name )
 #	define glLogCommand( list, name )
 #endif
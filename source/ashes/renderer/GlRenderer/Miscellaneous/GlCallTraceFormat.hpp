@@ -0,0 +1,65 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include <cstdint>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	The binary GL call trace file layout, shared with the trace decoder.
+	*\remarks
+	*	A trace file is made of:
+	*	- a CallTraceHeader,
+	*	- CallTraceHeader::opCount function names, each one as a uint16_t length followed by the characters,
+	*	- CallTraceRecord entries, until the end of the file.
+	*	The records are written per thread batch, so they aren't globally sorted by timestamp.
+	*/
+	static char constexpr CallTraceMagic[8]{ 'A', 'S', 'H', 'G', 'L', 'T', 'R', 'C' };
+	static uint32_t constexpr CallTraceVersion = 1u;
+	static uint32_t constexpr CallTraceMaxArgs = 5u;
+	// Records the count of records that were dropped because a thread's buffer was full, in args[0].
+	static uint16_t constexpr CallTraceDroppedOp = 0xFFFFu;
+
+	enum class CallTraceArgKind : uint16_t
+	{
+		eSigned,
+		eUnsigned,
+		eFloat,
+		ePointer,
+	};
+
+	struct CallTraceHeader
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t recordSize;
+		uint32_t opCount;
+		uint32_t reserved;
+	};
+
+	struct CallTraceRecord
+	{
+		// Nanoseconds since the trace start.
+		uint64_t timestamp;
+		// Nanoseconds.
+		uint32_t duration;
+		uint32_t thread;
+		uint16_t op;
+		// 2 bits per argument.
+		uint16_t argKinds;
+		// The function's arguments count, only the first CallTraceMaxArgs ones are recorded.
+		uint32_t argCount;
+		uint64_t args[CallTraceMaxArgs];
+	};
+	static_assert( sizeof( CallTraceRecord ) == 64u );
+
+	inline CallTraceArgKind getArgKind( CallTraceRecord const & record
+		, uint32_t index )
+	{
+		return CallTraceArgKind( ( record.argKinds >> ( index * 2u ) ) & 0x3u );
+	}
+}
@@ -0,0 +1,247 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/GlCallTracer.hpp"
+
+#include "ashesgl_api.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ashes::gl
+{
+	namespace
+	{
+		char const * const TraceFileEnvVar = "ASHES_GL_TRACE_FILE";
+		// 512 kB per thread.
+		size_t constexpr ThreadBufferCapacity = 8192u;
+		auto constexpr FlushPeriod = std::chrono::milliseconds{ 10 };
+
+		char const * const CallNames[]
+		{
+#define GL_LIB_BASE_FUNCTION( x )\
+			"gl"#x,
+#define GL_LIB_FUNCTION( x )\
+			"gl"#x,
+#define GL_LIB_FUNCTION_OPT( x )\
+			"gl"#x,
+#define GL_LIB_FUNCTION_EXT( x, ... )\
+			"gl"#x,
+#include "Miscellaneous/OpenGLFunctionsList.inl"
+		};
+		static_assert( std::size( CallNames ) == size_t( GlCallId::eCount ) );
+
+		// Single producer (the owning thread), single consumer (the flush thread).
+		struct ThreadBuffer
+		{
+			explicit ThreadBuffer( uint32_t index )
+				: index{ index }
+			{
+			}
+
+			uint32_t index;
+			std::atomic< uint64_t > head{};
+			std::atomic< uint64_t > tail{};
+			std::atomic< uint64_t > dropped{};
+			std::array< CallTraceRecord, ThreadBufferCapacity > records;
+		};
+
+		class Tracer
+		{
+		public:
+			Tracer()
+			{
+				auto path = std::getenv( TraceFileEnvVar );
+
+				if ( !path || !*path )
+				{
+					return;
+				}
+
+				m_file = std::fopen( path, "wb" );
+
+				if ( !m_file )
+				{
+					return;
+				}
+
+				CallTraceHeader header{};
+				std::memcpy( header.magic, CallTraceMagic, sizeof( header.magic ) );
+				header.version = CallTraceVersion;
+				header.recordSize = uint32_t( sizeof( CallTraceRecord ) );
+				header.opCount = uint32_t( GlCallId::eCount );
+				std::fwrite( &header, sizeof( header ), 1u, m_file );
+
+				for ( auto name : CallNames )
+				{
+					auto length = uint16_t( std::strlen( name ) );
+					std::fwrite( &length, sizeof( length ), 1u, m_file );
+					std::fwrite( name, 1u, length, m_file );
+				}
+
+				m_start = std::chrono::steady_clock::now();
+				m_flusher = std::thread{ [this]()
+					{
+						doFlushLoop();
+					} };
+			}
+
+			~Tracer()
+			{
+				if ( !m_file )
+				{
+					return;
+				}
+
+				{
+					std::lock_guard< std::mutex > lock{ m_stopMutex };
+					m_stopped = true;
+				}
+				m_stopCondition.notify_all();
+				m_flusher.join();
+				doFlush();
+				std::fclose( m_file );
+			}
+
+			bool isEnabled()const noexcept
+			{
+				return m_file != nullptr;
+			}
+
+			uint64_t getTimestamp()const noexcept
+			{
+				return uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - m_start ).count() );
+			}
+
+			void write( CallTraceRecord const & record )noexcept
+			{
+				thread_local ThreadBuffer * buffer = doRegisterThread();
+
+				if ( !buffer )
+				{
+					return;
+				}
+
+				auto head = buffer->head.load( std::memory_order_relaxed );
+
+				if ( head - buffer->tail.load( std::memory_order_acquire ) >= ThreadBufferCapacity )
+				{
+					buffer->dropped.fetch_add( 1u, std::memory_order_relaxed );
+					return;
+				}
+
+				auto & dst = buffer->records[head % ThreadBufferCapacity];
+				dst = record;
+				dst.thread = buffer->index;
+				buffer->head.store( head + 1u, std::memory_order_release );
+			}
+
+		private:
+			ThreadBuffer * doRegisterThread()noexcept
+			{
+				try
+				{
+					std::lock_guard< std::mutex > lock{ m_buffersMutex };
+					m_buffers.push_back( std::make_unique< ThreadBuffer >( uint32_t( m_buffers.size() ) ) );
+					return m_buffers.back().get();
+				}
+				catch ( ... )
+				{
+					return nullptr;
+				}
+			}
+
+			void doFlushLoop()
+			{
+				std::unique_lock< std::mutex > lock{ m_stopMutex };
+
+				while ( !m_stopCondition.wait_for( lock
+					, FlushPeriod
+					, [this](){ return m_stopped; } ) )
+				{
+					lock.unlock();
+					doFlush();
+					lock.lock();
+				}
+			}
+
+			void doFlush()
+			{
+				std::lock_guard< std::mutex > lock{ m_buffersMutex };
+
+				for ( auto & buffer : m_buffers )
+				{
+					auto tail = buffer->tail.load( std::memory_order_relaxed );
+					auto head = buffer->head.load( std::memory_order_acquire );
+
+					while ( tail != head )
+					{
+						auto index = tail % ThreadBufferCapacity;
+						auto count = std::min( head - tail, ThreadBufferCapacity - index );
+						std::fwrite( &buffer->records[index], sizeof( CallTraceRecord ), size_t( count ), m_file );
+						tail += count;
+					}
+
+					buffer->tail.store( tail, std::memory_order_release );
+
+					if ( auto dropped = buffer->dropped.exchange( 0u, std::memory_order_relaxed ) )
+					{
+						CallTraceRecord record{};
+						record.timestamp = getTimestamp();
+						record.thread = buffer->index;
+						record.op = CallTraceDroppedOp;
+						record.argCount = 1u;
+						record.args[0] = dropped;
+						std::fwrite( &record, sizeof( record ), 1u, m_file );
+					}
+				}
+
+				std::fflush( m_file );
+			}
+
+		private:
+			std::FILE * m_file{};
+			std::chrono::steady_clock::time_point m_start;
+			std::mutex m_buffersMutex;
+			std::vector< std::unique_ptr< ThreadBuffer > > m_buffers;
+			std::thread m_flusher;
+			std::mutex m_stopMutex;
+			std::condition_variable m_stopCondition;
+			bool m_stopped{ false };
+		};
+
+		Tracer & getTracer()
+		{
+			static Tracer result;
+			return result;
+		}
+	}
+
+	bool CallTracer::isEnabled()noexcept
+	{
+		static bool const result = getTracer().isEnabled();
+		return result;
+	}
+
+	uint64_t CallTracer::getTimestamp()noexcept
+	{
+		return getTracer().getTimestamp();
+	}
+
+	void CallTracer::write( CallTraceRecord const & record )noexcept
+	{
+		getTracer().write( record );
+	}
+}
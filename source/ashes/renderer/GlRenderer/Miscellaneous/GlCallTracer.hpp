@@ -0,0 +1,122 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/Miscellaneous/GlCallTraceFormat.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+namespace ashes::gl
+{
+	enum class GlCallId : uint16_t
+	{
+#define GL_LIB_BASE_FUNCTION( x )\
+		gl##x,
+#define GL_LIB_FUNCTION( x )\
+		gl##x,
+#define GL_LIB_FUNCTION_OPT( x )\
+		gl##x,
+#define GL_LIB_FUNCTION_EXT( x, ... )\
+		gl##x,
+#include "renderer/GlRenderer/Miscellaneous/OpenGLFunctionsList.inl"
+		eCount,
+	};
+	/**
+	*\brief
+	*	Writes the GL calls to a binary trace file, set through ASHES_GL_TRACE_FILE.
+	*\remarks
+	*	Each thread writes fixed size records into its own lock-free ring buffer,
+	*	which a background thread regularly flushes to the file.
+	*	When a buffer is full, the records are dropped and counted, the GL thread never waits.
+	*/
+	class CallTracer
+	{
+	public:
+		static bool isEnabled()noexcept;
+		static uint64_t getTimestamp()noexcept;
+		static void write( CallTraceRecord const & record )noexcept;
+	};
+
+	struct CallTraceScope
+	{
+		inline CallTraceScope( GlCallId op
+			, uint32_t argCount )noexcept
+		{
+			record.op = uint16_t( op );
+			record.argCount = argCount;
+			record.timestamp = CallTracer::getTimestamp();
+		}
+
+		inline ~CallTraceScope()noexcept
+		{
+			record.duration = uint32_t( CallTracer::getTimestamp() - record.timestamp );
+			CallTracer::write( record );
+		}
+
+		template< typename ParamT >
+		inline void addArg( uint32_t index
+			, ParamT const & param )noexcept
+		{
+			if ( index >= CallTraceMaxArgs )
+			{
+				return;
+			}
+
+			uint64_t word{};
+			CallTraceArgKind kind{ CallTraceArgKind::eUnsigned };
+
+			if constexpr ( std::is_pointer_v< ParamT > )
+			{
+				word = uint64_t( reinterpret_cast< uintptr_t >( param ) );
+				kind = CallTraceArgKind::ePointer;
+			}
+			else if constexpr ( std::is_null_pointer_v< ParamT > )
+			{
+				kind = CallTraceArgKind::ePointer;
+			}
+			else if constexpr ( std::is_floating_point_v< ParamT > )
+			{
+				auto value = double( param );
+				std::memcpy( &word, &value, sizeof( word ) );
+				kind = CallTraceArgKind::eFloat;
+			}
+			else if constexpr ( std::is_enum_v< ParamT > )
+			{
+				word = uint64_t( param );
+			}
+			else if constexpr ( std::is_integral_v< ParamT > && std::is_signed_v< ParamT > )
+			{
+				word = uint64_t( int64_t( param ) );
+				kind = CallTraceArgKind::eSigned;
+			}
+			else if constexpr ( std::is_integral_v< ParamT > )
+			{
+				word = uint64_t( param );
+			}
+
+			record.args[index] = word;
+			record.argKinds = uint16_t( record.argKinds | ( uint16_t( kind ) << ( index * 2u ) ) );
+		}
+
+		CallTraceRecord record{};
+	};
+
+	template< typename FuncT, typename ... ParamsT >
+	inline auto traceFunction( GlCallId op
+		, FuncT function
+		, ParamsT ... params )
+	{
+		if ( !CallTracer::isEnabled() )
+		{
+			return function( params... );
+		}
+
+		CallTraceScope scope{ op, uint32_t( sizeof...( ParamsT ) ) };
+		uint32_t index = 0u;
+		( scope.addArg( index++, params ), ... );
+		return function( params... );
+	}
+}
@@ -7,6 +7,7 @@
 #include "ashesgl_api.hpp"
 
 #include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -26,6 +27,31 @@ namespace ashes::gl
 			static std::string const debugLogBaseName = "CallLogGL.log";
 			return  debugLogBaseName + toString( std::this_thread::get_id() ) + ".log";
 		}
+
+		// Bounds the drain, a lost context may keep reporting errors.
+		uint32_t constexpr MaxDrainedErrors = 32u;
+	}
+
+	GlErrorCheckPolicy getErrorCheckPolicy()
+	{
+		auto value = std::getenv( "ASHES_GL_ERROR_CHECK" );
+
+		if ( value )
+		{
+			std::string policy{ value };
+
+			if ( policy == "submit" )
+			{
+				return GlErrorCheckPolicy::ePerSubmit;
+			}
+
+			if ( policy == "async" )
+			{
+				return GlErrorCheckPolicy::eAsync;
+			}
+		}
+
+		return GlErrorCheckPolicy::ePerCall;
 	}
 
 	std::string getErrorName( uint32_t code, uint32_t category )
@@ -67,6 +93,34 @@ namespace ashes::gl
 		return result;
 	}
 
+	bool glDrainErrors( ContextLock const & context )
+	{
+		bool result = true;
+		auto errorCode = context->m_glGetError();
+		uint32_t count = 0u;
+
+		while ( errorCode != GL_SUCCESS
+			&& count++ < MaxDrainedErrors )
+		{
+			if ( errorCode == GL_ERROR_OUT_OF_MEMORY )
+			{
+				context->setOutOfMemory();
+				result = false;
+			}
+			else
+			{
+				std::stringstream stream;
+				stream.imbue( std::locale{ "C" } );
+				stream << "OpenGL Error, on submit, ID: 0x" << std::hex << errorCode << " (" << getErrorName( errorCode, GL_DEBUG_TYPE_ERROR ) << ")";
+				logError( stream.str().c_str() );
+			}
+
+			errorCode = context->m_glGetError();
+		}
+
+		return result;
+	}
+
 	bool glCheckError( ContextLock const & context
 		, std::function< std::string() > stringifier
 		, bool log )
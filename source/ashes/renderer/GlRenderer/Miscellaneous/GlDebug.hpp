@@ -28,6 +28,23 @@ namespace ashes::gl
 		std::array< float, 4u > color;
 		std::string labelName;
 	};
+	/**
+	*\brief
+	*	When the GL errors are retrieved, in release builds.
+	*\remarks
+	*	Selected per context, through ASHES_GL_ERROR_CHECK ("call", "submit" or "async").
+	*	Debug builds always check, and log, each call's error.
+	*/
+	enum class GlErrorCheckPolicy
+	{
+		// glGetError after each GL call, the default.
+		ePerCall,
+		// glGetError is drained once per submitted command buffer.
+		ePerSubmit,
+		// A KHR_debug callback latches the errors, glGetError is never called.
+		eAsync,
+	};
+	GlErrorCheckPolicy getErrorCheckPolicy();
 	std::string getErrorName( uint32_t code, uint32_t category );
 	bool glCheckError( ContextLock const & context
 		, std::string const & text
@@ -36,6 +53,7 @@ namespace ashes::gl
 		, std::function< std::string() > stringifier
 		, bool log );
 	bool glCheckOutOfMemory( ContextLock const & context );
+	bool glDrainErrors( ContextLock const & context );
 	void clearDebugFile();
 	void logDebug( char const * const log );
 	void logError( char const * const log );
@@ -97,6 +97,8 @@ namespace ashes::gl
 	DeviceMemory::~DeviceMemory()
 	{
 		unregisterObject( m_device, *this );
+		// The GL buffer name may be reused.
+		get( m_device )->getQueryResultLinks().unlink( m_internal, 0u, WholeSize );
 		auto context = get( m_device )->getContext();
 		context->deleteBuffer( m_internal );
 	}
@@ -248,6 +250,9 @@ namespace ashes::gl
 		, BindingRange const & range )const
 	{
 		assert( !m_data.empty() );
+		get( m_device )->getQueryResultLinks().unlink( getInternal()
+			, range.getOffset()
+			, range.getSize() );
 		glLogCall( context
 			, glBindBuffer
 			, GL_BUFFER_TARGET_COPY_WRITE
@@ -265,6 +270,7 @@ namespace ashes::gl
 			glLogCall( context
 				, glUnmapBuffer
 				, GL_BUFFER_TARGET_COPY_WRITE );
+			RendererStatistics::addUpload( range.getSize() );
 		}
 
 		glLogCall( context
@@ -310,6 +316,7 @@ namespace ashes::gl
 			glLogCall( context
 				, glUnmapBuffer
 				, GL_BUFFER_TARGET_COPY_READ );
+			RendererStatistics::addDownload( range.getSize() );
 		}
 
 		glLogCall( context
@@ -74,11 +74,16 @@ namespace ashes::gl
 		getIntegerv = glGetIntegerv;
 #endif
 
+		auto const * cvendor = reinterpret_cast< char const * >( getString( GL_INFO_VENDOR ) );
+		auto const * crenderer = reinterpret_cast< char const * >( getString( GL_INFO_RENDERER ) );
+		m_vendor = cvendor ? cvendor : std::string{};
+		m_renderer = crenderer ? crenderer : std::string{};
 		char const * const cversion = reinterpret_cast< char const * >( getString( GL_INFO_VERSION ) );
 
 		if ( cversion )
 		{
 			std::string sversion = cversion;
+			m_versionString = sversion;
 			std::stringstream stream( sversion );
 			float fversion;
 			stream >> fversion;
@@ -66,6 +66,7 @@ namespace ashes::gl
 	makeGlExtension( 4, 4, ARB_clear_texture );
 	// Core since OpenGL 4.5
 	makeGlExtension( 4, 5, ARB_clip_control );
+	makeGlExtension( 4, 5, ARB_conditional_render_inverted );
 	makeGlExtension( 4, 5, ARB_gl_spirv );
 	makeGlExtension( 4, 5, ARB_query_buffer_object );
 	// Core since OpenGL 4.6
@@ -124,11 +125,29 @@ namespace ashes::gl
 			return m_features;
 		}
 
+		inline std::string const & getVendor()const
+		{
+			return m_vendor;
+		}
+
+		inline std::string const & getRenderer()const
+		{
+			return m_renderer;
+		}
+
+		inline std::string const & getVersion()const
+		{
+			return m_versionString;
+		}
+
 	private:
 		StringArray m_deviceExtensionNames;
 		StringArray m_deviceSPIRVExtensionNames;
 		std::vector< uint32_t > m_shaderBinaryFormats;
 		AshPluginFeatures m_features;
+		std::string m_vendor;
+		std::string m_renderer;
+		std::string m_versionString;
 		uint32_t m_major{ 0 };
 		uint32_t m_minor{ 0 };
 		uint32_t m_version{ 0 };
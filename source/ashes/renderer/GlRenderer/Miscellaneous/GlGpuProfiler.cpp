@@ -0,0 +1,331 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/GlGpuProfiler.hpp"
+
+#include "Core/GlContextLock.hpp"
+#include "Miscellaneous/GlCallLogger.hpp"
+
+#include "ashesgl_api.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace ashes::gl
+{
+	namespace
+	{
+		char const * const TraceFileEnvVar = "ASHES_GL_GPU_TRACE_FILE";
+		// The count of queries generated at once, when a context's pool is empty.
+		GLsizei constexpr QueryBatchSize = 64;
+		// A region's results are only looked for that many collections after it was submitted.
+		uint64_t constexpr CollectLatency = 3u;
+		uint32_t constexpr CpuProcessId = 1u;
+		uint32_t constexpr GpuProcessId = 2u;
+
+		struct Region
+		{
+			char const * category;
+			std::string name;
+			GLuint begin;
+			GLuint end;
+			uint64_t serial;
+		};
+
+		struct ContextData
+		{
+			std::vector< GLuint > freeQueries;
+			std::vector< Region > open;
+			std::deque< Region > pending;
+			uint64_t serial{};
+			// Converts a GPU timestamp to the CPU time base.
+			int64_t gpuToCpu{};
+			bool calibrated{ false };
+		};
+
+		std::string escape( std::string const & value )
+		{
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+
+			for ( auto c : value )
+			{
+				if ( c == '"' || c == '\\' )
+				{
+					stream << '\\' << c;
+				}
+				else if ( uint8_t( c ) < 0x20u )
+				{
+					stream << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' ) << uint32_t( c ) << std::dec;
+				}
+				else
+				{
+					stream << c;
+				}
+			}
+
+			return stream.str();
+		}
+
+		class Profiler
+		{
+		public:
+			Profiler()
+			{
+				auto path = std::getenv( TraceFileEnvVar );
+
+				if ( !path || !*path )
+				{
+					return;
+				}
+
+				m_file = std::fopen( path, "w" );
+
+				if ( !m_file )
+				{
+					return;
+				}
+
+				m_start = std::chrono::steady_clock::now();
+				std::fprintf( m_file, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n" );
+				std::fprintf( m_file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %u, \"args\": {\"name\": \"CPU\"}},\n", CpuProcessId );
+				std::fprintf( m_file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %u, \"args\": {\"name\": \"GPU\"}}", GpuProcessId );
+			}
+
+			~Profiler()
+			{
+				if ( m_file )
+				{
+					std::fprintf( m_file, "\n]}\n" );
+					std::fclose( m_file );
+				}
+			}
+
+			bool isEnabled()const noexcept
+			{
+				return m_file != nullptr;
+			}
+
+			uint64_t getTimestamp()const noexcept
+			{
+				return uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - m_start ).count() );
+			}
+
+			void addCpuEvent( char const * category
+				, std::string const & name
+				, uint64_t begin
+				, uint64_t end )
+			{
+				thread_local uint32_t const thread = m_threadCount++;
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				doWrite( CpuProcessId, thread, category, name, begin, end );
+			}
+
+			void beginGpuRegion( ContextLock const & context
+				, char const * category
+				, std::string name )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				auto & data = m_contexts[&context.getContext()];
+
+				if ( !data.calibrated )
+				{
+					GLint64 gpuTime{};
+					glLogCall( context
+						, glGetInteger64v
+						, GL_VALUE_NAME_TIMESTAMP
+						, &gpuTime );
+					data.gpuToCpu = int64_t( getTimestamp() ) - gpuTime;
+					data.calibrated = true;
+				}
+
+				auto query = doAcquireQuery( context, data );
+				glLogCall( context
+					, glQueryCounter
+					, query
+					, GL_QUERY_TYPE_TIMESTAMP );
+				data.open.push_back( { category, std::move( name ), query, 0u, 0u } );
+			}
+
+			void endGpuRegion( ContextLock const & context )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				auto & data = m_contexts[&context.getContext()];
+
+				if ( data.open.empty() )
+				{
+					return;
+				}
+
+				auto region = std::move( data.open.back() );
+				data.open.pop_back();
+				region.end = doAcquireQuery( context, data );
+				region.serial = data.serial;
+				glLogCall( context
+					, glQueryCounter
+					, region.end
+					, GL_QUERY_TYPE_TIMESTAMP );
+				data.pending.push_back( std::move( region ) );
+			}
+
+			void collect( ContextLock const & context )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				auto & data = m_contexts[&context.getContext()];
+				++data.serial;
+
+				// The end queries are issued in order, so the first unavailable one stops the lookup.
+				while ( !data.pending.empty()
+					&& data.pending.front().serial + CollectLatency <= data.serial )
+				{
+					auto & region = data.pending.front();
+					GLuint available{};
+					glLogCall( context
+						, glGetQueryObjectuiv
+						, region.end
+						, GL_QUERY_RESULT_AVAILABLE
+						, &available );
+
+					if ( available == GL_FALSE )
+					{
+						break;
+					}
+
+					GLuint64 begin{};
+					GLuint64 end{};
+					glLogCall( context
+						, glGetQueryObjectui64v
+						, region.begin
+						, GL_QUERY_RESULT
+						, &begin );
+					glLogCall( context
+						, glGetQueryObjectui64v
+						, region.end
+						, GL_QUERY_RESULT
+						, &end );
+					doWrite( GpuProcessId
+						, 0u
+						, region.category
+						, region.name
+						, uint64_t( int64_t( begin ) + data.gpuToCpu )
+						, uint64_t( int64_t( end ) + data.gpuToCpu ) );
+					data.freeQueries.push_back( region.begin );
+					data.freeQueries.push_back( region.end );
+					data.pending.pop_front();
+				}
+			}
+
+			void releaseContext( Context const & context )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				m_contexts.erase( &context );
+			}
+
+		private:
+			GLuint doAcquireQuery( ContextLock const & context
+				, ContextData & data )
+			{
+				if ( data.freeQueries.empty() )
+				{
+					data.freeQueries.resize( size_t( QueryBatchSize ) );
+					glLogCall( context
+						, glGenQueries
+						, QueryBatchSize
+						, data.freeQueries.data() );
+				}
+
+				auto result = data.freeQueries.back();
+				data.freeQueries.pop_back();
+				return result;
+			}
+
+			void doWrite( uint32_t process
+				, uint32_t thread
+				, char const * category
+				, std::string const & name
+				, uint64_t begin
+				, uint64_t end )
+			{
+				std::fprintf( m_file, ",\n{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": %u, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f}"
+					, escape( name ).c_str()
+					, category
+					, process
+					, thread
+					, double( begin ) / 1000.0
+					, double( end > begin ? end - begin : 0u ) / 1000.0 );
+			}
+
+		private:
+			std::FILE * m_file{};
+			std::chrono::steady_clock::time_point m_start;
+			std::atomic< uint32_t > m_threadCount{};
+			std::mutex m_mutex;
+			std::map< Context const *, ContextData > m_contexts;
+		};
+
+		Profiler & getProfiler()
+		{
+			static Profiler result;
+			return result;
+		}
+	}
+
+	bool GpuProfiler::isEnabled()noexcept
+	{
+		static bool const result = getProfiler().isEnabled();
+		return result;
+	}
+
+	uint64_t GpuProfiler::getCpuTimestamp()noexcept
+	{
+		return getProfiler().getTimestamp();
+	}
+
+	std::string GpuProfiler::getObjectName( char const * typeName
+		, void const * object )
+	{
+		std::stringstream stream;
+		stream.imbue( std::locale{ "C" } );
+		stream << typeName << " [0x" << std::hex << std::setw( 8u ) << std::setfill( '0' ) << uintptr_t( object ) << "]";
+		return stream.str();
+	}
+
+	void GpuProfiler::addCpuEvent( char const * category
+		, std::string name
+		, uint64_t begin
+		, uint64_t end )
+	{
+		getProfiler().addCpuEvent( category, name, begin, end );
+	}
+
+	void GpuProfiler::beginGpuRegion( ContextLock const & context
+		, char const * category
+		, std::string name )
+	{
+		getProfiler().beginGpuRegion( context, category, std::move( name ) );
+	}
+
+	void GpuProfiler::endGpuRegion( ContextLock const & context )
+	{
+		getProfiler().endGpuRegion( context );
+	}
+
+	void GpuProfiler::collect( ContextLock const & context )
+	{
+		getProfiler().collect( context );
+	}
+
+	void GpuProfiler::releaseContext( Context const & context )
+	{
+		getProfiler().releaseContext( context );
+	}
+}
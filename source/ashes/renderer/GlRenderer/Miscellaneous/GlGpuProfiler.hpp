@@ -0,0 +1,53 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+#include <string>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	Measures the GPU time spent in each submitted command buffer and debug label region,
+	*	and the CPU time spent recording and submitting the command buffers.
+	*\remarks
+	*	Enabled by setting ASHES_GL_GPU_TRACE_FILE, the events are written there as Chrome trace event JSON.
+	*	The regions are bracketed by GL_TIMESTAMP queries, taken from a recycled per context pool,
+	*	and read back a few submits later, once available, so the GPU is never waited for.
+	*/
+	class GpuProfiler
+	{
+	public:
+		static bool isEnabled()noexcept;
+		/**
+		*\return
+		*	The CPU time, in nanoseconds since the profiler start.
+		*/
+		static uint64_t getCpuTimestamp()noexcept;
+		static std::string getObjectName( char const * typeName
+			, void const * object );
+
+		static void addCpuEvent( char const * category
+			, std::string name
+			, uint64_t begin
+			, uint64_t end );
+		static void beginGpuRegion( ContextLock const & context
+			, char const * category
+			, std::string name );
+		static void endGpuRegion( ContextLock const & context );
+		/**
+		*\brief
+		*	Writes the events of the regions which results are available.
+		*/
+		static void collect( ContextLock const & context );
+		/**
+		*\brief
+		*	Forgets the context's queries and pending regions, it is being destroyed.
+		*/
+		static void releaseContext( Context const & context );
+	};
+}
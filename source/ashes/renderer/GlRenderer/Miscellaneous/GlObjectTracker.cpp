@@ -0,0 +1,166 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/GlObjectTracker.hpp"
+
+#include "Miscellaneous/GlDebug.hpp"
+
+#include "ashesgl_api.hpp"
+
+#include <ashes/common/Exception.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace ashes::gl
+{
+	namespace
+	{
+		struct ObjectTypeInfo
+		{
+			VkObjectType type;
+			char const * name;
+		};
+
+		struct ObjectTypeRegistry
+		{
+			std::mutex mutex;
+			std::array< ObjectTypeInfo, ObjectTracker::MaxTypes > types{};
+			std::atomic< uint32_t > count{};
+		};
+
+		ObjectTypeRegistry & getRegistry()
+		{
+			static ObjectTypeRegistry result;
+			return result;
+		}
+
+		bool isTrackingEnabled()
+		{
+			static bool const result = []()
+			{
+				auto value = std::getenv( "ASHES_TRACK_OBJECTS" );
+				return value
+					&& std::string{ value } == "1";
+			}();
+			return result;
+		}
+	}
+
+	ObjectTracker::ObjectTracker()
+		: m_shards{ isTrackingEnabled() ? std::make_unique< ShardArray >() : nullptr }
+	{
+	}
+
+	void ObjectTracker::registerObject( uint64_t object
+		, uint32_t typeIndex )
+	{
+		m_counters[typeIndex].created.fetch_add( 1u, std::memory_order_relaxed );
+
+		if ( m_shards )
+		{
+			auto & shard = doGetShard( object );
+			std::lock_guard< std::mutex > lock{ shard.mutex };
+			shard.objects.emplace( object, typeIndex );
+		}
+	}
+
+	void ObjectTracker::unregisterObject( uint64_t object
+		, uint32_t typeIndex )
+	{
+		m_counters[typeIndex].destroyed.fetch_add( 1u, std::memory_order_relaxed );
+
+		if ( m_shards )
+		{
+			auto & shard = doGetShard( object );
+			std::lock_guard< std::mutex > lock{ shard.mutex };
+			auto it = shard.objects.find( object );
+			assert( it != shard.objects.end() );
+			shard.objects.erase( it );
+		}
+	}
+
+	void ObjectTracker::reportLeaks()const
+	{
+		if ( !m_shards )
+		{
+			return;
+		}
+
+		auto & registry = getRegistry();
+
+		for ( auto & shard : *m_shards )
+		{
+			std::lock_guard< std::mutex > lock{ shard.mutex };
+
+			for ( auto & object : shard.objects )
+			{
+				std::stringstream stream;
+				stream.imbue( std::locale{ "C" } );
+				stream << "Leaked " << registry.types[object.second].name
+					<< " [0x" << std::hex << std::setw( 8u ) << std::setfill( '0' ) << object.first << "]";
+				logError( stream.str().c_str() );
+			}
+		}
+	}
+
+	VkResult ObjectTracker::getStatistics( uint32_t & count
+		, AshObjectTypeStatistics * statistics )const
+	{
+		auto & registry = getRegistry();
+		auto available = registry.count.load( std::memory_order_acquire );
+
+		if ( !statistics )
+		{
+			count = available;
+			return VK_SUCCESS;
+		}
+
+		auto result = count < available
+			? VK_INCOMPLETE
+			: VK_SUCCESS;
+		count = std::min( count, available );
+
+		for ( uint32_t index = 0u; index < count; ++index )
+		{
+			auto & info = registry.types[index];
+			auto & counters = m_counters[index];
+			auto & stats = statistics[index];
+			stats.objectType = info.type;
+			strncpy( stats.typeName, info.name, sizeof( stats.typeName ) - 1u );
+			stats.typeName[sizeof( stats.typeName ) - 1u] = 0;
+			stats.created = counters.created.load( std::memory_order_relaxed );
+			stats.destroyed = counters.destroyed.load( std::memory_order_relaxed );
+		}
+
+		return result;
+	}
+
+	uint32_t ObjectTracker::registerType( VkObjectType type
+		, char const * name )
+	{
+		auto & registry = getRegistry();
+		std::lock_guard< std::mutex > lock{ registry.mutex };
+		auto index = registry.count.load( std::memory_order_relaxed );
+
+		if ( index >= MaxTypes )
+		{
+			throw Exception{ VK_ERROR_INITIALIZATION_FAILED, "Too many tracked object types" };
+		}
+
+		registry.types[index] = { type, name };
+		// Published after the entry is written, for the lock-free readers.
+		registry.count.store( index + 1u, std::memory_order_release );
+		return index;
+	}
+
+	ObjectTracker::Shard & ObjectTracker::doGetShard( uint64_t object )const
+	{
+		// Handles are at least 16 bytes aligned, skip the always null bits.
+		return ( *m_shards )[( object >> 4u ) % ShardCount];
+	}
+}
@@ -0,0 +1,69 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	Counts the objects created and destroyed on a device, per object type.
+	*\remarks
+	*	When ASHES_TRACK_OBJECTS=1, each live object is also recorded,
+	*	so that the ones still alive at device destruction can be reported.
+	*/
+	class ObjectTracker
+	{
+	public:
+		static uint32_t constexpr MaxTypes = 64u;
+
+	public:
+		ObjectTracker();
+
+		void registerObject( uint64_t object
+			, uint32_t typeIndex );
+		void unregisterObject( uint64_t object
+			, uint32_t typeIndex );
+		void reportLeaks()const;
+		VkResult getStatistics( uint32_t & count
+			, AshObjectTypeStatistics * statistics )const;
+		/**
+		*\return
+		*	The compact index of the given object type, to be used with registerObject.
+		*/
+		static uint32_t registerType( VkObjectType type
+			, char const * name );
+
+	private:
+		struct Counters
+		{
+			std::atomic< uint64_t > created{};
+			std::atomic< uint64_t > destroyed{};
+		};
+
+		struct Shard
+		{
+			std::mutex mutex;
+			std::unordered_map< uint64_t, uint32_t > objects;
+		};
+
+		static uint32_t constexpr ShardCount = 16u;
+		using ShardArray = std::array< Shard, ShardCount >;
+
+		Shard & doGetShard( uint64_t object )const;
+
+	private:
+		std::array< Counters, MaxTypes > m_counters;
+		// Only allocated when the objects are tracked.
+		std::unique_ptr< ShardArray > m_shards;
+	};
+}
@@ -0,0 +1,359 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/GlPluginCache.hpp"
+
+#include "Miscellaneous/GlExtensionsHandler.hpp"
+
+#include "ashesgl_api.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#if _WIN32
+#	include <Windows.h>
+#	include <direct.h>
+#else
+#	include <dlfcn.h>
+#endif
+
+namespace ashes::gl
+{
+	namespace
+	{
+		uint32_t constexpr CacheFormatVersion = 1u;
+		char const * const CacheEnvVar = "ASHES_GL_PROBE_CACHE";
+#if _WIN32
+		char constexpr PathSeparator = '\\';
+#else
+		char constexpr PathSeparator = '/';
+#endif
+
+		using CacheValues = std::map< std::string, std::string >;
+
+		struct PluginKey
+		{
+			std::string path;
+			int64_t time{};
+			int64_t size{};
+		};
+
+		// Its address identifies the module this code lives in.
+		char const moduleAnchor{};
+
+		bool isEnabled()
+		{
+			auto value = std::getenv( CacheEnvVar );
+			return !value
+				|| std::string{ value } != "0";
+		}
+
+		bool isSupported( uint32_t major, uint32_t minor )
+		{
+			return major > uint32_t( MinMajor )
+				|| ( major == uint32_t( MinMajor ) && minor >= uint32_t( MinMinor ) );
+		}
+
+		std::string getModulePath()
+		{
+#if _WIN32
+			HMODULE module{};
+			char path[MAX_PATH]{};
+
+			if ( ::GetModuleHandleExA( GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT
+					, &moduleAnchor
+					, &module )
+				&& ::GetModuleFileNameA( module, path, MAX_PATH ) )
+			{
+				return path;
+			}
+#else
+			Dl_info info{};
+
+			if ( dladdr( &moduleAnchor, &info )
+				&& info.dli_fname )
+			{
+				return info.dli_fname;
+			}
+#endif
+			return std::string{};
+		}
+
+		bool getKey( PluginKey & key )
+		{
+			key.path = getModulePath();
+
+			if ( key.path.empty() )
+			{
+				return false;
+			}
+
+#if _WIN32
+			struct _stat64 status{};
+
+			if ( _stat64( key.path.c_str(), &status ) != 0 )
+			{
+				return false;
+			}
+#else
+			struct stat status{};
+
+			if ( stat( key.path.c_str(), &status ) != 0 )
+			{
+				return false;
+			}
+#endif
+
+			key.time = int64_t( status.st_mtime );
+			key.size = int64_t( status.st_size );
+			return true;
+		}
+
+		void makeDirectory( std::string const & path )
+		{
+#if _WIN32
+			_mkdir( path.c_str() );
+#else
+			mkdir( path.c_str(), 0755 );
+#endif
+		}
+
+		std::string getCacheFolder()
+		{
+			std::string result;
+#if _WIN32
+			if ( auto local = std::getenv( "LOCALAPPDATA" ) )
+			{
+				result = local;
+			}
+#elif __APPLE__
+			if ( auto home = std::getenv( "HOME" ) )
+			{
+				result = std::string{ home } + "/Library/Caches";
+			}
+#else
+			auto cache = std::getenv( "XDG_CACHE_HOME" );
+
+			if ( cache && *cache )
+			{
+				result = cache;
+			}
+			else if ( auto home = std::getenv( "HOME" ) )
+			{
+				result = std::string{ home } + "/.cache";
+			}
+#endif
+
+			if ( !result.empty() )
+			{
+				makeDirectory( result );
+				result += PathSeparator + std::string{ "ashes" };
+				makeDirectory( result );
+			}
+
+			return result;
+		}
+
+		std::string getCacheFile( PluginKey const & key )
+		{
+			auto folder = getCacheFolder();
+
+			if ( folder.empty() )
+			{
+				return folder;
+			}
+
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+			stream << folder << PathSeparator
+				<< "gl-" << std::hex << std::hash< std::string >{}( key.path ) << ".cache";
+			return stream.str();
+		}
+
+		CacheValues read( std::string const & file )
+		{
+			CacheValues result;
+			std::ifstream stream{ file };
+			std::string line;
+
+			while ( std::getline( stream, line ) )
+			{
+				auto index = line.find( '=' );
+
+				if ( index != std::string::npos )
+				{
+					result.emplace( line.substr( 0u, index ), line.substr( index + 1u ) );
+				}
+			}
+
+			return result;
+		}
+
+		std::string getValue( CacheValues const & values
+			, std::string const & name )
+		{
+			auto it = values.find( name );
+			return it == values.end()
+				? std::string{}
+				: it->second;
+		}
+
+		uint32_t getUInt( CacheValues const & values
+			, std::string const & name )
+		{
+			return uint32_t( std::strtoul( getValue( values, name ).c_str(), nullptr, 10 ) );
+		}
+
+		std::string serialise( PluginKey const & key
+			, PluginCacheEntry const & entry )
+		{
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+			stream << "format=" << CacheFormatVersion << "\n"
+				<< "path=" << key.path << "\n"
+				<< "time=" << key.time << "\n"
+				<< "size=" << key.size << "\n"
+				<< "vendor=" << entry.vendor << "\n"
+				<< "renderer=" << entry.renderer << "\n"
+				<< "version=" << entry.version << "\n"
+				<< "major=" << entry.major << "\n"
+				<< "minor=" << entry.minor << "\n"
+				<< "hasTexBufferRange=" << entry.features.hasTexBufferRange << "\n"
+				<< "hasImageTexture=" << entry.features.hasImageTexture << "\n"
+				<< "hasBaseInstance=" << entry.features.hasBaseInstance << "\n"
+				<< "hasClearTexImage=" << entry.features.hasClearTexImage << "\n"
+				<< "hasComputeShaders=" << entry.features.hasComputeShaders << "\n"
+				<< "hasStorageBuffers=" << entry.features.hasStorageBuffers << "\n"
+				<< "supportsPersistentMapping=" << entry.features.supportsPersistentMapping << "\n"
+				<< "maxShaderLanguageVersion=" << entry.features.maxShaderLanguageVersion << "\n";
+			return stream.str();
+		}
+	}
+
+	bool PluginCache::load( PluginCacheEntry & entry )
+	{
+		PluginKey key;
+
+		if ( !isEnabled()
+			|| !getKey( key ) )
+		{
+			return false;
+		}
+
+		auto file = getCacheFile( key );
+
+		if ( file.empty() )
+		{
+			return false;
+		}
+
+		auto values = read( file );
+
+		if ( getUInt( values, "format" ) != CacheFormatVersion
+			|| getValue( values, "path" ) != key.path
+			|| getValue( values, "time" ) != std::to_string( key.time )
+			|| getValue( values, "size" ) != std::to_string( key.size ) )
+		{
+			return false;
+		}
+
+		entry.vendor = getValue( values, "vendor" );
+		entry.renderer = getValue( values, "renderer" );
+		entry.version = getValue( values, "version" );
+		entry.major = getUInt( values, "major" );
+		entry.minor = getUInt( values, "minor" );
+		entry.features.hasTexBufferRange = getUInt( values, "hasTexBufferRange" );
+		entry.features.hasImageTexture = getUInt( values, "hasImageTexture" );
+		entry.features.hasBaseInstance = getUInt( values, "hasBaseInstance" );
+		entry.features.hasClearTexImage = getUInt( values, "hasClearTexImage" );
+		entry.features.hasComputeShaders = getUInt( values, "hasComputeShaders" );
+		entry.features.hasStorageBuffers = getUInt( values, "hasStorageBuffers" );
+		entry.features.supportsPersistentMapping = getUInt( values, "supportsPersistentMapping" );
+		entry.features.maxShaderLanguageVersion = getUInt( values, "maxShaderLanguageVersion" );
+		// Unsupported results are never written, a stale one would hide a driver upgrade.
+		return isSupported( entry.major, entry.minor );
+	}
+
+	void PluginCache::update( ExtensionsHandler const & extensions )
+	{
+		PluginKey key;
+
+		if ( !isEnabled()
+			|| !getKey( key ) )
+		{
+			return;
+		}
+
+		if ( !isSupported( extensions.getMajor(), extensions.getMinor() ) )
+		{
+			invalidate();
+			return;
+		}
+
+		auto file = getCacheFile( key );
+
+		if ( file.empty() )
+		{
+			return;
+		}
+
+		PluginCacheEntry entry{ extensions.getVendor()
+			, extensions.getRenderer()
+			, extensions.getVersion()
+			, extensions.getMajor()
+			, extensions.getMinor()
+			, extensions.getFeatures() };
+		auto content = serialise( key, entry );
+		std::string current;
+		{
+			std::ifstream stream{ file, std::ios::binary };
+			std::stringstream buffer;
+			buffer << stream.rdbuf();
+			current = buffer.str();
+		}
+
+		if ( content == current )
+		{
+			return;
+		}
+
+		// Write to a temporary file first, so that concurrent readers never see a partial entry.
+		auto temp = file + ".tmp";
+		{
+			std::ofstream stream{ temp, std::ios::binary | std::ios::trunc };
+
+			if ( !stream )
+			{
+				return;
+			}
+
+			stream << content;
+		}
+#if _WIN32
+		std::remove( file.c_str() );
+#endif
+		std::rename( temp.c_str(), file.c_str() );
+	}
+
+	void PluginCache::invalidate()
+	{
+		PluginKey key;
+
+		if ( getKey( key ) )
+		{
+			auto file = getCacheFile( key );
+
+			if ( !file.empty() )
+			{
+				std::remove( file.c_str() );
+			}
+		}
+	}
+}
@@ -0,0 +1,50 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+#include <string>
+
+namespace ashes::gl
+{
+	class ExtensionsHandler;
+
+	struct PluginCacheEntry
+	{
+		std::string vendor;
+		std::string renderer;
+		std::string version;
+		uint32_t major{};
+		uint32_t minor{};
+		AshPluginFeatures features{};
+	};
+	/**
+	*\brief
+	*	Persisted result of the plugin capability probe.
+	*\remarks
+	*	The entry lives in the user cache folder, and is keyed on the plugin
+	*	binary's path, modification time and size.
+	*	It is only written for a supported plugin, and is checked against
+	*	the driver's vendor, renderer and version strings each time an
+	*	instance creates its context.
+	*	Setting ASHES_GL_PROBE_CACHE=0 disables it.
+	*/
+	class PluginCache
+	{
+	public:
+		/**
+		*\return
+		*	\p true if a valid entry has been found.
+		*/
+		static bool load( PluginCacheEntry & entry );
+		/**
+		*\brief
+		*	Writes the probe results, if they differ from the stored ones.
+		*/
+		static void update( ExtensionsHandler const & extensions );
+		static void invalidate();
+	};
+}
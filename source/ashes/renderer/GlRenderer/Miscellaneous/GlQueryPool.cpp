@@ -32,6 +32,8 @@ namespace ashes::gl
 	QueryPool::~QueryPool()
 	{
 		unregisterObject( m_device, *this );
+		get( m_device )->getQueryResultLinks().unlinkQueries( m_names.data()
+			, m_names.size() );
 		auto context = get( m_device )->getContext();
 		glLogCall( context
 			, glDeleteQueries
@@ -47,44 +49,163 @@ namespace ashes::gl
 		, size_t dataSize
 		, void * buffer )const
 	{
-		assert( firstQuery + queryCount <= m_names.size() );
-		auto begin = m_names.begin() + firstQuery;
-		auto end = begin + ( m_queryType == VK_QUERY_TYPE_PIPELINE_STATISTICS ? uint32_t( m_pipelineStatistics.size() ) : queryCount );
+		auto valueCount = doGetValueCount();
+		auto is64 = checkFlag( flags, VK_QUERY_RESULT_64_BIT );
+		auto wait = checkFlag( flags, VK_QUERY_RESULT_WAIT_BIT );
+		auto partial = checkFlag( flags, VK_QUERY_RESULT_PARTIAL_BIT );
+		auto withAvailability = checkFlag( flags, VK_QUERY_RESULT_WITH_AVAILABILITY_BIT );
+		VkDeviceSize valueSize = is64
+			? sizeof( GLuint64 )
+			: sizeof( GLuint );
+		stride = stride
+			? stride
+			: valueSize * ( valueCount + ( withAvailability ? 1u : 0u ) );
+		assert( firstQuery + queryCount + valueCount - 1u <= m_names.size() );
+		assert( queryCount == 0u
+			|| dataSize >= stride * ( queryCount - 1u ) + valueSize * valueCount );
 		auto buf = reinterpret_cast< uint8_t * >( buffer );
+		auto result = VK_SUCCESS;
 
-		if ( checkFlag( flags, VK_QUERY_RESULT_64_BIT ) )
+		auto write = [is64]( uint8_t * dst, GLuint64 value )
 		{
-			stride = stride
-				? stride
-				: sizeof( GLuint64 );
+			if ( is64 )
+			{
+				*reinterpret_cast< GLuint64 * >( dst ) = value;
+			}
+			else
+			{
+				*reinterpret_cast< GLuint * >( dst ) = GLuint( value );
+			}
+		};
+
+		for ( auto query = firstQuery; query < firstQuery + queryCount; ++query )
+		{
+			// Without WAIT, GL_QUERY_RESULT is only read once it can't block anymore.
+			auto available = wait
+				|| doIsAvailable( context, query );
+			auto dst = buf;
 
-			for ( auto it = begin; it != end; ++it )
+			for ( auto value = 0u; value < valueCount; ++value )
 			{
-				glLogCall( context
-					, glGetQueryObjectui64v
-					, *it
-					, convertQueryResultFlags( flags )
-					, reinterpret_cast< GLuint64 * >( buf ) );
-				buf += stride;
+				if ( available )
+				{
+					GLuint64 data{};
+					glLogCall( context
+						, glGetQueryObjectui64v
+						, m_names[query + value]
+						, GL_QUERY_RESULT
+						, &data );
+					write( dst, data );
+				}
+				else if ( partial )
+				{
+					write( dst, 0u );
+				}
+
+				dst += valueSize;
+			}
+
+			if ( withAvailability )
+			{
+				write( dst, available ? 1u : 0u );
 			}
+
+			if ( !available )
+			{
+				result = VK_NOT_READY;
+			}
+
+			buf += stride;
 		}
-		else
-		{
-			stride = stride
-				? stride
-				: sizeof( GLuint );
 
-			for ( auto it = begin; it != end; ++it )
+		return result;
+	}
+
+	void QueryPool::copyResults( ContextLock const & context
+		, uint32_t firstQuery
+		, uint32_t queryCount
+		, VkDeviceSize stride
+		, VkQueryResultFlags flags
+		, VkDeviceSize bufferOffset )const
+	{
+		auto valueCount = doGetValueCount();
+		auto is64 = checkFlag( flags, VK_QUERY_RESULT_64_BIT );
+		auto withAvailability = checkFlag( flags, VK_QUERY_RESULT_WITH_AVAILABILITY_BIT );
+		// GL_QUERY_RESULT_NO_WAIT leaves the destination untouched when the result isn't available.
+		auto resultFlag = checkFlag( flags, VK_QUERY_RESULT_WAIT_BIT )
+			? GL_QUERY_RESULT
+			: GL_QUERY_RESULT_NO_WAIT;
+		VkDeviceSize valueSize = is64
+			? sizeof( GLuint64 )
+			: sizeof( GLuint );
+		stride = stride
+			? stride
+			: valueSize * ( valueCount + ( withAvailability ? 1u : 0u ) );
+		assert( firstQuery + queryCount + valueCount - 1u <= m_names.size() );
+
+		auto copy = [&context, is64]( GLuint name, GlQueryResultFlag pname, VkDeviceSize offset )
+		{
+			if ( is64 )
+			{
+				glLogCall( context
+					, glGetQueryObjectui64v
+					, name
+					, pname
+					, reinterpret_cast< GLuint64 * >( getBufferOffset( intptr_t( offset ) ) ) );
+			}
+			else
 			{
 				glLogCall( context
 					, glGetQueryObjectuiv
-					, *it
-					, convertQueryResultFlags( flags )
-					, reinterpret_cast< GLuint * >( buf ) );
-				buf += stride;
+					, name
+					, pname
+					, reinterpret_cast< GLuint * >( getBufferOffset( intptr_t( offset ) ) ) );
+			}
+		};
+
+		for ( auto query = firstQuery; query < firstQuery + queryCount; ++query )
+		{
+			auto offset = bufferOffset;
+
+			for ( auto value = 0u; value < valueCount; ++value )
+			{
+				copy( m_names[query + value], resultFlag, offset );
+				offset += valueSize;
+			}
+
+			if ( withAvailability )
+			{
+				// The statistics queries end together, the last one stands for the whole query.
+				copy( m_names[query + valueCount - 1u], GL_QUERY_RESULT_AVAILABLE, offset );
 			}
+
+			bufferOffset += stride;
+		}
+	}
+
+	uint32_t QueryPool::doGetValueCount()const
+	{
+		return m_queryType == VK_QUERY_TYPE_PIPELINE_STATISTICS
+			? uint32_t( m_pipelineStatistics.size() )
+			: 1u;
+	}
+
+	bool QueryPool::doIsAvailable( ContextLock const & context
+		, uint32_t query )const
+	{
+		auto result = true;
+
+		for ( auto value = 0u; value < doGetValueCount() && result; ++value )
+		{
+			GLuint available{};
+			glLogCall( context
+				, glGetQueryObjectuiv
+				, m_names[query + value]
+				, GL_QUERY_RESULT_AVAILABLE
+				, &available );
+			result = available != GL_FALSE;
 		}
 
-		return VK_SUCCESS;
+		return result;
 	}
 }
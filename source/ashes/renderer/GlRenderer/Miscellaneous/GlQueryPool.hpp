@@ -24,6 +24,16 @@ namespace ashes::gl
 			, VkQueryResultFlags flags
 			, size_t dataSize
 			, void * buffer )const;
+		/**
+		*\brief
+		*	Writes the results to the buffer currently bound to GL_QUERY_BUFFER.
+		*/
+		void copyResults( ContextLock const & context
+			, uint32_t firstQuery
+			, uint32_t queryCount
+			, VkDeviceSize stride
+			, VkQueryResultFlags flags
+			, VkDeviceSize bufferOffset )const;
 
 		inline auto begin()const
 		{
@@ -50,6 +60,11 @@ namespace ashes::gl
 			return m_device;
 		}
 
+	private:
+		uint32_t doGetValueCount()const;
+		bool doIsAvailable( ContextLock const & context
+			, uint32_t query )const;
+
 	protected:
 		VkDevice m_device;
 		VkQueryPoolCreateFlags m_flags;
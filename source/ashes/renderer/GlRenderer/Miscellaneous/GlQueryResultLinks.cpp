@@ -0,0 +1,101 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/GlQueryResultLinks.hpp"
+
+#include "ashesgl_api.hpp"
+
+#include <algorithm>
+
+namespace ashes::gl
+{
+	void QueryResultLinks::link( GLuint buffer
+		, VkDeviceSize offset
+		, GLuint query )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		m_links[buffer][offset] = query;
+	}
+
+	GLuint QueryResultLinks::find( GLuint buffer
+		, VkDeviceSize offset )const
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto bufferIt = m_links.find( buffer );
+
+		if ( bufferIt == m_links.end() )
+		{
+			return GLuint( GL_INVALID_INDEX );
+		}
+
+		auto it = bufferIt->second.find( offset );
+		return it == bufferIt->second.end()
+			? GLuint( GL_INVALID_INDEX )
+			: it->second;
+	}
+
+	void QueryResultLinks::unlink( GLuint buffer
+		, VkDeviceSize offset
+		, VkDeviceSize size )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		if ( !buffer )
+		{
+			m_links.clear();
+			return;
+		}
+
+		auto bufferIt = m_links.find( buffer );
+
+		if ( bufferIt == m_links.end() )
+		{
+			return;
+		}
+
+		if ( size == WholeSize )
+		{
+			m_links.erase( bufferIt );
+			return;
+		}
+
+		// A link covers the 32 bits predicate starting at its offset.
+		auto & links = bufferIt->second;
+		links.erase( links.lower_bound( offset < sizeof( uint32_t ) ? 0u : offset - sizeof( uint32_t ) + 1u )
+			, links.lower_bound( offset + size ) );
+
+		if ( links.empty() )
+		{
+			m_links.erase( bufferIt );
+		}
+	}
+
+	void QueryResultLinks::unlinkQueries( GLuint const * queries
+		, size_t count )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto end = queries + count;
+
+		for ( auto bufferIt = m_links.begin(); bufferIt != m_links.end(); )
+		{
+			auto & links = bufferIt->second;
+
+			for ( auto it = links.begin(); it != links.end(); )
+			{
+				if ( std::find( queries, end, it->second ) != end )
+				{
+					it = links.erase( it );
+				}
+				else
+				{
+					++it;
+				}
+			}
+
+			bufferIt = links.empty()
+				? m_links.erase( bufferIt )
+				: std::next( bufferIt );
+		}
+	}
+}
@@ -0,0 +1,54 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+#include <map>
+#include <mutex>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	Remembers, at execution time, the occlusion query whose result was last copied
+	*	at a device memory offset, so that a conditional rendering predicate read there
+	*	can be evaluated on the GPU, from that query.
+	*\remarks
+	*	The memories are identified by their GL buffer name, the offsets are memory offsets.
+	*	Any other write to a linked range, or a reset of the query, drops the link.
+	*/
+	class QueryResultLinks
+	{
+	public:
+		void link( GLuint buffer
+			, VkDeviceSize offset
+			, GLuint query );
+		/**
+		*\return
+		*	The query linked to given offset, GL_INVALID_INDEX if none.
+		*/
+		GLuint find( GLuint buffer
+			, VkDeviceSize offset )const;
+		/**
+		*\brief
+		*	Drops the links within given range, all of the buffer's ones for WholeSize,
+		*	all links for a null buffer.
+		*/
+		void unlink( GLuint buffer
+			, VkDeviceSize offset
+			, VkDeviceSize size );
+		/**
+		*\brief
+		*	Drops the links to the given queries, when they are reset or destroyed.
+		*/
+		void unlinkQueries( GLuint const * queries
+			, size_t count );
+
+	private:
+		mutable std::mutex m_mutex;
+		std::map< GLuint, std::map< VkDeviceSize, GLuint > > m_links;
+	};
+}
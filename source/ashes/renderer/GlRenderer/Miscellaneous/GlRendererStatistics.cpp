@@ -0,0 +1,430 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/GlRendererStatistics.hpp"
+
+#include "Core/GlContextLock.hpp"
+
+#include "ashesgl_api.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ashes::gl
+{
+	namespace
+	{
+		char const * const EnableEnvVar = "ASHES_GL_STATISTICS";
+		char const * const LogPeriodEnvVar = "ASHES_GL_STATISTICS_LOG_PERIOD";
+		size_t constexpr OpTypeCount = size_t( OpType::eCount );
+
+		// Same order as OpType.
+		char const * const OpTypeNames[]
+		{
+			"ActiveTexture",
+			"ApplyDepthRanges",
+			"ApplyScissor",
+			"ApplyScissors",
+			"ApplyViewport",
+			"ApplyViewports",
+			"BeginConditionalRenderBuffer",
+			"BeginQuery",
+			"BindBuffer",
+			"BindBufferRange",
+			"BindContextState",
+			"BindFramebuffer",
+			"BindCachedFramebuffer",
+			"BindImage",
+			"BindSampler",
+			"BindTexture",
+			"BindVextexArray",
+			"BindVextexArrayObject",
+			"BlendConstants",
+			"BlendEquation",
+			"BlendFunc",
+			"BlitFramebuffer",
+			"CheckFramebuffer",
+			"CleanupFramebuffer",
+			"ClearBack",
+			"ClearBackColour",
+			"ClearBackDepth",
+			"ClearBackDepthStencil",
+			"ClearBackStencil",
+			"ClearColour",
+			"ClearDepth",
+			"ClearDepthStencil",
+			"ClearStencil",
+			"ClearTexColorF",
+			"ClearTexColorUI",
+			"ClearTexColorSI",
+			"ClearTexDepth",
+			"ClearTexDepthStencil",
+			"ClearTexStencil",
+			"ColorMask",
+			"CompressedTexSubImage1D",
+			"CompressedTexSubImage2D",
+			"CompressedTexSubImage3D",
+			"CopyBufferSubData",
+			"CopyImageSubData",
+			"CullFace",
+			"DepthFunc",
+			"DepthMask",
+			"DepthRange",
+			"Disable",
+			"Dispatch",
+			"DispatchIndirect",
+			"DownloadMemory",
+			"Draw",
+			"DrawBaseInstance",
+			"DrawBuffer",
+			"DrawBuffers",
+			"DrawIndexed",
+			"DrawIndexedBaseInstance",
+			"DrawIndexedIndirect",
+			"DrawIndirect",
+			"Enable",
+			"EndConditionalRender",
+			"EndQuery",
+			"FillBuffer",
+			"FramebufferTexture",
+			"FramebufferTexture1D",
+			"FramebufferTexture2D",
+			"FramebufferTexture3D",
+			"FramebufferTextureLayer",
+			"FrontFace",
+			"GenerateMipmaps",
+			"GetCompressedTexImage",
+			"GetQueryResults",
+			"GetTexImage",
+			"InvalidateFramebuffer",
+			"LineWidth",
+			"LogCommand",
+			"LogicOp",
+			"MemoryBarrier",
+			"MinSampleShading",
+			"PatchParameter",
+			"PixelStore",
+			"PolygonMode",
+			"PolygonOffset",
+			"PopDebugGroup",
+			"PrimitiveRestartIndex",
+			"ProgramUniform1fv",
+			"ProgramUniform2fv",
+			"ProgramUniform3fv",
+			"ProgramUniform4fv",
+			"ProgramUniform1iv",
+			"ProgramUniform2iv",
+			"ProgramUniform3iv",
+			"ProgramUniform4iv",
+			"ProgramUniform1uiv",
+			"ProgramUniform2uiv",
+			"ProgramUniform3uiv",
+			"ProgramUniform4uiv",
+			"ProgramUniformMatrix2fv",
+			"ProgramUniformMatrix3fv",
+			"ProgramUniformMatrix4fv",
+			"PushDebugGroup",
+			"ReadBuffer",
+			"ReadPixels",
+			"ResetEvent",
+			"SetEvent",
+			"SetLineWidth",
+			"StencilFunc",
+			"StencilMask",
+			"StencilOp",
+			"TexParameteri",
+			"TexParameterf",
+			"TexSubImage1D",
+			"TexSubImage2D",
+			"TexSubImage3D",
+			"Uniform1fv",
+			"Uniform2fv",
+			"Uniform3fv",
+			"Uniform4fv",
+			"Uniform1iv",
+			"Uniform2iv",
+			"Uniform3iv",
+			"Uniform4iv",
+			"Uniform1uiv",
+			"Uniform2uiv",
+			"Uniform3uiv",
+			"Uniform4uiv",
+			"UniformMatrix2fv",
+			"UniformMatrix3fv",
+			"UniformMatrix4fv",
+			"UnlinkQueries",
+			"UnlinkQueryResults",
+			"UpdateBuffer",
+			"UploadMemory",
+			"UseProgram",
+			"UseProgramPipeline",
+			"UseTransferKernel",
+			"WaitEvents",
+			"WriteTimestamp",
+		};
+		static_assert( std::size( OpTypeNames ) == OpTypeCount
+			, "OpTypeNames must have one name per OpType" );
+
+		struct OperationCounters
+		{
+			std::atomic< uint64_t > count{};
+			std::atomic< uint64_t > cpuTime{};
+		};
+
+		class Statistics
+		{
+		public:
+			Statistics()
+			{
+				auto value = std::getenv( EnableEnvVar );
+				m_enabled = value
+					&& std::string{ value } == "1";
+
+				if ( auto period = std::getenv( LogPeriodEnvVar ) )
+				{
+					m_logPeriod = std::strtoull( period, nullptr, 10 );
+				}
+
+				m_start = std::chrono::steady_clock::now();
+			}
+
+			bool isEnabled()const noexcept
+			{
+				return m_enabled;
+			}
+
+			uint64_t getTimestamp()const noexcept
+			{
+				return uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - m_start ).count() );
+			}
+
+			void addOperation( OpType type
+				, uint64_t duration )noexcept
+			{
+				auto & counters = m_operations[size_t( type )];
+				counters.count.fetch_add( 1u, std::memory_order_relaxed );
+				counters.cpuTime.fetch_add( duration, std::memory_order_relaxed );
+			}
+
+			void add( std::atomic< uint64_t > & counter
+				, uint64_t value )noexcept
+			{
+				if ( m_enabled )
+				{
+					counter.fetch_add( value, std::memory_order_relaxed );
+				}
+			}
+
+			RendererStatistics::SubmitBegin beginSubmit( ContextLock const & context )const noexcept
+			{
+				return { context->getCallCount()
+					, uploadedBytes.load( std::memory_order_relaxed )
+					, downloadedBytes.load( std::memory_order_relaxed )
+					, framebuffersCreated.load( std::memory_order_relaxed )
+					, vertexArraysCreated.load( std::memory_order_relaxed ) };
+			}
+
+			void endSubmit( ContextLock const & context
+				, RendererStatistics::SubmitBegin const & begin )
+			{
+				// The counters are process wide, so concurrent submits from several contexts get mixed.
+				AshRendererSubmitStatistics submit{ context->getCallCount() - begin.apiCalls
+					, uploadedBytes.load( std::memory_order_relaxed ) - begin.uploadedBytes
+					, downloadedBytes.load( std::memory_order_relaxed ) - begin.downloadedBytes
+					, framebuffersCreated.load( std::memory_order_relaxed ) - begin.framebuffersCreated
+					, vertexArraysCreated.load( std::memory_order_relaxed ) - begin.vertexArraysCreated };
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				++m_statistics.submitCount;
+				m_statistics.lastSubmit = submit;
+				m_statistics.total.apiCalls += submit.apiCalls;
+				m_statistics.total.uploadedBytes += submit.uploadedBytes;
+				m_statistics.total.downloadedBytes += submit.downloadedBytes;
+				m_statistics.total.framebuffersCreated += submit.framebuffersCreated;
+				m_statistics.total.vertexArraysCreated += submit.vertexArraysCreated;
+
+				if ( m_logPeriod
+					&& ( m_statistics.submitCount % m_logPeriod ) == 0u )
+				{
+					doLog();
+				}
+			}
+
+			VkResult get( AshRendererStatistics * statistics
+				, uint32_t & operationCount
+				, AshRendererOperationStatistics * operations )
+			{
+				if ( !m_enabled )
+				{
+					return VK_ERROR_FEATURE_NOT_PRESENT;
+				}
+
+				if ( statistics )
+				{
+					std::lock_guard< std::mutex > lock{ m_mutex };
+					*statistics = m_statistics;
+				}
+
+				if ( !operations )
+				{
+					operationCount = uint32_t( OpTypeCount );
+					return VK_SUCCESS;
+				}
+
+				auto result = operationCount < OpTypeCount
+					? VK_INCOMPLETE
+					: VK_SUCCESS;
+				operationCount = std::min( operationCount, uint32_t( OpTypeCount ) );
+
+				for ( uint32_t index = 0u; index < operationCount; ++index )
+				{
+					auto & counters = m_operations[index];
+					auto & stats = operations[index];
+					strncpy( stats.name, OpTypeNames[index], sizeof( stats.name ) - 1u );
+					stats.name[sizeof( stats.name ) - 1u] = 0;
+					stats.count = counters.count.load( std::memory_order_relaxed );
+					stats.cpuTime = counters.cpuTime.load( std::memory_order_relaxed );
+				}
+
+				return result;
+			}
+
+		private:
+			void doLog()const
+			{
+				std::vector< size_t > executed;
+
+				for ( size_t index = 0u; index < OpTypeCount; ++index )
+				{
+					if ( m_operations[index].count.load( std::memory_order_relaxed ) )
+					{
+						executed.push_back( index );
+					}
+				}
+
+				std::sort( executed.begin()
+					, executed.end()
+					, [this]( size_t lhs, size_t rhs )
+					{
+						return m_operations[lhs].cpuTime.load( std::memory_order_relaxed )
+							> m_operations[rhs].cpuTime.load( std::memory_order_relaxed );
+					} );
+				auto & last = m_statistics.lastSubmit;
+				auto & total = m_statistics.total;
+				std::stringstream stream;
+				stream.imbue( std::locale{ "C" } );
+				stream << "Ashes GL statistics, " << m_statistics.submitCount << " submits\n"
+					<< "  Last submit: " << last.apiCalls << " GL calls, "
+					<< last.uploadedBytes << " bytes uploaded, " << last.downloadedBytes << " bytes downloaded, "
+					<< last.framebuffersCreated << " FBOs, " << last.vertexArraysCreated << " VAOs created\n"
+					<< "  Total: " << total.apiCalls << " GL calls, "
+					<< total.uploadedBytes << " bytes uploaded, " << total.downloadedBytes << " bytes downloaded, "
+					<< total.framebuffersCreated << " FBOs, " << total.vertexArraysCreated << " VAOs created\n"
+					<< std::fixed << std::setprecision( 3 );
+
+				for ( auto index : executed )
+				{
+					auto & counters = m_operations[index];
+					auto count = counters.count.load( std::memory_order_relaxed );
+					auto cpuTime = counters.cpuTime.load( std::memory_order_relaxed );
+					stream << "  " << std::left << std::setw( 32 ) << OpTypeNames[index]
+						<< std::right << std::setw( 12 ) << count << " executions, "
+						<< std::setw( 12 ) << double( cpuTime ) / 1000000.0 << " ms, "
+						<< std::setw( 10 ) << double( cpuTime ) / double( count ) << " ns each\n";
+				}
+
+				std::clog << stream.str() << std::flush;
+			}
+
+		public:
+			std::atomic< uint64_t > uploadedBytes{};
+			std::atomic< uint64_t > downloadedBytes{};
+			std::atomic< uint64_t > framebuffersCreated{};
+			std::atomic< uint64_t > vertexArraysCreated{};
+
+		private:
+			bool m_enabled{ false };
+			uint64_t m_logPeriod{};
+			std::chrono::steady_clock::time_point m_start;
+			std::array< OperationCounters, OpTypeCount > m_operations;
+			std::mutex m_mutex;
+			AshRendererStatistics m_statistics{};
+		};
+
+		Statistics & getStatistics()
+		{
+			static Statistics result;
+			return result;
+		}
+	}
+
+	bool RendererStatistics::isEnabled()noexcept
+	{
+		static bool const result = getStatistics().isEnabled();
+		return result;
+	}
+
+	uint64_t RendererStatistics::getCpuTimestamp()noexcept
+	{
+		return getStatistics().getTimestamp();
+	}
+
+	void RendererStatistics::addOperation( OpType type
+		, uint64_t duration )noexcept
+	{
+		getStatistics().addOperation( type, duration );
+	}
+
+	void RendererStatistics::addUpload( VkDeviceSize size )noexcept
+	{
+		auto & statistics = getStatistics();
+		statistics.add( statistics.uploadedBytes, uint64_t( size ) );
+	}
+
+	void RendererStatistics::addDownload( VkDeviceSize size )noexcept
+	{
+		auto & statistics = getStatistics();
+		statistics.add( statistics.downloadedBytes, uint64_t( size ) );
+	}
+
+	void RendererStatistics::addFramebuffer()noexcept
+	{
+		auto & statistics = getStatistics();
+		statistics.add( statistics.framebuffersCreated, 1u );
+	}
+
+	void RendererStatistics::addVertexArray()noexcept
+	{
+		auto & statistics = getStatistics();
+		statistics.add( statistics.vertexArraysCreated, 1u );
+	}
+
+	RendererStatistics::SubmitBegin RendererStatistics::beginSubmit( ContextLock const & context )noexcept
+	{
+		return getStatistics().beginSubmit( context );
+	}
+
+	void RendererStatistics::endSubmit( ContextLock const & context
+		, SubmitBegin const & begin )
+	{
+		getStatistics().endSubmit( context, begin );
+	}
+
+	VkResult RendererStatistics::get( AshRendererStatistics * statistics
+		, uint32_t & operationCount
+		, AshRendererOperationStatistics * operations )
+	{
+		return getStatistics().get( statistics, operationCount, operations );
+	}
+}
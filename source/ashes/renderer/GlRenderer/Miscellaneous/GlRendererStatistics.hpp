@@ -0,0 +1,62 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+#include "renderer/GlRenderer/Command/Commands/GlCommandBase.hpp"
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	Counts the executions and CPU time of each translated operation,
+	*	and per vkQueueSubmit, the GL calls, the memory uploads and downloads, and the FBO and VAO creations.
+	*\remarks
+	*	Enabled by setting ASHES_GL_STATISTICS=1, retrieved through ashGetRendererStatistics.
+	*	Setting ASHES_GL_STATISTICS_LOG_PERIOD=N also dumps them to std::clog every N submits.
+	*	When disabled, the callers only pay for the isEnabled check, the GL calls are always counted by their context.
+	*/
+	class RendererStatistics
+	{
+	public:
+		struct SubmitBegin
+		{
+			uint64_t apiCalls;
+			uint64_t uploadedBytes;
+			uint64_t downloadedBytes;
+			uint64_t framebuffersCreated;
+			uint64_t vertexArraysCreated;
+		};
+
+	public:
+		static bool isEnabled()noexcept;
+		/**
+		*\return
+		*	The CPU time, in nanoseconds.
+		*/
+		static uint64_t getCpuTimestamp()noexcept;
+		static void addOperation( OpType type
+			, uint64_t duration )noexcept;
+		/**
+		*\remarks
+		*	The following functions check isEnabled themselves, they aren't on hot paths.
+		*/
+		static void addUpload( VkDeviceSize size )noexcept;
+		static void addDownload( VkDeviceSize size )noexcept;
+		static void addFramebuffer()noexcept;
+		static void addVertexArray()noexcept;
+		/**
+		*\brief
+		*	Brackets a vkQueueSubmit, its statistics are the counters' differences.
+		*/
+		static SubmitBegin beginSubmit( ContextLock const & context )noexcept;
+		static void endSubmit( ContextLock const & context
+			, SubmitBegin const & begin );
+
+		static VkResult get( AshRendererStatistics * statistics
+			, uint32_t & operationCount
+			, AshRendererOperationStatistics * operations );
+	};
+}
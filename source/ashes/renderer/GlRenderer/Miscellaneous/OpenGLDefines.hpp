@@ -139,6 +139,7 @@ namespace ashes::gl
 
 	using PFN_glActiveTexture = void ( GLAPIENTRY * )( GlTextureUnit texture );
 	using PFN_glAttachShader = void ( GLAPIENTRY * )( GLuint program, GLuint shader );
+	using PFN_glBeginConditionalRender = void ( GLAPIENTRY * )( GLuint id, GlConditionalRenderMode mode );
 	using PFN_glBeginQuery = void ( GLAPIENTRY * )( GlQueryType target, GLuint id );
 	using PFN_glBindBuffer = void ( GLAPIENTRY * )( GlBufferTarget target, GLuint buffer );
 	using PFN_glBindBufferBase = void ( GLAPIENTRY * )( GlBufferTarget target, GLuint index, GLuint buffer );
@@ -186,6 +187,7 @@ namespace ashes::gl
 	using PFN_glCullFace = void ( GLAPIENTRY * )( GLenum mode );
 	using PFN_glDebugMessageCallback = void ( GLAPIENTRY * )( PFNGLDEBUGPROC callback, void * userParam );
 	using PFN_glDebugMessageCallbackAMD = void ( GLAPIENTRY * )( PFNGLDEBUGAMDPROC callback, void * userParam );
+	using PFN_glDebugMessageInsert = void ( GLAPIENTRY * )( GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const char * buf );
 	using PFN_glDeleteBuffers = void ( GLAPIENTRY * )( GLsizei n, const GLuint * buffers );
 	using PFN_glDeleteFramebuffers = void ( GLAPIENTRY * )( GLsizei n, const GLuint* framebuffers );
 	using PFN_glDeleteProgram = void ( GLAPIENTRY * )( GLuint program );
@@ -214,6 +216,7 @@ namespace ashes::gl
 	using PFN_glDrawElementsInstancedBaseVertexBaseInstance = void ( GLAPIENTRY * )( GLenum mode, GLsizei count, GLenum type, GLvoid *indices, GLsizei primcount, GLint basevertex, GLuint baseinstance );
 	using PFN_glEnable = void ( GLAPIENTRY * )( GlTweak cap );
 	using PFN_glEnableVertexAttribArray = void ( GLAPIENTRY * )( GLuint index );
+	using PFN_glEndConditionalRender = void ( GLAPIENTRY * )();
 	using PFN_glEndQuery = void ( GLAPIENTRY * )( GLenum target );
 	using PFN_glFenceSync = GLsync( GLAPIENTRY * )( GLenum condition, GLbitfield flags );
 	using PFN_glFinish = void ( GLAPIENTRY * )();
@@ -275,6 +278,7 @@ namespace ashes::gl
 	using PFN_glGetUniformBlockIndex = GLuint ( GLAPIENTRY * )( GLuint program, const GLchar * name );
 	using PFN_glGetUniformIndices = void ( GLAPIENTRY * )( GLuint program, GLsizei uniformCount, const char ** uniformNames, GLuint *uniformIndices );
 	using PFN_glInvalidateBufferSubData = void ( GLAPIENTRY * )( GLuint buffer, GLintptr offset, GLsizeiptr length );
+	using PFN_glInvalidateFramebuffer = void ( GLAPIENTRY * )( GlFrameBufferTarget target, GLsizei numAttachments, const GlAttachmentPoint * attachments );
 	using PFN_glIsBuffer = GLboolean ( GLAPIENTRY * )( GLuint buffer );
 	using PFN_glLineWidth = void ( GLAPIENTRY * )( GLfloat width );
 	using PFN_glLinkProgram = void ( GLAPIENTRY * )( GLuint program );
@@ -58,6 +58,7 @@ GL_LIB_BASE_FUNCTION( Viewport )
 
 GL_LIB_FUNCTION( ActiveTexture )
 GL_LIB_FUNCTION( AttachShader )
+GL_LIB_FUNCTION( BeginConditionalRender )
 GL_LIB_FUNCTION( BeginQuery )
 GL_LIB_FUNCTION( BindBuffer )
 GL_LIB_FUNCTION( BindBufferBase )
@@ -102,6 +103,7 @@ GL_LIB_FUNCTION( DrawElementsBaseVertex )
 GL_LIB_FUNCTION( DrawElementsInstanced )
 GL_LIB_FUNCTION( DrawElementsInstancedBaseVertex )
 GL_LIB_FUNCTION( EnableVertexAttribArray )
+GL_LIB_FUNCTION( EndConditionalRender )
 GL_LIB_FUNCTION( EndQuery )
 GL_LIB_FUNCTION( FenceSync )
 GL_LIB_FUNCTION( FlushMappedBufferRange )
@@ -203,6 +205,7 @@ GL_LIB_FUNCTION_EXT( ClipControl, "ARB", ARB_clip_control )
 GL_LIB_FUNCTION_EXT( CopyImageSubData, "ARB", ARB_copy_image )
 GL_LIB_FUNCTION_EXT( CreateShaderProgramv, "ARB", ARB_separate_shader_objects )
 GL_LIB_FUNCTION_EXT( DebugMessageCallback, "KHR", KHR_debug, "ARB", ARB_debug_output )
+GL_LIB_FUNCTION_EXT( DebugMessageInsert, "KHR", KHR_debug, "ARB", ARB_debug_output )
 GL_LIB_FUNCTION_EXT( DeleteProgramPipelines, "ARB", ARB_separate_shader_objects )
 GL_LIB_FUNCTION_EXT( DepthRangeArrayv, "ARB", ARB_viewport_array )
 GL_LIB_FUNCTION_EXT( DispatchCompute, "ARB", ARB_compute_shader )
@@ -220,6 +223,7 @@ GL_LIB_FUNCTION_EXT( GetProgramResourceiv, "ARB", ARB_program_interface_query )
 GL_LIB_FUNCTION_EXT( GetProgramResourceIndex, "ARB", ARB_program_interface_query )
 GL_LIB_FUNCTION_EXT( GetProgramResourceName, "ARB", ARB_program_interface_query )
 GL_LIB_FUNCTION_EXT( InvalidateBufferSubData, "ARB", ARB_invalidate_subdata )
+GL_LIB_FUNCTION_EXT( InvalidateFramebuffer, "ARB", ARB_invalidate_subdata )
 GL_LIB_FUNCTION_EXT( MemoryBarrier, "ARB", ARB_shader_image_load_store )
 GL_LIB_FUNCTION_EXT( MinSampleShading, "ARB", ARB_sample_shading )
 GL_LIB_FUNCTION_EXT( MultiDrawArraysIndirect, "ARB", ARB_multi_draw_indirect )
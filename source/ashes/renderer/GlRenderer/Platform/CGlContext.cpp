@@ -184,6 +184,13 @@ namespace ashes::gl
 		checkCGLErrorCode( errorCode, "CGLFlushDrawable" );
 	}
 
+	void CoreContext::setSwapInterval( int interval )const
+	{
+		GLint sync = interval;
+		auto errorCode = CGLSetParameter( m_cglContext, kCGLCPSwapInterval, &sync );
+		checkCGLErrorCode( errorCode, "CGLSetParameter - kCGLCPSwapInterval" );
+	}
+
 	VkExtent2D CoreContext::getExtent()const
 	{
 		if ( displayCreateInfo.sType )
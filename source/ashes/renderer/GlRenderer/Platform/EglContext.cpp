@@ -7,8 +7,11 @@ See LICENSE file in root folder
 #if defined( __linux__ )
 
 #include <EGL/egl.h>
+#include <EGL/eglext.h>
 
+#include <cstring>
 #include <map>
+#include <mutex>
 #include <stdexcept>
 
 namespace ashes::gl
@@ -38,7 +41,167 @@ namespace ashes::gl
 			default: return text;
 			}
 		}
+
+		bool hasExtension( char const * extensions
+			, char const * name )
+		{
+			if ( !extensions )
+			{
+				return false;
+			}
+
+			auto length = strlen( name );
+			auto it = strstr( extensions, name );
+
+			while ( it )
+			{
+				if ( ( it == extensions || it[-1] == ' ' )
+					&& ( it[length] == ' ' || it[length] == '\0' ) )
+				{
+					return true;
+				}
+
+				it = strstr( it + length, name );
+			}
+
+			return false;
+		}
+
+		EGLDisplay initialiseDisplay( EGLDisplay display )
+		{
+			if ( display == EGL_NO_DISPLAY )
+			{
+				return EGL_NO_DISPLAY;
+			}
+
+			EGLint major = 0;
+			EGLint minor = 0;
+
+			if ( !eglInitialize( display, &major, &minor ) )
+			{
+				return EGL_NO_DISPLAY;
+			}
+
+			return display;
+		}
+
+		EGLDisplay getHeadlessDisplay()
+		{
+			auto clientExtensions = eglQueryString( EGL_NO_DISPLAY, EGL_EXTENSIONS );
+			auto getPlatformDisplay = reinterpret_cast< PFNEGLGETPLATFORMDISPLAYEXTPROC >( eglGetProcAddress( "eglGetPlatformDisplayEXT" ) );
+			EGLDisplay result = EGL_NO_DISPLAY;
+
+			if ( getPlatformDisplay )
+			{
+				// Prefer a real device (render node, or Mesa's software device),
+				// then Mesa's surfaceless platform.
+				auto queryDevices = reinterpret_cast< PFNEGLQUERYDEVICESEXTPROC >( eglGetProcAddress( "eglQueryDevicesEXT" ) );
+
+				if ( queryDevices
+					&& hasExtension( clientExtensions, "EGL_EXT_platform_device" ) )
+				{
+					EGLint constexpr maxDevices = 16;
+					EGLDeviceEXT devices[maxDevices]{};
+					EGLint numDevices{};
+
+					if ( queryDevices( maxDevices, devices, &numDevices ) )
+					{
+						for ( EGLint i = 0; i < numDevices && result == EGL_NO_DISPLAY; ++i )
+						{
+							result = initialiseDisplay( getPlatformDisplay( EGL_PLATFORM_DEVICE_EXT, devices[i], nullptr ) );
+						}
+					}
+				}
+
+				if ( result == EGL_NO_DISPLAY
+					&& hasExtension( clientExtensions, "EGL_MESA_platform_surfaceless" ) )
+				{
+					result = initialiseDisplay( getPlatformDisplay( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr ) );
+				}
+			}
+
+			if ( result == EGL_NO_DISPLAY )
+			{
+				result = initialiseDisplay( eglGetDisplay( EGL_DEFAULT_DISPLAY ) );
+			}
+
+			return result;
+		}
+
+		// EGL returns the same EGLDisplay for the same native display, and doesn't count its
+		// initialisations, so it is only terminated when the last context using it is released.
+		std::mutex displaysMutex;
+		std::map< EGLDisplay, uint32_t > displaysRefCounts;
+
+		bool chooseHeadlessConfig( EGLDisplay display
+			, EGLint surfaceType
+			, EGLConfig & config )
+		{
+			const EGLint eglConfigAttribs[]
+			{
+				EGL_COLOR_BUFFER_TYPE,     EGL_RGB_BUFFER,
+				EGL_RED_SIZE,              8,
+				EGL_GREEN_SIZE,            8,
+				EGL_BLUE_SIZE,             8,
+				EGL_ALPHA_SIZE,            8,
+
+				EGL_SURFACE_TYPE,          surfaceType,
+				EGL_RENDERABLE_TYPE,       EGL_OPENGL_BIT,
+
+				EGL_NONE,
+			};
+			EGLint numConfigs{};
+			return eglChooseConfig( display
+				, eglConfigAttribs
+				, &config
+				, 1
+				, &numConfigs )
+				&& numConfigs > 0;
+		}
+
+		EGLContext createContext( EGLDisplay display
+			, EGLConfig config
+			, int reqMajor
+			, int reqMinor
+			, EGLContext shared )
+		{
+			const EGLint eglContextAttribs[]
+			{
+				EGL_CONTEXT_MAJOR_VERSION, reqMajor,
+				EGL_CONTEXT_MINOR_VERSION, reqMinor,
+				EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+				EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE, EGL_TRUE,
+#if !defined( NDEBUG )
+				EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE,
+#endif
+
+				EGL_NONE,
+			};
+			return eglCreateContext( display
+				, config
+				, shared
+				, eglContextAttribs );
+		}
+	}
+	void retainEglDisplay( EGLDisplay display )
+	{
+		std::lock_guard< std::mutex > lock{ displaysMutex };
+		++displaysRefCounts[display];
+	}
+
+	void releaseEglDisplay( EGLDisplay display )
+	{
+		std::lock_guard< std::mutex > lock{ displaysMutex };
+		auto it = displaysRefCounts.find( display );
+
+		if ( it != displaysRefCounts.end()
+			&& --it->second == 0u )
+		{
+			displaysRefCounts.erase( it );
+			eglTerminate( display );
+		}
 	}
+
 	ContextEgl::ContextEgl( Display * display
 		, uint64_t window
 		, int reqMajor
@@ -70,6 +233,8 @@ namespace ashes::gl
 				throw std::runtime_error{ getEGLError( "Couldn't initialise EGL" ) };
 			}
 
+			retainEglDisplay( m_display );
+
 			const EGLint eglConfigAttribs[]
 			{
 				EGL_COLOR_BUFFER_TYPE,     EGL_RGB_BUFFER,
@@ -132,22 +297,11 @@ namespace ashes::gl
 				throw std::runtime_error{ getEGLError( "EGL Surface creation failed" ) };
 			}
 
-			const EGLint eglContextAttribs[]
-			{
-				EGL_CONTEXT_MAJOR_VERSION, reqMajor,
-				EGL_CONTEXT_MINOR_VERSION, reqMinor,
-				EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
-				EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE, EGL_TRUE,
-#if !defined( NDEBUG )
-				EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE,
-#endif
-
-				EGL_NONE,
-			};
-			m_context = eglCreateContext( m_display
+			m_context = createContext( m_display
 				, config
-				, shared
-				, eglContextAttribs );
+				, reqMajor
+				, reqMinor
+				, shared );
 
 			if ( !m_context )
 			{
@@ -180,6 +334,86 @@ namespace ashes::gl
 	{
 	}
 
+	ContextEgl::ContextEgl( VkExtent2D const & extent
+		, int reqMajor
+		, int reqMinor
+		, EGLContext shared )
+		: m_extent{ extent }
+	{
+		try
+		{
+			EGLBoolean ok = eglBindAPI( EGL_OPENGL_API );
+
+			if ( !ok )
+			{
+				throw std::runtime_error{ getEGLError( "Couldn't bind EGL API" ) };
+			}
+
+			m_display = getHeadlessDisplay();
+
+			if ( m_display == EGL_NO_DISPLAY )
+			{
+				throw std::runtime_error{ getEGLError( "Couldn't get headless EGL display" ) };
+			}
+
+			retainEglDisplay( m_display );
+
+			EGLConfig config{ nullptr };
+
+			if ( chooseHeadlessConfig( m_display, EGL_PBUFFER_BIT, config ) )
+			{
+				const EGLint eglSurfaceAttribs[]
+				{
+					EGL_WIDTH, EGLint( m_extent.width ),
+					EGL_HEIGHT, EGLint( m_extent.height ),
+					EGL_NONE,
+				};
+				m_surface = eglCreatePbufferSurface( m_display
+					, config
+					, eglSurfaceAttribs );
+			}
+
+			if ( !m_surface )
+			{
+				if ( !hasExtension( eglQueryString( m_display, EGL_EXTENSIONS ), "EGL_KHR_surfaceless_context" ) )
+				{
+					throw std::runtime_error{ getEGLError( "EGL pbuffer creation failed, and surfaceless contexts aren't supported" ) };
+				}
+
+				// Surfaceless platforms may expose no pbuffer config at all, any config will do.
+				if ( !chooseHeadlessConfig( m_display, EGL_DONT_CARE, config ) )
+				{
+					throw std::runtime_error{ getEGLError( "Failed to find suitable EGLConfig" ) };
+				}
+			}
+
+			m_context = createContext( m_display
+				, config
+				, reqMajor
+				, reqMinor
+				, shared );
+
+			if ( !m_context )
+			{
+				throw std::runtime_error{ getEGLError( "EGL Context creation failed" ) };
+			}
+
+			ok = enable();
+
+			if ( !ok )
+			{
+				throw std::runtime_error{ getEGLError( "eglMakeCurrent() failed" ) };
+			}
+
+			disable();
+		}
+		catch ( std::exception & )
+		{
+			doCleanup();
+			throw;
+		}
+	}
+
 	ContextEgl::~ContextEgl()
 	{
 		doCleanup();
@@ -197,11 +431,26 @@ namespace ashes::gl
 
 	EGLBoolean ContextEgl::swap()const
 	{
+		if ( !m_surface )
+		{
+			return EGL_TRUE;
+		}
+
 		return eglSwapBuffers( m_display, m_surface );
 	}
 
+	EGLBoolean ContextEgl::setSwapInterval( int interval )const
+	{
+		return eglSwapInterval( m_display, interval );
+	}
+
 	VkExtent2D ContextEgl::getExtent()const
 	{
+		if ( !m_surface )
+		{
+			return m_extent;
+		}
+
 		VkExtent2D result{};
 		EGLint width = 0;
 		EGLint height = 0;
@@ -232,7 +481,7 @@ namespace ashes::gl
 
 		if ( m_display )
 		{
-			eglTerminate( m_display );
+			releaseEglDisplay( m_display );
 			m_display = nullptr;
 		}
 	}
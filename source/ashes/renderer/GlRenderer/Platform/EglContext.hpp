@@ -17,6 +17,17 @@ struct wl_egl_window;
 
 namespace ashes::gl
 {
+	/**
+	*\brief
+	*	Adds a reference to an initialised EGL display.
+	*/
+	void retainEglDisplay( EGLDisplay display );
+	/**
+	*\brief
+	*	Removes a reference to an EGL display, terminates it when it was the last one.
+	*/
+	void releaseEglDisplay( EGLDisplay display );
+
 	class ContextEgl
 	{
 	public:
@@ -30,11 +41,21 @@ namespace ashes::gl
 			, int reqMajor
 			, int reqMinor
 			, EGLContext shared );
+		/**
+		*\brief
+		*	Creates a context without any window system,
+		*	using a pbuffer surface when available, no surface otherwise.
+		*/
+		ContextEgl( VkExtent2D const & extent
+			, int reqMajor
+			, int reqMinor
+			, EGLContext shared );
 		~ContextEgl();
 
 		EGLBoolean enable()const;
 		EGLBoolean disable()const;
 		EGLBoolean swap()const;
+		EGLBoolean setSwapInterval( int interval )const;
 		VkExtent2D getExtent()const;
 
 		inline EGLContext getContext()const
@@ -49,6 +70,7 @@ namespace ashes::gl
 		EGLDisplay m_display{ nullptr };
 		EGLContext m_context{ nullptr };
 		EGLSurface m_surface{ nullptr };
+		VkExtent2D m_extent{};
 	};
 
 	using ContextEglPtr = std::unique_ptr< ContextEgl >;
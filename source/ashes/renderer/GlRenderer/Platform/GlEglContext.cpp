@@ -3,6 +3,7 @@ This file belongs to Ashes.
 See LICENSE file in root folder
 */
 #include "Platform/GlEglContext.hpp"
+#include "Platform/EglContext.hpp"
 
 #if defined( __linux__ )
 
@@ -52,6 +53,8 @@ namespace ashes::gl
 				throw std::runtime_error{ "Couldn't initialise EGL" };
 			}
 
+			retainEglDisplay( m_display );
+
 			const EGLint eglConfigAttribs[]
 			{
 				EGL_COLOR_BUFFER_TYPE, EGL_RGB_BUFFER,
@@ -170,6 +173,11 @@ namespace ashes::gl
 		eglSwapBuffers( m_display, m_surface );
 	}
 
+	void EglContext::setSwapInterval( int interval )const
+	{
+		eglSwapInterval( m_display, interval );
+	}
+
 	VkExtent2D EglContext::getExtent()const
 	{
 		VkExtent2D result{};
@@ -202,7 +210,7 @@ namespace ashes::gl
 
 		if ( m_display )
 		{
-			eglTerminate( m_display );
+			releaseEglDisplay( m_display );
 			m_display = nullptr;
 		}
 	}
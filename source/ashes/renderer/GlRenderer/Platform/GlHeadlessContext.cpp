@@ -0,0 +1,74 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#include "GlHeadlessContext.hpp"
+
+#if Ashes_GlHeadlessSurface
+
+#include "ashesgl_api.hpp"
+
+#include <EGL/egl.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace ashes::gl
+{
+	HeadlessContext::HeadlessContext( VkInstance instance
+		, VkHeadlessSurfaceCreateInfoEXT createInfo
+		, ContextImpl const * mainContext )
+		: ContextImpl{ instance }
+		, createInfo{ std::move( createInfo ) }
+		, m_mainContext{ dynamic_cast< HeadlessContext const * >( mainContext ) }
+	{
+	}
+
+	HeadlessContext::~HeadlessContext()noexcept
+	{
+	}
+
+	void HeadlessContext::preInitialise( int reqMajor, int reqMinor )
+	{
+		// Nothing is ever displayed, the swapchain images are the only render targets.
+		auto & extensions = get( instance )->getExtensions();
+		// The versions are compared as a whole, 4.5 against 3.6 must give 4.5.
+		auto version = std::max( std::make_pair( reqMajor, reqMinor )
+			, std::make_pair( int( extensions.getMajor() ), int( extensions.getMinor() ) ) );
+		m_context = std::make_unique< ContextEgl >( VkExtent2D{ 1u, 1u }
+			, version.first
+			, version.second
+			, ( m_mainContext
+				? m_mainContext->m_context->getContext()
+				: EGL_NO_CONTEXT ) );
+	}
+
+	void HeadlessContext::postInitialise()
+	{
+	}
+
+	void HeadlessContext::enable()const
+	{
+		m_context->enable();
+	}
+
+	void HeadlessContext::disable()const
+	{
+		m_context->disable();
+	}
+
+	void HeadlessContext::swapBuffers()const
+	{
+	}
+
+	void HeadlessContext::setSwapInterval( int interval )const
+	{
+	}
+
+	VkExtent2D HeadlessContext::getExtent()const
+	{
+		return m_context->getExtent();
+	}
+}
+
+#endif
@@ -0,0 +1,43 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/Core/GlContextImpl.hpp"
+
+#if Ashes_GlHeadlessSurface
+#include "EglContext.hpp"
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	EGL context that doesn't need any window system,
+	*	used for VK_EXT_headless_surface and when no display server is available.
+	*/
+	class HeadlessContext
+		: public ContextImpl
+	{
+	public:
+		HeadlessContext( VkInstance instance
+			, VkHeadlessSurfaceCreateInfoEXT createInfo
+			, ContextImpl const * mainContext );
+		~HeadlessContext()noexcept override;
+
+		void preInitialise( int major, int minor )override;
+		void postInitialise()override;
+		void enable()const override;
+		void disable()const override;
+		void swapBuffers()const override;
+		void setSwapInterval( int interval )const override;
+		VkExtent2D getExtent()const override;
+
+	private:
+		VkHeadlessSurfaceCreateInfoEXT createInfo;
+		ContextEglPtr m_context;
+		HeadlessContext const * m_mainContext{ nullptr };
+	};
+}
+
+#endif
@@ -325,6 +325,14 @@ namespace ashes::gl
 		::SwapBuffers( m_hDC );
 	}
 
+	void MswContext::setSwapInterval( int interval )const
+	{
+		if ( wglSwapIntervalEXT )
+		{
+			wglSwapIntervalEXT( interval );
+		}
+	}
+
 	VkExtent2D MswContext::getExtent()const
 	{
 		if ( displayCreateInfo.sType )
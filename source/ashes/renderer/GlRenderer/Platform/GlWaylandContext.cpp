@@ -66,6 +66,11 @@ namespace ashes::gl
 		m_context->swap();
 	}
 
+	void WaylandContext::setSwapInterval( int interval )const
+	{
+		m_context->setSwapInterval( interval );
+	}
+
 	VkExtent2D WaylandContext::getExtent()const
 	{
 		int w{};
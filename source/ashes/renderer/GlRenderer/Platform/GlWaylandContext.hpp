@@ -27,6 +27,7 @@ namespace ashes::gl
 		void enable()const override;
 		void disable()const override;
 		void swapBuffers()const override;
+		void setSwapInterval( int interval )const override;
 		VkExtent2D getExtent()const override;
 
 	private:
@@ -230,6 +230,14 @@ namespace ashes::gl
 		glXSwapBuffers( m_display, m_window );
 	}
 
+	void X11Context::setSwapInterval( int interval )const
+	{
+		if ( glXSwapInterval )
+		{
+			glXSwapInterval( m_display, m_window, interval );
+		}
+	}
+
 	VkExtent2D X11Context::getExtent()const
 	{
 		if ( displayCreateInfo.sType )
@@ -60,6 +60,11 @@ namespace ashes::gl
 		m_context->swap();
 	}
 
+	void X11EglContext::setSwapInterval( int interval )const
+	{
+		m_context->setSwapInterval( interval );
+	}
+
 	VkExtent2D X11EglContext::getExtent()const
 	{
 		return m_context->getExtent();
@@ -25,7 +25,17 @@ namespace ashes::gl
 
 			if ( !m_display )
 			{
+#if Ashes_GlHeadlessSurface
+				// No display server (render nodes, CI), fall back to a window-less EGL context.
+				m_headless = std::make_unique< ContextEgl >( VkExtent2D{ 1u, 1u }
+					, reqMajor
+					, reqMinor
+					, EGL_NO_CONTEXT );
+				m_headless->enable();
+				return;
+#else
 				throw std::runtime_error{ "Couldn't open X Display" };
+#endif
 			}
 
 			int attributes[] =
@@ -167,6 +177,16 @@ namespace ashes::gl
 
 	void RenderWindow::doCleanup()
 	{
+#if Ashes_GlHeadlessSurface
+
+		if ( m_headless )
+		{
+			m_headless->disable();
+			m_headless.reset();
+		}
+
+#endif
+
 #if ASHES_USE_XLIB_EGL
 
 		m_context.reset();
@@ -211,6 +231,20 @@ namespace ashes::gl
 			m_window,
 		};
 	}
+
+#if Ashes_GlHeadlessSurface
+
+	VkHeadlessSurfaceCreateInfoEXT RenderWindow::getHeadlessCreateInfo()const
+	{
+		return
+		{
+			VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT,
+			nullptr,
+			0u,
+		};
+	}
+
+#endif
 }
 
 #endif
@@ -8,9 +8,9 @@ See LICENSE file in root folder
 
 #include "GlRendererPrerequisites.hpp"
 
-#if ASHES_USE_XLIB_EGL
-#	include "EglContext.hpp"
-#else
+#include "EglContext.hpp"
+
+#if !ASHES_USE_XLIB_EGL
 typedef struct __GLXFBConfigRec * GLXFBConfig;
 typedef struct __GLXcontextRec * GLXContext;
 #endif
@@ -26,6 +26,14 @@ namespace ashes::gl
 			, std::string const & name );
 		~RenderWindow();
 		VkXlibSurfaceCreateInfoKHR getCreateInfo()const;
+#if Ashes_GlHeadlessSurface
+		VkHeadlessSurfaceCreateInfoEXT getHeadlessCreateInfo()const;
+
+		bool isHeadless()const
+		{
+			return m_headless != nullptr;
+		}
+#endif
 
 	private:
 		void doCleanup();
@@ -39,6 +47,9 @@ namespace ashes::gl
 #else
 		GLXFBConfig m_fbConfig{ nullptr };
 		GLXContext m_glxContext{ nullptr };
+#endif
+#if Ashes_GlHeadlessSurface
+		ContextEglPtr m_headless;
 #endif
 	};
 }
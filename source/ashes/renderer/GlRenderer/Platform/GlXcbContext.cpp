@@ -79,6 +79,11 @@ namespace ashes::gl
 		m_context->swap();
 	}
 
+	void XcbContext::setSwapInterval( int interval )const
+	{
+		m_context->setSwapInterval( interval );
+	}
+
 	VkExtent2D XcbContext::getExtent()const
 	{
 		return m_context->getExtent();
@@ -109,6 +109,57 @@ namespace ashes::gl
 		return GL_ATTACHMENT_POINT_COLOR0;
 	}
 
+	Optional< GlAttachmentPoint > getInvalidatedPoint( FboAttachment const & attach
+		, uint32_t index
+		, bool discardMain
+		, bool discardStencil )
+	{
+		switch ( attach.point )
+		{
+		case GL_ATTACHMENT_POINT_DEPTH_STENCIL:
+			if ( discardMain && discardStencil )
+			{
+				return GL_ATTACHMENT_POINT_DEPTH_STENCIL;
+			}
+
+			if ( discardMain )
+			{
+				return GL_ATTACHMENT_POINT_DEPTH;
+			}
+
+			if ( discardStencil )
+			{
+				return GL_ATTACHMENT_POINT_STENCIL;
+			}
+
+			return ashes::nullopt;
+
+		case GL_ATTACHMENT_POINT_DEPTH:
+			if ( discardMain )
+			{
+				return GL_ATTACHMENT_POINT_DEPTH;
+			}
+
+			return ashes::nullopt;
+
+		case GL_ATTACHMENT_POINT_STENCIL:
+			if ( discardStencil )
+			{
+				return GL_ATTACHMENT_POINT_STENCIL;
+			}
+
+			return ashes::nullopt;
+
+		default:
+			if ( discardMain )
+			{
+				return GlAttachmentPoint( attach.point + index );
+			}
+
+			return ashes::nullopt;
+		}
+	}
+
 	GlAttachmentType getAttachmentType( VkImageAspectFlags aspectMask )
 	{
 		if ( checkFlag( aspectMask, VkImageAspectFlagBits::VK_IMAGE_ASPECT_DEPTH_BIT )
@@ -344,6 +395,19 @@ namespace ashes::gl
 		return FboAttachment{};
 	}
 
+	bool Framebuffer::isTransient( VkAttachmentReference const & reference )const
+	{
+		if ( reference.attachment == VK_ATTACHMENT_UNUSED )
+		{
+			return false;
+		}
+
+		assert( reference.attachment < m_attachments.size() );
+		auto view = m_attachments[reference.attachment];
+		return checkFlag( get( get( view )->getImage() )->getUsage()
+			, VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT );
+	}
+
 	bool Framebuffer::hasOnlySwapchainImage()const
 	{
 		return m_attachments.end() == std::find_if( m_attachments.begin()
@@ -421,6 +485,7 @@ namespace ashes::gl
 			, glGenFramebuffers
 			, 1
 			, &m_internal );
+		RendererStatistics::addFramebuffer();
 	}
 
 	void Framebuffer::doInitialiseAttach( FboAttachment attachment
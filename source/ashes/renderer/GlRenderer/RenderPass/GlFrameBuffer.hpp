@@ -15,6 +15,10 @@ namespace ashes::gl
 	GlAttachmentPoint getAttachmentPoint( VkImageAspectFlags aspectMask );
 	GlAttachmentPoint getAttachmentPoint( VkImageView texture );
 	GlAttachmentPoint getAttachmentPoint( VkFormat format );
+	Optional< GlAttachmentPoint > getInvalidatedPoint( FboAttachment const & attach
+		, uint32_t index
+		, bool discardMain
+		, bool discardStencil );
 	GlAttachmentType getAttachmentType( VkImageAspectFlags aspectMask );
 	GlAttachmentType getAttachmentType( VkImageView texture );
 	GlAttachmentType getAttachmentType( VkFormat format );
@@ -40,6 +44,7 @@ namespace ashes::gl
 		FboAttachment getAttachment( VkAttachmentReference const & reference )const;
 		std::vector< GlAttachmentPoint > getDrawBuffers( ArrayView < VkAttachmentReference const > const & attaches )const;
 
+		bool isTransient( VkAttachmentReference const & reference )const;
 		bool hasOnlySwapchainImage()const;
 		bool hasSwapchainImage()const;
 
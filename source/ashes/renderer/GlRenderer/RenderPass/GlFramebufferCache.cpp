@@ -0,0 +1,219 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "RenderPass/GlFramebufferCache.hpp"
+
+#include "Core/GlContextLock.hpp"
+#include "Miscellaneous/GlCallLogger.hpp"
+#include "RenderPass/GlFrameBuffer.hpp"
+
+#include "ashesgl_api.hpp"
+
+#include <ashes/common/Hash.hpp>
+
+namespace ashes::gl
+{
+	namespace
+	{
+		bool isColourPoint( GlAttachmentPoint point )
+		{
+			return point != GL_ATTACHMENT_POINT_DEPTH_STENCIL
+				&& point != GL_ATTACHMENT_POINT_DEPTH
+				&& point != GL_ATTACHMENT_POINT_STENCIL;
+		}
+
+		void attach( ContextLock const & context
+			, GlFrameBufferTarget fboTarget
+			, FboCacheKey const & key )
+		{
+			if ( key.layer == FramebufferCache::LayeredAttachment )
+			{
+				glLogCall( context
+					, glFramebufferTexture
+					, fboTarget
+					, key.point
+					, key.object
+					, GLint( key.mipLevel ) );
+			}
+			else if ( key.texTarget == GL_TEXTURE_1D )
+			{
+				glLogCall( context
+					, glFramebufferTexture1D
+					, fboTarget
+					, key.point
+					, key.texTarget
+					, key.object
+					, GLint( key.mipLevel ) );
+			}
+			else if ( key.texTarget == GL_TEXTURE_2D
+				|| key.texTarget == GL_TEXTURE_2D_MULTISAMPLE )
+			{
+				glLogCall( context
+					, glFramebufferTexture2D
+					, fboTarget
+					, key.point
+					, key.texTarget
+					, key.object
+					, GLint( key.mipLevel ) );
+			}
+			else if ( key.texTarget == GL_TEXTURE_3D )
+			{
+				glLogCall( context
+					, glFramebufferTexture3D
+					, fboTarget
+					, key.point
+					, key.texTarget
+					, key.object
+					, GLint( key.mipLevel )
+					, GLint( key.layer ) );
+			}
+			else
+			{
+				glLogCall( context
+					, glFramebufferTextureLayer
+					, fboTarget
+					, key.point
+					, key.object
+					, GLint( key.mipLevel )
+					, GLint( key.layer ) );
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	size_t FboCacheKeyHasher::operator()( FboCacheKey const & key )const
+	{
+		size_t result = std::hash< GLuint >{}( key.object );
+		hashCombine( result, uint32_t( key.texTarget ) );
+		hashCombine( result, uint32_t( key.point ) );
+		hashCombine( result, key.mipLevel );
+		hashCombine( result, key.layer );
+		return result;
+	}
+
+	//*********************************************************************************************
+
+	FramebufferCache::FramebufferCache( VkDevice device
+		, uint32_t capacity )
+		: m_device{ device }
+		, m_capacity{ std::max( 2u, capacity ) }
+	{
+	}
+
+	void FramebufferCache::bind( ContextLock const & context
+		, GlFrameBufferTarget fboTarget
+		, FboCacheKey const & key )
+	{
+		auto it = m_lookup.find( key );
+
+		if ( it == m_lookup.end() )
+		{
+			doCreate( context, fboTarget, key );
+			return;
+		}
+
+		auto entry = it->second;
+		m_entries.splice( m_entries.begin(), m_entries, entry );
+		glLogCall( context
+			, glBindFramebuffer
+			, fboTarget
+			, entry->name );
+		doSetBuffers( context, fboTarget, *entry );
+	}
+
+	void FramebufferCache::evict( ContextLock const & context
+		, GLuint object )
+	{
+		auto it = m_entries.begin();
+
+		while ( it != m_entries.end() )
+		{
+			auto current = it++;
+
+			if ( current->key.object == object )
+			{
+				doDestroy( context, current );
+			}
+		}
+	}
+
+	void FramebufferCache::cleanup( ContextLock const & context )
+	{
+		while ( !m_entries.empty() )
+		{
+			doDestroy( context, m_entries.begin() );
+		}
+	}
+
+	void FramebufferCache::doCreate( ContextLock const & context
+		, GlFrameBufferTarget fboTarget
+		, FboCacheKey const & key )
+	{
+		if ( m_entries.size() >= m_capacity )
+		{
+			doDestroy( context, std::prev( m_entries.end() ) );
+		}
+
+		GLuint name{};
+		glLogCall( context
+			, glGenFramebuffers
+			, 1
+			, &name );
+		RendererStatistics::addFramebuffer();
+		m_entries.push_front( Entry{ key, name, false, false } );
+		m_lookup.emplace( key, m_entries.begin() );
+
+		glLogCall( context
+			, glBindFramebuffer
+			, fboTarget
+			, name );
+		attach( context, fboTarget, key );
+		doSetBuffers( context, fboTarget, m_entries.front() );
+		auto status = glLogNonVoidCall( context
+			, glCheckFramebufferStatus
+			, fboTarget );
+		checkCompleteness( m_device, status );
+	}
+
+	void FramebufferCache::doSetBuffers( ContextLock const & context
+		, GlFrameBufferTarget fboTarget
+		, Entry & entry )
+	{
+		if ( !isColourPoint( entry.key.point ) )
+		{
+			return;
+		}
+
+		if ( fboTarget != GL_READ_FRAMEBUFFER
+			&& !entry.hasDrawBuffers )
+		{
+			glLogCall( context
+				, glDrawBuffers
+				, 1
+				, &entry.key.point );
+			entry.hasDrawBuffers = true;
+		}
+
+		if ( fboTarget != GL_DRAW_FRAMEBUFFER
+			&& !entry.hasReadBuffer )
+		{
+			glLogCall( context
+				, glReadBuffer
+				, entry.key.point );
+			entry.hasReadBuffer = true;
+		}
+	}
+
+	void FramebufferCache::doDestroy( ContextLock const & context
+		, EntryList::iterator it )
+	{
+		glLogCall( context
+			, glDeleteFramebuffers
+			, 1
+			, &it->name );
+		m_lookup.erase( it->key );
+		m_entries.erase( it );
+	}
+}
@@ -0,0 +1,87 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+#include "renderer/GlRenderer/Enum/GlAttachmentPoint.hpp"
+
+#include <list>
+#include <unordered_map>
+
+namespace ashes::gl
+{
+	struct FboCacheKey
+	{
+		GLuint object;
+		GlTextureType texTarget;
+		GlAttachmentPoint point;
+		uint32_t mipLevel;
+		uint32_t layer;
+	};
+
+	inline bool operator==( FboCacheKey const & lhs, FboCacheKey const & rhs )
+	{
+		return lhs.object == rhs.object
+			&& lhs.texTarget == rhs.texTarget
+			&& lhs.point == rhs.point
+			&& lhs.mipLevel == rhs.mipLevel
+			&& lhs.layer == rhs.layer;
+	}
+
+	struct FboCacheKeyHasher
+	{
+		size_t operator()( FboCacheKey const & key )const;
+	};
+
+	/**
+	*\brief
+	*	LRU cache of the FBOs used internally by blits, copies, clears and resolves.
+	*\remarks
+	*	Each FBO holds one attachment, which is set up once at creation,
+	*	so that binding a cached FBO boils down to a single glBindFramebuffer.
+	*	All accesses happen through a ContextLock, which serialises them.
+	*/
+	class FramebufferCache
+	{
+	public:
+		static uint32_t constexpr DefaultCapacity = 64u;
+		static uint32_t constexpr LayeredAttachment = ~( 0u );
+
+		FramebufferCache( VkDevice device
+			, uint32_t capacity = DefaultCapacity );
+		void bind( ContextLock const & context
+			, GlFrameBufferTarget fboTarget
+			, FboCacheKey const & key );
+		// Must be called before the texture is deleted, since GL may reuse its name.
+		void evict( ContextLock const & context
+			, GLuint object );
+		void cleanup( ContextLock const & context );
+
+	private:
+		struct Entry
+		{
+			FboCacheKey key;
+			GLuint name;
+			bool hasReadBuffer;
+			bool hasDrawBuffers;
+		};
+		using EntryList = std::list< Entry >;
+
+		void doCreate( ContextLock const & context
+			, GlFrameBufferTarget fboTarget
+			, FboCacheKey const & key );
+		void doSetBuffers( ContextLock const & context
+			, GlFrameBufferTarget fboTarget
+			, Entry & entry );
+		void doDestroy( ContextLock const & context
+			, EntryList::iterator it );
+
+	private:
+		VkDevice m_device;
+		uint32_t m_capacity;
+		EntryList m_entries;
+		std::unordered_map< FboCacheKey, EntryList::iterator, FboCacheKeyHasher > m_lookup;
+	};
+}
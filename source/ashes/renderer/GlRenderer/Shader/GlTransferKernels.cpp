@@ -0,0 +1,511 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Shader/GlTransferKernels.hpp"
+
+#include "Core/GlContextLock.hpp"
+#include "Core/GlDevice.hpp"
+#include "Core/GlInstance.hpp"
+#include "Miscellaneous/GlCallLogger.hpp"
+
+#include "ashesgl_api.hpp"
+
+#include <sstream>
+
+namespace ashes::gl
+{
+	namespace
+	{
+		std::string getImageSuffix( TransferKernelDim dim )
+		{
+			switch ( dim )
+			{
+			case TransferKernelDim::e1D:
+				return "1D";
+			case TransferKernelDim::e1DArray:
+				return "1DArray";
+			case TransferKernelDim::e2D:
+				return "2D";
+			case TransferKernelDim::e2DArray:
+				return "2DArray";
+			case TransferKernelDim::e3D:
+				return "3D";
+			case TransferKernelDim::eCube:
+				return "Cube";
+			case TransferKernelDim::eCubeArray:
+				return "CubeArray";
+			default:
+				assert( false && "Unsupported TransferKernelDim" );
+				return "2D";
+			}
+		}
+
+		// The Z coordinate holds the array layer (or cube face) for layered images, the slice for 3D ones.
+		std::string getImageCoord( TransferKernelDim dim
+			, std::string const & name )
+		{
+			switch ( dim )
+			{
+			case TransferKernelDim::e1D:
+				return name + ".x";
+			case TransferKernelDim::e1DArray:
+				return "ivec2( " + name + ".x, " + name + ".z )";
+			case TransferKernelDim::e2D:
+				return name + ".xy";
+			default:
+				return name + ".xyz";
+			}
+		}
+
+		std::string getTexelQualifier( uint32_t texelSize )
+		{
+			switch ( texelSize )
+			{
+			case 1u:
+				return "r8ui";
+			case 2u:
+				return "r16ui";
+			case 4u:
+				return "r32ui";
+			case 8u:
+				return "rg32ui";
+			default:
+				return "rgba32ui";
+			}
+		}
+
+		std::string getHeader()
+		{
+			return R"(#version 430
+layout( local_size_x = 8, local_size_y = 8, local_size_z = 1 ) in;
+)";
+		}
+
+		std::string getCopyImageSource( TransferKernels const & kernels
+			, TransferKernelKey const & key )
+		{
+			auto qualifier = getTexelQualifier( key.texelSize );
+			std::stringstream stream;
+			stream << getHeader()
+				<< "layout( binding = " << kernels.getSrcImageUnit() << ", " << qualifier << " ) uniform readonly uimage" << getImageSuffix( key.srcDim ) << " srcImage;\n"
+				<< "layout( binding = " << kernels.getDstImageUnit() << ", " << qualifier << " ) uniform writeonly uimage" << getImageSuffix( key.dstDim ) << " dstImage;\n"
+				<< R"(layout( location = 0 ) uniform ivec4 srcOffset;
+layout( location = 1 ) uniform ivec4 dstOffset;
+layout( location = 2 ) uniform ivec4 extent;
+void main()
+{
+	ivec3 id = ivec3( gl_GlobalInvocationID );
+	if ( any( greaterThanEqual( id, extent.xyz ) ) )
+	{
+		return;
+	}
+	ivec3 src = srcOffset.xyz + id;
+	ivec3 dst = dstOffset.xyz + id;
+)"
+				<< "\timageStore( dstImage, " << getImageCoord( key.dstDim, "dst" )
+				<< ", imageLoad( srcImage, " << getImageCoord( key.srcDim, "src" ) << " ) );\n"
+				<< "}\n";
+			return stream.str();
+		}
+
+		std::string getImageToBufferSource( TransferKernels const & kernels
+			, TransferKernelKey const & key )
+		{
+			static char const * const components[4]{ "x", "y", "z", "w" };
+			auto words = key.texelSize / 4u;
+			std::stringstream stream;
+			stream << getHeader()
+				<< "layout( binding = " << kernels.getSrcImageUnit() << ", " << getTexelQualifier( key.texelSize ) << " ) uniform readonly uimage" << getImageSuffix( key.srcDim ) << " srcImage;\n"
+				<< "layout( std430, binding = " << kernels.getBufferBinding() << " ) writeonly buffer DstBuffer\n"
+				<< R"({
+	uint dstData[];
+};
+layout( location = 0 ) uniform ivec4 srcOffset;
+layout( location = 2 ) uniform ivec4 extent;
+// x: offset in words, y: row length in texels, z: image height in texels.
+layout( location = 3 ) uniform ivec4 bufferLayout;
+void main()
+{
+	ivec3 id = ivec3( gl_GlobalInvocationID );
+	if ( any( greaterThanEqual( id, extent.xyz ) ) )
+	{
+		return;
+	}
+	ivec3 src = srcOffset.xyz + id;
+)"
+				<< "\tuvec4 texel = imageLoad( srcImage, " << getImageCoord( key.srcDim, "src" ) << " );\n"
+				<< "\tint index = bufferLayout.x + ( ( id.z * bufferLayout.z + id.y ) * bufferLayout.y + id.x ) * " << words << ";\n";
+
+			for ( auto i = 0u; i < words; ++i )
+			{
+				stream << "\tdstData[index + " << i << "] = texel." << components[i] << ";\n";
+			}
+
+			stream << "}\n";
+			return stream.str();
+		}
+
+		std::string getBlitImageSource( TransferKernels const & kernels
+			, TransferKernelKey const & key )
+		{
+			auto suffix = getImageSuffix( key.srcDim );
+			std::stringstream stream;
+			stream << getHeader()
+				<< "layout( binding = " << kernels.getTextureUnit() << " ) uniform sampler" << suffix << " srcImage;\n"
+				<< "layout( binding = " << kernels.getDstImageUnit() << " ) uniform writeonly image" << suffix << " dstImage;\n"
+				<< R"(layout( location = 0 ) uniform vec4 srcOffset0;
+layout( location = 1 ) uniform vec4 srcOffset1;
+layout( location = 2 ) uniform ivec4 dstOffset0;
+layout( location = 3 ) uniform ivec4 dstOffset1;
+// xyz: destination region's lowest corner, w: source mip level.
+layout( location = 4 ) uniform ivec4 dstMin;
+// xyz: destination region's extent, w: unused.
+layout( location = 5 ) uniform ivec4 extent;
+// x: source base array layer, y: destination base array layer.
+layout( location = 6 ) uniform ivec4 layers;
+void main()
+{
+	ivec3 id = ivec3( gl_GlobalInvocationID );
+	if ( any( greaterThanEqual( id, extent.xyz ) ) )
+	{
+		return;
+	}
+	ivec3 dst = dstMin.xyz + id;
+	vec3 rel = ( vec3( dst ) + 0.5 - vec3( dstOffset0.xyz ) ) / vec3( dstOffset1.xyz - dstOffset0.xyz );
+	vec3 src = mix( srcOffset0.xyz, srcOffset1.xyz, rel );
+	int lod = dstMin.w;
+)";
+
+			switch ( key.srcDim )
+			{
+			case TransferKernelDim::e2DArray:
+				stream << R"(	vec2 size = vec2( textureSize( srcImage, lod ).xy );
+	vec4 texel = textureLod( srcImage, vec3( src.xy / size, float( layers.x + id.z ) ), float( lod ) );
+	imageStore( dstImage, ivec3( dst.xy, layers.y + id.z ), texel );
+)";
+				break;
+			case TransferKernelDim::e3D:
+				stream << R"(	vec3 size = vec3( textureSize( srcImage, lod ) );
+	vec4 texel = textureLod( srcImage, src / size, float( lod ) );
+	imageStore( dstImage, dst, texel );
+)";
+				break;
+			default:
+				stream << R"(	vec2 size = vec2( textureSize( srcImage, lod ) );
+	vec4 texel = textureLod( srcImage, src.xy / size, float( lod ) );
+	imageStore( dstImage, dst.xy, texel );
+)";
+				break;
+			}
+
+			stream << "}\n";
+			return stream.str();
+		}
+
+		std::string getSource( TransferKernels const & kernels
+			, TransferKernelKey const & key )
+		{
+			switch ( key.type )
+			{
+			case TransferKernelType::eCopyImage:
+				return getCopyImageSource( kernels, key );
+			case TransferKernelType::eImageToBuffer:
+				return getImageToBufferSource( kernels, key );
+			default:
+				return getBlitImageSource( kernels, key );
+			}
+		}
+
+		std::string retrieveLinkerLog( ContextLock const & context
+			, GLuint programName )
+		{
+			std::string log;
+			int infologLength = 0;
+			int charsWritten = 0;
+			glLogCall( context
+				, glGetProgramiv
+				, programName
+				, GL_INFO_LOG_LENGTH
+				, &infologLength );
+
+			if ( infologLength > 0 )
+			{
+				std::vector< char > infoLog;
+				infoLog.resize( size_t( infologLength + 1 ) );
+				glLogCall( context
+					, glGetProgramInfoLog
+					, programName
+					, infologLength
+					, &charsWritten
+					, infoLog.data() );
+				log = infoLog.data();
+			}
+
+			return log;
+		}
+
+		GLuint createSampler( ContextLock const & context
+			, GlFilter minFilter
+			, GlFilter magFilter )
+		{
+			GLuint result{};
+			glLogCreateCall( context
+				, glGenSamplers
+				, 1
+				, &result );
+			glLogCall( context
+				, glSamplerParameteri
+				, result
+				, GL_SAMPLER_PARAMETER_MIN_FILTER
+				, minFilter );
+			glLogCall( context
+				, glSamplerParameteri
+				, result
+				, GL_SAMPLER_PARAMETER_MAG_FILTER
+				, magFilter );
+			glLogCall( context
+				, glSamplerParameteri
+				, result
+				, GL_SAMPLER_PARAMETER_WRAP_S
+				, GL_WRAP_MODE_CLAMP_TO_EDGE );
+			glLogCall( context
+				, glSamplerParameteri
+				, result
+				, GL_SAMPLER_PARAMETER_WRAP_T
+				, GL_WRAP_MODE_CLAMP_TO_EDGE );
+			glLogCall( context
+				, glSamplerParameteri
+				, result
+				, GL_SAMPLER_PARAMETER_WRAP_R
+				, GL_WRAP_MODE_CLAMP_TO_EDGE );
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	uint32_t makeKernelId( TransferKernelKey const & key )
+	{
+		return ( uint32_t( key.type ) << 24u )
+			| ( uint32_t( key.srcDim ) << 16u )
+			| ( uint32_t( key.dstDim ) << 8u )
+			| uint32_t( key.texelSize );
+	}
+
+	TransferKernelKey getKernelKey( uint32_t id )
+	{
+		return TransferKernelKey{ TransferKernelType( ( id >> 24u ) & 0xFFu )
+			, TransferKernelDim( ( id >> 16u ) & 0xFFu )
+			, TransferKernelDim( ( id >> 8u ) & 0xFFu )
+			, uint8_t( id & 0xFFu ) };
+	}
+
+	TransferKernelDim getKernelDim( GlTextureType target )
+	{
+		switch ( target )
+		{
+		case GL_TEXTURE_1D:
+			return TransferKernelDim::e1D;
+		case GL_TEXTURE_1D_ARRAY:
+			return TransferKernelDim::e1DArray;
+		case GL_TEXTURE_2D:
+			return TransferKernelDim::e2D;
+		case GL_TEXTURE_2D_ARRAY:
+			return TransferKernelDim::e2DArray;
+		case GL_TEXTURE_3D:
+			return TransferKernelDim::e3D;
+		case GL_TEXTURE_CUBE:
+			return TransferKernelDim::eCube;
+		case GL_TEXTURE_CUBE_ARRAY:
+			return TransferKernelDim::eCubeArray;
+		default:
+			return TransferKernelDim::eUnsupported;
+		}
+	}
+
+	bool isKernelStorageFormat( VkFormat format )
+	{
+		switch ( getInternalFormat( format ) )
+		{
+		case GL_INTERNAL_R8_UNORM:
+		case GL_INTERNAL_R8_SNORM:
+		case GL_INTERNAL_R8_UINT:
+		case GL_INTERNAL_R8_SINT:
+		case GL_INTERNAL_R8G8_UNORM:
+		case GL_INTERNAL_R8G8_SNORM:
+		case GL_INTERNAL_R8G8_UINT:
+		case GL_INTERNAL_R8G8_SINT:
+		case GL_INTERNAL_R8G8B8A8_UNORM:
+		case GL_INTERNAL_R8G8B8A8_SNORM:
+		case GL_INTERNAL_R8G8B8A8_UINT:
+		case GL_INTERNAL_R8G8B8A8_SINT:
+		case GL_INTERNAL_R10G10B10A2_UNORM_PACK32:
+		case GL_INTERNAL_R10G10B10A2_UINT_PACK32:
+		case GL_INTERNAL_R16_UNORM:
+		case GL_INTERNAL_R16_SNORM:
+		case GL_INTERNAL_R16_UINT:
+		case GL_INTERNAL_R16_SINT:
+		case GL_INTERNAL_R16_SFLOAT:
+		case GL_INTERNAL_R16G16_UNORM:
+		case GL_INTERNAL_R16G16_SNORM:
+		case GL_INTERNAL_R16G16_UINT:
+		case GL_INTERNAL_R16G16_SINT:
+		case GL_INTERNAL_R16G16_SFLOAT:
+		case GL_INTERNAL_R16G16B16A16_UNORM:
+		case GL_INTERNAL_R16G16B16A16_SNORM:
+		case GL_INTERNAL_R16G16B16A16_UINT:
+		case GL_INTERNAL_R16G16B16A16_SINT:
+		case GL_INTERNAL_R16G16B16A16_SFLOAT:
+		case GL_INTERNAL_R32_UINT:
+		case GL_INTERNAL_R32_SINT:
+		case GL_INTERNAL_R32_SFLOAT:
+		case GL_INTERNAL_R32G32_UINT:
+		case GL_INTERNAL_R32G32_SINT:
+		case GL_INTERNAL_R32G32_SFLOAT:
+		case GL_INTERNAL_R32G32B32A32_UINT:
+		case GL_INTERNAL_R32G32B32A32_SINT:
+		case GL_INTERNAL_R32G32B32A32_SFLOAT:
+		case GL_INTERNAL_B10G11R11_UFLOAT_PACK32:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	GlInternal getKernelTexelFormat( uint32_t texelSize )
+	{
+		switch ( texelSize )
+		{
+		case 1u:
+			return GL_INTERNAL_R8_UINT;
+		case 2u:
+			return GL_INTERNAL_R16_UINT;
+		case 4u:
+			return GL_INTERNAL_R32_UINT;
+		case 8u:
+			return GL_INTERNAL_R32G32_UINT;
+		case 16u:
+			return GL_INTERNAL_R32G32B32A32_UINT;
+		default:
+			return GL_INTERNAL_UNSUPPORTED;
+		}
+	}
+
+	//*********************************************************************************************
+
+	TransferKernels::TransferKernels( VkDevice device
+		, ContextLock const & context )
+		: m_device{ device }
+		, m_available{ false }
+	{
+		auto & features = get( get( m_device )->getInstance() )->getFeatures();
+		m_available = features.hasComputeShaders
+			&& features.hasStorageBuffers
+			&& features.maxShaderLanguageVersion >= 430u
+			&& hasProgramPipelines( m_device );
+
+		if ( m_available )
+		{
+			GLint value{};
+			glLogCall( context
+				, glGetIntegerv
+				, GL_VALUE_NAME_MAX_IMAGE_UNITS
+				, &value );
+			m_imageUnit = uint32_t( value ) - 2u;
+			glLogCall( context
+				, glGetIntegerv
+				, GL_VALUE_NAME_MAX_SHADER_STORAGE_BUFFER_BINDINGS
+				, &value );
+			m_bufferBinding = uint32_t( value ) - 1u;
+			glLogCall( context
+				, glGetIntegerv
+				, GL_VALUE_NAME_MAX_COMBINED_TEXTURE_IMAGE_UNITS
+				, &value );
+			m_textureUnit = uint32_t( value ) - 1u;
+			m_nearestSampler = createSampler( context
+				, GL_FILTER_NEAREST_MIPMAP_NEAREST
+				, GL_FILTER_NEAREST );
+			m_linearSampler = createSampler( context
+				, GL_FILTER_LINEAR_MIPMAP_NEAREST
+				, GL_FILTER_LINEAR );
+		}
+	}
+
+	void TransferKernels::use( ContextLock const & context
+		, uint32_t kernelId )
+	{
+		auto it = m_programs.find( kernelId );
+
+		if ( it == m_programs.end() )
+		{
+			it = m_programs.emplace( kernelId
+				, doCreateProgram( context, getKernelKey( kernelId ) ) ).first;
+		}
+
+		glLogCall( context
+			, glUseProgram
+			, it->second );
+	}
+
+	void TransferKernels::cleanup( ContextLock const & context )
+	{
+		for ( auto & program : m_programs )
+		{
+			if ( program.second )
+			{
+				glLogCall( context
+					, glDeleteProgram
+					, program.second );
+			}
+		}
+
+		m_programs.clear();
+
+		if ( m_available )
+		{
+			glLogCall( context
+				, glDeleteSamplers
+				, 1
+				, &m_nearestSampler );
+			glLogCall( context
+				, glDeleteSamplers
+				, 1
+				, &m_linearSampler );
+			m_nearestSampler = 0u;
+			m_linearSampler = 0u;
+		}
+	}
+
+	GLuint TransferKernels::doCreateProgram( ContextLock const & context
+		, TransferKernelKey const & key )
+	{
+		auto source = getSource( *this, key );
+		char const * data = source.data();
+		auto result = glLogNonVoidCall( context
+			, glCreateShaderProgramv
+			, GL_SHADER_STAGE_COMPUTE
+			, 1u
+			, &data );
+		int linked = 0;
+		glLogCall( context
+			, glGetProgramiv
+			, result
+			, GL_INFO_LINK_STATUS
+			, &linked );
+
+		if ( !linked )
+		{
+			reportError( m_device
+				, VK_ERROR_INITIALIZATION_FAILED
+				, "Transfer kernel link"
+				, retrieveLinkerLog( context, result ) + "\n" + source );
+			glLogCall( context
+				, glDeleteProgram
+				, result );
+			result = 0u;
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,130 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+#include <unordered_map>
+
+namespace ashes::gl
+{
+	enum class TransferKernelType
+		: uint8_t
+	{
+		// Bitwise texel copy between two size-compatible images.
+		eCopyImage,
+		// Texel copy from an image to a buffer, honouring bufferRowLength/bufferImageHeight.
+		eImageToBuffer,
+		// Scaled, filtered copy between two colour images.
+		eBlitImage,
+	};
+
+	enum class TransferKernelDim
+		: uint8_t
+	{
+		e1D,
+		e1DArray,
+		e2D,
+		e2DArray,
+		e3D,
+		eCube,
+		eCubeArray,
+		eUnsupported,
+	};
+
+	struct TransferKernelKey
+	{
+		TransferKernelType type;
+		TransferKernelDim srcDim;
+		TransferKernelDim dstDim;
+		uint8_t texelSize;
+	};
+
+	uint32_t makeKernelId( TransferKernelKey const & key );
+	TransferKernelKey getKernelKey( uint32_t id );
+	TransferKernelDim getKernelDim( GlTextureType target );
+	/**
+	*\brief
+	*	Tells if given image format can be bound to an image unit, as a texel of given size.
+	*/
+	bool isKernelStorageFormat( VkFormat format );
+	/**
+	*\return
+	*	The unsigned integer format used to read or write raw texels of given size.
+	*/
+	GlInternal getKernelTexelFormat( uint32_t texelSize );
+	/**
+	*\brief
+	*	Internal compute kernels used by the transfer commands,
+	*	when the native GL path would stall or can't process the copy.
+	*\remarks
+	*	The programs are compiled on first use, from the queue's thread.
+	*	They use the highest image, texture and storage buffer units,
+	*	so that the bindings made from the descriptor sets are left untouched.
+	*/
+	class TransferKernels
+	{
+	public:
+		static uint32_t constexpr GroupSize = 8u;
+
+		static uint32_t getGroupCount( uint32_t size )
+		{
+			return ( size + GroupSize - 1u ) / GroupSize;
+		}
+
+		TransferKernels( VkDevice device
+			, ContextLock const & context );
+
+		void use( ContextLock const & context
+			, uint32_t kernelId );
+		void cleanup( ContextLock const & context );
+
+		bool isAvailable()const
+		{
+			return m_available;
+		}
+
+		GLuint getSampler( VkFilter filter )const
+		{
+			return filter == VK_FILTER_LINEAR
+				? m_linearSampler
+				: m_nearestSampler;
+		}
+
+		uint32_t getSrcImageUnit()const
+		{
+			return m_imageUnit;
+		}
+
+		uint32_t getDstImageUnit()const
+		{
+			return m_imageUnit + 1u;
+		}
+
+		uint32_t getBufferBinding()const
+		{
+			return m_bufferBinding;
+		}
+
+		uint32_t getTextureUnit()const
+		{
+			return m_textureUnit;
+		}
+
+	private:
+		GLuint doCreateProgram( ContextLock const & context
+			, TransferKernelKey const & key );
+
+	private:
+		VkDevice m_device;
+		bool m_available;
+		GLuint m_nearestSampler{};
+		GLuint m_linearSampler{};
+		uint32_t m_imageUnit{};
+		uint32_t m_bufferBinding{};
+		uint32_t m_textureUnit{};
+		std::unordered_map< uint32_t, GLuint > m_programs;
+	};
+}
@@ -4,6 +4,7 @@
 
 #include <renderer/GlRenderer/Miscellaneous/GlWindow.hpp>
 #include <renderer/GlRenderer/Miscellaneous/GlExtensionsHandler.hpp>
+#include <renderer/RendererCommon/ProcAddrTable.hpp>
 
 #include <ashes/common/Exception.hpp>
 
@@ -65,9 +66,17 @@ namespace ashes::gl
 		VkInstance* pInstance )
 	{
 		assert( pInstance );
-		return allocate( *pInstance
+		auto result = allocate( *pInstance
 			, pAllocator
 			, *pCreateInfo );
+
+		if ( result == VK_ERROR_INITIALIZATION_FAILED )
+		{
+			// The cached probe may predate a driver change, make the next startup probe again.
+			PluginCache::invalidate();
+		}
+
+		return result;
 	}
 
 	void VKAPI_CALL vkDestroyInstance(
@@ -1771,6 +1780,14 @@ namespace ashes::gl
 				pNext->pNext = next;
 			}
 #endif
+#if VK_EXT_conditional_rendering
+			if ( pNext->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT )
+			{
+				auto next = pNext->pNext;
+				*reinterpret_cast< VkPhysicalDeviceConditionalRenderingFeaturesEXT * >( pNext ) = get( physicalDevice )->getConditionalRenderingFeatures();
+				pNext->pNext = next;
+			}
+#endif
 
 			pNext = pNext->pNext;
 		}
@@ -2290,7 +2307,10 @@ namespace ashes::gl
 		const VkAcquireNextImageInfoKHR* pAcquireInfo,
 		uint32_t* pImageIndex )
 	{
-		return reportUnsupported( device, "vkAcquireNextImage2KHR" );
+		return get( pAcquireInfo->swapchain )->acquireNextImage( pAcquireInfo->timeout
+			, pAcquireInfo->semaphore
+			, pAcquireInfo->fence
+			, *pImageIndex );
 	}
 
 #endif
@@ -2411,6 +2431,14 @@ namespace ashes::gl
 				pNext->pNext = next;
 			}
 #endif
+#if VK_EXT_conditional_rendering
+			if ( pNext->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT )
+			{
+				auto next = pNext->pNext;
+				*reinterpret_cast< VkPhysicalDeviceConditionalRenderingFeaturesEXT * >( pNext ) = get( physicalDevice )->getConditionalRenderingFeatures();
+				pNext->pNext = next;
+			}
+#endif
 
 			pNext = pNext->pNext;
 		}
@@ -3202,13 +3230,13 @@ namespace ashes::gl
 		VkCommandBuffer commandBuffer,
 		const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin )
 	{
-		reportUnsupported( commandBuffer, "vkCmdBeginConditionalRenderingEXT" );
+		get( commandBuffer )->beginConditionalRendering( *pConditionalRenderingBegin );
 	}
 
 	void VKAPI_CALL vkCmdEndConditionalRenderingEXT(
 		VkCommandBuffer commandBuffer )
 	{
-		reportUnsupported( commandBuffer, "vkCmdEndConditionalRenderingEXT" );
+		get( commandBuffer )->endConditionalRendering();
 	}
 
 #endif
@@ -4337,6 +4365,28 @@ namespace ashes::gl
 	}
 
 #	endif
+#endif
+#pragma endregion
+#pragma region VK_EXT_headless_surface
+#ifdef VK_EXT_headless_surface
+
+	VkResult VKAPI_CALL vkCreateHeadlessSurfaceEXT(
+		VkInstance instance,
+		const VkHeadlessSurfaceCreateInfoEXT* pCreateInfo,
+		const VkAllocationCallbacks* pAllocator,
+		VkSurfaceKHR* pSurface )
+	{
+#	if Ashes_GlHeadlessSurface
+		assert( pSurface );
+		return allocate( *pSurface
+			, pAllocator
+			, instance
+			, *pCreateInfo );
+#	else
+		return reportUnsupported( instance, "vkCreateHeadlessSurfaceEXT" );
+#	endif
+	}
+
 #endif
 #pragma endregion
 #pragma region VK_KHR_win32_surface
@@ -4419,22 +4469,34 @@ namespace ashes::gl
 				{
 					clearDebugFile();
 					bool supported = false;
-					gl::ExtensionsHandler extensions;
+					gl::PluginCacheEntry cached;
 
-					try
+					if ( gl::PluginCache::load( cached ) )
 					{
-						gl::RenderWindow window{ MinMajor, MinMinor, "Gl4Init" };
-						extensions.initialise();
-						supported = extensions.getMajor() > MinMajor
-							|| ( extensions.getMajor() == MinMajor && extensions.getMinor() >= MinMinor );
+						supported = true;
+						description.features = cached.features;
 					}
-					catch ( std::exception & exc )
+					else
 					{
-						std::cerr << exc.what() << std::endl;
+						gl::ExtensionsHandler extensions;
+
+						try
+						{
+							gl::RenderWindow window{ MinMajor, MinMinor, "Gl4Init" };
+							extensions.initialise();
+							supported = extensions.getMajor() > MinMajor
+								|| ( extensions.getMajor() == MinMajor && extensions.getMinor() >= MinMinor );
+						}
+						catch ( std::exception & exc )
+						{
+							std::cerr << exc.what() << std::endl;
+						}
+
+						gl::PluginCache::update( extensions );
+						description.features = extensions.getFeatures();
 					}
 
 					description.getInstanceProcAddr = &vkGetInstanceProcAddr;
-					description.features = extensions.getFeatures();
 #define VK_LIB_GLOBAL_FUNCTION( v, x )\
 					description.functions.x = vk##x;
 #define VK_LIB_INSTANCE_FUNCTION( v, x )\
@@ -4495,78 +4557,71 @@ namespace ashes::gl
 				&& get( device )->hasExtension( extension.data() );
 		}
 
-		using ObjectFunctions = std::map< std::string, PFN_vkVoidFunction >;
-
 #pragma warning( push )
 #pragma warning( disable: 4191 )
 
-		ObjectFunctions const & getInstanceFunctions( VkInstance instance )
+		ProcAddrTable const & getInstanceFunctions( VkInstance instance )
 		{
-			static std::map< VkInstance, ObjectFunctions > functions;
+			static std::map< VkInstance, ProcAddrTable > functions;
 			auto it = functions.insert( { instance, {} } );
 
 			if ( it.second )
 			{
+				auto & table = it.first->second;
+
 				if ( instance != nullptr )
 				{
-					it.first->second =
-					{
 #define VK_LIB_GLOBAL_FUNCTION( v, x )\
-						{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+					table[ashesFunctionIndex( "vk"#x )] = checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_GLOBAL_FUNCTION_EXT( v, n, x )\
-						{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+					table[ashesFunctionIndex( "vk"#x )] = checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_INSTANCE_FUNCTION( v, x )\
-						{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+					table[ashesFunctionIndex( "vk"#x )] = checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_INSTANCE_FUNCTION_EXT( v, n, x )\
-						{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+					table[ashesFunctionIndex( "vk"#x )] = checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_DEVICE_FUNCTION( v, x )\
-						{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+					table[ashesFunctionIndex( "vk"#x )] = checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-						{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+					table[ashesFunctionIndex( "vk"#x )] = checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_STATIC_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-						{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+					table[ashesFunctionIndex( "vk"#x )] = checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #include <ashes/ashes_functions_list.hpp>
-					};
 				}
 				else
 				{
-					it.first->second =
-					{
 #define VK_LIB_GLOBAL_FUNCTION( v, x )\
-						{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
+					table[ashesFunctionIndex( "vk"#x )] = PFN_vkVoidFunction( vk##x );
 #define VK_LIB_INSTANCE_FUNCTION( v, x )\
-						{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
+					table[ashesFunctionIndex( "vk"#x )] = PFN_vkVoidFunction( vk##x );
 #define VK_LIB_DEVICE_FUNCTION( v, x )\
-						{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
+					table[ashesFunctionIndex( "vk"#x )] = PFN_vkVoidFunction( vk##x );
 #define VK_LIB_GLOBAL_FUNCTION_EXT( v, n, x )
 #define VK_LIB_INSTANCE_FUNCTION_EXT( v, n, x )
 #	define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )
 #include <ashes/ashes_functions_list.hpp>
-					};
 				}
 			}
 
 			return it.first->second;
 		}
 
-		ObjectFunctions const & getDeviceFunctions( VkDevice device )
+		ProcAddrTable const & getDeviceFunctions( VkDevice device )
 		{
-			static std::map< VkDevice, ObjectFunctions > functions;
+			static std::map< VkDevice, ProcAddrTable > functions;
 			auto it = functions.insert( { device, {} } );
 
 			if ( it.second )
 			{
-				it.first->second =
-				{
-					{ "vkGetDeviceProcAddr", PFN_vkVoidFunction( vkGetDeviceProcAddr ) },
+				auto & table = it.first->second;
+
+				table[ashesFunctionIndex( "vkGetDeviceProcAddr" )] = PFN_vkVoidFunction( vkGetDeviceProcAddr );
 #define VK_LIB_DEVICE_FUNCTION( v, x )\
-					{ "vk"#x, checkVersion( device, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+				table[ashesFunctionIndex( "vk"#x )] = checkVersion( device, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( device, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+				table[ashesFunctionIndex( "vk"#x )] = checkVersionExt( device, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #define VK_STATIC_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( device, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
+				table[ashesFunctionIndex( "vk"#x )] = checkVersionExt( device, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr );
 #include <ashes/ashes_functions_list.hpp>
-				};
 			}
 
 			return it.first->second;
@@ -4587,6 +4642,9 @@ namespace ashes::gl
 #	elif __linux__
 			VkExtensionProperties{ VK_KHR_XLIB_SURFACE_EXTENSION_NAME, VK_KHR_XLIB_SURFACE_SPEC_VERSION },
 			VkExtensionProperties{ VK_KHR_XCB_SURFACE_EXTENSION_NAME, VK_KHR_XCB_SURFACE_SPEC_VERSION },
+#		if Ashes_GlHeadlessSurface
+			VkExtensionProperties{ VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME, VK_EXT_HEADLESS_SURFACE_SPEC_VERSION },
+#		endif
 #	elif __APPLE__
 			VkExtensionProperties{ VK_MVK_MACOS_SURFACE_EXTENSION_NAME, VK_MVK_MACOS_SURFACE_SPEC_VERSION },
 #	endif
@@ -4625,32 +4683,14 @@ namespace ashes::gl
 		VkInstance instance,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		auto & functions = getInstanceFunctions( instance );
-		auto it = functions.find( pName );
-
-		if ( it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		return getProcAddr( getInstanceFunctions( instance ), pName );
 	}
 
 	PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(
 		VkDevice device,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		auto & functions = getDeviceFunctions( device );
-		auto it = functions.find( pName );
-
-		if ( it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		return getProcAddr( getDeviceFunctions( device ), pName );
 	}
 }
 
@@ -4877,6 +4917,31 @@ extern "C"
 		return result;
 	}
 
+	GlRenderer_API VkResult VKAPI_PTR ashGetPluginObjectStatistics( VkDevice device
+		, uint32_t * pCount
+		, AshObjectTypeStatistics * pStatistics )
+	{
+		if ( !device || !pCount )
+		{
+			return VK_ERROR_VALIDATION_FAILED_EXT;
+		}
+
+		return ashes::gl::get( device )->getObjectStatistics( *pCount, pStatistics );
+	}
+
+	GlRenderer_API VkResult VKAPI_PTR ashGetPluginRendererStatistics( VkDevice device
+		, AshRendererStatistics * pStatistics
+		, uint32_t * pOperationCount
+		, AshRendererOperationStatistics * pOperations )
+	{
+		if ( !device || !pOperationCount )
+		{
+			return VK_ERROR_VALIDATION_FAILED_EXT;
+		}
+
+		return ashes::gl::RendererStatistics::get( pStatistics, *pOperationCount, pOperations );
+	}
+
 #pragma endregion
 
 #ifdef __cplusplus
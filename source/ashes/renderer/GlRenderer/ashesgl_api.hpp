@@ -21,7 +21,10 @@ See LICENSE file in root folder.
 #include "Descriptor/GlDescriptorSet.hpp"
 #include "Descriptor/GlDescriptorSetLayout.hpp"
 #include "Miscellaneous/GlDeviceMemory.hpp"
+#include "Miscellaneous/GlObjectTracker.hpp"
+#include "Miscellaneous/GlPluginCache.hpp"
 #include "Miscellaneous/GlQueryPool.hpp"
+#include "Miscellaneous/GlRendererStatistics.hpp"
 #include "Image/GlImage.hpp"
 #include "Image/GlImageView.hpp"
 #include "Image/GlSampler.hpp"
@@ -2749,6 +2752,17 @@ namespace ashes::gl
 		struct wl_display * display );
 
 #	endif
+#endif
+#pragma endregion
+#pragma region VK_EXT_headless_surface
+#ifdef VK_EXT_headless_surface
+
+	VkResult VKAPI_CALL vkCreateHeadlessSurfaceEXT(
+		VkInstance instance,
+		const VkHeadlessSurfaceCreateInfoEXT * pCreateInfo,
+		const VkAllocationCallbacks * pAllocator,
+		VkSurfaceKHR * pSurface );
+
 #endif
 #pragma endregion
 #pragma region VK_KHR_win32_surface
@@ -2949,6 +2963,13 @@ extern "C"
 #pragma region Drop-in replacement mode
 
 	GlRenderer_API VkResult VKAPI_PTR ashGetPluginDescription( AshPluginDescription * pDescription );
+	GlRenderer_API VkResult VKAPI_PTR ashGetPluginObjectStatistics( VkDevice device
+		, uint32_t * pCount
+		, AshObjectTypeStatistics * pStatistics );
+	GlRenderer_API VkResult VKAPI_PTR ashGetPluginRendererStatistics( VkDevice device
+		, AshRendererStatistics * pStatistics
+		, uint32_t * pOperationCount
+		, AshRendererOperationStatistics * pOperations );
 
 #pragma endregion
 
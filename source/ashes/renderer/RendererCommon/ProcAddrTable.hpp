@@ -0,0 +1,241 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include <ashes/ashes.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace ashes
+{
+	namespace details
+	{
+		inline constexpr std::string_view FunctionNames[]
+		{
+#define VK_LIB_GLOBAL_FUNCTION( v, x )\
+			"vk"#x,
+#define VK_LIB_INSTANCE_FUNCTION( v, x )\
+			"vk"#x,
+#define VK_LIB_DEVICE_FUNCTION( v, x )\
+			"vk"#x,
+#include <ashes/ashes_functions_list.hpp>
+		};
+
+		inline constexpr size_t nextPowerOfTwo( size_t value )
+		{
+			size_t result = 1u;
+
+			while ( result < value )
+			{
+				result <<= 1u;
+			}
+
+			return result;
+		}
+
+		inline constexpr size_t FunctionCount = std::size( FunctionNames );
+		// Load factor of at most 0.5, so that most buckets fit on their first seed.
+		inline constexpr size_t SlotCount = nextPowerOfTwo( FunctionCount * 2u );
+		inline constexpr size_t BucketCount = nextPowerOfTwo( FunctionCount / 2u );
+		inline constexpr size_t MaxBucketSize = 16u;
+
+		inline constexpr uint64_t hashName( std::string_view name )
+		{
+			uint64_t result = 0xcbf29ce484222325ull;
+
+			for ( auto c : name )
+			{
+				result ^= uint64_t( uint8_t( c ) );
+				result *= 0x100000001b3ull;
+			}
+
+			return result;
+		}
+
+		inline constexpr size_t getBucket( uint64_t hash )
+		{
+			hash ^= hash >> 33u;
+			hash *= 0xff51afd7ed558ccdull;
+			hash ^= hash >> 33u;
+			return size_t( hash ) & ( BucketCount - 1u );
+		}
+
+		inline constexpr size_t getSlot( uint64_t hash
+			, uint16_t seed )
+		{
+			hash ^= uint64_t( seed ) * 0x9e3779b97f4a7c15ull;
+			hash ^= hash >> 31u;
+			hash *= 0xbf58476d1ce4e5b9ull;
+			hash ^= hash >> 29u;
+			return size_t( hash ) & ( SlotCount - 1u );
+		}
+
+		struct PerfectHashTable
+		{
+			std::array< uint16_t, BucketCount > seeds{};
+			// Function index + 1, 0 for an empty slot.
+			std::array< uint16_t, SlotCount > slots{};
+		};
+		/**
+		*\brief
+		*	Builds a hash-and-displace perfect hash of the function names.
+		*\remarks
+		*	Each bucket gets the first seed that sends all its names to free slots.
+		*	The biggest buckets are placed first, since they are the hardest to fit.
+		*/
+		inline constexpr PerfectHashTable buildPerfectHashTable()
+		{
+			PerfectHashTable result{};
+			std::array< uint64_t, FunctionCount > hashes{};
+			std::array< size_t, BucketCount + 1u > offsets{};
+			std::array< uint16_t, FunctionCount > members{};
+
+			for ( size_t i = 0u; i < FunctionCount; ++i )
+			{
+				hashes[i] = hashName( FunctionNames[i] );
+				++offsets[getBucket( hashes[i] ) + 1u];
+			}
+
+			size_t maxSize = 0u;
+
+			for ( size_t bucket = 0u; bucket < BucketCount; ++bucket )
+			{
+				maxSize = std::max( maxSize, offsets[bucket + 1u] );
+				offsets[bucket + 1u] += offsets[bucket];
+			}
+
+			if ( maxSize > MaxBucketSize )
+			{
+				throw std::logic_error{ "Too many function names in one bucket" };
+			}
+
+			auto fill = offsets;
+
+			for ( size_t i = 0u; i < FunctionCount; ++i )
+			{
+				members[fill[getBucket( hashes[i] )]++] = uint16_t( i );
+			}
+
+			for ( size_t size = maxSize; size > 0u; --size )
+			{
+				for ( size_t bucket = 0u; bucket < BucketCount; ++bucket )
+				{
+					auto begin = offsets[bucket];
+					auto end = offsets[bucket + 1u];
+
+					if ( end - begin != size )
+					{
+						continue;
+					}
+
+					for ( size_t i = begin; i < end; ++i )
+					{
+						for ( size_t j = begin; j < i; ++j )
+						{
+							if ( FunctionNames[members[i]] == FunctionNames[members[j]] )
+							{
+								throw std::logic_error{ "Duplicate function name in ashes_functions_list.hpp" };
+							}
+						}
+					}
+
+					bool placed = false;
+
+					for ( uint32_t seed = 0u; !placed && seed <= 0xFFFFu; ++seed )
+					{
+						std::array< size_t, MaxBucketSize > candidates{};
+						placed = true;
+
+						for ( size_t i = begin; placed && i < end; ++i )
+						{
+							auto slot = getSlot( hashes[members[i]], uint16_t( seed ) );
+							placed = result.slots[slot] == 0u;
+
+							for ( size_t j = begin; placed && j < i; ++j )
+							{
+								placed = candidates[j - begin] != slot;
+							}
+
+							candidates[i - begin] = slot;
+						}
+
+						if ( placed )
+						{
+							result.seeds[bucket] = uint16_t( seed );
+
+							for ( size_t i = begin; i < end; ++i )
+							{
+								result.slots[candidates[i - begin]] = uint16_t( members[i] + 1u );
+							}
+						}
+					}
+
+					if ( !placed )
+					{
+						throw std::logic_error{ "Couldn't find a perfect hash seed" };
+					}
+				}
+			}
+
+			return result;
+		}
+
+		inline constexpr PerfectHashTable FunctionsTable = buildPerfectHashTable();
+	}
+
+	inline constexpr size_t InvalidFunctionIndex = ~size_t( 0u );
+	/**
+	*\return
+	*	The index of the given function in ashes_functions_list.hpp, InvalidFunctionIndex if it isn't listed there.
+	*/
+	inline constexpr size_t getFunctionIndex( std::string_view name )noexcept
+	{
+		auto hash = details::hashName( name );
+		auto slot = details::FunctionsTable.slots[details::getSlot( hash
+			, details::FunctionsTable.seeds[details::getBucket( hash )] )];
+		return ( slot != 0u && details::FunctionNames[slot - 1u] == name )
+			? size_t( slot - 1u )
+			: InvalidFunctionIndex;
+	}
+
+	inline constexpr size_t getListedFunctionIndex( std::string_view name )
+	{
+		auto result = getFunctionIndex( name );
+
+		if ( result == InvalidFunctionIndex )
+		{
+			throw std::logic_error{ "Function not listed in ashes_functions_list.hpp" };
+		}
+
+		return result;
+	}
+	/**
+	*\brief
+	*	One function pointer per entry of ashes_functions_list.hpp, indexed by getFunctionIndex.
+	*/
+	using ProcAddrTable = std::array< PFN_vkVoidFunction, details::FunctionCount >;
+
+	inline PFN_vkVoidFunction getProcAddr( ProcAddrTable const & functions
+		, char const * name )
+	{
+		auto index = getFunctionIndex( name );
+		return index == InvalidFunctionIndex
+			? nullptr
+			: functions[index];
+	}
+}
+/**
+*\brief
+*	The index of a function name, evaluated at compile time.
+*	Doesn't compile if the name isn't listed in ashes_functions_list.hpp.
+*/
+#define ashesFunctionIndex( name )\
+	std::integral_constant< size_t, ashes::getListedFunctionIndex( name ) >::value
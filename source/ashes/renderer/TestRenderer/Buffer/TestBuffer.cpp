@@ -45,8 +45,8 @@ namespace ashes::test
 		, VkDeviceSize dstOffset )const
 	{
 		get( m_memory )->updateData( get( src )->m_memory
-			, srcOffset
-			, dstOffset
+			, get( src )->m_memoryOffset + srcOffset
+			, m_memoryOffset + dstOffset
 			, srcSize );
 	}
 
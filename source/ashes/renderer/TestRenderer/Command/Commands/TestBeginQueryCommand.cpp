@@ -10,20 +10,8 @@ See LICENSE file in root folder.
 
 namespace ashes::test
 {
-	BeginQueryCommand::BeginQueryCommand( VkDevice device
-		, VkQueryPool pool
-		, uint32_t query
-		, VkQueryControlFlags flags )
-		: CommandBase{ device }
+	void apply( ExecutionState &
+		, CmdBeginQuery const & )
 	{
 	}
-
-	void BeginQueryCommand::apply()const
-	{
-	}
-
-	CommandPtr BeginQueryCommand::clone()const
-	{
-		return std::make_unique< BeginQueryCommand >( *this );
-	}
 }
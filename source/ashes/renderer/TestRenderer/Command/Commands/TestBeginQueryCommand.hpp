@@ -8,16 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class BeginQueryCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBeginQuery >
 	{
-	public:
-		BeginQueryCommand( VkDevice device
-			, VkQueryPool pool
+		inline CmdT( VkQueryPool pool
 			, uint32_t query
-			, VkQueryControlFlags flags );
+			, VkQueryControlFlags flags )
+			: cmd{ { OpType::eBeginQuery, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, pool{ pool }
+			, query{ query }
+			, flags{ flags }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkQueryPool pool;
+		uint32_t query;
+		VkQueryControlFlags flags;
 	};
+	using CmdBeginQuery = CmdT< OpType::eBeginQuery >;
+
+	void apply( ExecutionState & state
+		, CmdBeginQuery const & cmd );
 }
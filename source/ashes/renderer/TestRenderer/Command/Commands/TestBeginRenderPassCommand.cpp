@@ -4,8 +4,9 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestBeginRenderPassCommand.hpp"
 
-#include "Buffer/TestBufferView.hpp"
-#include "Core/TestDevice.hpp"
+#include "Image/TestImage.hpp"
+#include "Image/TestImageView.hpp"
+#include "Miscellaneous/TestTransferKernels.hpp"
 #include "RenderPass/TestFrameBuffer.hpp"
 #include "RenderPass/TestRenderPass.hpp"
 
@@ -13,53 +14,86 @@ See LICENSE file in root folder.
 
 namespace ashes::test
 {
-	BeginRenderPassCommand::BeginRenderPassCommand( VkDevice device
-		, VkRenderPass renderPass
-		, VkFramebuffer frameBuffer
-		, VkClearValueArray const & clearValues )
-		: CommandBase{ device }
+	namespace
 	{
-		auto rp = get( renderPass );
-		assert( clearValues.size() == rp->size() );
-		for ( auto & attach : *rp )
+		void clearView( VkImageView imageView
+			, VkImageAspectFlags aspectMask
+			, VkRect2D const & renderArea
+			, std::array< uint8_t, 16u > const & texel )
 		{
-			auto & clearValue = clearValues[attach.attachment];
+			auto view = get( imageView );
+			auto image = get( view->getImage() );
+			auto & range = view->getSubResourceRange();
+			auto layerCount = ( range.layerCount == VK_REMAINING_ARRAY_LAYERS
+				? image->getLayerCount() - range.baseArrayLayer
+				: range.layerCount );
 
-			if ( ashes::isDepthOrStencilFormat( rp->getAttachment( attach ).format ) )
+			for ( auto layer = 0u; layer < layerCount; ++layer )
 			{
-				m_dsClearValue = clearValue;
-			}
-			else
-			{
-				m_rtClearValues.push_back( clearValue );
+				clearRegion( image->getSubresourceData( aspectMask
+						, range.baseMipLevel
+						, range.baseArrayLayer + layer )
+					, VkOffset3D{ renderArea.offset.x, renderArea.offset.y, 0 }
+					, VkExtent3D{ renderArea.extent.width, renderArea.extent.height, 1u }
+					, texel.data() );
 			}
 		}
 	}
 
-	void BeginRenderPassCommand::apply()const
+	void apply( ExecutionState & state
+		, CmdBeginRenderPass const & cmd )
 	{
-		auto & views = get( m_frameBuffer )->getAllViews();
-		uint32_t clearIndex = 0u;
-		auto it = get( m_renderPass )->begin();
+		state.renderPass = cmd.renderPass;
+		state.graphics.frameBuffer = cmd.frameBuffer;
+		auto renderPass = get( cmd.renderPass );
+		auto & views = get( cmd.frameBuffer )->getAllViews();
 
-		for ( auto viewIndex = 0u; viewIndex < views.size(); ++viewIndex )
+		// The attachments cleared by their load operation.
+		for ( auto & attach : *renderPass )
 		{
-			auto & attachDesc = get( m_renderPass )->getAttachment( *it );
+			if ( attach.attachment >= views.size()
+				|| attach.attachment >= cmd.clearValues.size() )
+			{
+				continue;
+			}
+
+			auto & attachDesc = renderPass->getAttachment( attach );
+			auto & clearValue = cmd.clearValues[attach.attachment];
+			auto aspects = getAspectMask( attachDesc.format );
+			VkImageAspectFlags aspectMask{};
 
-			if ( attachDesc.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR )
+			if ( checkFlag( aspects, VK_IMAGE_ASPECT_COLOR_BIT ) )
 			{
-				if ( getAspectMask( attachDesc.format ) == VK_IMAGE_ASPECT_COLOR_BIT )
+				if ( attachDesc.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR )
 				{
-					++clearIndex;
+					clearView( views[attach.attachment]
+						, VK_IMAGE_ASPECT_COLOR_BIT
+						, cmd.renderArea
+						, packClearColour( attachDesc.format, clearValue.color ) );
 				}
+
+				continue;
 			}
 
-			++it;
-		}
-	}
+			if ( checkFlag( aspects, VK_IMAGE_ASPECT_DEPTH_BIT )
+				&& attachDesc.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR )
+			{
+				aspectMask |= VK_IMAGE_ASPECT_DEPTH_BIT;
+			}
 
-	CommandPtr BeginRenderPassCommand::clone()const
-	{
-		return std::make_unique< BeginRenderPassCommand >( *this );
+			if ( checkFlag( aspects, VK_IMAGE_ASPECT_STENCIL_BIT )
+				&& attachDesc.stencilLoadOp == VK_ATTACHMENT_LOAD_OP_CLEAR )
+			{
+				aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+			}
+
+			if ( aspectMask )
+			{
+				clearView( views[attach.attachment]
+					, aspectMask
+					, cmd.renderArea
+					, packClearDepthStencil( attachDesc.format, clearValue.depthStencil ) );
+			}
+		}
 	}
 }
@@ -8,22 +8,29 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class BeginRenderPassCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBeginRenderPass >
 	{
-	public:
-		BeginRenderPassCommand( VkDevice device
-			, VkRenderPass renderPass
+		inline CmdT( VkRenderPass renderPass
 			, VkFramebuffer frameBuffer
-			, VkClearValueArray const & clearValues );
+			, VkRect2D renderArea
+			, ArrayView< VkClearValue const > clearValues )
+			: cmd{ { OpType::eBeginRenderPass, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, renderPass{ renderPass }
+			, frameBuffer{ frameBuffer }
+			, renderArea{ renderArea }
+			, clearValues{ clearValues }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		VkRenderPass m_renderPass{};
-		VkFramebuffer m_frameBuffer{};
-		VkClearValueArray m_rtClearValues;
-		VkClearValue m_dsClearValue{};
+		Command cmd;
+		VkRenderPass renderPass;
+		VkFramebuffer frameBuffer;
+		VkRect2D renderArea;
+		ArrayView< VkClearValue const > clearValues;
 	};
+	using CmdBeginRenderPass = CmdT< OpType::eBeginRenderPass >;
+
+	void apply( ExecutionState & state
+		, CmdBeginRenderPass const & cmd );
 }
@@ -4,29 +4,16 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestBeginSubpassCommand.hpp"
 
-#include "Buffer/TestBuffer.hpp"
-#include "Image/TestImageView.hpp"
-#include "RenderPass/TestFrameBuffer.hpp"
 #include "RenderPass/TestRenderPass.hpp"
 
 #include "ashestest_api.hpp"
 
 namespace ashes::test
 {
-	BeginSubpassCommand::BeginSubpassCommand( VkDevice device
-		, VkRenderPass
-		, VkFramebuffer
-		, VkSubpassDescription const & )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdBeginSubpass const & cmd )
 	{
-	}
-
-	void BeginSubpassCommand::apply()const
-	{
-	}
-
-	CommandPtr BeginSubpassCommand::clone()const
-	{
-		return std::make_unique< BeginSubpassCommand >( *this );
+		state.subpassIndex = cmd.subpassIndex;
+		state.graphics.subpass = &get( state.renderPass )->getSubpasses()[cmd.subpassIndex];
 	}
 }
@@ -8,16 +8,20 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class BeginSubpassCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBeginSubpass >
 	{
-	public:
-		BeginSubpassCommand( VkDevice device
-			, VkRenderPass renderPass
-			, VkFramebuffer frameBuffer
-			, VkSubpassDescription const & subpass );
+		inline CmdT( uint32_t subpassIndex )
+			: cmd{ { OpType::eBeginSubpass, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, subpassIndex{ subpassIndex }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		uint32_t subpassIndex;
 	};
+	using CmdBeginSubpass = CmdT< OpType::eBeginSubpass >;
+
+	void apply( ExecutionState & state
+		, CmdBeginSubpass const & cmd );
 }
@@ -4,36 +4,40 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestBindDescriptorSetCommand.hpp"
 
-#include "Buffer/TestBuffer.hpp"
-#include "Buffer/TestBufferView.hpp"
 #include "Descriptor/TestDescriptorSet.hpp"
-#include "Pipeline/TestPipelineLayout.hpp"
-#include "Image/TestSampler.hpp"
-#include "Image/TestImage.hpp"
-#include "Image/TestImageView.hpp"
 
 #include "ashestest_api.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace ashes::test
 {
-	BindDescriptorSetCommand::BindDescriptorSetCommand( VkDevice context
-		, VkDescriptorSet descriptorSet
-		, VkPipelineLayout
-		, UInt32Array const & dynamicOffsets
-		, VkPipelineBindPoint )
-		: CommandBase{ context }
-		, m_dynamicOffsets{ dynamicOffsets }
+	void apply( ExecutionState & state
+		, CmdBindDescriptorSets const & cmd )
 	{
-		assert( get( descriptorSet )->getDynamicBuffers().size() == m_dynamicOffsets.size()
-			&& "Dynamic descriptors and dynamic offsets sizes must match." );
-	}
+		auto & sets = cmd.bindingPoint == VK_PIPELINE_BIND_POINT_COMPUTE
+			? state.computeDescriptorSets
+			: state.graphics.descriptorSets;
+		sets.resize( std::max( sets.size(), size_t( cmd.firstSet + cmd.descriptorSets.size() ) ) );
+		auto offsetIt = cmd.dynamicOffsets.begin();
+		auto index = cmd.firstSet;
 
-	void BindDescriptorSetCommand::apply()const
-	{
-	}
+		for ( auto & descriptorSet : cmd.descriptorSets )
+		{
+			// Each set consumes the dynamic offsets of its dynamic descriptors.
+			uint32_t count{};
 
-	CommandPtr BindDescriptorSetCommand::clone()const
-	{
-		return std::make_unique< BindDescriptorSetCommand >( *this );
+			for ( auto dynamic : get( descriptorSet )->getDynamicBuffers() )
+			{
+				count += dynamic->binding.descriptorCount;
+			}
+
+			auto end = offsetIt + std::min( ptrdiff_t( count ), std::distance( offsetIt, cmd.dynamicOffsets.end() ) );
+			auto & binding = sets[index++];
+			binding.set = descriptorSet;
+			binding.dynamicOffsets.assign( offsetIt, end );
+			offsetIt = end;
+		}
 	}
 }
@@ -8,20 +8,29 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class BindDescriptorSetCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindDescriptorSets >
 	{
-	public:
-		BindDescriptorSetCommand( VkDevice device
-			, VkDescriptorSet descriptorSet
-			, VkPipelineLayout layout
-			, UInt32Array const & dynamicOffsets
-			, VkPipelineBindPoint bindingPoint );
+		inline CmdT( VkPipelineBindPoint bindingPoint
+			, uint32_t firstSet
+			, ArrayView< VkDescriptorSet const > descriptorSets
+			, ArrayView< uint32_t const > dynamicOffsets )
+			: cmd{ { OpType::eBindDescriptorSets, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, bindingPoint{ bindingPoint }
+			, firstSet{ firstSet }
+			, descriptorSets{ descriptorSets }
+			, dynamicOffsets{ dynamicOffsets }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		UInt32Array m_dynamicOffsets;
+		Command cmd;
+		VkPipelineBindPoint bindingPoint;
+		uint32_t firstSet;
+		ArrayView< VkDescriptorSet const > descriptorSets;
+		ArrayView< uint32_t const > dynamicOffsets;
 	};
+	using CmdBindDescriptorSets = CmdT< OpType::eBindDescriptorSets >;
+
+	void apply( ExecutionState & state
+		, CmdBindDescriptorSets const & cmd );
 }
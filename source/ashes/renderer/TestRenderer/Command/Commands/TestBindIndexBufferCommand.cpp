@@ -4,26 +4,15 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestBindIndexBufferCommand.hpp"
 
-#include "Buffer/TestBuffer.hpp"
-
 #include "ashestest_api.hpp"
 
 namespace ashes::test
 {
-	BindIndexBufferCommand::BindIndexBufferCommand( VkDevice device
-		, VkBuffer
-		, uint64_t
-		, VkIndexType )
-		: CommandBase{ device }
-	{
-	}
-
-	void BindIndexBufferCommand::apply()const
-	{
-	}
-
-	CommandPtr BindIndexBufferCommand::clone()const
+	void apply( ExecutionState & state
+		, CmdBindIndexBuffer const & cmd )
 	{
-		return std::make_unique< BindIndexBufferCommand >( *this );
+		state.graphics.indexBuffer = cmd.buffer;
+		state.graphics.indexOffset = cmd.offset;
+		state.graphics.indexType = cmd.indexType;
 	}
 }
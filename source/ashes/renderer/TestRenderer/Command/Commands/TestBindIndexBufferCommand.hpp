@@ -8,16 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class BindIndexBufferCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindIndexBuffer >
 	{
-	public:
-		BindIndexBufferCommand( VkDevice device
-			, VkBuffer ibo
-			, uint64_t offset
-			, VkIndexType indexType );
+		inline CmdT( VkBuffer buffer
+			, VkDeviceSize offset
+			, VkIndexType indexType )
+			: cmd{ { OpType::eBindIndexBuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, buffer{ buffer }
+			, offset{ offset }
+			, indexType{ indexType }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkBuffer buffer;
+		VkDeviceSize offset;
+		VkIndexType indexType;
 	};
+	using CmdBindIndexBuffer = CmdT< OpType::eBindIndexBuffer >;
+
+	void apply( ExecutionState & state
+		, CmdBindIndexBuffer const & cmd );
 }
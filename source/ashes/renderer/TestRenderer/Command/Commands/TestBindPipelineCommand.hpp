@@ -8,23 +8,23 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class BindPipelineCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindPipeline >
 	{
-	public:
-		BindPipelineCommand( VkDevice device
-			, VkPipeline pipeline
-			, VkPipelineBindPoint bindingPoint );
+		inline CmdT( VkPipeline pipeline
+			, VkPipelineBindPoint bindingPoint )
+			: cmd{ { OpType::eBindPipeline, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, pipeline{ pipeline }
+			, bindingPoint{ bindingPoint }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		VkPipeline m_pipeline;
-		VkPipelineLayout m_layout;
-		bool m_dynamicLineWidth;
-		bool m_dynamicDepthBias;
-		bool m_dynamicScissor;
-		bool m_dynamicViewport;
+		Command cmd;
+		VkPipeline pipeline;
+		VkPipelineBindPoint bindingPoint;
 	};
+	using CmdBindPipeline = CmdT< OpType::eBindPipeline >;
+
+	void apply( ExecutionState & state
+		, CmdBindPipeline const & cmd );
 }
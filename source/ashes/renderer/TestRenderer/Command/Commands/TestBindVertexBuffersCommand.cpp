@@ -4,44 +4,36 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestBindVertexBuffersCommand.hpp"
 
-#include "Buffer/TestBuffer.hpp"
-
 #include "ashestest_api.hpp"
 
+#include <algorithm>
+
 namespace ashes::test
 {
-	namespace
+	void apply( ExecutionState & state
+		, CmdBindVertexBuffers const & cmd )
 	{
-		std::vector< uint32_t > convert( UInt64Array const & array )
-		{
-			std::vector< uint32_t > result;
+		auto & vbos = state.graphics.vbos;
+		auto binding = cmd.firstBinding;
 
-			for ( auto & v : array )
+		// The bindings are kept one per entry, so that binding a buffer replaces the previous one.
+		for ( size_t i = 0u; i < cmd.buffers.size(); ++i, ++binding )
+		{
+			auto it = std::find_if( vbos.begin()
+				, vbos.end()
+				, [binding]( VbosBinding const & lookup )
+				{
+					return lookup.startIndex == binding;
+				} );
+
+			if ( it == vbos.end() )
 			{
-				result.push_back( uint32_t( v ) );
+				it = vbos.emplace( vbos.end() );
+				it->startIndex = binding;
 			}
 
-			return result;
+			it->buffers.assign( 1u, cmd.buffers[i] );
+			it->offsets.assign( 1u, uint32_t( cmd.offsets[i] ) );
 		}
 	}
-
-	BindVertexBuffersCommand::BindVertexBuffersCommand( VkDevice device
-		, uint32_t
-		, VkBufferArray const & buffers
-		, UInt64Array const & offsets )
-		: CommandBase{ device }
-		, m_vbos{ buffers }
-		, m_offsets{ convert( offsets ) }
-		, m_strides( m_offsets.size(), 24u )
-	{
-	}
-
-	void BindVertexBuffersCommand::apply()const
-	{
-	}
-
-	CommandPtr BindVertexBuffersCommand::clone()const
-	{
-		return std::make_unique< BindVertexBuffersCommand >( *this );
-	}
 }
@@ -8,21 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class BindVertexBuffersCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindVertexBuffers >
 	{
-	public:
-		BindVertexBuffersCommand( VkDevice device
-			, uint32_t firstBinding
-			, VkBufferArray const & buffers
-			, UInt64Array const & offsets );
+		inline CmdT( uint32_t firstBinding
+			, ArrayView< VkBuffer const > buffers
+			, ArrayView< VkDeviceSize const > offsets )
+			: cmd{ { OpType::eBindVertexBuffers, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, firstBinding{ firstBinding }
+			, buffers{ buffers }
+			, offsets{ offsets }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		VkBufferArray m_vbos;
-		std::vector< uint32_t > m_offsets;
-		std::vector< uint32_t > m_strides;
+		Command cmd;
+		uint32_t firstBinding;
+		ArrayView< VkBuffer const > buffers;
+		ArrayView< VkDeviceSize const > offsets;
 	};
+	using CmdBindVertexBuffers = CmdT< OpType::eBindVertexBuffers >;
+
+	void apply( ExecutionState & state
+		, CmdBindVertexBuffers const & cmd );
 }
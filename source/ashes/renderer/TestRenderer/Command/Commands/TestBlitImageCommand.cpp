@@ -4,25 +4,46 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestBlitImageCommand.hpp"
 
+#include "Core/TestDevice.hpp"
+#include "Image/TestImage.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
+
+#include "ashestest_api.hpp"
+
+#include <cstdlib>
+
 namespace ashes::test
 {
-	BlitImageCommand::BlitImageCommand( VkCommandPool pool
-		, VkCommandBuffer cb
-		, VkDevice device
-		, VkImage srcImage
-		, VkImage dstImage
-		, VkImageBlitArray const & regions
-		, VkFilter filter )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdBlitImage const & cmd )
 	{
-	}
+		auto src = get( cmd.srcImage );
+		auto dst = get( cmd.dstImage );
+		VkDeviceSize size{};
 
-	void BlitImageCommand::apply()const
-	{
-	}
+		for ( auto & region : cmd.regions )
+		{
+			// The cost is the one of the written texels.
+			VkExtent3D extent{ uint32_t( std::abs( region.dstOffsets[1].x - region.dstOffsets[0].x ) )
+				, uint32_t( std::abs( region.dstOffsets[1].y - region.dstOffsets[0].y ) )
+				, uint32_t( std::abs( region.dstOffsets[1].z - region.dstOffsets[0].z ) ) };
 
-	CommandPtr BlitImageCommand::clone()const
-	{
-		return std::make_unique< BlitImageCommand >( *this );
+			for ( uint32_t layer = 0u; layer < region.srcSubresource.layerCount; ++layer )
+			{
+				auto dstData = dst->getSubresourceData( region.dstSubresource.aspectMask
+					, region.dstSubresource.mipLevel
+					, region.dstSubresource.baseArrayLayer + layer );
+				size += getRegionSize( dstData, extent );
+				blitRegion( dstData
+					, region.dstOffsets
+					, src->getSubresourceData( region.srcSubresource.aspectMask
+						, region.srcSubresource.mipLevel
+						, region.srcSubresource.baseArrayLayer + layer )
+					, region.srcOffsets
+					, cmd.filter );
+			}
+		}
+
+		get( state.device )->getGpuClock().chargeTransfer( size );
 	}
 }
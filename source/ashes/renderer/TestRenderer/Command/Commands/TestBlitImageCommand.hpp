@@ -4,23 +4,33 @@ See LICENSE file in root folder
 */
 #pragma once
 
-#include "Command/Commands/TestCommandBase.hpp"
+#include "renderer/TestRenderer/Command/Commands/TestCommandBase.hpp"
 
 namespace ashes::test
 {
-	class BlitImageCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBlitImage >
 	{
-	public:
-		BlitImageCommand( VkCommandPool pool
-			, VkCommandBuffer cb
-			, VkDevice device
-			, VkImage srcImage
+		inline CmdT( VkImage srcImage
 			, VkImage dstImage
-			, VkImageBlitArray const & regions
-			, VkFilter filter );
+			, ArrayView< VkImageBlit const > regions
+			, VkFilter filter )
+			: cmd{ { OpType::eBlitImage, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, srcImage{ srcImage }
+			, dstImage{ dstImage }
+			, regions{ regions }
+			, filter{ filter }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkImage srcImage;
+		VkImage dstImage;
+		ArrayView< VkImageBlit const > regions;
+		VkFilter filter;
 	};
+	using CmdBlitImage = CmdT< OpType::eBlitImage >;
+
+	void apply( ExecutionState & state
+		, CmdBlitImage const & cmd );
 }
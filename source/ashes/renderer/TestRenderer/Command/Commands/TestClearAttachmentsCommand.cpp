@@ -4,24 +4,70 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestClearAttachmentsCommand.hpp"
 
+#include "Image/TestImage.hpp"
+#include "Image/TestImageView.hpp"
+#include "Miscellaneous/TestTransferKernels.hpp"
+#include "RenderPass/TestFrameBuffer.hpp"
+
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	ClearAttachmentsCommand::ClearAttachmentsCommand( VkDevice device
-		, VkRenderPass renderPass
-		, VkSubpassDescription const & subpass
-		, VkFramebuffer framebuffer
-		, VkClearAttachmentArray const & clearAttaches
-		, VkClearRectArray const & clearRects )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdClearAttachments const & cmd )
 	{
-	}
+		// The attachments are the ones of the current subpass, which a secondary command buffer inherits.
+		auto subpass = state.graphics.subpass;
 
-	void ClearAttachmentsCommand::apply()const
-	{
-	}
+		if ( !subpass
+			|| !state.graphics.frameBuffer )
+		{
+			return;
+		}
 
-	CommandPtr ClearAttachmentsCommand::clone()const
-	{
-		return std::make_unique< ClearAttachmentsCommand >( *this );
+		auto & views = get( state.graphics.frameBuffer )->getAllViews();
+
+		for ( auto & attach : cmd.clearAttaches )
+		{
+			auto attachment = VK_ATTACHMENT_UNUSED;
+
+			if ( checkFlag( attach.aspectMask, VK_IMAGE_ASPECT_COLOR_BIT ) )
+			{
+				if ( attach.colorAttachment < subpass->colorAttachmentCount )
+				{
+					attachment = subpass->pColorAttachments[attach.colorAttachment].attachment;
+				}
+			}
+			else if ( subpass->pDepthStencilAttachment )
+			{
+				attachment = subpass->pDepthStencilAttachment->attachment;
+			}
+
+			if ( attachment == VK_ATTACHMENT_UNUSED
+				|| attachment >= views.size() )
+			{
+				continue;
+			}
+
+			auto view = get( views[attachment] );
+			auto image = get( view->getImage() );
+			auto & range = view->getSubResourceRange();
+			auto texel = ( checkFlag( attach.aspectMask, VK_IMAGE_ASPECT_COLOR_BIT )
+				? packClearColour( view->getFormat(), attach.clearValue.color )
+				: packClearDepthStencil( view->getFormat(), attach.clearValue.depthStencil ) );
+
+			for ( auto & rect : cmd.clearRects )
+			{
+				for ( auto layer = rect.baseArrayLayer; layer < rect.baseArrayLayer + rect.layerCount; ++layer )
+				{
+					clearRegion( image->getSubresourceData( attach.aspectMask
+							, range.baseMipLevel
+							, range.baseArrayLayer + layer )
+						, VkOffset3D{ rect.rect.offset.x, rect.rect.offset.y, 0 }
+						, VkExtent3D{ rect.rect.extent.width, rect.rect.extent.height, 1u }
+						, texel.data() );
+				}
+			}
+		}
 	}
 }
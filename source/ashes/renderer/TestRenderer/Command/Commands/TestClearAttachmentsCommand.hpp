@@ -8,18 +8,23 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class ClearAttachmentsCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eClearAttachments >
 	{
-	public:
-		ClearAttachmentsCommand( VkDevice device
-			, VkRenderPass renderPass
-			, VkSubpassDescription const & subpass
-			, VkFramebuffer framebuffer
-			, VkClearAttachmentArray const & clearAttaches
-			, VkClearRectArray const & clearRects );
+		inline CmdT( ArrayView< VkClearAttachment const > clearAttaches
+			, ArrayView< VkClearRect const > clearRects )
+			: cmd{ { OpType::eClearAttachments, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, clearAttaches{ clearAttaches }
+			, clearRects{ clearRects }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		ArrayView< VkClearAttachment const > clearAttaches;
+		ArrayView< VkClearRect const > clearRects;
 	};
+	using CmdClearAttachments = CmdT< OpType::eClearAttachments >;
+
+	void apply( ExecutionState & state
+		, CmdClearAttachments const & cmd );
 }
@@ -8,16 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class ClearColourCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eClearColour >
 	{
-	public:
-		ClearColourCommand( VkDevice device
-			, VkImage image
-			, VkImageSubresourceRangeArray ranges
-			, VkClearColorValue const & colour );
+		inline CmdT( VkImage image
+			, ArrayView< VkImageSubresourceRange const > ranges
+			, VkClearColorValue colour )
+			: cmd{ { OpType::eClearColour, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, image{ image }
+			, ranges{ ranges }
+			, colour{ colour }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkImage image;
+		ArrayView< VkImageSubresourceRange const > ranges;
+		VkClearColorValue colour;
 	};
+	using CmdClearColour = CmdT< OpType::eClearColour >;
+
+	void apply( ExecutionState & state
+		, CmdClearColour const & cmd );
 }
@@ -4,22 +4,45 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestClearDepthStencilCommand.hpp"
 
+#include "Core/TestDevice.hpp"
+#include "Image/TestImage.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
+#include "Miscellaneous/TestTransferKernels.hpp"
+
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	ClearDepthStencilCommand::ClearDepthStencilCommand( VkDevice device
-		, VkImage image
-		, VkImageSubresourceRangeArray ranges
-		, VkClearDepthStencilValue value )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdClearDepthStencil const & cmd )
 	{
-	}
+		auto image = get( cmd.image );
+		auto texel = packClearDepthStencil( image->getFormat(), cmd.value );
+		VkDeviceSize size{};
 
-	void ClearDepthStencilCommand::apply()const
-	{
-	}
+		for ( auto & range : cmd.ranges )
+		{
+			auto levelCount = ( range.levelCount == VK_REMAINING_MIP_LEVELS
+				? image->getMipmapLevels() - range.baseMipLevel
+				: range.levelCount );
+			auto layerCount = ( range.layerCount == VK_REMAINING_ARRAY_LAYERS
+				? image->getLayerCount() - range.baseArrayLayer
+				: range.layerCount );
 
-	CommandPtr ClearDepthStencilCommand::clone()const
-	{
-		return std::make_unique< ClearDepthStencilCommand >( *this );
+			for ( auto layer = range.baseArrayLayer; layer < range.baseArrayLayer + layerCount; ++layer )
+			{
+				for ( auto level = range.baseMipLevel; level < range.baseMipLevel + levelCount; ++level )
+				{
+					auto data = image->getSubresourceData( range.aspectMask, level, layer );
+					clearRegion( data
+						, VkOffset3D{}
+						, data.extent
+						, texel.data() );
+					size += getRegionSize( data, data.extent );
+				}
+			}
+		}
+
+		get( state.device )->getGpuClock().chargeTransfer( size );
 	}
 }
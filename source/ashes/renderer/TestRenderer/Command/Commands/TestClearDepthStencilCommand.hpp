@@ -8,16 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class ClearDepthStencilCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eClearDepthStencil >
 	{
-	public:
-		ClearDepthStencilCommand( VkDevice device
-			, VkImage image
-			, VkImageSubresourceRangeArray ranges
-			, VkClearDepthStencilValue value );
+		inline CmdT( VkImage image
+			, ArrayView< VkImageSubresourceRange const > ranges
+			, VkClearDepthStencilValue value )
+			: cmd{ { OpType::eClearDepthStencil, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, image{ image }
+			, ranges{ ranges }
+			, value{ value }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkImage image;
+		ArrayView< VkImageSubresourceRange const > ranges;
+		VkClearDepthStencilValue value;
 	};
+	using CmdClearDepthStencil = CmdT< OpType::eClearDepthStencil >;
+
+	void apply( ExecutionState & state
+		, CmdClearDepthStencil const & cmd );
 }
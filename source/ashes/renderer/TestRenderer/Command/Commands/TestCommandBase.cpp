@@ -4,14 +4,193 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestCommandBase.hpp"
 
-#include "Core/TestDevice.hpp"
+#include "Command/Commands/TestBeginQueryCommand.hpp"
+#include "Command/Commands/TestBeginRenderPassCommand.hpp"
+#include "Command/Commands/TestBeginSubpassCommand.hpp"
+#include "Command/Commands/TestBindDescriptorSetCommand.hpp"
+#include "Command/Commands/TestBindIndexBufferCommand.hpp"
+#include "Command/Commands/TestBindPipelineCommand.hpp"
+#include "Command/Commands/TestBindVertexBuffersCommand.hpp"
+#include "Command/Commands/TestBlitImageCommand.hpp"
+#include "Command/Commands/TestClearAttachmentsCommand.hpp"
+#include "Command/Commands/TestClearColourCommand.hpp"
+#include "Command/Commands/TestClearDepthStencilCommand.hpp"
+#include "Command/Commands/TestCopyBufferCommand.hpp"
+#include "Command/Commands/TestCopyBufferToImageCommand.hpp"
+#include "Command/Commands/TestCopyImageCommand.hpp"
+#include "Command/Commands/TestCopyImageToBufferCommand.hpp"
+#include "Command/Commands/TestDispatchCommand.hpp"
+#include "Command/Commands/TestDispatchIndirectCommand.hpp"
+#include "Command/Commands/TestDownloadMemoryCommand.hpp"
+#include "Command/Commands/TestDrawCommand.hpp"
+#include "Command/Commands/TestDrawIndexedCommand.hpp"
+#include "Command/Commands/TestDrawIndexedIndirectCommand.hpp"
+#include "Command/Commands/TestDrawIndirectCommand.hpp"
+#include "Command/Commands/TestEndQueryCommand.hpp"
+#include "Command/Commands/TestEndRenderPassCommand.hpp"
+#include "Command/Commands/TestEndSubpassCommand.hpp"
+#include "Command/Commands/TestExecuteCommandsCommand.hpp"
+#include "Command/Commands/TestFillBufferCommand.hpp"
+#include "Command/Commands/TestGenerateMipsCommand.hpp"
+#include "Command/Commands/TestMemoryBarrierCommand.hpp"
+#include "Command/Commands/TestPushConstantsCommand.hpp"
+#include "Command/Commands/TestResetEventCommand.hpp"
+#include "Command/Commands/TestResetQueryPoolCommand.hpp"
+#include "Command/Commands/TestScissorCommand.hpp"
+#include "Command/Commands/TestSetBlendConstantsCommand.hpp"
+#include "Command/Commands/TestSetDepthBiasCommand.hpp"
+#include "Command/Commands/TestSetEventCommand.hpp"
+#include "Command/Commands/TestSetLineWidthCommand.hpp"
+#include "Command/Commands/TestSetStencilValueCommand.hpp"
+#include "Command/Commands/TestUpdateBufferCommand.hpp"
+#include "Command/Commands/TestUploadMemoryCommand.hpp"
+#include "Command/Commands/TestViewportCommand.hpp"
+#include "Command/Commands/TestWaitEventsCommand.hpp"
+#include "Command/Commands/TestWriteTimestampCommand.hpp"
 
 #include "ashestest_api.hpp"
 
 namespace ashes::test
 {
-	CommandBase::CommandBase( VkDevice device )
-		: m_device{ device }
+	void applyCmd( ExecutionState & state
+		, Command const & cmd )
 	{
+		switch ( cmd.op.type )
+		{
+		case OpType::eNone:
+			break;
+		case OpType::eBeginQuery:
+			apply( state, map< OpType::eBeginQuery >( cmd ) );
+			break;
+		case OpType::eBeginRenderPass:
+			apply( state, map< OpType::eBeginRenderPass >( cmd ) );
+			break;
+		case OpType::eBeginSubpass:
+			apply( state, map< OpType::eBeginSubpass >( cmd ) );
+			break;
+		case OpType::eBindDescriptorSets:
+			apply( state, map< OpType::eBindDescriptorSets >( cmd ) );
+			break;
+		case OpType::eBindIndexBuffer:
+			apply( state, map< OpType::eBindIndexBuffer >( cmd ) );
+			break;
+		case OpType::eBindPipeline:
+			apply( state, map< OpType::eBindPipeline >( cmd ) );
+			break;
+		case OpType::eBindVertexBuffers:
+			apply( state, map< OpType::eBindVertexBuffers >( cmd ) );
+			break;
+		case OpType::eBlitImage:
+			apply( state, map< OpType::eBlitImage >( cmd ) );
+			break;
+		case OpType::eClearAttachments:
+			apply( state, map< OpType::eClearAttachments >( cmd ) );
+			break;
+		case OpType::eClearColour:
+			apply( state, map< OpType::eClearColour >( cmd ) );
+			break;
+		case OpType::eClearDepthStencil:
+			apply( state, map< OpType::eClearDepthStencil >( cmd ) );
+			break;
+		case OpType::eCopyBuffer:
+			apply( state, map< OpType::eCopyBuffer >( cmd ) );
+			break;
+		case OpType::eCopyBufferToImage:
+			apply( state, map< OpType::eCopyBufferToImage >( cmd ) );
+			break;
+		case OpType::eCopyImage:
+			apply( state, map< OpType::eCopyImage >( cmd ) );
+			break;
+		case OpType::eCopyImageToBuffer:
+			apply( state, map< OpType::eCopyImageToBuffer >( cmd ) );
+			break;
+		case OpType::eDispatch:
+			apply( state, map< OpType::eDispatch >( cmd ) );
+			break;
+		case OpType::eDispatchIndirect:
+			apply( state, map< OpType::eDispatchIndirect >( cmd ) );
+			break;
+		case OpType::eDownloadMemory:
+			apply( state, map< OpType::eDownloadMemory >( cmd ) );
+			break;
+		case OpType::eDraw:
+			apply( state, map< OpType::eDraw >( cmd ) );
+			break;
+		case OpType::eDrawIndexed:
+			apply( state, map< OpType::eDrawIndexed >( cmd ) );
+			break;
+		case OpType::eDrawIndexedIndirect:
+			apply( state, map< OpType::eDrawIndexedIndirect >( cmd ) );
+			break;
+		case OpType::eDrawIndirect:
+			apply( state, map< OpType::eDrawIndirect >( cmd ) );
+			break;
+		case OpType::eEndQuery:
+			apply( state, map< OpType::eEndQuery >( cmd ) );
+			break;
+		case OpType::eEndRenderPass:
+			apply( state, map< OpType::eEndRenderPass >( cmd ) );
+			break;
+		case OpType::eEndSubpass:
+			apply( state, map< OpType::eEndSubpass >( cmd ) );
+			break;
+		case OpType::eExecuteCommands:
+			apply( state, map< OpType::eExecuteCommands >( cmd ) );
+			break;
+		case OpType::eFillBuffer:
+			apply( state, map< OpType::eFillBuffer >( cmd ) );
+			break;
+		case OpType::eGenerateMips:
+			apply( state, map< OpType::eGenerateMips >( cmd ) );
+			break;
+		case OpType::eMemoryBarrier:
+			apply( state, map< OpType::eMemoryBarrier >( cmd ) );
+			break;
+		case OpType::ePushConstants:
+			apply( state, map< OpType::ePushConstants >( cmd ) );
+			break;
+		case OpType::eResetEvent:
+			apply( state, map< OpType::eResetEvent >( cmd ) );
+			break;
+		case OpType::eResetQueryPool:
+			apply( state, map< OpType::eResetQueryPool >( cmd ) );
+			break;
+		case OpType::eScissor:
+			apply( state, map< OpType::eScissor >( cmd ) );
+			break;
+		case OpType::eSetBlendConstants:
+			apply( state, map< OpType::eSetBlendConstants >( cmd ) );
+			break;
+		case OpType::eSetDepthBias:
+			apply( state, map< OpType::eSetDepthBias >( cmd ) );
+			break;
+		case OpType::eSetEvent:
+			apply( state, map< OpType::eSetEvent >( cmd ) );
+			break;
+		case OpType::eSetLineWidth:
+			apply( state, map< OpType::eSetLineWidth >( cmd ) );
+			break;
+		case OpType::eSetStencilValue:
+			apply( state, map< OpType::eSetStencilValue >( cmd ) );
+			break;
+		case OpType::eUpdateBuffer:
+			apply( state, map< OpType::eUpdateBuffer >( cmd ) );
+			break;
+		case OpType::eUploadMemory:
+			apply( state, map< OpType::eUploadMemory >( cmd ) );
+			break;
+		case OpType::eViewport:
+			apply( state, map< OpType::eViewport >( cmd ) );
+			break;
+		case OpType::eWaitEvents:
+			apply( state, map< OpType::eWaitEvents >( cmd ) );
+			break;
+		case OpType::eWriteTimestamp:
+			apply( state, map< OpType::eWriteTimestamp >( cmd ) );
+			break;
+		default:
+			assert( false && "Unsupported command type." );
+			break;
+		}
 	}
 }
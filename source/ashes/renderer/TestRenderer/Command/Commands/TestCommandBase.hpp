@@ -6,22 +6,108 @@ See LICENSE file in root folder
 
 #include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
 
+#include <ashes/common/ArrayView.hpp>
+
+#include <type_traits>
+
 namespace ashes::test
 {
-	class CommandBase
+	//*************************************************************************
+
+	enum class OpType
+		: uint16_t
+	{
+		// A command disabled after its recording, because its resources were destroyed.
+		eNone,
+		eBeginQuery,
+		eBeginRenderPass,
+		eBeginSubpass,
+		eBindDescriptorSets,
+		eBindIndexBuffer,
+		eBindPipeline,
+		eBindVertexBuffers,
+		eBlitImage,
+		eClearAttachments,
+		eClearColour,
+		eClearDepthStencil,
+		eCopyBuffer,
+		eCopyBufferToImage,
+		eCopyImage,
+		eCopyImageToBuffer,
+		eDispatch,
+		eDispatchIndirect,
+		eDownloadMemory,
+		eDraw,
+		eDrawIndexed,
+		eDrawIndexedIndirect,
+		eDrawIndirect,
+		eEndQuery,
+		eEndRenderPass,
+		eEndSubpass,
+		eExecuteCommands,
+		eFillBuffer,
+		eGenerateMips,
+		eMemoryBarrier,
+		ePushConstants,
+		eResetEvent,
+		eResetQueryPool,
+		eScissor,
+		eSetBlendConstants,
+		eSetDepthBias,
+		eSetEvent,
+		eSetLineWidth,
+		eSetStencilValue,
+		eUpdateBuffer,
+		eUploadMemory,
+		eViewport,
+		eWaitEvents,
+		eWriteTimestamp,
+	};
+
+	struct Op
 	{
-	public:
-		CommandBase( VkDevice device );
-		CommandBase() = delete;
-		virtual ~CommandBase()noexcept = default;
-
-		virtual CommandPtr clone()const = 0;
-		virtual void apply()const = 0;
-		virtual void remove()const
-		{
-		}
-
-	protected:
-		VkDevice m_device;
+		OpType type;
+		// The command size, in uint32_t.
+		uint16_t size;
 	};
+
+	struct Command
+	{
+		Op op;
+		uint32_t dummy{ 0u };
+	};
+
+	template< OpType OpT >
+	struct CmdT;
+
+	template< OpType OpT >
+	CmdT< OpT > const & map( Command const & cmd )
+	{
+		return *reinterpret_cast< CmdT< OpT > const * >( &cmd );
+	}
+	/**
+	*\brief
+	*	The state the commands of a command buffer update while they execute.
+	*\remarks
+	*	The draws and dispatches run with it, each command buffer starts from a fresh one,
+	*	and the secondary command buffers only inherit the render pass state.
+	*/
+	struct ExecutionState
+	{
+		VkDevice device{};
+		VkRenderPass renderPass{};
+		uint32_t subpassIndex{};
+		DrawState graphics;
+		VkPipeline computePipeline{};
+		DescriptorSetBindingArray computeDescriptorSets;
+		ByteArray computePushConstants;
+	};
+	/**
+	*\brief
+	*	Executes a recorded command.
+	*/
+	void applyCmd( ExecutionState & state
+		, Command const & cmd );
+
+	//*************************************************************************
 }
@@ -4,22 +4,29 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestCopyBufferCommand.hpp"
 
+#include "Buffer/TestBuffer.hpp"
+#include "Core/TestDevice.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
+
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	CopyBufferCommand::CopyBufferCommand( VkDevice device
-		, VkBufferCopy const & copyInfo
-		, VkBuffer src
-		, VkBuffer dst )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdCopyBuffer const & cmd )
 	{
-	}
+		auto dst = get( cmd.dst );
+		VkDeviceSize size{};
 
-	void CopyBufferCommand::apply()const
-	{
-	}
+		for ( auto & region : cmd.regions )
+		{
+			dst->copyFrom( cmd.src
+				, region.srcOffset
+				, region.size
+				, region.dstOffset );
+			size += region.size;
+		}
 
-	CommandPtr CopyBufferCommand::clone()const
-	{
-		return std::make_unique< CopyBufferCommand >( *this );
+		get( state.device )->getGpuClock().chargeTransfer( size );
 	}
 }
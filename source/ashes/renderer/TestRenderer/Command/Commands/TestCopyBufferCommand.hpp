@@ -8,16 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class CopyBufferCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eCopyBuffer >
 	{
-	public:
-		CopyBufferCommand( VkDevice device
-			, VkBufferCopy const & copyInfo
-			, VkBuffer src
-			, VkBuffer dst );
+		inline CmdT( VkBuffer src
+			, VkBuffer dst
+			, ArrayView< VkBufferCopy const > regions )
+			: cmd{ { OpType::eCopyBuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, src{ src }
+			, dst{ dst }
+			, regions{ regions }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkBuffer src;
+		VkBuffer dst;
+		ArrayView< VkBufferCopy const > regions;
 	};
+	using CmdCopyBuffer = CmdT< OpType::eCopyBuffer >;
+
+	void apply( ExecutionState & state
+		, CmdCopyBuffer const & cmd );
 }
@@ -4,22 +4,42 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestCopyBufferToImageCommand.hpp"
 
+#include "Buffer/TestBuffer.hpp"
+#include "Core/TestDevice.hpp"
+#include "Image/TestImage.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
+
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	CopyBufferToImageCommand::CopyBufferToImageCommand( VkDevice device
-		, VkBufferImageCopyArray const & copyInfos
-		, VkBuffer src
-		, VkImage dst )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdCopyBufferToImage const & cmd )
 	{
-	}
+		auto buffer = get( cmd.src );
+		auto image = get( cmd.dst );
+		auto format = image->getFormat();
+		VkDeviceSize size{};
 
-	void CopyBufferToImageCommand::apply()const
-	{
-	}
+		for ( auto & copyInfo : cmd.copyInfos )
+		{
+			auto data = get( buffer->getMemory() )->getData( buffer->getMemoryOffset() + copyInfo.bufferOffset );
+			auto extent = getBlockExtent( format, copyInfo.imageExtent );
 
-	CommandPtr CopyBufferToImageCommand::clone()const
-	{
-		return std::make_unique< CopyBufferToImageCommand >( *this );
+			for ( uint32_t layer = 0u; layer < copyInfo.imageSubresource.layerCount; ++layer )
+			{
+				auto dst = image->getSubresourceData( copyInfo.imageSubresource.aspectMask
+					, copyInfo.imageSubresource.mipLevel
+					, copyInfo.imageSubresource.baseArrayLayer + layer );
+				copyRegion( dst
+					, getBlockOffset( format, copyInfo.imageOffset )
+					, getBufferImageData( data, format, copyInfo, layer )
+					, VkOffset3D{}
+					, extent );
+				size += getRegionSize( dst, extent );
+			}
+		}
+
+		get( state.device )->getGpuClock().chargeTransfer( size );
 	}
 }
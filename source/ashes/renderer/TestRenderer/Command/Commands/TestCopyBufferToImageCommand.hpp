@@ -8,16 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class CopyBufferToImageCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eCopyBufferToImage >
 	{
-	public:
-		CopyBufferToImageCommand( VkDevice device
-			, VkBufferImageCopyArray const & copyInfo
-			, VkBuffer src
-			, VkImage dst );
+		inline CmdT( VkBuffer src
+			, VkImage dst
+			, ArrayView< VkBufferImageCopy const > copyInfos )
+			: cmd{ { OpType::eCopyBufferToImage, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, src{ src }
+			, dst{ dst }
+			, copyInfos{ copyInfos }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkBuffer src;
+		VkImage dst;
+		ArrayView< VkBufferImageCopy const > copyInfos;
 	};
+	using CmdCopyBufferToImage = CmdT< OpType::eCopyBufferToImage >;
+
+	void apply( ExecutionState & state
+		, CmdCopyBufferToImage const & cmd );
 }
@@ -4,22 +4,41 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestCopyImageCommand.hpp"
 
+#include "Core/TestDevice.hpp"
+#include "Image/TestImage.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
+
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	CopyImageCommand::CopyImageCommand( VkDevice device
-		, VkImageCopy const & copyInfo
-		, VkImage src
-		, VkImage dst )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdCopyImage const & cmd )
 	{
-	}
+		auto src = get( cmd.src );
+		auto dst = get( cmd.dst );
+		VkDeviceSize size{};
 
-	void CopyImageCommand::apply()const
-	{
-	}
+		for ( auto & region : cmd.regions )
+		{
+			auto extent = getBlockExtent( src->getFormat(), region.extent );
 
-	CommandPtr CopyImageCommand::clone()const
-	{
-		return std::make_unique< CopyImageCommand >( *this );
+			for ( uint32_t layer = 0u; layer < region.srcSubresource.layerCount; ++layer )
+			{
+				auto srcData = src->getSubresourceData( region.srcSubresource.aspectMask
+					, region.srcSubresource.mipLevel
+					, region.srcSubresource.baseArrayLayer + layer );
+				copyRegion( dst->getSubresourceData( region.dstSubresource.aspectMask
+						, region.dstSubresource.mipLevel
+						, region.dstSubresource.baseArrayLayer + layer )
+					, getBlockOffset( dst->getFormat(), region.dstOffset )
+					, srcData
+					, getBlockOffset( src->getFormat(), region.srcOffset )
+					, extent );
+				size += getRegionSize( srcData, extent );
+			}
+		}
+
+		get( state.device )->getGpuClock().chargeTransfer( size );
 	}
 }
@@ -8,16 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class CopyImageCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eCopyImage >
 	{
-	public:
-		CopyImageCommand( VkDevice device
-			, VkImageCopy const & copyInfo
-			, VkImage src
-			, VkImage dst );
+		inline CmdT( VkImage src
+			, VkImage dst
+			, ArrayView< VkImageCopy const > regions )
+			: cmd{ { OpType::eCopyImage, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, src{ src }
+			, dst{ dst }
+			, regions{ regions }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkImage src;
+		VkImage dst;
+		ArrayView< VkImageCopy const > regions;
 	};
+	using CmdCopyImage = CmdT< OpType::eCopyImage >;
+
+	void apply( ExecutionState & state
+		, CmdCopyImage const & cmd );
 }
@@ -4,22 +4,42 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestCopyImageToBufferCommand.hpp"
 
+#include "Buffer/TestBuffer.hpp"
+#include "Core/TestDevice.hpp"
+#include "Image/TestImage.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
+
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	CopyImageToBufferCommand::CopyImageToBufferCommand( VkDevice device
-		, VkBufferImageCopyArray const & copyInfo
-		, VkImage src
-		, VkBuffer dst )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdCopyImageToBuffer const & cmd )
 	{
-	}
+		auto image = get( cmd.src );
+		auto buffer = get( cmd.dst );
+		auto format = image->getFormat();
+		VkDeviceSize size{};
 
-	void CopyImageToBufferCommand::apply()const
-	{
-	}
+		for ( auto & copyInfo : cmd.copyInfos )
+		{
+			auto data = get( buffer->getMemory() )->getData( buffer->getMemoryOffset() + copyInfo.bufferOffset );
+			auto extent = getBlockExtent( format, copyInfo.imageExtent );
 
-	CommandPtr CopyImageToBufferCommand::clone()const
-	{
-		return std::make_unique< CopyImageToBufferCommand >( *this );
+			for ( uint32_t layer = 0u; layer < copyInfo.imageSubresource.layerCount; ++layer )
+			{
+				auto src = image->getSubresourceData( copyInfo.imageSubresource.aspectMask
+					, copyInfo.imageSubresource.mipLevel
+					, copyInfo.imageSubresource.baseArrayLayer + layer );
+				copyRegion( getBufferImageData( data, format, copyInfo, layer )
+					, VkOffset3D{}
+					, src
+					, getBlockOffset( format, copyInfo.imageOffset )
+					, extent );
+				size += getRegionSize( src, extent );
+			}
+		}
+
+		get( state.device )->getGpuClock().chargeTransfer( size );
 	}
 }
@@ -8,16 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class CopyImageToBufferCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eCopyImageToBuffer >
 	{
-	public:
-		CopyImageToBufferCommand( VkDevice device
-			, VkBufferImageCopyArray const & copyInfo
-			, VkImage src
-			, VkBuffer dst );
+		inline CmdT( VkImage src
+			, VkBuffer dst
+			, ArrayView< VkBufferImageCopy const > copyInfos )
+			: cmd{ { OpType::eCopyImageToBuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, src{ src }
+			, dst{ dst }
+			, copyInfos{ copyInfos }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkImage src;
+		VkBuffer dst;
+		ArrayView< VkBufferImageCopy const > copyInfos;
 	};
+	using CmdCopyImageToBuffer = CmdT< OpType::eCopyImageToBuffer >;
+
+	void apply( ExecutionState & state
+		, CmdCopyImageToBuffer const & cmd );
 }
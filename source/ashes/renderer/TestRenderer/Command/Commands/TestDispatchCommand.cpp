@@ -4,22 +4,19 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestDispatchCommand.hpp"
 
-namespace ashes::test
-{
-	DispatchCommand::DispatchCommand( VkDevice device
-		, uint32_t
-		, uint32_t
-		, uint32_t )
-		: CommandBase{ device }
-	{
-	}
+#include "Shader/TestComputeDispatch.hpp"
 
-	void DispatchCommand::apply()const
-	{
-	}
+#include "ashestest_api.hpp"
 
-	CommandPtr DispatchCommand::clone()const
+namespace ashes::test
+{
+	void apply( ExecutionState & state
+		, CmdDispatch const & cmd )
 	{
-		return std::make_unique< DispatchCommand >( *this );
+		dispatchCompute( state.device
+			, state.computePipeline
+			, state.computeDescriptorSets
+			, state.computePushConstants
+			, cmd.groupCount );
 	}
 }
@@ -8,16 +8,20 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class DispatchCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eDispatch >
 	{
-	public:
-		DispatchCommand( VkDevice device
-			, uint32_t groupCountX
-			, uint32_t groupCountY
-			, uint32_t groupCountZ );
+		inline CmdT( VkExtent3D groupCount )
+			: cmd{ { OpType::eDispatch, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, groupCount{ groupCount }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkExtent3D groupCount;
 	};
+	using CmdDispatch = CmdT< OpType::eDispatch >;
+
+	void apply( ExecutionState & state
+		, CmdDispatch const & cmd );
 }
@@ -4,21 +4,35 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestDispatchIndirectCommand.hpp"
 
+#include "Buffer/TestBuffer.hpp"
+#include "Miscellaneous/TestDeviceMemory.hpp"
+#include "Shader/TestComputeDispatch.hpp"
+
+#include "ashestest_api.hpp"
+
+#include <cstring>
+
 namespace ashes::test
 {
-	DispatchIndirectCommand::DispatchIndirectCommand( VkDevice device
-		, VkBuffer
-		, VkDeviceSize )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdDispatchIndirect const & cmd )
 	{
-	}
+		// The group count is read at execution time, it may have been written by previous commands.
+		auto buffer = get( cmd.buffer );
+		VkDispatchIndirectCommand command{};
 
-	void DispatchIndirectCommand::apply()const
-	{
-	}
+		if ( cmd.offset + sizeof( command ) > buffer->getSize() )
+		{
+			return;
+		}
 
-	CommandPtr DispatchIndirectCommand::clone()const
-	{
-		return std::make_unique< DispatchIndirectCommand >( *this );
+		std::memcpy( &command
+			, get( buffer->getMemory() )->getData( buffer->getMemoryOffset() + cmd.offset )
+			, sizeof( command ) );
+		dispatchCompute( state.device
+			, state.computePipeline
+			, state.computeDescriptorSets
+			, state.computePushConstants
+			, { command.x, command.y, command.z } );
 	}
 }
@@ -8,15 +8,23 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class DispatchIndirectCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eDispatchIndirect >
 	{
-	public:
-		DispatchIndirectCommand( VkDevice device
-			, VkBuffer buffer
-			, VkDeviceSize offset );
+		inline CmdT( VkBuffer buffer
+			, VkDeviceSize offset )
+			: cmd{ { OpType::eDispatchIndirect, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, buffer{ buffer }
+			, offset{ offset }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkBuffer buffer;
+		VkDeviceSize offset;
 	};
+	using CmdDispatchIndirect = CmdT< OpType::eDispatchIndirect >;
+
+	void apply( ExecutionState & state
+		, CmdDispatchIndirect const & cmd );
 }
@@ -4,23 +4,12 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestDownloadMemoryCommand.hpp"
 
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	DownloadMemoryCommand::DownloadMemoryCommand( VkDevice device
-		, ObjectMemory const * memory
-		, VkDeviceSize offset
-		, VkDeviceSize size )
-		: CommandBase{ device }
-		, m_range{ offset, size }
-	{
-	}
-
-	void DownloadMemoryCommand::apply()const
-	{
-	}
-
-	CommandPtr DownloadMemoryCommand::clone()const
+	void apply( ExecutionState &
+		, CmdDownloadMemory const & )
 	{
-		return std::make_unique< DownloadMemoryCommand >( *this );
 	}
 }
@@ -8,19 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class DownloadMemoryCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eDownloadMemory >
 	{
-	public:
-		DownloadMemoryCommand( VkDevice device
-			, ObjectMemory const * memory
+		inline CmdT( ObjectMemory const * memory
 			, VkDeviceSize offset
-			, VkDeviceSize size );
+			, VkDeviceSize size )
+			: cmd{ { OpType::eDownloadMemory, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, memory{ memory }
+			, offset{ offset }
+			, size{ size }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		std::pair< VkDeviceSize, VkDeviceSize > m_range;
+		Command cmd;
+		ObjectMemory const * memory;
+		VkDeviceSize offset;
+		VkDeviceSize size;
 	};
+	using CmdDownloadMemory = CmdT< OpType::eDownloadMemory >;
+
+	void apply( ExecutionState & state
+		, CmdDownloadMemory const & cmd );
 }
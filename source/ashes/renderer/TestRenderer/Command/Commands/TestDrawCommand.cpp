@@ -4,26 +4,15 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestDrawCommand.hpp"
 
-namespace ashes::test
-{
-	DrawCommand::DrawCommand( VkDevice device
-		, uint32_t
-		, uint32_t
-		, uint32_t
-		, uint32_t
-		, VkPrimitiveTopology
-		, VbosBindingArray const & vbos )
-		: CommandBase{ device }
-		, m_vbos{ vbos }
-	{
-	}
+#include "Shader/TestGraphicsDraw.hpp"
 
-	void DrawCommand::apply()const
-	{
-	}
+#include "ashestest_api.hpp"
 
-	CommandPtr DrawCommand::clone()const
+namespace ashes::test
+{
+	void apply( ExecutionState & state
+		, CmdDraw const & cmd )
 	{
-		return std::make_unique< DrawCommand >( *this );
+		drawGraphics( state.device, state.graphics, cmd.draw );
 	}
 }
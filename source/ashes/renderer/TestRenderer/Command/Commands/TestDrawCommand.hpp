@@ -8,22 +8,20 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class DrawCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eDraw >
 	{
-	public:
-		DrawCommand( VkDevice device
-			, uint32_t vtxCount
-			, uint32_t instCount
-			, uint32_t firstVertex
-			, uint32_t firstInstance
-			, VkPrimitiveTopology mode
-			, VbosBindingArray const & vbos );
+		inline CmdT( VkDrawIndirectCommand draw )
+			: cmd{ { OpType::eDraw, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, draw{ draw }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		VbosBindingArray m_vbos;
+		Command cmd;
+		VkDrawIndirectCommand draw;
 	};
+	using CmdDraw = CmdT< OpType::eDraw >;
+
+	void apply( ExecutionState & state
+		, CmdDraw const & cmd );
 }
@@ -4,28 +4,15 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestDrawIndexedCommand.hpp"
 
-namespace ashes::test
-{
-	DrawIndexedCommand::DrawIndexedCommand( VkDevice device
-		, uint32_t
-		, uint32_t
-		, uint32_t
-		, uint32_t
-		, uint32_t
-		, VkPrimitiveTopology
-		, VkIndexType
-		, VbosBindingArray const & vbos )
-		: CommandBase{ device }
-		, m_vbos{ vbos }
-	{
-	}
+#include "Shader/TestGraphicsDraw.hpp"
 
-	void DrawIndexedCommand::apply()const
-	{
-	}
+#include "ashestest_api.hpp"
 
-	CommandPtr DrawIndexedCommand::clone()const
+namespace ashes::test
+{
+	void apply( ExecutionState & state
+		, CmdDrawIndexed const & cmd )
 	{
-		return std::make_unique< DrawIndexedCommand >( *this );
+		drawGraphicsIndexed( state.device, state.graphics, cmd.draw );
 	}
 }
@@ -8,24 +8,20 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class DrawIndexedCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eDrawIndexed >
 	{
-	public:
-		DrawIndexedCommand( VkDevice device
-			, uint32_t indexCount
-			, uint32_t instCount
-			, uint32_t firstIndex
-			, uint32_t vertexOffset
-			, uint32_t firstInstance
-			, VkPrimitiveTopology mode
-			, VkIndexType type
-			, VbosBindingArray const & vbos );
+		inline CmdT( VkDrawIndexedIndirectCommand draw )
+			: cmd{ { OpType::eDrawIndexed, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, draw{ draw }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		VbosBindingArray m_vbos;
+		Command cmd;
+		VkDrawIndexedIndirectCommand draw;
 	};
+	using CmdDrawIndexed = CmdT< OpType::eDrawIndexed >;
+
+	void apply( ExecutionState & state
+		, CmdDrawIndexed const & cmd );
 }
@@ -4,27 +4,36 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestDrawIndexedIndirectCommand.hpp"
 
+#include "Buffer/TestBuffer.hpp"
+#include "Miscellaneous/TestDeviceMemory.hpp"
+#include "Shader/TestGraphicsDraw.hpp"
+
+#include "ashestest_api.hpp"
+
+#include <cstring>
+
 namespace ashes::test
 {
-	DrawIndexedIndirectCommand::DrawIndexedIndirectCommand( VkDevice device
-		, VkBuffer
-		, VkDeviceSize
-		, uint32_t
-		, uint32_t
-		, VkPrimitiveTopology
-		, VkIndexType
-		, VbosBindingArray const & vbos )
-		: CommandBase{ device }
-		, m_vbos{ vbos }
+	void apply( ExecutionState & state
+		, CmdDrawIndexedIndirect const & cmd )
 	{
-	}
+		// The draws are read at execution time, they may have been written by previous commands.
+		auto buffer = get( cmd.buffer );
 
-	void DrawIndexedIndirectCommand::apply()const
-	{
-	}
+		for ( uint32_t i = 0u; i < cmd.drawCount; ++i )
+		{
+			auto offset = cmd.offset + VkDeviceSize( i ) * cmd.stride;
+			VkDrawIndexedIndirectCommand command{};
 
-	CommandPtr DrawIndexedIndirectCommand::clone()const
-	{
-		return std::make_unique< DrawIndexedIndirectCommand >( *this );
+			if ( offset + sizeof( command ) > buffer->getSize() )
+			{
+				return;
+			}
+
+			std::memcpy( &command
+				, get( buffer->getMemory() )->getData( buffer->getMemoryOffset() + offset )
+				, sizeof( command ) );
+			drawGraphicsIndexed( state.device, state.graphics, command );
+		}
 	}
 }
@@ -8,23 +8,29 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class DrawIndexedIndirectCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eDrawIndexedIndirect >
 	{
-	public:
-		DrawIndexedIndirectCommand( VkDevice device
-			, VkBuffer buffer
+		inline CmdT( VkBuffer buffer
 			, VkDeviceSize offset
 			, uint32_t drawCount
-			, uint32_t stride
-			, VkPrimitiveTopology mode
-			, VkIndexType type
-			, VbosBindingArray const & vbos );
+			, uint32_t stride )
+			: cmd{ { OpType::eDrawIndexedIndirect, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, buffer{ buffer }
+			, offset{ offset }
+			, drawCount{ drawCount }
+			, stride{ stride }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		VbosBindingArray m_vbos;
+		Command cmd;
+		VkBuffer buffer;
+		VkDeviceSize offset;
+		uint32_t drawCount;
+		uint32_t stride;
 	};
+	using CmdDrawIndexedIndirect = CmdT< OpType::eDrawIndexedIndirect >;
+
+	void apply( ExecutionState & state
+		, CmdDrawIndexedIndirect const & cmd );
 }
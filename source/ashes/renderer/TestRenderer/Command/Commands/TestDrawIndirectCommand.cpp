@@ -5,29 +5,35 @@ See LICENSE file in root folder.
 #include "Command/Commands/TestDrawIndirectCommand.hpp"
 
 #include "Buffer/TestBuffer.hpp"
+#include "Miscellaneous/TestDeviceMemory.hpp"
+#include "Shader/TestGraphicsDraw.hpp"
 
 #include "ashestest_api.hpp"
 
+#include <cstring>
+
 namespace ashes::test
 {
-	DrawIndirectCommand::DrawIndirectCommand( VkDevice device
-		, VkBuffer
-		, VkDeviceSize
-		, uint32_t
-		, uint32_t
-		, VkPrimitiveTopology
-		, VbosBindingArray const & vbos )
-		: CommandBase{ device }
-		, m_vbos{ vbos }
+	void apply( ExecutionState & state
+		, CmdDrawIndirect const & cmd )
 	{
-	}
+		// The draws are read at execution time, they may have been written by previous commands.
+		auto buffer = get( cmd.buffer );
 
-	void DrawIndirectCommand::apply()const
-	{
-	}
+		for ( uint32_t i = 0u; i < cmd.drawCount; ++i )
+		{
+			auto offset = cmd.offset + VkDeviceSize( i ) * cmd.stride;
+			VkDrawIndirectCommand command{};
 
-	CommandPtr DrawIndirectCommand::clone()const
-	{
-		return std::make_unique< DrawIndirectCommand >( *this );
+			if ( offset + sizeof( command ) > buffer->getSize() )
+			{
+				return;
+			}
+
+			std::memcpy( &command
+				, get( buffer->getMemory() )->getData( buffer->getMemoryOffset() + offset )
+				, sizeof( command ) );
+			drawGraphics( state.device, state.graphics, command );
+		}
 	}
 }
@@ -8,22 +8,29 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class DrawIndirectCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eDrawIndirect >
 	{
-	public:
-		DrawIndirectCommand( VkDevice device
-			, VkBuffer buffer
+		inline CmdT( VkBuffer buffer
 			, VkDeviceSize offset
 			, uint32_t drawCount
-			, uint32_t stride
-			, VkPrimitiveTopology mode
-			, VbosBindingArray const & vbos );
+			, uint32_t stride )
+			: cmd{ { OpType::eDrawIndirect, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, buffer{ buffer }
+			, offset{ offset }
+			, drawCount{ drawCount }
+			, stride{ stride }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		VbosBindingArray m_vbos;
+		Command cmd;
+		VkBuffer buffer;
+		VkDeviceSize offset;
+		uint32_t drawCount;
+		uint32_t stride;
 	};
+	using CmdDrawIndirect = CmdT< OpType::eDrawIndirect >;
+
+	void apply( ExecutionState & state
+		, CmdDrawIndirect const & cmd );
 }
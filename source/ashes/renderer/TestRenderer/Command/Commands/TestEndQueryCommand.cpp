@@ -4,21 +4,12 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestEndQueryCommand.hpp"
 
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	EndQueryCommand::EndQueryCommand( VkDevice device
-		, VkQueryPool pool
-		, uint32_t query )
-		: CommandBase{ device }
-	{
-	}
-
-	void EndQueryCommand::apply()const
-	{
-	}
-
-	CommandPtr EndQueryCommand::clone()const
+	void apply( ExecutionState &
+		, CmdEndQuery const & )
 	{
-		return std::make_unique< EndQueryCommand >( *this );
 	}
 }
@@ -8,15 +8,23 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class EndQueryCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eEndQuery >
 	{
-	public:
-		EndQueryCommand( VkDevice device
-			, VkQueryPool pool
-			, uint32_t query );
+		inline CmdT( VkQueryPool pool
+			, uint32_t query )
+			: cmd{ { OpType::eEndQuery, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, pool{ pool }
+			, query{ query }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkQueryPool pool;
+		uint32_t query;
 	};
+	using CmdEndQuery = CmdT< OpType::eEndQuery >;
+
+	void apply( ExecutionState & state
+		, CmdEndQuery const & cmd );
 }
@@ -4,21 +4,16 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestEndRenderPassCommand.hpp"
 
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	EndRenderPassCommand::EndRenderPassCommand( VkDevice device
-		, VkRenderPass
-		, VkFramebuffer )
-		: CommandBase{ device }
-	{
-	}
-
-	void EndRenderPassCommand::apply()const
-	{
-	}
-
-	CommandPtr EndRenderPassCommand::clone()const
+	void apply( ExecutionState & state
+		, CmdEndRenderPass const & )
 	{
-		return std::make_unique< EndRenderPassCommand >( *this );
+		state.renderPass = VK_NULL_HANDLE;
+		state.subpassIndex = 0u;
+		state.graphics.frameBuffer = VK_NULL_HANDLE;
+		state.graphics.subpass = nullptr;
 	}
 }
@@ -8,15 +8,18 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class EndRenderPassCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eEndRenderPass >
 	{
-	public:
-		EndRenderPassCommand( VkDevice device
-			, VkRenderPass renderPass
-			, VkFramebuffer frameBuffer );
+		inline CmdT()
+			: cmd{ { OpType::eEndRenderPass, sizeof( CmdT ) / sizeof( uint32_t ) } }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
 	};
+	using CmdEndRenderPass = CmdT< OpType::eEndRenderPass >;
+
+	void apply( ExecutionState & state
+		, CmdEndRenderPass const & cmd );
 }
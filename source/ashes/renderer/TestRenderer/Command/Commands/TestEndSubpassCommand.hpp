@@ -8,15 +8,18 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class EndSubpassCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eEndSubpass >
 	{
-	public:
-		EndSubpassCommand( VkDevice device
-			, VkFramebuffer frameBuffer
-			, VkSubpassDescription const & subpass );
+		inline CmdT()
+			: cmd{ { OpType::eEndSubpass, sizeof( CmdT ) / sizeof( uint32_t ) } }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
 	};
+	using CmdEndSubpass = CmdT< OpType::eEndSubpass >;
+
+	void apply( ExecutionState & state
+		, CmdEndSubpass const & cmd );
 }
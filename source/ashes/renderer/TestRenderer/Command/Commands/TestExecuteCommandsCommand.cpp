@@ -10,23 +10,16 @@ See LICENSE file in root folder.
 
 namespace ashes::test
 {
-	ExecuteCommandsCommand::ExecuteCommandsCommand( VkDevice device
-		, VkCommandBuffer commandBuffer )
-		: CommandBase{ device }
-		, m_commandBuffer{ commandBuffer }
+	void apply( ExecutionState & state
+		, CmdExecuteCommands const & cmd )
 	{
-	}
-
-	void ExecuteCommandsCommand::apply()const
-	{
-		for ( auto & command : get( m_commandBuffer )->getCommands() )
-		{
-			command->apply();
-		}
-	}
-
-	CommandPtr ExecuteCommandsCommand::clone()const
-	{
-		return std::make_unique< ExecuteCommandsCommand >( *this );
+		// The secondary command buffer runs its own commands, inheriting the render pass state only.
+		ExecutionState secondary;
+		secondary.device = state.device;
+		secondary.renderPass = state.renderPass;
+		secondary.subpassIndex = state.subpassIndex;
+		secondary.graphics.frameBuffer = state.graphics.frameBuffer;
+		secondary.graphics.subpass = state.graphics.subpass;
+		get( cmd.commandBuffer )->execute( secondary );
 	}
 }
@@ -8,17 +8,20 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class ExecuteCommandsCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eExecuteCommands >
 	{
-	public:
-		ExecuteCommandsCommand( VkDevice device
-			, VkCommandBuffer commandBuffer );
+		inline CmdT( VkCommandBuffer commandBuffer )
+			: cmd{ { OpType::eExecuteCommands, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, commandBuffer{ commandBuffer }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		VkCommandBuffer m_commandBuffer;
+		Command cmd;
+		VkCommandBuffer commandBuffer;
 	};
+	using CmdExecuteCommands = CmdT< OpType::eExecuteCommands >;
+
+	void apply( ExecutionState & state
+		, CmdExecuteCommands const & cmd );
 }
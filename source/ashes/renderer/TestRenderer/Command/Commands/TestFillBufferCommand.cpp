@@ -0,0 +1,34 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Command/Commands/TestFillBufferCommand.hpp"
+
+#include "Buffer/TestBuffer.hpp"
+#include "Core/TestDevice.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
+#include "Miscellaneous/TestTransferKernels.hpp"
+
+#include "ashestest_api.hpp"
+
+namespace ashes::test
+{
+	void apply( ExecutionState & state
+		, CmdFillBuffer const & cmd )
+	{
+		auto buffer = get( cmd.dstBuffer );
+		auto size = cmd.size;
+
+		if ( size == WholeSize )
+		{
+			// The remaining size is rounded down to a multiple of 4.
+			size = ( buffer->getSize() - cmd.dstOffset ) & ~VkDeviceSize( 3u );
+		}
+
+		fillMemory( get( buffer->getMemory() )->getData( buffer->getMemoryOffset() + cmd.dstOffset )
+			, size
+			, reinterpret_cast< uint8_t const * >( &cmd.data )
+			, uint32_t( sizeof( cmd.data ) ) );
+		get( state.device )->getGpuClock().chargeTransfer( size );
+	}
+}
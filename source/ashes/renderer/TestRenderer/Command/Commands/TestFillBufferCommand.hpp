@@ -0,0 +1,36 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/Command/Commands/TestCommandBase.hpp"
+
+namespace ashes::test
+{
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eFillBuffer >
+	{
+		inline CmdT( VkBuffer dstBuffer
+			, VkDeviceSize dstOffset
+			, VkDeviceSize size
+			, uint32_t data )
+			: cmd{ { OpType::eFillBuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, dstBuffer{ dstBuffer }
+			, dstOffset{ dstOffset }
+			, size{ size }
+			, data{ data }
+		{
+		}
+
+		Command cmd;
+		VkBuffer dstBuffer;
+		VkDeviceSize dstOffset;
+		VkDeviceSize size;
+		uint32_t data;
+	};
+	using CmdFillBuffer = CmdT< OpType::eFillBuffer >;
+
+	void apply( ExecutionState & state
+		, CmdFillBuffer const & cmd );
+}
@@ -10,18 +10,19 @@ See LICENSE file in root folder.
 
 namespace ashes::test
 {
-	GenerateMipsCommand::GenerateMipsCommand( VkDevice device
-		, VkImage )
-		: CommandBase{ device }
+	void apply( ExecutionState &
+		, CmdGenerateMips const & cmd )
 	{
-	}
+		auto image = get( cmd.image );
+		auto aspectMask = getAspectMask( image->getFormat() );
 
-	void GenerateMipsCommand::apply()const
-	{
-	}
-
-	CommandPtr GenerateMipsCommand::clone()const
-	{
-		return std::make_unique< GenerateMipsCommand >( *this );
+		for ( uint32_t layer = 0u; layer < image->getLayerCount(); ++layer )
+		{
+			for ( uint32_t level = 1u; level < image->getMipmapLevels(); ++level )
+			{
+				generateMipLevel( image->getSubresourceData( aspectMask, level, layer )
+					, image->getSubresourceData( aspectMask, level - 1u, layer ) );
+			}
+		}
 	}
 }
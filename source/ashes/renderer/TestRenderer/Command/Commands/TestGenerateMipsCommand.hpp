@@ -5,18 +5,23 @@ See LICENSE file in root folder
 #pragma once
 
 #include "renderer/TestRenderer/Command/Commands/TestCommandBase.hpp"
-#include "renderer/TestRenderer/Image/TestImageView.hpp"
 
 namespace ashes::test
 {
-	class GenerateMipsCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eGenerateMips >
 	{
-	public:
-		GenerateMipsCommand( VkDevice device
-			, VkImage texture );
+		inline CmdT( VkImage image )
+			: cmd{ { OpType::eGenerateMips, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, image{ image }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkImage image;
 	};
+	using CmdGenerateMips = CmdT< OpType::eGenerateMips >;
+
+	void apply( ExecutionState & state
+		, CmdGenerateMips const & cmd );
 }
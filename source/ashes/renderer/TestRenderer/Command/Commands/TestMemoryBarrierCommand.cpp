@@ -4,65 +4,26 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestMemoryBarrierCommand.hpp"
 
+#include "Buffer/TestBuffer.hpp"
+#include "Miscellaneous/TestDeviceMemory.hpp"
+
 #include "ashestest_api.hpp"
 
 namespace ashes::test
 {
-	MemoryBarrierCommand::MemoryBarrierCommand( VkDevice device
-		, VkPipelineStageFlags after
-		, VkPipelineStageFlags before
-		, VkMemoryBarrierArray const & memoryBarriers
-		, VkBufferMemoryBarrierArray const & bufferBarriers
-		, VkImageMemoryBarrierArray const & imageBarriers )
-		: CommandBase{ device }
+	void apply( ExecutionState &
+		, CmdMemoryBarrier const & cmd )
 	{
-		for ( auto & barrier : bufferBarriers )
-		{
-			if ( get( barrier.buffer )->isMapped() )
-			{
-				if ( checkFlag( barrier.srcAccessMask, VK_ACCESS_MEMORY_WRITE_BIT )
-					|| checkFlag( barrier.srcAccessMask, VK_ACCESS_HOST_WRITE_BIT )
-					|| checkFlag( barrier.srcAccessMask, VK_ACCESS_TRANSFER_WRITE_BIT ) )
-				{
-					m_uploadBuffers.push_back(
-						{
-							barrier.offset,
-							barrier.size,
-							barrier.buffer,
-						} );
-				}
-				else if ( checkFlag( barrier.dstAccessMask, VK_ACCESS_TRANSFER_READ_BIT )
-					|| checkFlag( barrier.dstAccessMask, VK_ACCESS_HOST_READ_BIT )
-					|| checkFlag( barrier.dstAccessMask, VK_ACCESS_MEMORY_READ_BIT ) )
-				{
-					m_downloadBuffers.push_back(
-						{
-							barrier.offset,
-							barrier.size,
-							barrier.buffer,
-						} );
-				}
-			}
-		}
-	}
-
-	void MemoryBarrierCommand::apply()const
-	{
-		for ( auto & buffer : m_uploadBuffers )
+		for ( auto & buffer : cmd.uploadBuffers )
 		{
 			get( get( buffer.buffer )->getMemory() )->updateUpload( buffer.offset
 				, buffer.size );
 		}
 
-		for ( auto & buffer : m_uploadBuffers )
+		for ( auto & buffer : cmd.downloadBuffers )
 		{
 			get( get( buffer.buffer )->getMemory() )->updateDownload( buffer.offset
 				, buffer.size );
 		}
 	}
-
-	CommandPtr MemoryBarrierCommand::clone()const
-	{
-		return std::make_unique< MemoryBarrierCommand >( *this );
-	}
 }
@@ -8,29 +8,31 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class MemoryBarrierCommand
-		: public CommandBase
+	// A mapped buffer range, made visible to the device or to the host by a barrier.
+	struct BufferLock
 	{
-	public:
-		MemoryBarrierCommand( VkDevice device
-			, VkPipelineStageFlags after
-			, VkPipelineStageFlags before
-			, VkMemoryBarrierArray const & memoryBarriers
-			, VkBufferMemoryBarrierArray const & bufferBarriers
-			, VkImageMemoryBarrierArray const & imageBarriers );
-
-		void apply()const override;
-		CommandPtr clone()const override;
+		VkDeviceSize offset;
+		VkDeviceSize size;
+		VkBuffer buffer;
+	};
 
-	private:
-		struct BufferLock
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eMemoryBarrier >
+	{
+		inline CmdT( ArrayView< BufferLock const > uploadBuffers
+			, ArrayView< BufferLock const > downloadBuffers )
+			: cmd{ { OpType::eMemoryBarrier, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, uploadBuffers{ uploadBuffers }
+			, downloadBuffers{ downloadBuffers }
 		{
-			VkDeviceSize offset;
-			VkDeviceSize size;
-			VkBuffer buffer;
-		};
-		using BufferLockArray = std::vector< BufferLock >;
-		BufferLockArray m_uploadBuffers;
-		BufferLockArray m_downloadBuffers;
+		}
+
+		Command cmd;
+		ArrayView< BufferLock const > uploadBuffers;
+		ArrayView< BufferLock const > downloadBuffers;
 	};
+	using CmdMemoryBarrier = CmdT< OpType::eMemoryBarrier >;
+
+	void apply( ExecutionState & state
+		, CmdMemoryBarrier const & cmd );
 }
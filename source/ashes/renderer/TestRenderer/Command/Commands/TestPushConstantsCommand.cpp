@@ -4,32 +4,33 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestPushConstantsCommand.hpp"
 
-#include "Buffer/TestBuffer.hpp"
-#include "Shader/TestShaderModule.hpp"
-
 #include "ashestest_api.hpp"
 
+#include <algorithm>
+
 namespace ashes::test
 {
-	PushConstantsCommand::PushConstantsCommand( VkDevice device
-		, PushConstantsBuffer const & pcb )
-		: CommandBase{ device }
-		, m_pcb{ pcb }
+	namespace
 	{
+		void update( ByteArray & pushConstants
+			, CmdPushConstants const & cmd )
+		{
+			pushConstants.resize( std::max( pushConstants.size(), size_t( cmd.offset + cmd.data.size() ) ) );
+			std::copy( cmd.data.begin(), cmd.data.end(), pushConstants.begin() + cmd.offset );
+		}
 	}
 
-	PushConstantsCommand::PushConstantsCommand( VkDevice device
-		, PushConstantsDesc const & pcb )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdPushConstants const & cmd )
 	{
-	}
+		if ( cmd.stageFlags & VK_SHADER_STAGE_COMPUTE_BIT )
+		{
+			update( state.computePushConstants, cmd );
+		}
 
-	void PushConstantsCommand::apply()const
-	{
-	}
-
-	CommandPtr PushConstantsCommand::clone()const
-	{
-		return std::make_unique< PushConstantsCommand >( *this );
+		if ( cmd.stageFlags & VK_SHADER_STAGE_ALL_GRAPHICS )
+		{
+			update( state.graphics.pushConstants, cmd );
+		}
 	}
 }
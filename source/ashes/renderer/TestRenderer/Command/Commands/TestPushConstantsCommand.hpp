@@ -8,19 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class PushConstantsCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::ePushConstants >
 	{
-	public:
-		PushConstantsCommand( VkDevice device
-			, PushConstantsBuffer const & pcb );
-		PushConstantsCommand( VkDevice device
-			, PushConstantsDesc const & pcb );
+		inline CmdT( VkShaderStageFlags stageFlags
+			, uint32_t offset
+			, ArrayView< uint8_t const > data )
+			: cmd{ { OpType::ePushConstants, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, stageFlags{ stageFlags }
+			, offset{ offset }
+			, data{ data }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		PushConstantsBuffer m_pcb;
+		Command cmd;
+		VkShaderStageFlags stageFlags;
+		uint32_t offset;
+		ArrayView< uint8_t const > data;
 	};
+	using CmdPushConstants = CmdT< OpType::ePushConstants >;
+
+	void apply( ExecutionState & state
+		, CmdPushConstants const & cmd );
 }
@@ -4,21 +4,15 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestResetEventCommand.hpp"
 
-namespace ashes::test
-{
-	ResetEventCommand::ResetEventCommand( VkDevice device
-		, VkEvent
-		, VkPipelineStageFlags )
-		: CommandBase{ device }
-	{
-	}
+#include "Sync/TestEvent.hpp"
 
-	void ResetEventCommand::apply()const
-	{
-	}
+#include "ashestest_api.hpp"
 
-	CommandPtr ResetEventCommand::clone()const
+namespace ashes::test
+{
+	void apply( ExecutionState &
+		, CmdResetEvent const & cmd )
 	{
-		return std::make_unique< ResetEventCommand >( *this );
+		get( cmd.event )->reset();
 	}
 }
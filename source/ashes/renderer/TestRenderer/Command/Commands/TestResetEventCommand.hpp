@@ -8,15 +8,20 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class ResetEventCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eResetEvent >
 	{
-	public:
-		ResetEventCommand( VkDevice device
-			, VkEvent event
-			, VkPipelineStageFlags stageFlags );
+		inline CmdT( VkEvent event )
+			: cmd{ { OpType::eResetEvent, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, event{ event }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkEvent event;
 	};
+	using CmdResetEvent = CmdT< OpType::eResetEvent >;
+
+	void apply( ExecutionState & state
+		, CmdResetEvent const & cmd );
 }
@@ -4,22 +4,15 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestResetQueryPoolCommand.hpp"
 
-namespace ashes::test
-{
-	ResetQueryPoolCommand::ResetQueryPoolCommand( VkDevice device
-		, VkQueryPool pool
-		, uint32_t firstQuery
-		, uint32_t queryCount )
-		: CommandBase{ device }
-	{
-	}
+#include "Miscellaneous/TestQueryPool.hpp"
 
-	void ResetQueryPoolCommand::apply()const
-	{
-	}
+#include "ashestest_api.hpp"
 
-	CommandPtr ResetQueryPoolCommand::clone()const
+namespace ashes::test
+{
+	void apply( ExecutionState &
+		, CmdResetQueryPool const & cmd )
 	{
-		return std::make_unique< ResetQueryPoolCommand >( *this );
+		get( cmd.pool )->reset( cmd.firstQuery, cmd.queryCount );
 	}
 }
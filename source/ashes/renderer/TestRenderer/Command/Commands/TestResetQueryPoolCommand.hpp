@@ -8,16 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class ResetQueryPoolCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eResetQueryPool >
 	{
-	public:
-		ResetQueryPoolCommand( VkDevice device
-			, VkQueryPool pool
+		inline CmdT( VkQueryPool pool
 			, uint32_t firstQuery
-			, uint32_t queryCount );
+			, uint32_t queryCount )
+			: cmd{ { OpType::eResetQueryPool, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, pool{ pool }
+			, firstQuery{ firstQuery }
+			, queryCount{ queryCount }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkQueryPool pool;
+		uint32_t firstQuery;
+		uint32_t queryCount;
 	};
+	using CmdResetQueryPool = CmdT< OpType::eResetQueryPool >;
+
+	void apply( ExecutionState & state
+		, CmdResetQueryPool const & cmd );
 }
@@ -4,23 +4,17 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestScissorCommand.hpp"
 
-#include "Core/TestDevice.hpp"
+#include "ashestest_api.hpp"
+
+#include <algorithm>
 
 namespace ashes::test
 {
-	ScissorCommand::ScissorCommand( VkDevice device
-		, uint32_t first
-		, VkScissorArray const & scissors )
-		: CommandBase{ device }
-	{
-	}
-
-	void ScissorCommand::apply()const
-	{
-	}
-
-	CommandPtr ScissorCommand::clone()const
+	void apply( ExecutionState & state
+		, CmdScissor const & cmd )
 	{
-		return std::make_unique< ScissorCommand >( *this );
+		auto & scissors = state.graphics.scissors;
+		scissors.resize( std::max( scissors.size(), size_t( cmd.first + cmd.scissors.size() ) ) );
+		std::copy( cmd.scissors.begin(), cmd.scissors.end(), scissors.begin() + cmd.first );
 	}
 }
@@ -8,15 +8,23 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class ScissorCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eScissor >
 	{
-	public:
-		ScissorCommand( VkDevice device
-			, uint32_t first
-			, VkScissorArray const & scissors );
+		inline CmdT( uint32_t first
+			, ArrayView< VkRect2D const > scissors )
+			: cmd{ { OpType::eScissor, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, first{ first }
+			, scissors{ scissors }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		uint32_t first;
+		ArrayView< VkRect2D const > scissors;
 	};
+	using CmdScissor = CmdT< OpType::eScissor >;
+
+	void apply( ExecutionState & state
+		, CmdScissor const & cmd );
 }
@@ -0,0 +1,16 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Command/Commands/TestSetBlendConstantsCommand.hpp"
+
+#include "ashestest_api.hpp"
+
+namespace ashes::test
+{
+	void apply( ExecutionState & state
+		, CmdSetBlendConstants const & cmd )
+	{
+		state.graphics.blendConstants = cmd.blendConstants;
+	}
+}
@@ -0,0 +1,27 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/Command/Commands/TestCommandBase.hpp"
+
+namespace ashes::test
+{
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eSetBlendConstants >
+	{
+		inline CmdT( std::array< float, 4u > blendConstants )
+			: cmd{ { OpType::eSetBlendConstants, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, blendConstants{ blendConstants }
+		{
+		}
+
+		Command cmd;
+		std::array< float, 4u > blendConstants;
+	};
+	using CmdSetBlendConstants = CmdT< OpType::eSetBlendConstants >;
+
+	void apply( ExecutionState & state
+		, CmdSetBlendConstants const & cmd );
+}
@@ -4,22 +4,12 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestSetDepthBiasCommand.hpp"
 
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	SetDepthBiasCommand::SetDepthBiasCommand( VkDevice device
-		, float
-		, float
-		, float )
-		: CommandBase{ device }
-	{
-	}
-
-	void SetDepthBiasCommand::apply()const
-	{
-	}
-
-	CommandPtr SetDepthBiasCommand::clone()const
+	void apply( ExecutionState &
+		, CmdSetDepthBias const & )
 	{
-		return std::make_unique< SetDepthBiasCommand >( *this );
 	}
 }
@@ -8,16 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class SetDepthBiasCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eSetDepthBias >
 	{
-	public:
-		SetDepthBiasCommand( VkDevice device
-			, float constantFactor
+		inline CmdT( float constantFactor
 			, float clamp
-			, float slopeFactor );
+			, float slopeFactor )
+			: cmd{ { OpType::eSetDepthBias, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, constantFactor{ constantFactor }
+			, clamp{ clamp }
+			, slopeFactor{ slopeFactor }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		float constantFactor;
+		float clamp;
+		float slopeFactor;
 	};
+	using CmdSetDepthBias = CmdT< OpType::eSetDepthBias >;
+
+	void apply( ExecutionState & state
+		, CmdSetDepthBias const & cmd );
 }
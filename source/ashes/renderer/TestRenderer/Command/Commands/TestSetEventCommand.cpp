@@ -10,21 +10,9 @@ See LICENSE file in root folder.
 
 namespace ashes::test
 {
-	SetEventCommand::SetEventCommand( VkDevice device
-		, VkEvent event
-		, VkPipelineStageFlags stageFlags )
-		: CommandBase{ device }
-		, m_event{ event }
+	void apply( ExecutionState &
+		, CmdSetEvent const & cmd )
 	{
-	}
-
-	void SetEventCommand::apply()const
-	{
-		get( m_event )->reset();
-	}
-
-	CommandPtr SetEventCommand::clone()const
-	{
-		return std::make_unique< SetEventCommand >( *this );
+		get( cmd.event )->set();
 	}
 }
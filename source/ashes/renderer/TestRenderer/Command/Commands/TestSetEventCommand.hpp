@@ -8,18 +8,20 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class SetEventCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eSetEvent >
 	{
-	public:
-		SetEventCommand( VkDevice device
-			, VkEvent event
-			, VkPipelineStageFlags stageFlags );
+		inline CmdT( VkEvent event )
+			: cmd{ { OpType::eSetEvent, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, event{ event }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		VkEvent m_event;
+		Command cmd;
+		VkEvent event;
 	};
+	using CmdSetEvent = CmdT< OpType::eSetEvent >;
+
+	void apply( ExecutionState & state
+		, CmdSetEvent const & cmd );
 }
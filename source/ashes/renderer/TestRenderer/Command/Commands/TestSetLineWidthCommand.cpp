@@ -4,20 +4,12 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestSetLineWidthCommand.hpp"
 
+#include "ashestest_api.hpp"
+
 namespace ashes::test
 {
-	SetLineWidthCommand::SetLineWidthCommand( VkDevice device
-		, float )
-		: CommandBase{ device }
-	{
-	}
-
-	void SetLineWidthCommand::apply()const
-	{
-	}
-
-	CommandPtr SetLineWidthCommand::clone()const
+	void apply( ExecutionState &
+		, CmdSetLineWidth const & )
 	{
-		return std::make_unique< SetLineWidthCommand >( *this );
 	}
 }
@@ -8,14 +8,20 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class SetLineWidthCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eSetLineWidth >
 	{
-	public:
-		SetLineWidthCommand( VkDevice device
-			, float width );
+		inline CmdT( float width )
+			: cmd{ { OpType::eSetLineWidth, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, width{ width }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		float width;
 	};
+	using CmdSetLineWidth = CmdT< OpType::eSetLineWidth >;
+
+	void apply( ExecutionState & state
+		, CmdSetLineWidth const & cmd );
 }
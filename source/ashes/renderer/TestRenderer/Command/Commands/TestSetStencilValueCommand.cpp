@@ -0,0 +1,30 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Command/Commands/TestSetStencilValueCommand.hpp"
+
+#include "ashestest_api.hpp"
+
+namespace ashes::test
+{
+	void apply( ExecutionState & state
+		, CmdSetStencilValue const & cmd )
+	{
+		auto & faces = ( cmd.value == StencilValue::eCompareMask
+			? state.graphics.stencilCompareMasks
+			: ( cmd.value == StencilValue::eWriteMask
+				? state.graphics.stencilWriteMasks
+				: state.graphics.stencilReferences ) );
+
+		if ( checkFlag( cmd.faceMask, VK_STENCIL_FACE_FRONT_BIT ) )
+		{
+			faces[0] = cmd.data;
+		}
+
+		if ( checkFlag( cmd.faceMask, VK_STENCIL_FACE_BACK_BIT ) )
+		{
+			faces[1] = cmd.data;
+		}
+	}
+}
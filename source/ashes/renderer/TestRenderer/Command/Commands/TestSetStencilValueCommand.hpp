@@ -0,0 +1,41 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/Command/Commands/TestCommandBase.hpp"
+
+namespace ashes::test
+{
+	enum class StencilValue
+		: uint32_t
+	{
+		eCompareMask,
+		eWriteMask,
+		eReference,
+	};
+
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eSetStencilValue >
+	{
+		inline CmdT( StencilValue value
+			, VkStencilFaceFlags faceMask
+			, uint32_t data )
+			: cmd{ { OpType::eSetStencilValue, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, value{ value }
+			, faceMask{ faceMask }
+			, data{ data }
+		{
+		}
+
+		Command cmd;
+		StencilValue value;
+		VkStencilFaceFlags faceMask;
+		uint32_t data;
+	};
+	using CmdSetStencilValue = CmdT< OpType::eSetStencilValue >;
+
+	void apply( ExecutionState & state
+		, CmdSetStencilValue const & cmd );
+}
@@ -0,0 +1,25 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Command/Commands/TestUpdateBufferCommand.hpp"
+
+#include "Buffer/TestBuffer.hpp"
+#include "Core/TestDevice.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
+#include "Miscellaneous/TestTransferKernels.hpp"
+
+#include "ashestest_api.hpp"
+
+namespace ashes::test
+{
+	void apply( ExecutionState & state
+		, CmdUpdateBuffer const & cmd )
+	{
+		auto buffer = get( cmd.dstBuffer );
+		copyMemory( get( buffer->getMemory() )->getData( buffer->getMemoryOffset() + cmd.dstOffset )
+			, cmd.data.data()
+			, cmd.data.size() );
+		get( state.device )->getGpuClock().chargeTransfer( cmd.data.size() );
+	}
+}
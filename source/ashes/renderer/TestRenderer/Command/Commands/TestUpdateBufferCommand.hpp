@@ -0,0 +1,33 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/Command/Commands/TestCommandBase.hpp"
+
+namespace ashes::test
+{
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eUpdateBuffer >
+	{
+		inline CmdT( VkBuffer dstBuffer
+			, VkDeviceSize dstOffset
+			, ArrayView< uint8_t const > data )
+			: cmd{ { OpType::eUpdateBuffer, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, dstBuffer{ dstBuffer }
+			, dstOffset{ dstOffset }
+			, data{ data }
+		{
+		}
+
+		Command cmd;
+		VkBuffer dstBuffer;
+		VkDeviceSize dstOffset;
+		ArrayView< uint8_t const > data;
+	};
+	using CmdUpdateBuffer = CmdT< OpType::eUpdateBuffer >;
+
+	void apply( ExecutionState & state
+		, CmdUpdateBuffer const & cmd );
+}
@@ -10,25 +10,11 @@ See LICENSE file in root folder.
 
 namespace ashes::test
 {
-	UploadMemoryCommand::UploadMemoryCommand( VkDevice device
-		, ObjectMemory const * memory
-		, VkDeviceSize offset
-		, VkDeviceSize size )
-		: CommandBase{ device }
-		, m_memory{ memory }
-		, m_range{ offset, size }
+	void apply( ExecutionState &
+		, CmdUploadMemory const & cmd )
 	{
-	}
-
-	void UploadMemoryCommand::apply()const
-	{
-		get( m_memory->deviceMemory )->updateUpload( *m_memory
-			, m_range.first
-			, m_range.second );
-	}
-
-	CommandPtr UploadMemoryCommand::clone()const
-	{
-		return std::make_unique< UploadMemoryCommand >( *this );
+		get( cmd.memory->deviceMemory )->updateUpload( *cmd.memory
+			, cmd.offset
+			, cmd.size );
 	}
 }
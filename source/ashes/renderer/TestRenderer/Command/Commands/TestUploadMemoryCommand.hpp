@@ -8,20 +8,26 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class UploadMemoryCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eUploadMemory >
 	{
-	public:
-		UploadMemoryCommand( VkDevice device
-			, ObjectMemory const * memory
+		inline CmdT( ObjectMemory const * memory
 			, VkDeviceSize offset
-			, VkDeviceSize size );
+			, VkDeviceSize size )
+			: cmd{ { OpType::eUploadMemory, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, memory{ memory }
+			, offset{ offset }
+			, size{ size }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		ObjectMemory const * m_memory;
-		std::pair< VkDeviceSize, VkDeviceSize > m_range;
+		Command cmd;
+		ObjectMemory const * memory;
+		VkDeviceSize offset;
+		VkDeviceSize size;
 	};
+	using CmdUploadMemory = CmdT< OpType::eUploadMemory >;
+
+	void apply( ExecutionState & state
+		, CmdUploadMemory const & cmd );
 }
@@ -4,21 +4,17 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestViewportCommand.hpp"
 
-namespace ashes::test
-{
-	ViewportCommand::ViewportCommand( VkDevice device
-		, uint32_t first
-		, VkViewportArray const & viewports )
-		: CommandBase{ device }
-	{
-	}
+#include "ashestest_api.hpp"
 
-	void ViewportCommand::apply()const
-	{
-	}
+#include <algorithm>
 
-	CommandPtr ViewportCommand::clone()const
+namespace ashes::test
+{
+	void apply( ExecutionState & state
+		, CmdViewport const & cmd )
 	{
-		return std::make_unique< ViewportCommand >( *this );
+		auto & viewports = state.graphics.viewports;
+		viewports.resize( std::max( viewports.size(), size_t( cmd.first + cmd.viewports.size() ) ) );
+		std::copy( cmd.viewports.begin(), cmd.viewports.end(), viewports.begin() + cmd.first );
 	}
 }
@@ -8,15 +8,23 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class ViewportCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eViewport >
 	{
-	public:
-		ViewportCommand( VkDevice device
-			, uint32_t first
-			, VkViewportArray const & viewports );
+		inline CmdT( uint32_t first
+			, ArrayView< VkViewport const > viewports )
+			: cmd{ { OpType::eViewport, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, first{ first }
+			, viewports{ viewports }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		uint32_t first;
+		ArrayView< VkViewport const > viewports;
 	};
+	using CmdViewport = CmdT< OpType::eViewport >;
+
+	void apply( ExecutionState & state
+		, CmdViewport const & cmd );
 }
@@ -8,21 +8,20 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class WaitEventsCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eWaitEvents >
 	{
-	public:
-		WaitEventsCommand( VkDevice device
-			, VkEventArray const & events
-			, VkPipelineStageFlags srcStageMask
-			, VkPipelineStageFlags dstStageMask
-			, VkBufferMemoryBarrierArray const & bufferMemoryBarriers
-			, VkImageMemoryBarrierArray const & imageMemoryBarriers );
+		inline CmdT( ArrayView< VkEvent const > events )
+			: cmd{ { OpType::eWaitEvents, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, events{ events }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
-
-	private:
-		VkEventArray m_events;
+		Command cmd;
+		ArrayView< VkEvent const > events;
 	};
+	using CmdWaitEvents = CmdT< OpType::eWaitEvents >;
+
+	void apply( ExecutionState & state
+		, CmdWaitEvents const & cmd );
 }
@@ -4,26 +4,19 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/TestWriteTimestampCommand.hpp"
 
+#include "Core/TestDevice.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
 #include "Miscellaneous/TestQueryPool.hpp"
 
 #include "ashestest_api.hpp"
 
 namespace ashes::test
 {
-	WriteTimestampCommand::WriteTimestampCommand( VkDevice device
-		, VkPipelineStageFlagBits pipelineStage
-		, VkQueryPool pool
-		, uint32_t query )
-		: CommandBase{ device }
+	void apply( ExecutionState & state
+		, CmdWriteTimestamp const & cmd )
 	{
-	}
-
-	void WriteTimestampCommand::apply()const
-	{
-	}
-
-	CommandPtr WriteTimestampCommand::clone()const
-	{
-		return std::make_unique< WriteTimestampCommand >( *this );
+		// The commands execute in order, so all the stages have reached the timestamp.
+		get( cmd.pool )->writeTimestamp( cmd.query
+			, get( state.device )->getGpuClock().getTime() );
 	}
 }
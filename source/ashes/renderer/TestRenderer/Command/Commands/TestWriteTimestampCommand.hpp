@@ -8,16 +8,23 @@ See LICENSE file in root folder
 
 namespace ashes::test
 {
-	class WriteTimestampCommand
-		: public CommandBase
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eWriteTimestamp >
 	{
-	public:
-		WriteTimestampCommand( VkDevice device
-			, VkPipelineStageFlagBits pipelineStage
-			, VkQueryPool pool
-			, uint32_t query );
+		inline CmdT( VkQueryPool pool
+			, uint32_t query )
+			: cmd{ { OpType::eWriteTimestamp, sizeof( CmdT ) / sizeof( uint32_t ) } }
+			, pool{ pool }
+			, query{ query }
+		{
+		}
 
-		void apply()const override;
-		CommandPtr clone()const override;
+		Command cmd;
+		VkQueryPool pool;
+		uint32_t query;
 	};
+	using CmdWriteTimestamp = CmdT< OpType::eWriteTimestamp >;
+
+	void apply( ExecutionState & state
+		, CmdWriteTimestamp const & cmd );
 }
@@ -0,0 +1,82 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Command/TestCommandArena.hpp"
+
+#include <algorithm>
+
+namespace ashes::test
+{
+	//*********************************************************************************************
+
+	CommandArena::Block CommandArena::acquire( size_t size )
+	{
+		if ( size <= BlockSize
+			&& !m_free.empty() )
+		{
+			auto result = std::move( m_free.back() );
+			m_free.pop_back();
+			result.used = 0u;
+			return result;
+		}
+
+		auto capacity = std::max( size, BlockSize );
+		return { std::unique_ptr< uint8_t[] >( new uint8_t[capacity] ), capacity, 0u };
+	}
+
+	void CommandArena::release( Block block )
+	{
+		if ( block.capacity == BlockSize )
+		{
+			m_free.push_back( std::move( block ) );
+		}
+	}
+
+	void CommandArena::trim()
+	{
+		m_free.clear();
+		m_free.shrink_to_fit();
+	}
+
+	//*********************************************************************************************
+
+	CommandStream::CommandStream( CommandArena & arena )
+		: m_arena{ arena }
+	{
+	}
+
+	CommandStream::~CommandStream()
+	{
+		clear();
+	}
+
+	void CommandStream::clear()
+	{
+		for ( auto & block : m_blocks )
+		{
+			m_arena.release( std::move( block ) );
+		}
+
+		m_blocks.clear();
+		m_count = 0u;
+	}
+
+	void * CommandStream::allocate( size_t size )
+	{
+		size = ( size + Alignment - 1u ) & ~( Alignment - 1u );
+
+		if ( m_blocks.empty()
+			|| m_blocks.back().used + size > m_blocks.back().capacity )
+		{
+			m_blocks.push_back( m_arena.acquire( size ) );
+		}
+
+		auto & block = m_blocks.back();
+		auto result = block.data.get() + block.used;
+		block.used += size;
+		return result;
+	}
+
+	//*********************************************************************************************
+}
@@ -0,0 +1,137 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace ashes::test
+{
+	/**
+	*\brief
+	*	The memory blocks the command buffers of a command pool record into.
+	*\remarks
+	*	The blocks are recycled from a recording to the next, so that recording doesn't allocate once warm.
+	*	Like the command pool, it is externally synchronised.
+	*/
+	class CommandArena
+	{
+	public:
+		static size_t constexpr BlockSize = 64u * 1024u;
+
+		struct Block
+		{
+			std::unique_ptr< uint8_t[] > data;
+			size_t capacity{};
+			size_t used{};
+		};
+
+	public:
+		/**
+		*\brief
+		*	Gives a block of at least the given size, recycled when the size fits in a default block.
+		*/
+		Block acquire( size_t size );
+		/**
+		*\brief
+		*	Gives a block back, only the default sized ones are kept for recycling.
+		*/
+		void release( Block block );
+		/**
+		*\brief
+		*	Frees the recycled blocks.
+		*/
+		void trim();
+
+	private:
+		std::vector< Block > m_free;
+	};
+	/**
+	*\brief
+	*	An append only sequence of commands, or of their data, stored in the blocks of a command arena.
+	*\remarks
+	*	What is written in it never moves until it is cleared, so the commands can point to their data.
+	*	It only holds trivially destructible types, which are dropped without being destroyed.
+	*/
+	class CommandStream
+	{
+	public:
+		explicit CommandStream( CommandArena & arena );
+		~CommandStream();
+		CommandStream( CommandStream const & ) = delete;
+		CommandStream & operator=( CommandStream const & ) = delete;
+
+		/**
+		*\brief
+		*	Gives the blocks back to the arena.
+		*/
+		void clear();
+		/**
+		*\return
+		*	The given size of uninitialised memory, aligned on 8 bytes.
+		*/
+		void * allocate( size_t size );
+
+		template< typename ValueT, typename ... ParamsT >
+		ValueT & push( ParamsT && ... params )
+		{
+			static_assert( std::is_trivially_destructible_v< ValueT > );
+			static_assert( alignof( ValueT ) <= Alignment );
+			++m_count;
+			return *new( allocate( sizeof( ValueT ) ) ) ValueT{ std::forward< ParamsT >( params )... };
+		}
+
+		template< typename ValueT >
+		ArrayView< ValueT const > pushArray( ValueT const * values
+			, size_t count )
+		{
+			static_assert( std::is_trivially_copyable_v< ValueT > );
+			static_assert( alignof( ValueT ) <= Alignment );
+
+			if ( !count )
+			{
+				return {};
+			}
+
+			auto result = static_cast< ValueT * >( allocate( count * sizeof( ValueT ) ) );
+			std::memcpy( result, values, count * sizeof( ValueT ) );
+			return { result, result + count };
+		}
+		/**
+		*\brief
+		*	Walks the commands, which must start with their Command header, in recording order.
+		*/
+		template< typename CommandT, typename FuncT >
+		void forEach( FuncT const & func )const
+		{
+			for ( auto & block : m_blocks )
+			{
+				size_t offset{};
+
+				while ( offset < block.used )
+				{
+					auto & command = *reinterpret_cast< CommandT const * >( block.data.get() + offset );
+					offset += command.op.size * sizeof( uint32_t );
+					func( command );
+				}
+			}
+		}
+
+		inline size_t getCount()const
+		{
+			return m_count;
+		}
+
+	private:
+		static size_t constexpr Alignment = alignof( uint64_t );
+
+		CommandArena & m_arena;
+		std::vector< CommandArena::Block > m_blocks;
+		size_t m_count{};
+	};
+}
@@ -21,11 +21,11 @@ See LICENSE file in root folder.
 #include "Command/Commands/TestBeginQueryCommand.hpp"
 #include "Command/Commands/TestBeginRenderPassCommand.hpp"
 #include "Command/Commands/TestBeginSubpassCommand.hpp"
-#include "Command/Commands/TestBindComputePipelineCommand.hpp"
 #include "Command/Commands/TestBindDescriptorSetCommand.hpp"
 #include "Command/Commands/TestBindIndexBufferCommand.hpp"
-#include "Command/Commands/TestBindVertexBuffersCommand.hpp"
 #include "Command/Commands/TestBindPipelineCommand.hpp"
+#include "Command/Commands/TestBindVertexBuffersCommand.hpp"
+#include "Command/Commands/TestBlitImageCommand.hpp"
 #include "Command/Commands/TestClearAttachmentsCommand.hpp"
 #include "Command/Commands/TestClearColourCommand.hpp"
 #include "Command/Commands/TestClearDepthStencilCommand.hpp"
@@ -43,17 +43,20 @@ See LICENSE file in root folder.
 #include "Command/Commands/TestEndQueryCommand.hpp"
 #include "Command/Commands/TestEndRenderPassCommand.hpp"
 #include "Command/Commands/TestEndSubpassCommand.hpp"
-#include "Command/Commands/TestExecuteActionsCommand.hpp"
 #include "Command/Commands/TestExecuteCommandsCommand.hpp"
+#include "Command/Commands/TestFillBufferCommand.hpp"
 #include "Command/Commands/TestGenerateMipsCommand.hpp"
 #include "Command/Commands/TestMemoryBarrierCommand.hpp"
 #include "Command/Commands/TestPushConstantsCommand.hpp"
 #include "Command/Commands/TestResetEventCommand.hpp"
 #include "Command/Commands/TestResetQueryPoolCommand.hpp"
 #include "Command/Commands/TestScissorCommand.hpp"
+#include "Command/Commands/TestSetBlendConstantsCommand.hpp"
 #include "Command/Commands/TestSetDepthBiasCommand.hpp"
 #include "Command/Commands/TestSetEventCommand.hpp"
 #include "Command/Commands/TestSetLineWidthCommand.hpp"
+#include "Command/Commands/TestSetStencilValueCommand.hpp"
+#include "Command/Commands/TestUpdateBufferCommand.hpp"
 #include "Command/Commands/TestUploadMemoryCommand.hpp"
 #include "Command/Commands/TestViewportCommand.hpp"
 #include "Command/Commands/TestWaitEventsCommand.hpp"
@@ -61,6 +64,8 @@ See LICENSE file in root folder.
 
 #include "ashestest_api.hpp"
 
+#include <algorithm>
+
 namespace ashes::test
 {
 	//*********************************************************************************************
@@ -73,6 +78,13 @@ namespace ashes::test
 			return ( uint64_t( src ) << 32 )
 				| ( uint64_t( dst ) << 0 );
 		}
+
+		template< typename ValueT >
+		ArrayView< ValueT const > makeView( ValueT const * values
+			, size_t count )
+		{
+			return { values, values + count };
+		}
 	}
 
 	//*********************************************************************************************
@@ -82,6 +94,8 @@ namespace ashes::test
 		, bool primary )
 		: m_device{ device }
 		, m_commandPool{ commandPool }
+		, m_commands{ get( commandPool )->getArena() }
+		, m_data{ get( commandPool )->getArena() }
 	{
 		get( commandPool )->registerCommands( get( this ) );
 	}
@@ -92,22 +106,22 @@ namespace ashes::test
 
 	void CommandBuffer::execute()const
 	{
-		for ( auto & command : m_commands )
-		{
-			command->apply();
-		}
+		ExecutionState state;
+		state.device = m_device;
+		execute( state );
+	}
 
-		for ( auto & action : m_afterSubmitActions )
-		{
-			action();
-		}
+	void CommandBuffer::execute( ExecutionState & state )const
+	{
+		m_commands.forEach< Command >( [&state]( Command const & command )
+			{
+				applyCmd( state, command );
+			} );
 	}
 
 	VkResult CommandBuffer::begin( VkCommandBufferBeginInfo info )const
 	{
-		m_commands.clear();
-		m_mappedResources.clear();
-		m_afterSubmitActions.clear();
+		doClear();
 		m_state = State{};
 		m_state.beginInfo = std::move( info );
 		return VK_SUCCESS;
@@ -115,71 +129,47 @@ namespace ashes::test
 
 	VkResult CommandBuffer::end()const
 	{
-		m_state.pushConstantBuffers.clear();
 		return VK_SUCCESS;
 	}
 
 	VkResult CommandBuffer::reset( VkCommandBufferResetFlags flags )const
 	{
-		m_commands.clear();
+		doClear();
 		return VK_SUCCESS;
 	}
 
 	void CommandBuffer::beginRenderPass( VkRenderPassBeginInfo beginInfo
 		, VkSubpassContents contents )const
 	{
-		m_state.currentRenderPass = beginInfo.renderPass;
-		m_state.currentFrameBuffer = beginInfo.framebuffer;
 		m_state.currentSubpassIndex = 0u;
-		m_state.currentSubpass = &get( m_state.currentRenderPass )->getSubpasses()[m_state.currentSubpassIndex++];
 		m_state.vbos.clear();
-		m_commands.emplace_back( std::make_unique< BeginRenderPassCommand >( m_device
-			, m_state.currentRenderPass
-			, m_state.currentFrameBuffer
-			, VkClearValueArray{ beginInfo.pClearValues, beginInfo.pClearValues + beginInfo.clearValueCount } ) );
-		m_commands.emplace_back( std::make_unique< BeginSubpassCommand >( m_device
-			, m_state.currentRenderPass
-			, m_state.currentFrameBuffer
-			, *m_state.currentSubpass ) );
+		m_commands.push< CmdBeginRenderPass >( beginInfo.renderPass
+			, beginInfo.framebuffer
+			, beginInfo.renderArea
+			, m_data.pushArray( beginInfo.pClearValues, beginInfo.clearValueCount ) );
+		m_commands.push< CmdBeginSubpass >( m_state.currentSubpassIndex );
 	}
 
 	void CommandBuffer::nextSubpass( VkSubpassContents contents )const
 	{
-		m_commands.emplace_back( std::make_unique< EndSubpassCommand >( m_device
-			, m_state.currentFrameBuffer
-			, *m_state.currentSubpass ) );
-		m_state.currentSubpass = &get( m_state.currentRenderPass )->getSubpasses()[m_state.currentSubpassIndex++];
-		m_commands.emplace_back( std::make_unique< BeginSubpassCommand >( m_device
-			, m_state.currentRenderPass
-			, m_state.currentFrameBuffer
-			, *m_state.currentSubpass ) );
+		m_commands.push< CmdEndSubpass >();
+		m_commands.push< CmdBeginSubpass >( ++m_state.currentSubpassIndex );
 		m_state.vbos.clear();
 	}
 
 	void CommandBuffer::endRenderPass()const
 	{
-		m_commands.emplace_back( std::make_unique< EndSubpassCommand >( m_device
-			, m_state.currentFrameBuffer
-			, *m_state.currentSubpass ) );
-		m_commands.emplace_back( std::make_unique< EndRenderPassCommand >( m_device
-			, m_state.currentRenderPass
-			, m_state.currentFrameBuffer ) );
+		m_commands.push< CmdEndSubpass >();
+		m_commands.push< CmdEndRenderPass >();
 		m_state.vbos.clear();
 	}
 
 	void CommandBuffer::executeCommands( VkCommandBufferArray commands )const
 	{
+		// The secondary command buffers are executed in place, their commands aren't copied.
 		for ( auto & commandBuffer : commands )
 		{
-			auto & dxCommandBuffer = *get( commandBuffer );
-
-			for ( auto & command : dxCommandBuffer.getCommands() )
-			{
-				m_commands.emplace_back( command->clone() );
-			}
-
-			m_commands.emplace_back( std::make_unique< ExecuteActionsCommand >( m_device
-				, dxCommandBuffer.m_afterSubmitActions ) );
+			m_commands.push< CmdExecuteCommands >( commandBuffer );
 		}
 	}
 
@@ -188,10 +178,9 @@ namespace ashes::test
 		, VkClearColorValue colour
 		, VkImageSubresourceRangeArray ranges )const
 	{
-		m_commands.emplace_back( std::make_unique< ClearColourCommand >( m_device
-			, image
-			, ranges
-			, colour ) );
+		m_commands.push< CmdClearColour >( image
+			, m_data.pushArray( ranges.data(), ranges.size() )
+			, colour );
 	}
 
 	void CommandBuffer::clearDepthStencilImage( VkImage image
@@ -199,21 +188,16 @@ namespace ashes::test
 		, VkClearDepthStencilValue value
 		, VkImageSubresourceRangeArray ranges )const
 	{
-		m_commands.emplace_back( std::make_unique< ClearDepthStencilCommand >( m_device
-			, image
-			, ranges
-			, value ) );
+		m_commands.push< CmdClearDepthStencil >( image
+			, m_data.pushArray( ranges.data(), ranges.size() )
+			, value );
 	}
 
 	void CommandBuffer::clearAttachments( VkClearAttachmentArray clearAttachments
 		, VkClearRectArray clearRects )
 	{
-		m_commands.emplace_back( std::make_unique< ClearAttachmentsCommand >( m_device
-			, m_state.currentRenderPass
-			, *m_state.currentSubpass
-			, m_state.currentFrameBuffer
-			, clearAttachments
-			, clearRects ) );
+		m_commands.push< CmdClearAttachments >( m_data.pushArray( clearAttachments.data(), clearAttachments.size() )
+			, m_data.pushArray( clearRects.data(), clearRects.size() ) );
 	}
 
 	void CommandBuffer::bindPipeline( VkPipeline pipeline
@@ -233,38 +217,10 @@ namespace ashes::test
 			}
 
 			m_state.currentPipeline = pipeline;
-			m_commands.emplace_back( std::make_unique< BindPipelineCommand >( m_device
-				, pipeline
-				, bindingPoint ) );
-			doAddAfterSubmitAction();
-
-			for ( auto & pcb : m_state.pushConstantBuffers )
-			{
-				m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_device
-					, pcb.second ) );
-				doAddAfterSubmitAction();
-			}
-
-			m_state.pushConstantBuffers.clear();
-		}
-		else
-		{
-			m_state.currentComputePipeline = pipeline;
-			m_commands.emplace_back( std::make_unique< BindComputePipelineCommand >( m_device
-				, pipeline
-				, bindingPoint ) );
-			doAddAfterSubmitAction();
-
-			for ( auto & pcb : m_state.pushConstantBuffers )
-			{
-				m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_device
-					, pcb.second ) );
-				doAddAfterSubmitAction();
-			}
-
-			m_state.pushConstantBuffers.clear();
 		}
 
+		m_commands.push< CmdBindPipeline >( pipeline
+			, bindingPoint );
 		auto it = m_state.boundDescriptors.end();
 
 		for ( auto & layout : get( pipeline )->getDescriptorsLayouts() )
@@ -298,20 +254,18 @@ namespace ashes::test
 		}
 
 		m_state.vbos.push_back( binding );
-		doAddAfterSubmitAction();
+		m_commands.push< CmdBindVertexBuffers >( firstBinding
+			, m_data.pushArray( buffers.data(), buffers.size() )
+			, m_data.pushArray( offsets.data(), offsets.size() ) );
 	}
 
 	void CommandBuffer::bindIndexBuffer( VkBuffer buffer
 		, uint64_t offset
 		, VkIndexType indexType )const
 	{
-		m_commands.emplace_back( std::make_unique< BindIndexBufferCommand >( m_device
-			, static_cast< VkBuffer >( buffer )
+		m_commands.push< CmdBindIndexBuffer >( buffer
 			, offset
-			, indexType ) );
-		doAddAfterSubmitAction();
-		m_state.indexType = indexType;
-		m_state.newlyBoundIbo = buffer;
+			, indexType );
 	}
 
 	void CommandBuffer::bindDescriptorSets( VkPipelineBindPoint bindingPoint
@@ -320,29 +274,30 @@ namespace ashes::test
 		, VkDescriptorSetArray descriptorSets
 		, UInt32Array dynamicOffsets )const
 	{
+		m_commands.push< CmdBindDescriptorSets >( bindingPoint
+			, firstSet
+			, m_data.pushArray( descriptorSets.data(), descriptorSets.size() )
+			, m_data.pushArray( dynamicOffsets.data(), dynamicOffsets.size() ) );
+
 		for ( auto & descriptorSet : descriptorSets )
 		{
 			m_state.boundDescriptors.push_back( descriptorSet );
 			doProcessMappedBoundDescriptorResourcesIn( descriptorSet );
-			m_commands.emplace_back( std::make_unique< BindDescriptorSetCommand >( m_device
-				, descriptorSet
-				, layout
-				, dynamicOffsets
-				, bindingPoint ) );
-			doAddAfterSubmitAction();
 		}
 	}
 
 	void CommandBuffer::setViewport( uint32_t firstViewport
 		, VkViewportArray viewports )const
 	{
-		m_commands.emplace_back( std::make_unique< ViewportCommand >( m_device, firstViewport, viewports ) );
+		m_commands.push< CmdViewport >( firstViewport
+			, m_data.pushArray( viewports.data(), viewports.size() ) );
 	}
 
 	void CommandBuffer::setScissor( uint32_t firstScissor
 		, VkScissorArray scissors )const
 	{
-		m_commands.emplace_back( std::make_unique< ScissorCommand >( m_device, firstScissor, scissors ) );
+		m_commands.push< CmdScissor >( firstScissor
+			, m_data.pushArray( scissors.data(), scissors.size() ) );
 	}
 
 	void CommandBuffer::draw( uint32_t vtxCount
@@ -350,34 +305,11 @@ namespace ashes::test
 		, uint32_t firstVertex
 		, uint32_t firstInstance )const
 	{
-		doFillVboStrides();
-
-		if ( !get( m_state.currentPipeline )->hasVertexLayout() )
-		{
-			bindIndexBuffer( get( m_device )->getEmptyIndexedVaoIdx(), 0u, VK_INDEX_TYPE_UINT32 );
-			doProcessMappedBoundVaoBuffersIn();
-			m_commands.emplace_back( std::make_unique< DrawIndexedCommand >( m_device
-				, vtxCount
-				, instCount
-				, 0u
-				, firstVertex
-				, firstInstance
-				, get( m_state.currentPipeline )->getInputAssemblyState().topology
-				, m_state.indexType
-				, m_state.vbos ) );
-		}
-		else
-		{
-			doProcessMappedBoundVaoBuffersIn();
-			m_commands.emplace_back( std::make_unique< DrawCommand >( m_device
-				, vtxCount
-				, instCount
-				, firstVertex
-				, firstInstance
-				, get( m_state.currentPipeline )->getInputAssemblyState().topology
-				, m_state.vbos ) );
-		}
-
+		doProcessMappedBoundVaoBuffersIn();
+		m_commands.push< CmdDraw >( VkDrawIndirectCommand{ vtxCount
+			, instCount
+			, firstVertex
+			, firstInstance } );
 		doProcessMappedBoundDescriptorsResourcesOut();
 	}
 
@@ -387,25 +319,13 @@ namespace ashes::test
 		, uint32_t vertexOffset
 		, uint32_t firstInstance )const
 	{
-		if ( !get( m_state.currentPipeline )->hasVertexLayout()
-			&& m_state.newlyBoundIbo == nullptr )
-		{
-			bindIndexBuffer( get( m_device )->getEmptyIndexedVaoIdx(), 0u, VK_INDEX_TYPE_UINT32 );
-		}
-
-		doFillVboStrides();
 		doProcessMappedBoundVaoBuffersIn();
-		m_commands.emplace_back( std::make_unique< DrawIndexedCommand >( m_device
-			, indexCount
+		m_commands.push< CmdDrawIndexed >( VkDrawIndexedIndirectCommand{ indexCount
 			, instCount
 			, firstIndex
-			, vertexOffset
-			, firstInstance
-			, get( m_state.currentPipeline )->getInputAssemblyState().topology
-			, m_state.indexType
-			, m_state.vbos ) );
+			, int32_t( vertexOffset )
+			, firstInstance } );
 		doProcessMappedBoundDescriptorsResourcesOut();
-		m_state.newlyBoundIbo = nullptr;
 	}
 
 	void CommandBuffer::drawIndirect( VkBuffer buffer
@@ -413,15 +333,11 @@ namespace ashes::test
 		, uint32_t drawCount
 		, uint32_t stride )const
 	{
-		doFillVboStrides();
 		doProcessMappedBoundVaoBuffersIn();
-		m_commands.emplace_back( std::make_unique< DrawIndirectCommand >( m_device
-			, buffer
+		m_commands.push< CmdDrawIndirect >( buffer
 			, offset
 			, drawCount
-			, stride
-			, get( m_state.currentPipeline )->getInputAssemblyState().topology
-			, m_state.vbos ) );
+			, stride );
 		doProcessMappedBoundDescriptorsResourcesOut();
 	}
 
@@ -430,24 +346,12 @@ namespace ashes::test
 		, uint32_t drawCount
 		, uint32_t stride )const
 	{
-		if ( !get( m_state.currentPipeline )->hasVertexLayout()
-			&& m_state.newlyBoundIbo == nullptr )
-		{
-			bindIndexBuffer( get( m_device )->getEmptyIndexedVaoIdx(), 0u, VK_INDEX_TYPE_UINT32 );
-		}
-
-		doFillVboStrides();
 		doProcessMappedBoundVaoBuffersIn();
-		m_commands.emplace_back( std::make_unique< DrawIndexedIndirectCommand >( m_device
-			, buffer
+		m_commands.push< CmdDrawIndexedIndirect >( buffer
 			, offset
 			, drawCount
-			, stride
-			, get( m_state.currentPipeline )->getInputAssemblyState().topology
-			, m_state.indexType
-			, m_state.vbos ) );
+			, stride );
 		doProcessMappedBoundDescriptorsResourcesOut();
-		m_state.newlyBoundIbo = nullptr;
 	}
 
 	void CommandBuffer::copyToImage( VkBuffer src
@@ -457,10 +361,9 @@ namespace ashes::test
 	{
 		if ( !get( m_device )->onCopyToImageCommand( get( this ), copyInfos, src, dst ) )
 		{
-			m_commands.emplace_back( std::make_unique< CopyBufferToImageCommand >( m_device
-				, std::move( copyInfos )
-				, src
-				, dst ) );
+			m_commands.push< CmdCopyBufferToImage >( src
+				, dst
+				, m_data.pushArray( copyInfos.data(), copyInfos.size() ) );
 		}
 	}
 
@@ -469,15 +372,18 @@ namespace ashes::test
 		, VkBuffer dst
 		, VkBufferImageCopyArray copyInfos )const
 	{
-		m_commands.emplace_back( std::make_unique< CopyImageToBufferCommand >( m_device
-			, std::move( copyInfos )
-			, src
-			, dst ) );
+		m_commands.push< CmdCopyImageToBuffer >( src
+			, dst
+			, m_data.pushArray( copyInfos.data(), copyInfos.size() ) );
 	}
+
 	void CommandBuffer::updateBuffer( VkBuffer dstBuffer
 		, VkDeviceSize dstOffset
 		, ArrayView< uint8_t const > data )
 	{
+		m_commands.push< CmdUpdateBuffer >( dstBuffer
+			, dstOffset
+			, m_data.pushArray( data.begin(), data.size() ) );
 	}
 
 	void CommandBuffer::fillBuffer( VkBuffer dstBuffer
@@ -485,19 +391,19 @@ namespace ashes::test
 		, VkDeviceSize size
 		, uint32_t data )
 	{
+		m_commands.push< CmdFillBuffer >( dstBuffer
+			, dstOffset
+			, size
+			, data );
 	}
 
 	void CommandBuffer::copyBuffer( VkBuffer src
 		, VkBuffer dst
 		, VkBufferCopyArray copyInfos )const
 	{
-		for ( auto & copyInfo : copyInfos )
-		{
-			m_commands.emplace_back( std::make_unique< CopyBufferCommand >( m_device
-				, std::move( copyInfo )
-				, src
-				, dst ) );
-		}
+		m_commands.push< CmdCopyBuffer >( src
+			, dst
+			, m_data.pushArray( copyInfos.data(), copyInfos.size() ) );
 	}
 
 	void CommandBuffer::copyImage( VkImage src
@@ -506,13 +412,9 @@ namespace ashes::test
 		, VkImageLayout dstLayout
 		, VkImageCopyArray copyInfos )const
 	{
-		for ( auto & copyInfo : copyInfos )
-		{
-			m_commands.emplace_back( std::make_unique< CopyImageCommand >( m_device
-				, copyInfo
-				, src
-				, dst ) );
-		}
+		m_commands.push< CmdCopyImage >( src
+			, dst
+			, m_data.pushArray( copyInfos.data(), copyInfos.size() ) );
 	}
 
 	void CommandBuffer::blitImage( VkImage srcImage
@@ -522,13 +424,10 @@ namespace ashes::test
 		, VkImageBlitArray regions
 		, VkFilter filter )const
 	{
-		m_commands.emplace_back( std::make_unique< BlitImageCommand >( m_commandPool
-			, get( this )
-			, m_device
-			, srcImage
+		m_commands.push< CmdBlitImage >( srcImage
 			, dstImage
-			, regions
-			, filter ) );
+			, m_data.pushArray( regions.data(), regions.size() )
+			, filter );
 	}
 
 	void CommandBuffer::resolveImage( VkImage srcImage
@@ -537,44 +436,55 @@ namespace ashes::test
 		, VkImageLayout dstLayout
 		, VkImageResolveArray regions )const
 	{
+		// The samples aren't stored separately, so a resolve is a copy.
+		auto copies = static_cast< VkImageCopy * >( m_data.allocate( regions.size() * sizeof( VkImageCopy ) ) );
+
+		for ( size_t i = 0u; i < regions.size(); ++i )
+		{
+			auto & region = regions[i];
+			copies[i] = VkImageCopy{ region.srcSubresource
+				, region.srcOffset
+				, region.dstSubresource
+				, region.dstOffset
+				, region.extent };
+		}
+
+		m_commands.push< CmdCopyImage >( srcImage
+			, dstImage
+			, makeView< VkImageCopy >( copies, regions.size() ) );
 	}
 
 	void CommandBuffer::resetQueryPool( VkQueryPool pool
 		, uint32_t firstQuery
 		, uint32_t queryCount )const
 	{
-		m_commands.emplace_back( std::make_unique< ResetQueryPoolCommand >( m_device
-			, pool
+		m_commands.push< CmdResetQueryPool >( pool
 			, firstQuery
-			, queryCount ) );
+			, queryCount );
 	}
 
 	void CommandBuffer::beginQuery( VkQueryPool pool
 		, uint32_t query
 		, VkQueryControlFlags flags )const
 	{
-		m_commands.emplace_back( std::make_unique< BeginQueryCommand >( m_device
-			, pool
+		m_commands.push< CmdBeginQuery >( pool
 			, query
-			, flags ) );
+			, flags );
 	}
 
 	void CommandBuffer::endQuery( VkQueryPool pool
 		, uint32_t query )const
 	{
-		m_commands.emplace_back( std::make_unique< EndQueryCommand >( m_device
-			, pool
-			, query ) );
+		m_commands.push< CmdEndQuery >( pool
+			, query );
 	}
 
 	void CommandBuffer::writeTimestamp( VkPipelineStageFlagBits pipelineStage
 		, VkQueryPool pool
 		, uint32_t query )const
 	{
-		m_commands.emplace_back( std::make_unique< WriteTimestampCommand >( m_device
-			, pipelineStage
-			, pool
-			, query ) );
+		m_commands.push< CmdWriteTimestamp >( pool
+			, query );
 	}
 
 	void CommandBuffer::copyQueryPoolResults( VkQueryPool queryPool
@@ -593,70 +503,49 @@ namespace ashes::test
 		, uint32_t size
 		, void const * data )const
 	{
-		PushConstantsDesc desc
-		{
-			stageFlags,
-			offset,
-			size,
-			{ reinterpret_cast< uint8_t const * >( data ), reinterpret_cast< uint8_t const * >( data ) + size }
-		};
-
-		if ( m_state.currentPipeline )
-		{
-			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_device
-				, desc ) );
-			doAddAfterSubmitAction();
-		}
-		else if ( m_state.currentComputePipeline )
-		{
-			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_device
-				, desc ) );
-			doAddAfterSubmitAction();
-		}
-		else
-		{
-			m_state.pushConstantBuffers.emplace_back( layout, desc );
-		}
+		m_commands.push< CmdPushConstants >( stageFlags
+			, offset
+			, m_data.pushArray( static_cast< uint8_t const * >( data ), size ) );
 	}
 
 	void CommandBuffer::dispatch( uint32_t groupCountX
 		, uint32_t groupCountY
 		, uint32_t groupCountZ )const
 	{
-		m_commands.emplace_back( std::make_unique< DispatchCommand >( m_device
-			, groupCountX
+		m_commands.push< CmdDispatch >( VkExtent3D{ groupCountX
 			, groupCountY
-			, groupCountZ ) );
+			, groupCountZ } );
 		doProcessMappedBoundDescriptorsResourcesOut();
 	}
 
 	void CommandBuffer::dispatchIndirect( VkBuffer buffer
 		, VkDeviceSize offset )const
 	{
-		m_commands.emplace_back( std::make_unique< DispatchIndirectCommand >( m_device
-			, buffer
-			, offset ) );
+		m_commands.push< CmdDispatchIndirect >( buffer
+			, offset );
 		doProcessMappedBoundDescriptorsResourcesOut();
 	}
 
 	void CommandBuffer::setLineWidth( float width )const
 	{
-		m_commands.emplace_back( std::make_unique< SetLineWidthCommand >( m_device
-			, width ) );
+		m_commands.push< CmdSetLineWidth >( width );
 	}
 
 	void CommandBuffer::setDepthBias( float constantFactor
 		, float clamp
 		, float slopeFactor )const
 	{
-		m_commands.emplace_back( std::make_unique< SetDepthBiasCommand >( m_device
-			, constantFactor
+		m_commands.push< CmdSetDepthBias >( constantFactor
 			, clamp
-			, slopeFactor ) );
+			, slopeFactor );
 	}
 
 	void CommandBuffer::setBlendConstants( float const blendConstants[4] )const
 	{
+		m_commands.push< CmdSetBlendConstants >( std::array< float, 4u >{ blendConstants[0]
+			, blendConstants[1]
+			, blendConstants[2]
+			, blendConstants[3] } );
 	}
 
 	void CommandBuffer::setDepthBounds( float minDepthBounds
@@ -667,32 +556,37 @@ namespace ashes::test
 	void CommandBuffer::setStencilCompareMask( VkStencilFaceFlags faceMask
 		, uint32_t compareMask )const
 	{
+		m_commands.push< CmdSetStencilValue >( StencilValue::eCompareMask
+			, faceMask
+			, compareMask );
 	}
 
 	void CommandBuffer::setStencilWriteMask( VkStencilFaceFlags faceMask
 		, uint32_t writeMask )const
 	{
+		m_commands.push< CmdSetStencilValue >( StencilValue::eWriteMask
+			, faceMask
+			, writeMask );
 	}
 
 	void CommandBuffer::setStencilReference( VkStencilFaceFlags faceMask
 		, uint32_t reference )
 	{
+		m_commands.push< CmdSetStencilValue >( StencilValue::eReference
+			, faceMask
+			, reference );
 	}
 
 	void CommandBuffer::setEvent( VkEvent event
 		, VkPipelineStageFlags stageMask )const
 	{
-		m_commands.emplace_back( std::make_unique< SetEventCommand >( m_device
-			, event
-			, stageMask ) );
+		m_commands.push< CmdSetEvent >( event );
 	}
 
 	void CommandBuffer::resetEvent( VkEvent event
 		, VkPipelineStageFlags stageMask )const
 	{
-		m_commands.emplace_back( std::make_unique< ResetEventCommand >( m_device
-			, event
-			, stageMask ) );
+		m_commands.push< CmdResetEvent >( event );
 	}
 
 	void CommandBuffer::waitEvents( VkEventArray events
@@ -702,12 +596,7 @@ namespace ashes::test
 		, VkBufferMemoryBarrierArray bufferMemoryBarriers
 		, VkImageMemoryBarrierArray imageMemoryBarriers )const
 	{
-		m_commands.emplace_back( std::make_unique< WaitEventsCommand >( m_device
-			, events
-			, srcStageMask
-			, dstStageMask
-			, bufferMemoryBarriers
-			, imageMemoryBarriers ) );
+		m_commands.push< CmdWaitEvents >( m_data.pushArray( events.data(), events.size() ) );
 	}
 
 	void CommandBuffer::pipelineBarrier( VkPipelineStageFlags after
@@ -717,18 +606,50 @@ namespace ashes::test
 		, VkBufferMemoryBarrierArray bufferMemoryBarriers
 		, VkImageMemoryBarrierArray imageMemoryBarriers )const
 	{
-		m_commands.emplace_back( std::make_unique< MemoryBarrierCommand >( m_device
-			, after
-			, before
-			, memoryBarriers
-			, bufferMemoryBarriers
-			, imageMemoryBarriers ) );
+		// The commands execute in order, so only the barriers on mapped buffers have work to do.
+		auto count = size_t( std::count_if( bufferMemoryBarriers.begin()
+			, bufferMemoryBarriers.end()
+			, []( VkBufferMemoryBarrier const & barrier )
+			{
+				return get( barrier.buffer )->isMapped();
+			} ) );
+
+		if ( !count )
+		{
+			return;
+		}
+
+		auto uploads = static_cast< BufferLock * >( m_data.allocate( count * sizeof( BufferLock ) ) );
+		auto downloads = static_cast< BufferLock * >( m_data.allocate( count * sizeof( BufferLock ) ) );
+		size_t uploadCount{};
+		size_t downloadCount{};
+
+		for ( auto & barrier : bufferMemoryBarriers )
+		{
+			if ( get( barrier.buffer )->isMapped() )
+			{
+				if ( checkFlag( barrier.srcAccessMask, VK_ACCESS_MEMORY_WRITE_BIT )
+					|| checkFlag( barrier.srcAccessMask, VK_ACCESS_HOST_WRITE_BIT )
+					|| checkFlag( barrier.srcAccessMask, VK_ACCESS_TRANSFER_WRITE_BIT ) )
+				{
+					uploads[uploadCount++] = { barrier.offset, barrier.size, barrier.buffer };
+				}
+				else if ( checkFlag( barrier.dstAccessMask, VK_ACCESS_TRANSFER_READ_BIT )
+					|| checkFlag( barrier.dstAccessMask, VK_ACCESS_HOST_READ_BIT )
+					|| checkFlag( barrier.dstAccessMask, VK_ACCESS_MEMORY_READ_BIT ) )
+				{
+					downloads[downloadCount++] = { barrier.offset, barrier.size, barrier.buffer };
+				}
+			}
+		}
+
+		m_commands.push< CmdMemoryBarrier >( makeView< BufferLock >( uploads, uploadCount )
+			, makeView< BufferLock >( downloads, downloadCount ) );
 	}
 
 	void CommandBuffer::generateMipmaps( VkImage texture )const
 	{
-		m_commands.emplace_back( std::make_unique< GenerateMipsCommand >( m_device
-			, texture ) );
+		m_commands.push< CmdGenerateMips >( texture );
 	}
 
 #if VK_EXT_debug_utils
@@ -784,49 +705,11 @@ namespace ashes::test
 
 #endif
 
-	void CommandBuffer::doFillVboStrides()const
-	{
-		auto & state = get( m_state.currentPipeline )->getVertexInputState();
-
-		if ( !state.vertexBindingDescriptionCount )
-		{
-			m_state.vbos.clear();
-		}
-
-		auto bindingsEnd = state.pVertexBindingDescriptions + state.vertexBindingDescriptionCount;
-
-		for ( auto & binding : m_state.vbos )
-		{
-			auto startIndex = binding.startIndex;
-			binding.strides.clear();
-
-			for ( auto i = 0u; i < binding.buffers.size(); ++i )
-			{
-				auto it = std::find_if( state.pVertexBindingDescriptions
-					, bindingsEnd
-					, [startIndex]( ::VkVertexInputBindingDescription const & desc )
-					{
-						return desc.binding == startIndex;
-					} );
-
-				if ( it != bindingsEnd )
-				{
-					binding.strides.push_back( it->stride );
-				}
-
-				++startIndex;
-			}
-		}
-	}
-
-	void CommandBuffer::doAddAfterSubmitAction()const
+	void CommandBuffer::doClear()const
 	{
-		auto & command = *m_commands.back();
-		m_afterSubmitActions.insert( m_afterSubmitActions.begin()
-			, [&command]()
-			{
-				command.remove();
-			} );
+		m_mappedResources.clear();
+		m_commands.clear();
+		m_data.clear();
 	}
 
 	void CommandBuffer::doProcessMappedBoundDescriptorResourcesIn( VkDescriptorSet descriptor )const
@@ -950,14 +833,17 @@ namespace ashes::test
 		//if ( get( img->getMemory() )->isMapped() )
 		{
 			auto & range = get( image )->getSubResourceRange();
+			auto alignment = uint32_t( img->getMemoryRequirements().alignment );
 			auto layerSize = getLevelsSize( img->getDimensions()
 				, img->getFormat()
 				, 0u
-				, img->getMipmapLevels() );
+				, img->getMipmapLevels()
+				, alignment );
 			auto size = getLevelsSize( img->getDimensions()
 				, img->getFormat()
 				, range.baseMipLevel
-				, range.levelCount );
+				, range.levelCount
+				, alignment );
 			auto offset = img->getMemoryOffset();
 
 			for ( auto layer = range.baseArrayLayer; layer < range.baseArrayLayer + range.layerCount; ++layer )
@@ -993,14 +879,17 @@ namespace ashes::test
 		//if ( get( img->getMemory() )->isMapped() )
 		{
 			auto & range = get( image )->getSubResourceRange();
+			auto alignment = uint32_t( img->getMemoryRequirements().alignment );
 			auto layerSize = getLevelsSize( img->getDimensions()
 				, img->getFormat()
 				, 0u
-				, img->getMipmapLevels() );
+				, img->getMipmapLevels()
+				, alignment );
 			auto size = getLevelsSize( img->getDimensions()
 				, img->getFormat()
 				, range.baseMipLevel
-				, range.levelCount );
+				, range.levelCount
+				, alignment );
 			auto offset = img->getMemoryOffset();
 
 			for ( auto layer = range.baseArrayLayer; layer < range.baseArrayLayer + range.layerCount; ++layer )
@@ -1014,27 +903,15 @@ namespace ashes::test
 		}
 	}
 
-	CommandBuffer::ResourceIndex & CommandBuffer::doAddMappedResource( ObjectMemory const * memory
+	void CommandBuffer::doAddMappedResource( ObjectMemory const * memory
 		, VkDeviceSize offset
 		, VkDeviceSize range
 		, bool isInput )const
 	{
-		if ( isInput )
-		{
-			m_commands.emplace_back( std::make_unique< UploadMemoryCommand >( m_device
-				, memory
-				, offset
-				, range ) );
-		}
-		else
-		{
-			m_commands.emplace_back( std::make_unique< DownloadMemoryCommand >( m_device
-				, memory
-				, offset
-				, range ) );
-		}
-
-		return doAddMappedResource( memory );
+		auto & command = ( isInput
+			? m_commands.push< CmdUploadMemory >( memory, offset, range ).cmd
+			: m_commands.push< CmdDownloadMemory >( memory, offset, range ).cmd );
+		doAddMappedResource( memory ).commands.push_back( &command );
 	}
 
 	CommandBuffer::ResourceIndex & CommandBuffer::doAddMappedResource( ObjectMemory const * memory )const
@@ -1051,7 +928,6 @@ namespace ashes::test
 		if ( it == m_mappedResources.end() )
 		{
 			result = &m_mappedResources.emplace_back( memory
-				, m_commands.size() - 1u
 				, get( memory->deviceMemory )->onDestroy.connect( [this, memory]( VkDeviceMemory deviceMemory )
 					{
 						doRemoveMappedResource( memory );
@@ -1076,15 +952,13 @@ namespace ashes::test
 
 		if ( it != m_mappedResources.end() )
 		{
-			auto index = it->index;
-			m_commands.erase( m_commands.begin() + index );
-			it = m_mappedResources.erase( it );
-
-			while ( it != m_mappedResources.end() )
+			// The commands stay in place, they are only disabled.
+			for ( auto command : it->commands )
 			{
-				it->index--;
-				++it;
+				command->op.type = OpType::eNone;
 			}
+
+			m_mappedResources.erase( it );
 		}
 	}
 
@@ -4,11 +4,12 @@ See LICENSE file in root folder
 */
 #pragma once
 
-#include "renderer/TestRenderer/Command/Commands/TestBlitImageCommand.hpp"
+#include "renderer/TestRenderer/Command/TestCommandArena.hpp"
+#include "renderer/TestRenderer/Command/Commands/TestCommandBase.hpp"
 
 #include <renderer/RendererCommon/IcdObject.hpp>
 
-#define AshesTest_DummyCommandBuffer 1
+#define AshesTest_DummyCommandBuffer 0
 
 namespace ashes::test
 {
@@ -22,6 +23,11 @@ namespace ashes::test
 		~CommandBuffer();
 
 		void execute()const;
+		/**
+		*\brief
+		*	Executes the commands with the given state, which a secondary command buffer inherits from its primary.
+		*/
+		void execute( ExecutionState & state )const;
 
 		VkResult begin( VkCommandBufferBeginInfo info )const;
 		VkResult end()const;
@@ -178,11 +184,6 @@ namespace ashes::test
 		void debugMarkerInsert( VkDebugMarkerMarkerInfoEXT const & labelInfo )const;
 #endif
 
-		inline CommandArray const & getCommands()const
-		{
-			return m_commands;
-		}
-
 		inline VkDevice getDevice()const
 		{
 			return m_device;
@@ -192,23 +193,20 @@ namespace ashes::test
 		struct ResourceIndex
 		{
 			ResourceIndex( ObjectMemory const * memory
-				, size_t index
 				, DeviceMemoryDestroyConnection connection )
 				: memory{ memory }
-				, index{ index }
 				, connection{ std::move( connection ) }
 			{
 			}
 
 			ObjectMemory const * memory;
-			size_t index;
+			// The upload and download commands, disabled when the memory is destroyed.
+			std::vector< Command * > commands;
 			DeviceMemoryDestroyConnection connection;
 		};
 
-
 	private:
-		void doFillVboStrides()const;
-		void doAddAfterSubmitAction()const;
+		void doClear()const;
 		void doProcessMappedBoundDescriptorResourcesIn( VkDescriptorSet descriptor )const;
 		void doProcessMappedBoundDescriptorsResourcesOut()const;
 		void doProcessMappedBoundVaoBuffersIn()const;
@@ -220,7 +218,7 @@ namespace ashes::test
 			, VkDeviceSize offset
 			, VkDeviceSize range )const;
 		void doProcessMappedBoundResourceOut( VkImageView image )const;
-		ResourceIndex & doAddMappedResource( ObjectMemory const * memory
+		void doAddMappedResource( ObjectMemory const * memory
 			, VkDeviceSize offset
 			, VkDeviceSize range
 			, bool isInput )const;
@@ -230,25 +228,21 @@ namespace ashes::test
 	private:
 		VkDevice m_device;
 		VkCommandPool m_commandPool;
-		mutable CommandArray m_commands;
+		// The commands, and the arrays they point to, in the command pool's arena.
+		mutable CommandStream m_commands;
+		mutable CommandStream m_data;
 		mutable std::vector< ResourceIndex > m_mappedResources;
 		struct State
 		{
 			VkCommandBufferBeginInfo beginInfo{};
-			VkPipeline currentPipeline{};
-			std::vector< std::pair < VkPipelineLayout, PushConstantsDesc > > pushConstantBuffers;
-			VkPipeline currentComputePipeline{};
-			VkSubpassDescription const * currentSubpass{};
-			VkRenderPass currentRenderPass{};
-			VkFramebuffer currentFrameBuffer{};
 			uint32_t currentSubpassIndex{ 0u };
-			mutable VbosBindingArray vbos;
-			VkIndexType indexType{};
+			// The bindings are only tracked here to find the mapped resources the commands use,
+			// the commands track them again while they execute.
+			VkPipeline currentPipeline{};
+			VbosBindingArray vbos;
 			VkDescriptorSetArray boundDescriptors;
-			VkBuffer newlyBoundIbo{};
 		};
 		mutable State m_state;
-		mutable ActionArray m_afterSubmitActions;
 		mutable Optional< DebugLabel > m_label;
 	};
 }
@@ -33,12 +33,17 @@ namespace ashes::test
 
 	VkResult CommandPool::reset( VkCommandPoolResetFlags flags )
 	{
+		// The command buffers stay allocated, they only go back to the initial state.
 		for ( auto & command : m_commands )
 		{
-			deallocate( command, nullptr );
+			get( command )->reset( 0u );
+		}
+
+		if ( checkFlag( flags, VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT ) )
+		{
+			trim();
 		}
 
-		m_commands.clear();
 		return VK_SUCCESS;
 	}
 
@@ -59,4 +64,9 @@ namespace ashes::test
 
 		return VK_SUCCESS;
 	}
+
+	void CommandPool::trim()
+	{
+		m_arena.trim();
+	}
 }
@@ -4,7 +4,7 @@ See LICENSE file in root folder
 */
 #pragma once
 
-#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+#include "renderer/TestRenderer/Command/TestCommandArena.hpp"
 
 namespace ashes::test
 {
@@ -18,15 +18,22 @@ namespace ashes::test
 		void registerCommands( VkCommandBuffer commands );
 		VkResult reset( VkCommandPoolResetFlags flags );
 		VkResult free( VkCommandBufferArray sets );
+		void trim();
 
 		VkDevice getDevice()const
 		{
 			return m_device;
 		}
 
+		CommandArena & getArena()
+		{
+			return m_arena;
+		}
+
 	private:
 		VkDevice m_device;
 		VkCommandPoolCreateInfo m_createInfo;
+		CommandArena m_arena;
 		VkCommandBufferArray m_commands;
 	};
 }
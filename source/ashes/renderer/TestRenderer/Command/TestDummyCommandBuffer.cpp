@@ -15,6 +15,8 @@ namespace ashes::test
 		, bool primary )
 		: m_device{ device }
 		, m_commandPool{}
+		, m_commands{ get( commandPool )->getArena() }
+		, m_data{ get( commandPool )->getArena() }
 	{
 		get( commandPool )->registerCommands( get( this ) );
 	}
@@ -27,6 +29,10 @@ namespace ashes::test
 	{
 	}
 
+	void CommandBuffer::execute( ExecutionState & state )const
+	{
+	}
+
 	VkResult CommandBuffer::begin( VkCommandBufferBeginInfo info )const
 	{
 		return VK_SUCCESS;
@@ -8,30 +8,87 @@ See LICENSE file in root folder.
 #include "Command/TestCommandBuffer.hpp"
 #include "Core/TestDevice.hpp"
 #include "Core/TestSwapChain.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
 #include "Sync/TestFence.hpp"
 #include "Sync/TestSemaphore.hpp"
 
 #include "ashestest_api.hpp"
 
+#include <limits>
+
 namespace ashes::test
 {
 	Queue::Queue( VkDevice device
 		, VkDeviceQueueCreateInfo createInfo )
 		: m_device{ device }
 		, m_createInfo{ std::move( createInfo ) }
+		, m_thread{ [this]()
+			{
+				doRun();
+			} }
+	{
+	}
+
+	Queue::~Queue()noexcept
 	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_stopped = true;
+		}
+		m_pushed.notify_all();
+		m_thread.join();
 	}
 
 	VkResult Queue::submit( VkSubmitInfoArray const & infos
 		, VkFence fence )const
 	{
+		if ( infos.empty() )
+		{
+			if ( fence )
+			{
+				doPush( { {}, {}, {}, fence } );
+			}
+
+			return VK_SUCCESS;
+		}
+
 		for ( auto & info : infos )
 		{
-			doSubmit( { info.pCommandBuffers, info.pCommandBuffers + info.commandBufferCount }
-				, { info.pWaitSemaphores, info.pWaitSemaphores + info.waitSemaphoreCount }
-				, { info.pWaitDstStageMask, info.pWaitDstStageMask + info.waitSemaphoreCount }
-				, { info.pSignalSemaphores, info.pSignalSemaphores + info.signalSemaphoreCount }
-				, fence );
+			Submission submission{ { info.pCommandBuffers, info.pCommandBuffers + info.commandBufferCount } };
+			// Timeline semaphores take their values from the chained structure, binary ones ignore them.
+			uint64_t const * waitValues{};
+			uint64_t const * signalValues{};
+#if VK_KHR_timeline_semaphore
+
+			if ( auto timelineInfo = tryGet< VkTimelineSemaphoreSubmitInfoKHR >( info.pNext ) )
+			{
+				waitValues = timelineInfo->waitSemaphoreValueCount
+					? timelineInfo->pWaitSemaphoreValues
+					: nullptr;
+				signalValues = timelineInfo->signalSemaphoreValueCount
+					? timelineInfo->pSignalSemaphoreValues
+					: nullptr;
+			}
+
+#endif
+
+			for ( uint32_t i = 0u; i < info.waitSemaphoreCount; ++i )
+			{
+				submission.waits.push_back( { info.pWaitSemaphores[i]
+					, waitValues ? waitValues[i] : 0u } );
+			}
+
+			for ( uint32_t i = 0u; i < info.signalSemaphoreCount; ++i )
+			{
+				submission.signals.push_back( { info.pSignalSemaphores[i]
+					, signalValues ? signalValues[i] : 0u } );
+			}
+
+			// The fence is signaled once all the batches are complete.
+			submission.fence = ( &info == &infos.back()
+				? fence
+				: nullptr );
+			doPush( std::move( submission ) );
 		}
 
 		return VK_SUCCESS;
@@ -39,6 +96,19 @@ namespace ashes::test
 
 	VkResult Queue::present( VkPresentInfoKHR const & presentInfo )const
 	{
+		// The wait semaphores are consumed in the queue's order, the images are presented immediately.
+		if ( presentInfo.waitSemaphoreCount )
+		{
+			Submission submission{};
+
+			for ( auto & semaphore : makeArrayView( presentInfo.pWaitSemaphores, presentInfo.waitSemaphoreCount ) )
+			{
+				submission.waits.push_back( { semaphore, 0u } );
+			}
+
+			doPush( std::move( submission ) );
+		}
+
 		auto itIndices = presentInfo.pImageIndices;
 
 		if ( presentInfo.pResults )
@@ -72,6 +142,13 @@ namespace ashes::test
 
 	VkResult Queue::waitIdle()const
 	{
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		m_idle.wait( lock
+			, [this]()
+			{
+				return m_submissions.empty()
+					&& !m_running;
+			} );
 		return VK_SUCCESS;
 	}
 
@@ -128,18 +205,74 @@ namespace ashes::test
 
 #endif
 
-	VkResult Queue::doSubmit( VkCommandBufferArray const & commandBuffers
-		, VkSemaphoreArray const & semaphoresToWait
-		, VkPipelineStageFlagsArray const & semaphoresStage
-		, VkSemaphoreArray const & semaphoresToSignal
-		, VkFence fence )const
+	void Queue::doPush( Submission submission )const
 	{
-		for ( auto & commandBuffer : commandBuffers )
 		{
-			auto & dxCommandBuffer = *get( commandBuffer );
-			dxCommandBuffer.execute();
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_submissions.push_back( std::move( submission ) );
 		}
+		m_pushed.notify_one();
+	}
 
-		return VK_SUCCESS;
+	void Queue::doRun()
+	{
+		std::unique_lock< std::mutex > lock{ m_mutex };
+
+		while ( true )
+		{
+			m_pushed.wait( lock
+				, [this]()
+				{
+					return m_stopped
+						|| !m_submissions.empty();
+				} );
+
+			if ( m_submissions.empty() )
+			{
+				break;
+			}
+
+			auto submission = std::move( m_submissions.front() );
+			m_submissions.pop_front();
+			m_running = true;
+			lock.unlock();
+
+			for ( auto & wait : submission.waits )
+			{
+				get( wait.semaphore )->wait( wait.value, std::numeric_limits< uint64_t >::max() );
+			}
+
+			if ( !submission.commandBuffers.empty() )
+			{
+				// With a cost model, the semaphores and fence are signaled at the simulated completion time.
+				auto & clock = get( m_device )->getGpuClock();
+				clock.beginSubmission();
+
+				for ( auto & commandBuffer : submission.commandBuffers )
+				{
+					get( commandBuffer )->execute();
+				}
+
+				clock.endSubmission();
+			}
+
+			for ( auto & signal : submission.signals )
+			{
+				get( signal.semaphore )->signal( signal.value );
+			}
+
+			if ( submission.fence )
+			{
+				get( submission.fence )->signal();
+			}
+
+			lock.lock();
+			m_running = false;
+
+			if ( m_submissions.empty() )
+			{
+				m_idle.notify_all();
+			}
+		}
 	}
 }
@@ -8,14 +8,28 @@ See LICENSE file in root folder.
 
 #include <renderer/RendererCommon/IcdObject.hpp>
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 namespace ashes::test
 {
+	/**
+	*\brief
+	*	Executes its submissions in order, on its own thread.
+	*\remarks
+	*	A submission waits for its semaphores, executes its command buffers,
+	*	then signals its semaphores and fence.
+	*	Queues run concurrently, only synchronised through semaphores, events and fences.
+	*/
 	class Queue
 		: public ashes::IcdObject
 	{
 	public:
 		Queue( VkDevice device
 			, VkDeviceQueueCreateInfo createInfo );
+		~Queue()noexcept;
 
 		VkResult submit( VkSubmitInfoArray const & infos
 			, VkFence fence )const;
@@ -41,15 +55,34 @@ namespace ashes::test
 		}
 
 	private:
-		VkResult doSubmit( VkCommandBufferArray const & commandBuffers
-			, VkSemaphoreArray const & semaphoresToWait
-			, VkPipelineStageFlagsArray const & semaphoresStage
-			, VkSemaphoreArray const & semaphoresToSignal
-			, VkFence fence )const;
+		struct SemaphoreValue
+		{
+			VkSemaphore semaphore;
+			uint64_t value;
+		};
+
+		struct Submission
+		{
+			VkCommandBufferArray commandBuffers;
+			std::vector< SemaphoreValue > waits;
+			std::vector< SemaphoreValue > signals;
+			VkFence fence;
+		};
+
+	private:
+		void doPush( Submission submission )const;
+		void doRun();
 
 	private:
 		VkDevice m_device;
 		VkDeviceQueueCreateInfo m_createInfo;
 		mutable Optional< DebugLabel > m_label;
+		mutable std::mutex m_mutex;
+		mutable std::condition_variable m_pushed;
+		mutable std::condition_variable m_idle;
+		mutable std::deque< Submission > m_submissions;
+		bool m_running{};
+		bool m_stopped{};
+		std::thread m_thread;
 	};
 }
@@ -19,7 +19,9 @@ See LICENSE file in root folder.
 #include "Image/TestImage.hpp"
 #include "Image/TestImageView.hpp"
 #include "Miscellaneous/TestDeviceMemory.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
 #include "Miscellaneous/TestQueryPool.hpp"
+#include "Miscellaneous/TestThreadPool.hpp"
 #include "Pipeline/TestPipelineLayout.hpp"
 #include "RenderPass/TestRenderPass.hpp"
 #include "Shader/TestShaderModule.hpp"
@@ -43,47 +45,6 @@ namespace ashes::test
 			return T( ( value + align - 1 ) & ~( align - 1 ) );
 		}
 
-		template< typename T >
-		T getSubresourceValue( T value, uint32_t mipLevel )
-		{
-			return T( value >> mipLevel );
-		}
-
-		VkExtent3D getTexelBlockExtent( VkFormat format )
-		{
-			VkExtent3D texelBlockExtent{ 1u, 1u, 1u };
-
-			if ( ashes::isCompressedFormat( format ) )
-			{
-				auto extent = ashes::getMinimalExtent2D( format );
-				texelBlockExtent.width = extent.width;
-				texelBlockExtent.height = extent.height;
-			}
-			else
-			{
-				texelBlockExtent.width = 1u;
-			}
-
-			return texelBlockExtent;
-		}
-
-		uint32_t getTexelBlockByteSize( VkExtent3D const & texelBlockExtent
-			, VkFormat format )
-		{
-			VkDeviceSize texelBlockSize;
-
-			if ( !isDepthStencilFormat( format ) )
-			{
-				texelBlockSize = getSize( texelBlockExtent, format );
-			}
-			else
-			{
-				texelBlockSize = texelBlockExtent.width;
-			}
-
-			return uint32_t( texelBlockSize );
-		}
-
 		void doCheckEnabledExtensions( VkPhysicalDevice physicalDevice
 			, ashes::ArrayView< char const * const > const & extensions )
 		{
@@ -138,6 +99,7 @@ namespace ashes::test
 		: m_instance{ instance }
 		, m_physicalDevice{ physicalDevice }
 		, m_createInfos{ std::move( createInfos ) }
+		, m_gpuClock{ std::make_unique< GpuClock >() }
 	{
 		doCreateDummyIndexBuffer();
 		doCreateQueues();
@@ -163,6 +125,16 @@ namespace ashes::test
 		deallocate( m_dummyIndexed.buffer, nullptr );
 	}
 
+	ThreadPool & Device::getThreadPool()const
+	{
+		std::call_once( m_threadPoolFlag
+			, [this]()
+			{
+				m_threadPool = std::make_unique< ThreadPool >();
+			} );
+		return *m_threadPool;
+	}
+
 	VkPhysicalDeviceLimits const & Device::getLimits()const
 	{
 		return get( m_physicalDevice )->getProperties().limits;
@@ -235,15 +207,7 @@ namespace ashes::test
 		, VkImageSubresource const & subresource
 		, VkSubresourceLayout & layout )const
 	{
-		auto extent = getTexelBlockExtent( get( image )->getFormat() );
-		auto byteSize = getTexelBlockByteSize( extent, get( image )->getFormat() );
-		auto mipWidth = getSubresourceValue( get( image )->getDimensions().width, subresource.mipLevel );
-		auto mipHeight = getSubresourceValue( get( image )->getDimensions().height, subresource.mipLevel );
-		layout.rowPitch = byteSize * mipWidth / ( extent.width * extent.height * extent.depth );
-		layout.arrayPitch = layout.rowPitch * mipHeight * extent.height / ( extent.width * extent.depth );
-		layout.depthPitch = layout.arrayPitch;
-		layout.offset = subresource.arrayLayer * layout.arrayPitch;
-		layout.size = layout.arrayPitch * get( image )->getDimensions().depth;
+		layout = get( image )->getSubresourceLayout( subresource );
 	}
 
 #if VK_EXT_debug_utils
@@ -331,6 +295,14 @@ namespace ashes::test
 
 	VkResult Device::waitIdle()const
 	{
+		for ( auto & creates : m_queues )
+		{
+			for ( auto queue : creates.second.queues )
+			{
+				get( queue )->waitIdle();
+			}
+		}
+
 		return VK_SUCCESS;
 	}
 
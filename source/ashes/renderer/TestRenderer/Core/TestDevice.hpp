@@ -11,6 +11,7 @@ See LICENSE file in root folder
 
 #include <renderer/RendererCommon/IcdObject.hpp>
 
+#include <mutex>
 #include <unordered_map>
 
 namespace ashes::test
@@ -126,6 +127,19 @@ namespace ashes::test
 		{
 			return m_physicalDevice;
 		}
+		/**
+		*\return
+		*	The threads running the dispatches, created on first use.
+		*/
+		ThreadPool & getThreadPool()const;
+		/**
+		*\return
+		*	The simulated clock, advanced by the executed commands.
+		*/
+		inline GpuClock & getGpuClock()const
+		{
+			return *m_gpuClock;
+		}
 
 	private:
 		void doCreateDummyIndexBuffer();
@@ -152,5 +166,8 @@ namespace ashes::test
 		};
 		Buffer m_dummyIndexed;
 		std::unordered_map< size_t, std::pair< VkImage, VkDeviceMemory > > m_stagingTextures;
+		mutable std::once_flag m_threadPoolFlag;
+		mutable std::unique_ptr< ThreadPool > m_threadPool;
+		std::unique_ptr< GpuClock > m_gpuClock;
 	};
 }
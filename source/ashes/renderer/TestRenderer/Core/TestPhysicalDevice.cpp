@@ -61,6 +61,9 @@ namespace ashes::test
 #endif
 #if VK_KHR_portability_subset
 			VkExtensionProperties{ VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME, VK_KHR_PORTABILITY_SUBSET_SPEC_VERSION },
+#endif
+#if VK_KHR_timeline_semaphore
+			VkExtensionProperties{ VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, VK_KHR_TIMELINE_SEMAPHORE_SPEC_VERSION },
 #endif
 		};
 		return extensions;
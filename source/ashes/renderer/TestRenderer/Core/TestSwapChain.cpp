@@ -7,6 +7,7 @@
 #include "Image/TestImage.hpp"
 #include "RenderPass/TestFrameBuffer.hpp"
 #include "RenderPass/TestRenderPass.hpp"
+#include "Sync/TestFence.hpp"
 #include "Sync/TestSemaphore.hpp"
 
 #include "ashestest_api.hpp"
@@ -118,7 +119,19 @@ namespace ashes::test
 		, VkFence fence
 		, uint32_t & imageIndex )const
 	{
+		// The images are never in use, so they are available immediately.
 		imageIndex = 0u;
+
+		if ( semaphore )
+		{
+			get( semaphore )->signal( 1u );
+		}
+
+		if ( fence )
+		{
+			get( fence )->signal();
+		}
+
 		return VK_SUCCESS;
 	}
 
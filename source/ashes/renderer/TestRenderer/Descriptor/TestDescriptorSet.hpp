@@ -29,6 +29,14 @@ namespace ashes::test
 			return m_layout;
 		}
 
+		inline LayoutBindingWrites const * getBindingWrites( uint32_t binding )const
+		{
+			auto it = m_writes.find( binding );
+			return it == m_writes.end()
+				? nullptr
+				: &it->second;
+		}
+
 		inline LayoutBindingWritesArray const & getCombinedTextureSamplers()const
 		{
 			return m_combinedTextureSamplers;
@@ -144,4 +144,40 @@ namespace ashes::test
 		assert( m_memory != nullptr );
 		return get( m_memory )->isMapped();
 	}
+
+	VkSubresourceLayout Image::getSubresourceLayout( VkImageSubresource const & subresource )const
+	{
+		auto alignment = uint32_t( getMemoryRequirements().alignment );
+		auto blockExtent = getBlockExtent( getFormat()
+			, getSubresourceDimensions( getDimensions(), subresource.mipLevel, getFormat() ) );
+		auto layerSize = getLevelsSize( getDimensions(), getFormat(), 0u, getMipmapLevels(), alignment );
+		VkSubresourceLayout result{};
+		result.rowPitch = blockExtent.width * ashes::getMinimalSize( getFormat() );
+		result.depthPitch = result.rowPitch * blockExtent.height;
+		result.arrayPitch = layerSize;
+		result.size = result.depthPitch * blockExtent.depth;
+		result.offset = subresource.arrayLayer * layerSize
+			+ getLevelsSize( getDimensions(), getFormat(), 0u, subresource.mipLevel, alignment );
+		return result;
+	}
+
+	SubresourceData Image::getSubresourceData( VkImageAspectFlags aspectMask
+		, uint32_t mipLevel
+		, uint32_t arrayLayer )const
+	{
+		auto layout = getSubresourceLayout( { aspectMask, mipLevel, arrayLayer } );
+		SubresourceData result;
+		result.data = get( m_memory )->getData( m_memoryOffset + layout.offset );
+		result.format = getFormat();
+		result.extent = getBlockExtent( getFormat()
+			, getSubresourceDimensions( getDimensions(), mipLevel, getFormat() ) );
+		result.rowPitch = layout.rowPitch;
+		result.depthPitch = layout.depthPitch;
+		result.texelSize = uint32_t( ashes::getMinimalSize( getFormat() ) );
+		getAspectRange( getFormat()
+			, aspectMask
+			, result.aspectOffset
+			, result.aspectSize );
+		return result;
+	}
 }
@@ -8,7 +8,7 @@
 #define ___TestRenderer_Texture_HPP___
 #pragma once
 
-#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+#include "renderer/TestRenderer/Miscellaneous/TestTransferKernels.hpp"
 
 namespace ashes::test
 {
@@ -38,6 +38,14 @@ namespace ashes::test
 		VkResult bindMemory( VkDeviceMemory memory
 			, VkDeviceSize memoryOffset );
 		bool isMapped()const;
+		/**
+		*\brief
+		*	The subresources are stored layer after layer, each layer holding all its mip levels.
+		*/
+		VkSubresourceLayout getSubresourceLayout( VkImageSubresource const & subresource )const;
+		SubresourceData getSubresourceData( VkImageAspectFlags aspectMask
+			, uint32_t mipLevel
+			, uint32_t arrayLayer )const;
 
 		inline uint32_t getMipmapLevels()const
 		{
@@ -7,6 +7,7 @@ See LICENSE file in root folder
 #include "Core/TestDevice.hpp"
 #include "Core/TestInstance.hpp"
 #include "Core/TestPhysicalDevice.hpp"
+#include "Miscellaneous/TestTransferKernels.hpp"
 
 #include <ashes/common/Exception.hpp>
 
@@ -217,12 +218,9 @@ namespace ashes::test
 		, m_allocateInfo{ std::move( allocateInfo ) }
 		, m_propertyFlags{ getMemoryProperties( m_allocateInfo.memoryTypeIndex ) }
 	{
+		// Device local memory is also stored, since the commands are executed on the CPU.
 		thread_local uint8_t defaultInitValue = 10u;
-
-		if ( ashes::checkFlag( m_propertyFlags, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT ) )
-		{
-			m_data.resize( allocateInfo.allocationSize, defaultInitValue++ );
-		}
+		m_data.resize( m_allocateInfo.allocationSize, defaultInitValue++ );
 	}
 
 	DeviceMemory::~DeviceMemory()
@@ -481,7 +479,7 @@ namespace ashes::test
 		if ( !m_data.empty()
 			&& !get( src )->m_data.empty() )
 		{
-			std::memcpy( &m_data[dstOffset]
+			copyMemory( &m_data[dstOffset]
 				, &get( src )->m_data[srcOffset]
 				, size );
 		}
@@ -112,6 +112,15 @@ namespace ashes::test
 		{
 			return m_propertyFlags;
 		}
+		/**
+		*\brief
+		*	The memory storage, on which the commands are executed.
+		*/
+		inline uint8_t * getData( VkDeviceSize offset )const
+		{
+			assert( offset <= m_data.size() );
+			return m_data.data() + offset;
+		}
 
 	public:
 		mutable DeviceMemoryDestroySignal onDestroy;
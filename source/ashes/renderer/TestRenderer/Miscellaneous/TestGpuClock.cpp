@@ -0,0 +1,297 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/TestGpuClock.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace ashes::test
+{
+	namespace
+	{
+		char const * const CostModelEnvVar = "ASHES_TEST_COST_MODEL";
+
+		// Parses the flat JSON object holding the cost model members, unknown members are ignored.
+		class CostModelParser
+		{
+		public:
+			explicit CostModelParser( std::string text )
+				: m_text{ std::move( text ) }
+			{
+			}
+
+			bool parse( CostModel & model )
+			{
+				if ( !doAccept( '{' ) )
+				{
+					return false;
+				}
+
+				if ( doPeek() == '}' )
+				{
+					++m_index;
+					return doAtEnd();
+				}
+
+				do
+				{
+					std::string name;
+
+					if ( !doParseString( name )
+						|| !doAccept( ':' )
+						|| !doParseMember( name, model ) )
+					{
+						return false;
+					}
+				}
+				while ( doAccept( ',' ) );
+
+				return doAccept( '}' )
+					&& doAtEnd();
+			}
+
+			size_t getIndex()const
+			{
+				return m_index;
+			}
+
+		private:
+			char doPeek()
+			{
+				while ( m_index < m_text.size()
+					&& std::isspace( uint8_t( m_text[m_index] ) ) )
+				{
+					++m_index;
+				}
+
+				return m_index < m_text.size()
+					? m_text[m_index]
+					: '\0';
+			}
+
+			bool doAccept( char c )
+			{
+				if ( doPeek() != c )
+				{
+					return false;
+				}
+
+				++m_index;
+				return true;
+			}
+
+			bool doAtEnd()
+			{
+				return doPeek() == '\0';
+			}
+
+			bool doParseString( std::string & result )
+			{
+				if ( !doAccept( '"' ) )
+				{
+					return false;
+				}
+
+				while ( m_index < m_text.size()
+					&& m_text[m_index] != '"' )
+				{
+					if ( m_text[m_index] == '\\' )
+					{
+						return false;
+					}
+
+					result += m_text[m_index++];
+				}
+
+				return m_index++ < m_text.size();
+			}
+
+			bool doParseMember( std::string const & name
+				, CostModel & model )
+			{
+				auto c = doPeek();
+
+				if ( c == 't' || c == 'f' )
+				{
+					bool value = c == 't';
+					std::string keyword = value ? "true" : "false";
+
+					if ( m_text.compare( m_index, keyword.size(), keyword ) != 0 )
+					{
+						return false;
+					}
+
+					m_index += keyword.size();
+
+					if ( name == "realTime" )
+					{
+						model.realTime = value;
+					}
+
+					return true;
+				}
+
+				auto begin = m_text.c_str() + m_index;
+				char * end{};
+				auto value = std::strtod( begin, &end );
+
+				if ( end == begin || value < 0.0 )
+				{
+					return false;
+				}
+
+				m_index += size_t( end - begin );
+
+				if ( name == "submission" )
+				{
+					model.submission = value;
+				}
+				else if ( name == "draw" )
+				{
+					model.draw = value;
+				}
+				else if ( name == "vertex" )
+				{
+					model.vertex = value;
+				}
+				else if ( name == "dispatch" )
+				{
+					model.dispatch = value;
+				}
+				else if ( name == "dispatchGroup" )
+				{
+					model.dispatchGroup = value;
+				}
+				else if ( name == "byteCopied" )
+				{
+					model.byteCopied = value;
+				}
+
+				return true;
+			}
+
+		private:
+			std::string m_text;
+			size_t m_index{};
+		};
+
+		bool loadCostModel( CostModel & model )
+		{
+			auto path = std::getenv( CostModelEnvVar );
+
+			if ( !path || !*path )
+			{
+				return false;
+			}
+
+			std::ifstream file{ path };
+
+			if ( !file )
+			{
+				std::cerr << "Couldn't open the cost model file " << path << std::endl;
+				return false;
+			}
+
+			std::stringstream stream;
+			stream << file.rdbuf();
+			CostModelParser parser{ stream.str() };
+
+			if ( !parser.parse( model ) )
+			{
+				std::cerr << "Invalid cost model file " << path
+					<< ", at character " << parser.getIndex() << std::endl;
+				return false;
+			}
+
+			return true;
+		}
+	}
+
+	GpuClock::GpuClock()
+		: m_simulated{ loadCostModel( m_model ) }
+		, m_epoch{ std::chrono::steady_clock::now() }
+	{
+	}
+
+	uint64_t GpuClock::getTime()const
+	{
+		if ( !m_simulated )
+		{
+			return doGetHostTime();
+		}
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		return uint64_t( m_time );
+	}
+
+	void GpuClock::beginSubmission()const
+	{
+		if ( !m_simulated )
+		{
+			return;
+		}
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		if ( m_model.realTime )
+		{
+			m_time = std::max( m_time, double( doGetHostTime() ) );
+		}
+
+		m_time += m_model.submission;
+	}
+
+	void GpuClock::endSubmission()const
+	{
+		if ( !m_simulated
+			|| !m_model.realTime )
+		{
+			return;
+		}
+
+		auto completion = getTime();
+		std::this_thread::sleep_until( m_epoch + std::chrono::nanoseconds( completion ) );
+	}
+
+	void GpuClock::chargeDraw( uint64_t vertexCount
+		, uint64_t instanceCount )const
+	{
+		if ( m_simulated )
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_time += m_model.draw
+				+ m_model.vertex * double( vertexCount ) * double( instanceCount );
+		}
+	}
+
+	void GpuClock::chargeDispatch( uint64_t groupCount )const
+	{
+		if ( m_simulated )
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_time += m_model.dispatch
+				+ m_model.dispatchGroup * double( groupCount );
+		}
+	}
+
+	void GpuClock::chargeTransfer( VkDeviceSize size )const
+	{
+		if ( m_simulated )
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_time += m_model.byteCopied * double( size );
+		}
+	}
+
+	uint64_t GpuClock::doGetHostTime()const
+	{
+		return uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - m_epoch ).count() );
+	}
+}
@@ -0,0 +1,81 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+
+#include <chrono>
+#include <mutex>
+
+namespace ashes::test
+{
+	/**
+	*\brief
+	*	The simulated cost of the device work, in nanoseconds.
+	*\remarks
+	*	Read from the JSON file given by ASHES_TEST_COST_MODEL, a flat object holding these members, for example:
+	*	{ "submission": 20000, "draw": 2000, "vertex": 0.5, "dispatch": 2000, "dispatchGroup": 40, "byteCopied": 0.05, "realTime": true }
+	*	Missing members cost nothing.
+	*/
+	struct CostModel
+	{
+		double submission{};
+		double draw{};
+		// Per vertex and per instance.
+		double vertex{};
+		double dispatch{};
+		double dispatchGroup{};
+		// Per byte copied, filled, cleared or blitted.
+		double byteCopied{};
+		// When true, the submissions complete at their simulated time, on the host clock.
+		// Otherwise, they complete as soon as they're executed, and only the timestamps are simulated.
+		bool realTime{ true };
+	};
+	/**
+	*\brief
+	*	The device's simulated clock, in nanoseconds since the device creation.
+	*\remarks
+	*	Without cost model, it follows the host clock and the commands cost nothing.
+	*	With one, the executed commands advance it by their cost. The device has a single engine,
+	*	so the work of all the queues adds up on the same clock.
+	*	In real time mode, an idle device catches up with the host clock when a submission starts.
+	*/
+	class GpuClock
+	{
+	public:
+		GpuClock();
+
+		inline bool isSimulated()const
+		{
+			return m_simulated;
+		}
+
+		uint64_t getTime()const;
+		/**
+		*\brief
+		*	Starts a queue submission.
+		*/
+		void beginSubmission()const;
+		/**
+		*\brief
+		*	Ends a queue submission, waiting for its simulated completion time in real time mode.
+		*/
+		void endSubmission()const;
+		void chargeDraw( uint64_t vertexCount
+			, uint64_t instanceCount )const;
+		void chargeDispatch( uint64_t groupCount )const;
+		void chargeTransfer( VkDeviceSize size )const;
+
+	private:
+		uint64_t doGetHostTime()const;
+
+	private:
+		CostModel m_model;
+		bool m_simulated{};
+		std::chrono::steady_clock::time_point m_epoch;
+		mutable std::mutex m_mutex;
+		mutable double m_time{};
+	};
+}
@@ -79,14 +79,16 @@ namespace ashes::test
 			};
 			break;
 		case VK_QUERY_TYPE_TIMESTAMP:
-			m_data.resize( sizeof( uint64_t ) );
+			// One value per query, written by the queues from the device's clock.
+			m_data.resize( sizeof( uint64_t ) * m_createInfo.queryCount );
+			m_available.resize( m_createInfo.queryCount );
 			getUint32 = [this]( uint32_t index )
 			{
-				return uint32_t( *reinterpret_cast< uint64_t * >( m_data.data() ) );
+				return uint32_t( reinterpret_cast< uint64_t * >( m_data.data() )[index] );
 			};
 			getUint64 = [this]( uint32_t index )
 			{
-				return *reinterpret_cast< uint64_t * >( m_data.data() );
+				return reinterpret_cast< uint64_t * >( m_data.data() )[index];
 			};
 			break;
 		default:
@@ -100,8 +102,9 @@ namespace ashes::test
 		, VkQueryResultFlags flags
 		, UInt32Array & datas )const
 	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
 		auto max = firstQuery + queryCount;
-		VkResult result = VK_SUCCESS;
+		VkResult result = doGetAvailability( firstQuery, queryCount, flags );
 
 		for ( auto i = firstQuery; i < max; ++i )
 		{
@@ -117,8 +120,9 @@ namespace ashes::test
 		, VkQueryResultFlags flags
 		, UInt64Array & datas )const
 	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
 		auto max = firstQuery + queryCount;
-		VkResult result = VK_SUCCESS;
+		VkResult result = doGetAvailability( firstQuery, queryCount, flags );
 
 		for ( auto i = firstQuery; i < max; ++i )
 		{
@@ -127,4 +131,50 @@ namespace ashes::test
 
 		return result;
 	}
+
+	void QueryPool::reset( uint32_t firstQuery
+		, uint32_t queryCount )const
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		for ( auto i = firstQuery; i < firstQuery + queryCount && i < m_available.size(); ++i )
+		{
+			m_available[i] = false;
+		}
+	}
+
+	void QueryPool::writeTimestamp( uint32_t query
+		, uint64_t value )const
+	{
+		if ( m_createInfo.queryType != VK_QUERY_TYPE_TIMESTAMP
+			|| query >= m_createInfo.queryCount )
+		{
+			return;
+		}
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		reinterpret_cast< uint64_t * >( m_data.data() )[query] = value;
+		m_available[query] = true;
+	}
+
+	VkResult QueryPool::doGetAvailability( uint32_t firstQuery
+		, uint32_t queryCount
+		, VkQueryResultFlags flags )const
+	{
+		// The results are only tracked for the timestamps, they're written once the submission has executed.
+		if ( flags & ( VK_QUERY_RESULT_WAIT_BIT | VK_QUERY_RESULT_PARTIAL_BIT ) )
+		{
+			return VK_SUCCESS;
+		}
+
+		for ( auto i = firstQuery; i < firstQuery + queryCount && i < m_available.size(); ++i )
+		{
+			if ( !m_available[i] )
+			{
+				return VK_NOT_READY;
+			}
+		}
+
+		return VK_SUCCESS;
+	}
 }
@@ -6,6 +6,8 @@ See LICENSE file in root folder
 
 #include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
 
+#include <mutex>
+
 namespace ashes::test
 {
 	class QueryPool
@@ -24,16 +26,35 @@ namespace ashes::test
 			, VkDeviceSize stride
 			, VkQueryResultFlags flags
 			, UInt64Array & data )const;
+		/**
+		*\brief
+		*	Makes the queries unavailable.
+		*/
+		void reset( uint32_t firstQuery
+			, uint32_t queryCount )const;
+		/**
+		*\brief
+		*	Writes a timestamp query, and makes it available.
+		*/
+		void writeTimestamp( uint32_t query
+			, uint64_t value )const;
 
 		inline VkDevice getDevice()const
 		{
 			return m_device;
 		}
 
+	private:
+		VkResult doGetAvailability( uint32_t firstQuery
+			, uint32_t queryCount
+			, VkQueryResultFlags flags )const;
+
 	private:
 		VkDevice m_device;
 		VkQueryPoolCreateInfo m_createInfo;
+		mutable std::mutex m_mutex;
 		mutable ByteArray m_data;
+		mutable std::vector< bool > m_available;
 		std::function< uint32_t( uint32_t ) > getUint32;
 		std::function< uint64_t( uint32_t ) > getUint64;
 	};
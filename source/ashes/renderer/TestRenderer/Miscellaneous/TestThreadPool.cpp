@@ -0,0 +1,202 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/TestThreadPool.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace ashes::test
+{
+	namespace
+	{
+		char const * const ThreadsEnvVar = "ASHES_TEST_THREADS";
+		// The chunks per worker, when a loop is split, so that stealing can balance uneven items.
+		uint32_t constexpr ChunksPerWorker = 4u;
+
+		uint32_t getThreadCount()
+		{
+			auto value = std::getenv( ThreadsEnvVar );
+
+			if ( value && *value )
+			{
+				auto count = std::atoi( value );
+
+				if ( count > 0 )
+				{
+					return uint32_t( count );
+				}
+			}
+
+			return std::max( 1u, std::thread::hardware_concurrency() );
+		}
+	}
+
+	ThreadPool::ThreadPool()
+	{
+		auto count = getThreadCount();
+
+		for ( uint32_t worker = 0u; worker < count; ++worker )
+		{
+			m_queues.emplace_back( std::make_unique< Queue >() );
+		}
+
+		for ( uint32_t worker = 1u; worker < count; ++worker )
+		{
+			m_threads.emplace_back( [this, worker]()
+				{
+					doThread( worker );
+				} );
+		}
+	}
+
+	ThreadPool::~ThreadPool()noexcept
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_stopped = true;
+		}
+
+		m_start.notify_all();
+
+		for ( auto & thread : m_threads )
+		{
+			thread.join();
+		}
+	}
+
+	void ThreadPool::run( uint32_t count
+		, Job const & job )
+	{
+		if ( !count )
+		{
+			return;
+		}
+
+		std::lock_guard< std::mutex > runLock{ m_runMutex };
+		auto workers = getWorkerCount();
+
+		if ( workers == 1u || count == 1u )
+		{
+			for ( uint32_t index = 0u; index < count; ++index )
+			{
+				job( index, 0u );
+			}
+
+			return;
+		}
+
+		// Each worker gets a contiguous part of the loop, split in chunks.
+		auto chunkSize = std::max( 1u, count / ( workers * ChunksPerWorker ) );
+
+		for ( uint32_t worker = 0u; worker < workers; ++worker )
+		{
+			auto begin = uint32_t( uint64_t( count ) * worker / workers );
+			auto end = uint32_t( uint64_t( count ) * ( worker + 1u ) / workers );
+			auto & queue = *m_queues[worker];
+			std::lock_guard< std::mutex > lock{ queue.mutex };
+
+			for ( auto index = begin; index < end; index += chunkSize )
+			{
+				queue.ranges.push_back( { index, std::min( end, index + chunkSize ) } );
+			}
+		}
+
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_job = &job;
+			m_busy = uint32_t( m_threads.size() );
+			++m_generation;
+		}
+
+		m_start.notify_all();
+		doWork( 0u );
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		m_end.wait( lock
+			, [this]()
+			{
+				return m_busy == 0u;
+			} );
+		m_job = nullptr;
+	}
+
+	bool ThreadPool::doGetWork( uint32_t worker
+		, Range & range )
+	{
+		{
+			auto & queue = *m_queues[worker];
+			std::lock_guard< std::mutex > lock{ queue.mutex };
+
+			if ( !queue.ranges.empty() )
+			{
+				range = queue.ranges.front();
+				queue.ranges.pop_front();
+				return true;
+			}
+		}
+
+		auto workers = getWorkerCount();
+
+		for ( uint32_t i = 1u; i < workers; ++i )
+		{
+			auto & queue = *m_queues[( worker + i ) % workers];
+			std::lock_guard< std::mutex > lock{ queue.mutex };
+
+			if ( !queue.ranges.empty() )
+			{
+				range = queue.ranges.back();
+				queue.ranges.pop_back();
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void ThreadPool::doWork( uint32_t worker )
+	{
+		Range range{};
+
+		while ( doGetWork( worker, range ) )
+		{
+			for ( auto index = range.begin; index < range.end; ++index )
+			{
+				( *m_job )( index, worker );
+			}
+		}
+	}
+
+	void ThreadPool::doThread( uint32_t worker )
+	{
+		uint64_t generation{};
+
+		while ( true )
+		{
+			{
+				std::unique_lock< std::mutex > lock{ m_mutex };
+				m_start.wait( lock
+					, [this, &generation]()
+					{
+						return m_stopped || m_generation != generation;
+					} );
+
+				if ( m_stopped )
+				{
+					return;
+				}
+
+				generation = m_generation;
+			}
+
+			doWork( worker );
+
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				--m_busy;
+			}
+
+			m_end.notify_one();
+		}
+	}
+}
@@ -0,0 +1,85 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace ashes::test
+{
+	/**
+	*\brief
+	*	Runs the items of a parallel loop on a fixed set of threads.
+	*\remarks
+	*	The items are split in contiguous chunks, distributed among per worker queues.
+	*	A worker takes its own chunks in order, and steals from the end of the others' queues once its queue is empty.
+	*	The calling thread is the worker 0, the thread count is read from ASHES_TEST_THREADS,
+	*	and defaults to the hardware concurrency.
+	*/
+	class ThreadPool
+	{
+	public:
+		/**
+		*\param index
+		*	The item index.
+		*\param worker
+		*	The index of the worker running the item, in [0, getWorkerCount()).
+		*/
+		using Job = std::function< void( uint32_t index, uint32_t worker ) >;
+
+	public:
+		ThreadPool();
+		~ThreadPool()noexcept;
+		/**
+		*\brief
+		*	Runs the job for each index in [0, count), and returns once they are all done.
+		*\remarks
+		*	Concurrent calls are run one after the other.
+		*/
+		void run( uint32_t count
+			, Job const & job );
+
+		inline uint32_t getWorkerCount()const noexcept
+		{
+			return uint32_t( m_queues.size() );
+		}
+
+	private:
+		struct Range
+		{
+			uint32_t begin;
+			uint32_t end;
+		};
+
+		struct Queue
+		{
+			std::mutex mutex;
+			std::deque< Range > ranges;
+		};
+
+	private:
+		bool doGetWork( uint32_t worker
+			, Range & range );
+		void doWork( uint32_t worker );
+		void doThread( uint32_t worker );
+
+	private:
+		std::vector< std::unique_ptr< Queue > > m_queues;
+		std::vector< std::thread > m_threads;
+		std::mutex m_runMutex;
+		std::mutex m_mutex;
+		std::condition_variable m_start;
+		std::condition_variable m_end;
+		Job const * m_job{};
+		uint64_t m_generation{};
+		uint32_t m_busy{};
+		bool m_stopped{};
+	};
+}
@@ -0,0 +1,1606 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/TestTransferKernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined( _M_X64 ) || defined( __x86_64__ )
+#	define AshesTest_X64 1
+#	include <immintrin.h>
+#	if defined( _MSC_VER )
+#		include <intrin.h>
+#		define AshesTest_TargetAvx2
+#	else
+#		define AshesTest_TargetAvx2 __attribute__( ( target( "avx2" ) ) )
+#	endif
+#else
+#	define AshesTest_X64 0
+#endif
+
+namespace ashes::test
+{
+	//*********************************************************************************************
+
+	namespace
+	{
+		char const * const SimdEnvVar = "ASHES_TEST_SIMD";
+		// From this size on, copies use non temporal stores, to leave the caches alone.
+		VkDeviceSize constexpr StreamingCopyThreshold = 1024u * 1024u;
+
+		enum class SimdLevel
+		{
+			eNone,
+			eSse2,
+			eAvx2,
+		};
+
+		SimdLevel detectSimdLevel()
+		{
+#if AshesTest_X64
+#	if defined( _MSC_VER )
+			int info[4]{};
+			__cpuid( info, 0 );
+			bool avx2 = false;
+
+			if ( info[0] >= 7 )
+			{
+				__cpuid( info, 1 );
+				auto osxsave = ( info[2] & ( 1 << 27 ) ) != 0;
+				auto avx = ( info[2] & ( 1 << 28 ) ) != 0;
+				__cpuidex( info, 7, 0 );
+				avx2 = osxsave
+					&& avx
+					&& ( info[1] & ( 1 << 5 ) ) != 0
+					&& ( _xgetbv( 0 ) & 0x6u ) == 0x6u;
+			}
+#	else
+			__builtin_cpu_init();
+			bool avx2 = __builtin_cpu_supports( "avx2" ) != 0;
+#	endif
+			// SSE2 is part of x86-64.
+			auto result = avx2
+				? SimdLevel::eAvx2
+				: SimdLevel::eSse2;
+#else
+			auto result = SimdLevel::eNone;
+#endif
+
+			if ( auto value = std::getenv( SimdEnvVar ) )
+			{
+				std::string name{ value };
+
+				if ( name == "none" )
+				{
+					result = SimdLevel::eNone;
+				}
+				else if ( name == "sse2" )
+				{
+					result = std::min( result, SimdLevel::eSse2 );
+				}
+			}
+
+			return result;
+		}
+
+		SimdLevel getSimdLevel()
+		{
+			static SimdLevel const result = detectSimdLevel();
+			return result;
+		}
+
+		//*****************************************************************************************
+
+		void fillScalar( uint8_t * dst
+			, VkDeviceSize size
+			, uint8_t const * pattern
+			, uint32_t patternSize )
+		{
+			// Writes the pattern once, then doubles the written range.
+			auto written = std::min( size, VkDeviceSize( patternSize ) );
+			std::memcpy( dst, pattern, size_t( written ) );
+
+			while ( written < size )
+			{
+				auto count = std::min( written, size - written );
+				std::memcpy( dst + written, dst, size_t( count ) );
+				written += count;
+			}
+		}
+
+		// Averages 2x2 texels blocks, of texelSize 8 bits channels.
+		void downsampleRowScalar( uint8_t * dst
+			, uint8_t const * src0
+			, uint8_t const * src1
+			, uint32_t texelSize
+			, uint32_t count )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				for ( uint32_t c = 0u; c < texelSize; ++c )
+				{
+					auto left = i * 2u * texelSize + c;
+					auto right = left + texelSize;
+					dst[i * texelSize + c] = uint8_t( ( uint32_t( src0[left] )
+						+ src0[right]
+						+ src1[left]
+						+ src1[right]
+						+ 2u ) >> 2u );
+				}
+			}
+		}
+
+#if AshesTest_X64
+
+		void copySse2( uint8_t * dst
+			, uint8_t const * src
+			, VkDeviceSize size )
+		{
+			// The non temporal stores need an aligned destination.
+			auto head = std::min( size, VkDeviceSize( ( 16u - ( uintptr_t( dst ) & 15u ) ) & 15u ) );
+			std::memcpy( dst, src, size_t( head ) );
+			auto index = head;
+
+			for ( ; index + 64u <= size; index += 64u )
+			{
+				auto s = reinterpret_cast< __m128i const * >( src + index );
+				auto d = reinterpret_cast< __m128i * >( dst + index );
+				auto v0 = _mm_loadu_si128( s + 0 );
+				auto v1 = _mm_loadu_si128( s + 1 );
+				auto v2 = _mm_loadu_si128( s + 2 );
+				auto v3 = _mm_loadu_si128( s + 3 );
+				_mm_stream_si128( d + 0, v0 );
+				_mm_stream_si128( d + 1, v1 );
+				_mm_stream_si128( d + 2, v2 );
+				_mm_stream_si128( d + 3, v3 );
+			}
+
+			_mm_sfence();
+			std::memcpy( dst + index, src + index, size_t( size - index ) );
+		}
+
+		AshesTest_TargetAvx2 void copyAvx2( uint8_t * dst
+			, uint8_t const * src
+			, VkDeviceSize size )
+		{
+			auto head = std::min( size, VkDeviceSize( ( 32u - ( uintptr_t( dst ) & 31u ) ) & 31u ) );
+			std::memcpy( dst, src, size_t( head ) );
+			auto index = head;
+
+			for ( ; index + 128u <= size; index += 128u )
+			{
+				auto s = reinterpret_cast< __m256i const * >( src + index );
+				auto d = reinterpret_cast< __m256i * >( dst + index );
+				auto v0 = _mm256_loadu_si256( s + 0 );
+				auto v1 = _mm256_loadu_si256( s + 1 );
+				auto v2 = _mm256_loadu_si256( s + 2 );
+				auto v3 = _mm256_loadu_si256( s + 3 );
+				_mm256_stream_si256( d + 0, v0 );
+				_mm256_stream_si256( d + 1, v1 );
+				_mm256_stream_si256( d + 2, v2 );
+				_mm256_stream_si256( d + 3, v3 );
+			}
+
+			_mm_sfence();
+			std::memcpy( dst + index, src + index, size_t( size - index ) );
+		}
+
+		// block holds 32 bytes of the repeated pattern.
+		void fillSse2( uint8_t * dst
+			, VkDeviceSize size
+			, uint8_t const * block )
+		{
+			auto value = _mm_loadu_si128( reinterpret_cast< __m128i const * >( block ) );
+			VkDeviceSize index = 0u;
+
+			for ( ; index + 64u <= size; index += 64u )
+			{
+				auto d = reinterpret_cast< __m128i * >( dst + index );
+				_mm_storeu_si128( d + 0, value );
+				_mm_storeu_si128( d + 1, value );
+				_mm_storeu_si128( d + 2, value );
+				_mm_storeu_si128( d + 3, value );
+			}
+
+			for ( ; index + 16u <= size; index += 16u )
+			{
+				_mm_storeu_si128( reinterpret_cast< __m128i * >( dst + index ), value );
+			}
+
+			std::memcpy( dst + index, block, size_t( size - index ) );
+		}
+
+		AshesTest_TargetAvx2 void fillAvx2( uint8_t * dst
+			, VkDeviceSize size
+			, uint8_t const * block )
+		{
+			auto value = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( block ) );
+			VkDeviceSize index = 0u;
+
+			for ( ; index + 128u <= size; index += 128u )
+			{
+				auto d = reinterpret_cast< __m256i * >( dst + index );
+				_mm256_storeu_si256( d + 0, value );
+				_mm256_storeu_si256( d + 1, value );
+				_mm256_storeu_si256( d + 2, value );
+				_mm256_storeu_si256( d + 3, value );
+			}
+
+			for ( ; index + 32u <= size; index += 32u )
+			{
+				_mm256_storeu_si256( reinterpret_cast< __m256i * >( dst + index ), value );
+			}
+
+			std::memcpy( dst + index, block, size_t( size - index ) );
+		}
+
+		// 2 destination texels, of 4 8 bits channels, per iteration.
+		void downsampleRowSse2( uint8_t * dst
+			, uint8_t const * src0
+			, uint8_t const * src1
+			, uint32_t count )
+		{
+			auto zero = _mm_setzero_si128();
+			auto rounding = _mm_set1_epi16( 2 );
+			uint32_t i = 0u;
+
+			for ( ; i + 2u <= count; i += 2u )
+			{
+				auto r0 = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src0 + i * 8u ) );
+				auto r1 = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src1 + i * 8u ) );
+				// Vertical sums, lo holds texels 0 and 1, hi holds texels 2 and 3.
+				auto lo = _mm_add_epi16( _mm_unpacklo_epi8( r0, zero ), _mm_unpacklo_epi8( r1, zero ) );
+				auto hi = _mm_add_epi16( _mm_unpackhi_epi8( r0, zero ), _mm_unpackhi_epi8( r1, zero ) );
+				// Horizontal sums: ( 0 + 1, 2 + 3 ).
+				auto sum = _mm_add_epi16( _mm_unpacklo_epi64( lo, hi ), _mm_unpackhi_epi64( lo, hi ) );
+				sum = _mm_srli_epi16( _mm_add_epi16( sum, rounding ), 2 );
+				_mm_storel_epi64( reinterpret_cast< __m128i * >( dst + i * 4u ), _mm_packus_epi16( sum, sum ) );
+			}
+
+			downsampleRowScalar( dst + i * 4u, src0 + i * 8u, src1 + i * 8u, 4u, count - i );
+		}
+
+		// 4 destination texels, of 4 8 bits channels, per iteration.
+		AshesTest_TargetAvx2 void downsampleRowAvx2( uint8_t * dst
+			, uint8_t const * src0
+			, uint8_t const * src1
+			, uint32_t count )
+		{
+			auto zero = _mm256_setzero_si256();
+			auto rounding = _mm256_set1_epi16( 2 );
+			uint32_t i = 0u;
+
+			for ( ; i + 4u <= count; i += 4u )
+			{
+				auto r0 = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( src0 + i * 8u ) );
+				auto r1 = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( src1 + i * 8u ) );
+				// Same as the SSE2 version, in each 128 bits lane.
+				auto lo = _mm256_add_epi16( _mm256_unpacklo_epi8( r0, zero ), _mm256_unpacklo_epi8( r1, zero ) );
+				auto hi = _mm256_add_epi16( _mm256_unpackhi_epi8( r0, zero ), _mm256_unpackhi_epi8( r1, zero ) );
+				auto sum = _mm256_add_epi16( _mm256_unpacklo_epi64( lo, hi ), _mm256_unpackhi_epi64( lo, hi ) );
+				sum = _mm256_srli_epi16( _mm256_add_epi16( sum, rounding ), 2 );
+				// Gathers each lane's packed texels in the low 128 bits.
+				auto packed = _mm256_permute4x64_epi64( _mm256_packus_epi16( sum, sum ), 0xD8 );
+				_mm_storeu_si128( reinterpret_cast< __m128i * >( dst + i * 4u ), _mm256_castsi256_si128( packed ) );
+			}
+
+			downsampleRowSse2( dst + i * 4u, src0 + i * 8u, src1 + i * 8u, count - i );
+		}
+
+#endif
+
+		//*****************************************************************************************
+
+		enum class ChannelType
+			: uint8_t
+		{
+			eUnorm,
+			eSnorm,
+			eUint,
+			eSint,
+			eSfloat,
+			eSrgb,
+		};
+
+		struct TexelFormat
+		{
+			ChannelType type{};
+			// The channels byte size, for non packed formats.
+			uint32_t channelSize{};
+			uint32_t channelCount{};
+			// The RGBA component held by each channel, in memory order.
+			std::array< uint8_t, 4u > components{ 0u, 1u, 2u, 3u };
+			// For packed formats, the texel byte size, and each RGBA component's bit width and shift.
+			uint32_t packedSize{};
+			std::array< uint8_t, 4u > bits{};
+			std::array< uint8_t, 4u > shifts{};
+		};
+
+		TexelFormat makeChannels( ChannelType type
+			, uint32_t channelSize
+			, uint32_t channelCount
+			, bool bgr = false )
+		{
+			TexelFormat result;
+			result.type = type;
+			result.channelSize = channelSize;
+			result.channelCount = channelCount;
+
+			if ( bgr )
+			{
+				result.components = { 2u, 1u, 0u, 3u };
+			}
+
+			return result;
+		}
+
+		TexelFormat makePacked( ChannelType type
+			, uint32_t size
+			, std::array< uint8_t, 4u > bits
+			, std::array< uint8_t, 4u > shifts )
+		{
+			TexelFormat result;
+			result.type = type;
+			result.packedSize = size;
+			result.bits = bits;
+			result.shifts = shifts;
+			return result;
+		}
+
+		bool getTexelFormat( VkFormat format
+			, TexelFormat & result )
+		{
+			using Type = ChannelType;
+
+			switch ( format )
+			{
+			case VK_FORMAT_R8_UNORM: result = makeChannels( Type::eUnorm, 1u, 1u ); break;
+			case VK_FORMAT_R8_SNORM: result = makeChannels( Type::eSnorm, 1u, 1u ); break;
+			case VK_FORMAT_R8_UINT: result = makeChannels( Type::eUint, 1u, 1u ); break;
+			case VK_FORMAT_R8_SINT: result = makeChannels( Type::eSint, 1u, 1u ); break;
+			case VK_FORMAT_R8_SRGB: result = makeChannels( Type::eSrgb, 1u, 1u ); break;
+			case VK_FORMAT_R8G8_UNORM: result = makeChannels( Type::eUnorm, 1u, 2u ); break;
+			case VK_FORMAT_R8G8_SNORM: result = makeChannels( Type::eSnorm, 1u, 2u ); break;
+			case VK_FORMAT_R8G8_UINT: result = makeChannels( Type::eUint, 1u, 2u ); break;
+			case VK_FORMAT_R8G8_SINT: result = makeChannels( Type::eSint, 1u, 2u ); break;
+			case VK_FORMAT_R8G8_SRGB: result = makeChannels( Type::eSrgb, 1u, 2u ); break;
+			case VK_FORMAT_R8G8B8_UNORM: result = makeChannels( Type::eUnorm, 1u, 3u ); break;
+			case VK_FORMAT_R8G8B8_SNORM: result = makeChannels( Type::eSnorm, 1u, 3u ); break;
+			case VK_FORMAT_R8G8B8_UINT: result = makeChannels( Type::eUint, 1u, 3u ); break;
+			case VK_FORMAT_R8G8B8_SINT: result = makeChannels( Type::eSint, 1u, 3u ); break;
+			case VK_FORMAT_R8G8B8_SRGB: result = makeChannels( Type::eSrgb, 1u, 3u ); break;
+			case VK_FORMAT_B8G8R8_UNORM: result = makeChannels( Type::eUnorm, 1u, 3u, true ); break;
+			case VK_FORMAT_B8G8R8_SNORM: result = makeChannels( Type::eSnorm, 1u, 3u, true ); break;
+			case VK_FORMAT_B8G8R8_UINT: result = makeChannels( Type::eUint, 1u, 3u, true ); break;
+			case VK_FORMAT_B8G8R8_SINT: result = makeChannels( Type::eSint, 1u, 3u, true ); break;
+			case VK_FORMAT_B8G8R8_SRGB: result = makeChannels( Type::eSrgb, 1u, 3u, true ); break;
+			case VK_FORMAT_R8G8B8A8_UNORM:
+			case VK_FORMAT_A8B8G8R8_UNORM_PACK32: result = makeChannels( Type::eUnorm, 1u, 4u ); break;
+			case VK_FORMAT_R8G8B8A8_SNORM:
+			case VK_FORMAT_A8B8G8R8_SNORM_PACK32: result = makeChannels( Type::eSnorm, 1u, 4u ); break;
+			case VK_FORMAT_R8G8B8A8_UINT:
+			case VK_FORMAT_A8B8G8R8_UINT_PACK32: result = makeChannels( Type::eUint, 1u, 4u ); break;
+			case VK_FORMAT_R8G8B8A8_SINT:
+			case VK_FORMAT_A8B8G8R8_SINT_PACK32: result = makeChannels( Type::eSint, 1u, 4u ); break;
+			case VK_FORMAT_R8G8B8A8_SRGB:
+			case VK_FORMAT_A8B8G8R8_SRGB_PACK32: result = makeChannels( Type::eSrgb, 1u, 4u ); break;
+			case VK_FORMAT_B8G8R8A8_UNORM: result = makeChannels( Type::eUnorm, 1u, 4u, true ); break;
+			case VK_FORMAT_B8G8R8A8_SNORM: result = makeChannels( Type::eSnorm, 1u, 4u, true ); break;
+			case VK_FORMAT_B8G8R8A8_UINT: result = makeChannels( Type::eUint, 1u, 4u, true ); break;
+			case VK_FORMAT_B8G8R8A8_SINT: result = makeChannels( Type::eSint, 1u, 4u, true ); break;
+			case VK_FORMAT_B8G8R8A8_SRGB: result = makeChannels( Type::eSrgb, 1u, 4u, true ); break;
+			case VK_FORMAT_R16_UNORM:
+			case VK_FORMAT_D16_UNORM: result = makeChannels( Type::eUnorm, 2u, 1u ); break;
+			case VK_FORMAT_R16_SNORM: result = makeChannels( Type::eSnorm, 2u, 1u ); break;
+			case VK_FORMAT_R16_UINT: result = makeChannels( Type::eUint, 2u, 1u ); break;
+			case VK_FORMAT_R16_SINT: result = makeChannels( Type::eSint, 2u, 1u ); break;
+			case VK_FORMAT_R16_SFLOAT: result = makeChannels( Type::eSfloat, 2u, 1u ); break;
+			case VK_FORMAT_R16G16_UNORM: result = makeChannels( Type::eUnorm, 2u, 2u ); break;
+			case VK_FORMAT_R16G16_SNORM: result = makeChannels( Type::eSnorm, 2u, 2u ); break;
+			case VK_FORMAT_R16G16_UINT: result = makeChannels( Type::eUint, 2u, 2u ); break;
+			case VK_FORMAT_R16G16_SINT: result = makeChannels( Type::eSint, 2u, 2u ); break;
+			case VK_FORMAT_R16G16_SFLOAT: result = makeChannels( Type::eSfloat, 2u, 2u ); break;
+			case VK_FORMAT_R16G16B16_UNORM: result = makeChannels( Type::eUnorm, 2u, 3u ); break;
+			case VK_FORMAT_R16G16B16_SNORM: result = makeChannels( Type::eSnorm, 2u, 3u ); break;
+			case VK_FORMAT_R16G16B16_UINT: result = makeChannels( Type::eUint, 2u, 3u ); break;
+			case VK_FORMAT_R16G16B16_SINT: result = makeChannels( Type::eSint, 2u, 3u ); break;
+			case VK_FORMAT_R16G16B16_SFLOAT: result = makeChannels( Type::eSfloat, 2u, 3u ); break;
+			case VK_FORMAT_R16G16B16A16_UNORM: result = makeChannels( Type::eUnorm, 2u, 4u ); break;
+			case VK_FORMAT_R16G16B16A16_SNORM: result = makeChannels( Type::eSnorm, 2u, 4u ); break;
+			case VK_FORMAT_R16G16B16A16_UINT: result = makeChannels( Type::eUint, 2u, 4u ); break;
+			case VK_FORMAT_R16G16B16A16_SINT: result = makeChannels( Type::eSint, 2u, 4u ); break;
+			case VK_FORMAT_R16G16B16A16_SFLOAT: result = makeChannels( Type::eSfloat, 2u, 4u ); break;
+			case VK_FORMAT_R32_UINT: result = makeChannels( Type::eUint, 4u, 1u ); break;
+			case VK_FORMAT_R32_SINT: result = makeChannels( Type::eSint, 4u, 1u ); break;
+			case VK_FORMAT_R32_SFLOAT:
+			case VK_FORMAT_D32_SFLOAT: result = makeChannels( Type::eSfloat, 4u, 1u ); break;
+			case VK_FORMAT_R32G32_UINT: result = makeChannels( Type::eUint, 4u, 2u ); break;
+			case VK_FORMAT_R32G32_SINT: result = makeChannels( Type::eSint, 4u, 2u ); break;
+			case VK_FORMAT_R32G32_SFLOAT: result = makeChannels( Type::eSfloat, 4u, 2u ); break;
+			case VK_FORMAT_R32G32B32_UINT: result = makeChannels( Type::eUint, 4u, 3u ); break;
+			case VK_FORMAT_R32G32B32_SINT: result = makeChannels( Type::eSint, 4u, 3u ); break;
+			case VK_FORMAT_R32G32B32_SFLOAT: result = makeChannels( Type::eSfloat, 4u, 3u ); break;
+			case VK_FORMAT_R32G32B32A32_UINT: result = makeChannels( Type::eUint, 4u, 4u ); break;
+			case VK_FORMAT_R32G32B32A32_SINT: result = makeChannels( Type::eSint, 4u, 4u ); break;
+			case VK_FORMAT_R32G32B32A32_SFLOAT: result = makeChannels( Type::eSfloat, 4u, 4u ); break;
+			case VK_FORMAT_R4G4B4A4_UNORM_PACK16: result = makePacked( Type::eUnorm, 2u, { 4u, 4u, 4u, 4u }, { 12u, 8u, 4u, 0u } ); break;
+			case VK_FORMAT_B4G4R4A4_UNORM_PACK16: result = makePacked( Type::eUnorm, 2u, { 4u, 4u, 4u, 4u }, { 4u, 8u, 12u, 0u } ); break;
+			case VK_FORMAT_R5G6B5_UNORM_PACK16: result = makePacked( Type::eUnorm, 2u, { 5u, 6u, 5u, 0u }, { 11u, 5u, 0u, 0u } ); break;
+			case VK_FORMAT_B5G6R5_UNORM_PACK16: result = makePacked( Type::eUnorm, 2u, { 5u, 6u, 5u, 0u }, { 0u, 5u, 11u, 0u } ); break;
+			case VK_FORMAT_R5G5B5A1_UNORM_PACK16: result = makePacked( Type::eUnorm, 2u, { 5u, 5u, 5u, 1u }, { 11u, 6u, 1u, 0u } ); break;
+			case VK_FORMAT_B5G5R5A1_UNORM_PACK16: result = makePacked( Type::eUnorm, 2u, { 5u, 5u, 5u, 1u }, { 1u, 6u, 11u, 0u } ); break;
+			case VK_FORMAT_A1R5G5B5_UNORM_PACK16: result = makePacked( Type::eUnorm, 2u, { 5u, 5u, 5u, 1u }, { 10u, 5u, 0u, 15u } ); break;
+			case VK_FORMAT_A2R10G10B10_UNORM_PACK32: result = makePacked( Type::eUnorm, 4u, { 10u, 10u, 10u, 2u }, { 20u, 10u, 0u, 30u } ); break;
+			case VK_FORMAT_A2R10G10B10_UINT_PACK32: result = makePacked( Type::eUint, 4u, { 10u, 10u, 10u, 2u }, { 20u, 10u, 0u, 30u } ); break;
+			case VK_FORMAT_A2B10G10R10_UNORM_PACK32: result = makePacked( Type::eUnorm, 4u, { 10u, 10u, 10u, 2u }, { 0u, 10u, 20u, 30u } ); break;
+			case VK_FORMAT_A2B10G10R10_UINT_PACK32: result = makePacked( Type::eUint, 4u, { 10u, 10u, 10u, 2u }, { 0u, 10u, 20u, 30u } ); break;
+			case VK_FORMAT_X8_D24_UNORM_PACK32: result = makePacked( Type::eUnorm, 4u, { 24u, 0u, 0u, 0u }, { 0u, 0u, 0u, 0u } ); break;
+			default:
+				return false;
+			}
+
+			return true;
+		}
+
+		bool isIntegerType( ChannelType type )
+		{
+			return type == ChannelType::eUint
+				|| type == ChannelType::eSint;
+		}
+
+		//*****************************************************************************************
+
+		float srgbToLinear( float value )
+		{
+			return value <= 0.04045f
+				? value / 12.92f
+				: std::pow( ( value + 0.055f ) / 1.055f, 2.4f );
+		}
+
+		float linearToSrgb( float value )
+		{
+			return value <= 0.0031308f
+				? value * 12.92f
+				: 1.055f * std::pow( value, 1.0f / 2.4f ) - 0.055f;
+		}
+
+		struct SrgbTable
+		{
+			SrgbTable()
+			{
+				for ( uint32_t i = 0u; i < 256u; ++i )
+				{
+					values[i] = srgbToLinear( float( i ) / 255.0f );
+				}
+			}
+
+			std::array< float, 256u > values;
+		};
+
+		float decodeSrgb8( uint8_t value )
+		{
+			static SrgbTable const table;
+			return table.values[value];
+		}
+
+		uint32_t encodeUnorm( float value
+			, uint32_t bits )
+		{
+			auto max = double( ( uint64_t( 1u ) << bits ) - 1u );
+			auto clamped = std::min( std::max( double( value ), 0.0 ), 1.0 );
+			return uint32_t( std::floor( clamped * max + 0.5 ) );
+		}
+
+		uint32_t encodeSnorm( float value
+			, uint32_t bits )
+		{
+			auto max = double( ( uint64_t( 1u ) << ( bits - 1u ) ) - 1u );
+			auto clamped = std::min( std::max( double( value ), -1.0 ), 1.0 );
+			return uint32_t( int32_t( std::floor( clamped * max + 0.5 ) ) );
+		}
+
+		uint32_t encodeUint( float value
+			, uint32_t bits )
+		{
+			auto max = double( ( uint64_t( 1u ) << bits ) - 1u );
+			return uint32_t( std::floor( std::min( std::max( double( value ), 0.0 ), max ) + 0.5 ) );
+		}
+
+		uint32_t encodeSint( float value
+			, uint32_t bits )
+		{
+			auto max = double( ( uint64_t( 1u ) << ( bits - 1u ) ) - 1u );
+			return uint32_t( int32_t( std::floor( std::min( std::max( double( value ), -max - 1.0 ), max ) + 0.5 ) ) );
+		}
+
+		int32_t signExtend( uint32_t value
+			, uint32_t bits )
+		{
+			auto shift = 32u - bits;
+			return int32_t( value << shift ) >> shift;
+		}
+
+		float decodeChannel( ChannelType type
+			, uint32_t size
+			, uint8_t const * src )
+		{
+			uint32_t value{};
+			std::memcpy( &value, src, size );
+			auto bits = size * 8u;
+
+			switch ( type )
+			{
+			case ChannelType::eUnorm:
+				return float( double( value ) / double( ( uint64_t( 1u ) << bits ) - 1u ) );
+			case ChannelType::eSnorm:
+				return std::max( -1.0f
+					, float( double( signExtend( value, bits ) ) / double( ( uint64_t( 1u ) << ( bits - 1u ) ) - 1u ) ) );
+			case ChannelType::eUint:
+				return float( value );
+			case ChannelType::eSint:
+				return float( signExtend( value, bits ) );
+			case ChannelType::eSfloat:
+				if ( size == 2u )
+				{
+					return halfToFloat( uint16_t( value ) );
+				}
+				else
+				{
+					float result;
+					std::memcpy( &result, &value, sizeof( result ) );
+					return result;
+				}
+			case ChannelType::eSrgb:
+				return decodeSrgb8( uint8_t( value ) );
+			default:
+				return 0.0f;
+			}
+		}
+
+		void encodeChannel( ChannelType type
+			, uint32_t size
+			, float value
+			, uint8_t * dst )
+		{
+			uint32_t result{};
+			auto bits = size * 8u;
+
+			switch ( type )
+			{
+			case ChannelType::eUnorm:
+				result = encodeUnorm( value, bits );
+				break;
+			case ChannelType::eSnorm:
+				result = encodeSnorm( value, bits );
+				break;
+			case ChannelType::eUint:
+				result = encodeUint( value, bits );
+				break;
+			case ChannelType::eSint:
+				result = encodeSint( value, bits );
+				break;
+			case ChannelType::eSfloat:
+				if ( size == 2u )
+				{
+					result = floatToHalf( value );
+				}
+				else
+				{
+					std::memcpy( &result, &value, sizeof( result ) );
+				}
+				break;
+			case ChannelType::eSrgb:
+				result = encodeUnorm( linearToSrgb( std::min( std::max( value, 0.0f ), 1.0f ) ), bits );
+				break;
+			default:
+				break;
+			}
+
+			std::memcpy( dst, &result, size );
+		}
+
+		void decodeTexel( TexelFormat const & format
+			, uint8_t const * texel
+			, float * rgba )
+		{
+			rgba[0] = 0.0f;
+			rgba[1] = 0.0f;
+			rgba[2] = 0.0f;
+			rgba[3] = 1.0f;
+
+			if ( format.packedSize )
+			{
+				uint32_t value{};
+				std::memcpy( &value, texel, format.packedSize );
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					if ( format.bits[c] )
+					{
+						auto mask = uint32_t( ( uint64_t( 1u ) << format.bits[c] ) - 1u );
+						auto component = ( value >> format.shifts[c] ) & mask;
+						rgba[c] = format.type == ChannelType::eUint
+							? float( component )
+							: float( component ) / float( mask );
+					}
+				}
+
+				return;
+			}
+
+			for ( uint32_t i = 0u; i < format.channelCount; ++i )
+			{
+				auto component = format.components[i];
+				// The alpha channel of sRGB formats is linear.
+				auto type = ( format.type == ChannelType::eSrgb && component == 3u )
+					? ChannelType::eUnorm
+					: format.type;
+				rgba[component] = decodeChannel( type
+					, format.channelSize
+					, texel + i * format.channelSize );
+			}
+		}
+
+		void encodeTexel( TexelFormat const & format
+			, float const * rgba
+			, uint8_t * texel )
+		{
+			if ( format.packedSize )
+			{
+				uint32_t value{};
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					if ( format.bits[c] )
+					{
+						auto component = format.type == ChannelType::eUint
+							? encodeUint( rgba[c], format.bits[c] )
+							: encodeUnorm( rgba[c], format.bits[c] );
+						value |= component << format.shifts[c];
+					}
+				}
+
+				std::memcpy( texel, &value, format.packedSize );
+				return;
+			}
+
+			for ( uint32_t i = 0u; i < format.channelCount; ++i )
+			{
+				auto component = format.components[i];
+				auto type = ( format.type == ChannelType::eSrgb && component == 3u )
+					? ChannelType::eUnorm
+					: format.type;
+				encodeChannel( type
+					, format.channelSize
+					, rgba[component]
+					, texel + i * format.channelSize );
+			}
+		}
+
+		// Integer clear values are truncated to the channel size, without any conversion.
+		void encodeIntegerTexel( TexelFormat const & format
+			, uint32_t const * rgba
+			, uint8_t * texel )
+		{
+			if ( format.packedSize )
+			{
+				uint32_t value{};
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					if ( format.bits[c] )
+					{
+						auto mask = uint32_t( ( uint64_t( 1u ) << format.bits[c] ) - 1u );
+						value |= ( rgba[c] & mask ) << format.shifts[c];
+					}
+				}
+
+				std::memcpy( texel, &value, format.packedSize );
+				return;
+			}
+
+			for ( uint32_t i = 0u; i < format.channelCount; ++i )
+			{
+				auto value = rgba[format.components[i]];
+				std::memcpy( texel + i * format.channelSize, &value, format.channelSize );
+			}
+		}
+
+		//*****************************************************************************************
+
+		uint8_t * getTexel( SubresourceData const & data
+			, uint32_t x
+			, uint32_t y
+			, uint32_t z )
+		{
+			return data.data
+				+ z * data.depthPitch
+				+ y * data.rowPitch
+				+ x * VkDeviceSize( data.texelSize );
+		}
+
+		bool isWholeTexel( SubresourceData const & data )
+		{
+			return data.aspectOffset == 0u
+				&& data.aspectSize == data.texelSize;
+		}
+
+		// Shrinks the extent, so that the region lies inside the data.
+		VkExtent3D clip( SubresourceData const & data
+			, VkOffset3D const & offset
+			, VkExtent3D extent )
+		{
+			auto clipOne = []( int32_t offset
+				, uint32_t size
+				, uint32_t limit )
+			{
+				return offset < 0 || uint32_t( offset ) >= limit
+					? 0u
+					: std::min( size, limit - uint32_t( offset ) );
+			};
+			extent.width = clipOne( offset.x, extent.width, data.extent.width );
+			extent.height = clipOne( offset.y, extent.height, data.extent.height );
+			extent.depth = clipOne( offset.z, extent.depth, data.extent.depth );
+			return extent;
+		}
+
+		int32_t clampCoord( int32_t value
+			, uint32_t size )
+		{
+			return std::min( std::max( value, 0 ), int32_t( size ) - 1 );
+		}
+
+		// Decodes rows of a subresource, keeping the last few ones.
+		class RowCache
+		{
+		public:
+			RowCache( TexelFormat const & format
+				, SubresourceData const & data )
+				: m_format{ format }
+				, m_data{ data }
+			{
+				for ( auto & row : m_rows )
+				{
+					row.texels.resize( size_t( data.extent.width ) * 4u );
+				}
+			}
+
+			float const * get( uint32_t y
+				, uint32_t z )
+			{
+				for ( auto & row : m_rows )
+				{
+					if ( row.y == y && row.z == z )
+					{
+						return row.texels.data();
+					}
+				}
+
+				auto & row = m_rows[m_next];
+				m_next = ( m_next + 1u ) % m_rows.size();
+				row.y = y;
+				row.z = z;
+				auto src = getTexel( m_data, 0u, y, z );
+
+				for ( uint32_t x = 0u; x < m_data.extent.width; ++x )
+				{
+					decodeTexel( m_format, src, &row.texels[x * 4u] );
+					src += m_data.texelSize;
+				}
+
+				return row.texels.data();
+			}
+
+		private:
+			struct Row
+			{
+				uint32_t y{ ~( 0u ) };
+				uint32_t z{ ~( 0u ) };
+				std::vector< float > texels;
+			};
+
+			TexelFormat const & m_format;
+			SubresourceData const & m_data;
+			// Enough for trilinear filtering.
+			std::array< Row, 4u > m_rows;
+			size_t m_next{};
+		};
+
+		// The source taps, along one axis, for a destination coordinate.
+		struct Taps
+		{
+			int32_t index[2];
+			float weight;
+		};
+
+		std::vector< Taps > computeTaps( int32_t dst0
+			, int32_t dst1
+			, int32_t src0
+			, int32_t src1
+			, int32_t begin
+			, int32_t end
+			, uint32_t srcSize
+			, bool linear )
+		{
+			std::vector< Taps > result;
+			result.reserve( size_t( end - begin ) );
+			auto scale = float( src1 - src0 ) / float( dst1 - dst0 );
+
+			for ( auto dst = begin; dst < end; ++dst )
+			{
+				auto coord = float( src0 ) + ( float( dst ) + 0.5f - float( dst0 ) ) * scale;
+
+				if ( linear )
+				{
+					coord -= 0.5f;
+					auto base = std::floor( coord );
+					auto index = int32_t( base );
+					result.push_back( { { clampCoord( index, srcSize ), clampCoord( index + 1, srcSize ) }
+						, coord - base } );
+				}
+				else
+				{
+					auto index = clampCoord( int32_t( std::floor( coord ) ), srcSize );
+					result.push_back( { { index, index }, 0.0f } );
+				}
+			}
+
+			return result;
+		}
+
+		void generateMipLevelBytes( SubresourceData const & dst
+			, SubresourceData const & src )
+		{
+			auto simd = getSimdLevel();
+			// The count of destination texels which have both horizontal source texels.
+			auto pairs = std::min( dst.extent.width, src.extent.width / 2u );
+
+			for ( uint32_t y = 0u; y < dst.extent.height; ++y )
+			{
+				auto dstRow = getTexel( dst, 0u, y, 0u );
+				auto src0 = getTexel( src, 0u, std::min( y * 2u, src.extent.height - 1u ), 0u );
+				auto src1 = getTexel( src, 0u, std::min( y * 2u + 1u, src.extent.height - 1u ), 0u );
+
+#if AshesTest_X64
+				if ( src.texelSize == 4u && simd == SimdLevel::eAvx2 )
+				{
+					downsampleRowAvx2( dstRow, src0, src1, pairs );
+				}
+				else if ( src.texelSize == 4u && simd == SimdLevel::eSse2 )
+				{
+					downsampleRowSse2( dstRow, src0, src1, pairs );
+				}
+				else
+#endif
+				{
+					downsampleRowScalar( dstRow, src0, src1, src.texelSize, pairs );
+				}
+
+				// An odd source width leaves a last column, averaged with itself.
+				for ( auto x = pairs; x < dst.extent.width; ++x )
+				{
+					auto left = std::min( x * 2u, src.extent.width - 1u );
+
+					for ( uint32_t c = 0u; c < src.texelSize; ++c )
+					{
+						dstRow[x * src.texelSize + c] = uint8_t( ( uint32_t( src0[left * src.texelSize + c] )
+							+ src1[left * src.texelSize + c]
+							+ 1u ) >> 1u );
+					}
+				}
+			}
+		}
+
+		void generateMipLevelFloat( TexelFormat const & format
+			, SubresourceData const & dst
+			, SubresourceData const & src )
+		{
+			RowCache rows{ format, src };
+			auto slices = src.extent.depth > 1u ? 2u : 1u;
+			auto rowsCount = src.extent.height > 1u ? 2u : 1u;
+
+			for ( uint32_t z = 0u; z < dst.extent.depth; ++z )
+			{
+				for ( uint32_t y = 0u; y < dst.extent.height; ++y )
+				{
+					float const * taps[4]{};
+					uint32_t tapCount = 0u;
+
+					for ( uint32_t k = 0u; k < slices; ++k )
+					{
+						for ( uint32_t j = 0u; j < rowsCount; ++j )
+						{
+							taps[tapCount++] = rows.get( std::min( y * 2u + j, src.extent.height - 1u )
+								, std::min( z * 2u + k, src.extent.depth - 1u ) );
+						}
+					}
+
+					auto dstTexel = getTexel( dst, 0u, y, z );
+
+					for ( uint32_t x = 0u; x < dst.extent.width; ++x )
+					{
+						auto left = std::min( x * 2u, src.extent.width - 1u ) * 4u;
+						auto right = std::min( x * 2u + 1u, src.extent.width - 1u ) * 4u;
+						float rgba[4]{};
+
+						for ( uint32_t t = 0u; t < tapCount; ++t )
+						{
+							for ( uint32_t c = 0u; c < 4u; ++c )
+							{
+								rgba[c] += taps[t][left + c] + taps[t][right + c];
+							}
+						}
+
+						for ( auto & component : rgba )
+						{
+							component /= float( tapCount * 2u );
+						}
+
+						encodeTexel( format, rgba, dstTexel );
+						dstTexel += dst.texelSize;
+					}
+				}
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	void getAspectRange( VkFormat format
+		, VkImageAspectFlags aspect
+		, uint32_t & offset
+		, uint32_t & size )
+	{
+		offset = 0u;
+		size = uint32_t( getMinimalSize( format ) );
+
+		if ( !isDepthStencilFormat( format )
+			|| ( checkFlag( aspect, VK_IMAGE_ASPECT_DEPTH_BIT )
+				&& checkFlag( aspect, VK_IMAGE_ASPECT_STENCIL_BIT ) ) )
+		{
+			return;
+		}
+
+		// The depth is stored first, the stencil in the following byte.
+		switch ( format )
+		{
+		case VK_FORMAT_D16_UNORM_S8_UINT:
+			offset = checkFlag( aspect, VK_IMAGE_ASPECT_DEPTH_BIT ) ? 0u : 2u;
+			size = checkFlag( aspect, VK_IMAGE_ASPECT_DEPTH_BIT ) ? 2u : 1u;
+			break;
+		case VK_FORMAT_D24_UNORM_S8_UINT:
+			offset = checkFlag( aspect, VK_IMAGE_ASPECT_DEPTH_BIT ) ? 0u : 3u;
+			size = checkFlag( aspect, VK_IMAGE_ASPECT_DEPTH_BIT ) ? 3u : 1u;
+			break;
+		case VK_FORMAT_D32_SFLOAT_S8_UINT:
+			offset = checkFlag( aspect, VK_IMAGE_ASPECT_DEPTH_BIT ) ? 0u : 4u;
+			size = checkFlag( aspect, VK_IMAGE_ASPECT_DEPTH_BIT ) ? 4u : 1u;
+			break;
+		default:
+			break;
+		}
+	}
+
+	SubresourceData getBufferImageData( uint8_t * data
+		, VkFormat imageFormat
+		, VkBufferImageCopy const & copy
+		, uint32_t layer )
+	{
+		SubresourceData result;
+		result.format = imageFormat;
+		getAspectRange( imageFormat
+			, copy.imageSubresource.aspectMask
+			, result.aspectOffset
+			, result.aspectSize );
+		result.texelSize = uint32_t( getMinimalSize( imageFormat ) );
+
+		if ( isDepthStencilFormat( imageFormat )
+			&& result.aspectSize != result.texelSize )
+		{
+			// Single aspect copies are tightly packed, D24 depth uses 4 bytes.
+			result.texelSize = result.aspectSize == 3u
+				? 4u
+				: result.aspectSize;
+		}
+
+		// The buffer data is tightly packed, its aspect starts each texel.
+		result.aspectOffset = 0u;
+		result.extent = getBlockExtent( imageFormat
+			, { ( copy.bufferRowLength ? copy.bufferRowLength : copy.imageExtent.width )
+				, ( copy.bufferImageHeight ? copy.bufferImageHeight : copy.imageExtent.height )
+				, copy.imageExtent.depth } );
+		result.rowPitch = VkDeviceSize( result.extent.width ) * result.texelSize;
+		result.depthPitch = result.rowPitch * result.extent.height;
+		result.data = data + layer * result.depthPitch * result.extent.depth;
+		return result;
+	}
+
+	VkOffset3D getBlockOffset( VkFormat format
+		, VkOffset3D const & offset )
+	{
+		auto block = getMinimalExtent3D( format );
+		return
+		{
+			offset.x / int32_t( block.width ),
+			offset.y / int32_t( block.height ),
+			offset.z / int32_t( block.depth ),
+		};
+	}
+
+	VkExtent3D getBlockExtent( VkFormat format
+		, VkExtent3D const & extent )
+	{
+		auto block = getMinimalExtent3D( format );
+		return
+		{
+			( extent.width + block.width - 1u ) / block.width,
+			( extent.height + block.height - 1u ) / block.height,
+			( extent.depth + block.depth - 1u ) / block.depth,
+		};
+	}
+
+	VkDeviceSize getRegionSize( SubresourceData const & data
+		, VkExtent3D const & extent )
+	{
+		return VkDeviceSize( extent.width )
+			* extent.height
+			* extent.depth
+			* data.aspectSize;
+	}
+
+	void copyMemory( uint8_t * dst
+		, uint8_t const * src
+		, VkDeviceSize size )
+	{
+#if AshesTest_X64
+		if ( size >= StreamingCopyThreshold )
+		{
+			switch ( getSimdLevel() )
+			{
+			case SimdLevel::eAvx2:
+				copyAvx2( dst, src, size );
+				return;
+			case SimdLevel::eSse2:
+				copySse2( dst, src, size );
+				return;
+			default:
+				break;
+			}
+		}
+#endif
+		// Below the threshold, the C library's copy is already vectorised.
+		std::memcpy( dst, src, size_t( size ) );
+	}
+
+	void fillMemory( uint8_t * dst
+		, VkDeviceSize size
+		, uint8_t const * pattern
+		, uint32_t patternSize )
+	{
+		if ( !size || !patternSize )
+		{
+			return;
+		}
+
+#if AshesTest_X64
+		auto simd = getSimdLevel();
+
+		if ( simd != SimdLevel::eNone
+			&& 16u % patternSize == 0u )
+		{
+			uint8_t block[32];
+
+			for ( uint32_t i = 0u; i < 32u; i += patternSize )
+			{
+				std::memcpy( block + i, pattern, patternSize );
+			}
+
+			if ( simd == SimdLevel::eAvx2 )
+			{
+				fillAvx2( dst, size, block );
+			}
+			else
+			{
+				fillSse2( dst, size, block );
+			}
+
+			return;
+		}
+#endif
+		fillScalar( dst, size, pattern, patternSize );
+	}
+
+	void copyRegion( SubresourceData const & dst
+		, VkOffset3D const & dstOffset
+		, SubresourceData const & src
+		, VkOffset3D const & srcOffset
+		, VkExtent3D const & extent )
+	{
+		auto region = clip( src, srcOffset, clip( dst, dstOffset, extent ) );
+
+		if ( !region.width || !region.height || !region.depth )
+		{
+			return;
+		}
+
+		if ( isWholeTexel( dst )
+			&& isWholeTexel( src )
+			&& dst.texelSize == src.texelSize )
+		{
+			auto rowSize = VkDeviceSize( region.width ) * dst.texelSize;
+			// Consecutive rows on both sides are copied at once.
+			auto rowsAtOnce = ( dst.rowPitch == rowSize && src.rowPitch == rowSize )
+				? region.height
+				: 1u;
+
+			for ( uint32_t z = 0u; z < region.depth; ++z )
+			{
+				for ( uint32_t y = 0u; y < region.height; y += rowsAtOnce )
+				{
+					copyMemory( getTexel( dst, uint32_t( dstOffset.x ), uint32_t( dstOffset.y ) + y, uint32_t( dstOffset.z ) + z )
+						, getTexel( src, uint32_t( srcOffset.x ), uint32_t( srcOffset.y ) + y, uint32_t( srcOffset.z ) + z )
+						, rowSize * rowsAtOnce );
+				}
+			}
+
+			return;
+		}
+
+		auto size = std::min( dst.aspectSize, src.aspectSize );
+
+		for ( uint32_t z = 0u; z < region.depth; ++z )
+		{
+			for ( uint32_t y = 0u; y < region.height; ++y )
+			{
+				auto dstTexel = getTexel( dst, uint32_t( dstOffset.x ), uint32_t( dstOffset.y ) + y, uint32_t( dstOffset.z ) + z ) + dst.aspectOffset;
+				auto srcTexel = getTexel( src, uint32_t( srcOffset.x ), uint32_t( srcOffset.y ) + y, uint32_t( srcOffset.z ) + z ) + src.aspectOffset;
+
+				for ( uint32_t x = 0u; x < region.width; ++x )
+				{
+					std::memcpy( dstTexel, srcTexel, size );
+					dstTexel += dst.texelSize;
+					srcTexel += src.texelSize;
+				}
+			}
+		}
+	}
+
+	void clearRegion( SubresourceData const & dst
+		, VkOffset3D const & offset
+		, VkExtent3D const & extent
+		, uint8_t const * texel )
+	{
+		auto region = clip( dst, offset, extent );
+
+		if ( !region.width || !region.height || !region.depth )
+		{
+			return;
+		}
+
+		if ( isWholeTexel( dst ) )
+		{
+			auto rowSize = VkDeviceSize( region.width ) * dst.texelSize;
+			auto rowsAtOnce = dst.rowPitch == rowSize
+				? region.height
+				: 1u;
+
+			for ( uint32_t z = 0u; z < region.depth; ++z )
+			{
+				for ( uint32_t y = 0u; y < region.height; y += rowsAtOnce )
+				{
+					fillMemory( getTexel( dst, uint32_t( offset.x ), uint32_t( offset.y ) + y, uint32_t( offset.z ) + z )
+						, rowSize * rowsAtOnce
+						, texel
+						, dst.texelSize );
+				}
+			}
+
+			return;
+		}
+
+		for ( uint32_t z = 0u; z < region.depth; ++z )
+		{
+			for ( uint32_t y = 0u; y < region.height; ++y )
+			{
+				auto dstTexel = getTexel( dst, uint32_t( offset.x ), uint32_t( offset.y ) + y, uint32_t( offset.z ) + z ) + dst.aspectOffset;
+
+				for ( uint32_t x = 0u; x < region.width; ++x )
+				{
+					std::memcpy( dstTexel, texel + dst.aspectOffset, dst.aspectSize );
+					dstTexel += dst.texelSize;
+				}
+			}
+		}
+	}
+
+	void blitRegion( SubresourceData const & dst
+		, VkOffset3D const ( & dstOffsets )[2]
+		, SubresourceData const & src
+		, VkOffset3D const ( & srcOffsets )[2]
+		, VkFilter filter )
+	{
+		if ( dstOffsets[0].x == dstOffsets[1].x
+			|| dstOffsets[0].y == dstOffsets[1].y
+			|| dstOffsets[0].z == dstOffsets[1].z
+			|| !src.extent.width
+			|| !src.extent.height
+			|| !src.extent.depth )
+		{
+			return;
+		}
+
+		TexelFormat srcFormat;
+		TexelFormat dstFormat;
+		auto convertible = getTexelFormat( src.format, srcFormat )
+			&& getTexelFormat( dst.format, dstFormat );
+		// Same format nearest blits copy texels, whatever the format.
+		auto raw = src.format == dst.format
+			&& ( filter == VK_FILTER_NEAREST || !convertible );
+
+		if ( !raw && !convertible )
+		{
+			return;
+		}
+
+		auto linear = !raw
+			&& filter != VK_FILTER_NEAREST
+			&& !isIntegerType( srcFormat.type );
+		auto dstBegin = VkOffset3D{ std::max( std::min( dstOffsets[0].x, dstOffsets[1].x ), 0 )
+			, std::max( std::min( dstOffsets[0].y, dstOffsets[1].y ), 0 )
+			, std::max( std::min( dstOffsets[0].z, dstOffsets[1].z ), 0 ) };
+		auto dstEnd = VkOffset3D{ std::min( std::max( dstOffsets[0].x, dstOffsets[1].x ), int32_t( dst.extent.width ) )
+			, std::min( std::max( dstOffsets[0].y, dstOffsets[1].y ), int32_t( dst.extent.height ) )
+			, std::min( std::max( dstOffsets[0].z, dstOffsets[1].z ), int32_t( dst.extent.depth ) ) };
+		auto xTaps = computeTaps( dstOffsets[0].x, dstOffsets[1].x, srcOffsets[0].x, srcOffsets[1].x, dstBegin.x, dstEnd.x, src.extent.width, linear );
+		auto yTaps = computeTaps( dstOffsets[0].y, dstOffsets[1].y, srcOffsets[0].y, srcOffsets[1].y, dstBegin.y, dstEnd.y, src.extent.height, linear );
+		auto zTaps = computeTaps( dstOffsets[0].z, dstOffsets[1].z, srcOffsets[0].z, srcOffsets[1].z, dstBegin.z, dstEnd.z, src.extent.depth, linear && src.extent.depth > 1u );
+
+		if ( raw )
+		{
+			for ( auto z = dstBegin.z; z < dstEnd.z; ++z )
+			{
+				for ( auto y = dstBegin.y; y < dstEnd.y; ++y )
+				{
+					auto dstTexel = getTexel( dst, uint32_t( dstBegin.x ), uint32_t( y ), uint32_t( z ) );
+					auto srcRow = getTexel( src, 0u, uint32_t( yTaps[size_t( y - dstBegin.y )].index[0] ), uint32_t( zTaps[size_t( z - dstBegin.z )].index[0] ) );
+
+					for ( auto & tap : xTaps )
+					{
+						std::memcpy( dstTexel, srcRow + tap.index[0] * src.texelSize, dst.texelSize );
+						dstTexel += dst.texelSize;
+					}
+				}
+			}
+
+			return;
+		}
+
+		RowCache rows{ srcFormat, src };
+
+		for ( auto z = dstBegin.z; z < dstEnd.z; ++z )
+		{
+			auto & zTap = zTaps[size_t( z - dstBegin.z )];
+
+			for ( auto y = dstBegin.y; y < dstEnd.y; ++y )
+			{
+				auto & yTap = yTaps[size_t( y - dstBegin.y )];
+				float const * r00 = rows.get( uint32_t( yTap.index[0] ), uint32_t( zTap.index[0] ) );
+				float const * r01 = rows.get( uint32_t( yTap.index[1] ), uint32_t( zTap.index[0] ) );
+				float const * r10 = rows.get( uint32_t( yTap.index[0] ), uint32_t( zTap.index[1] ) );
+				float const * r11 = rows.get( uint32_t( yTap.index[1] ), uint32_t( zTap.index[1] ) );
+				auto dstTexel = getTexel( dst, uint32_t( dstBegin.x ), uint32_t( y ), uint32_t( z ) );
+
+				for ( auto & xTap : xTaps )
+				{
+					auto x0 = size_t( xTap.index[0] ) * 4u;
+					auto x1 = size_t( xTap.index[1] ) * 4u;
+					float rgba[4];
+
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						auto front = ( r00[x0 + c] * ( 1.0f - xTap.weight ) + r00[x1 + c] * xTap.weight ) * ( 1.0f - yTap.weight )
+							+ ( r01[x0 + c] * ( 1.0f - xTap.weight ) + r01[x1 + c] * xTap.weight ) * yTap.weight;
+						auto back = ( r10[x0 + c] * ( 1.0f - xTap.weight ) + r10[x1 + c] * xTap.weight ) * ( 1.0f - yTap.weight )
+							+ ( r11[x0 + c] * ( 1.0f - xTap.weight ) + r11[x1 + c] * xTap.weight ) * yTap.weight;
+						rgba[c] = front * ( 1.0f - zTap.weight ) + back * zTap.weight;
+					}
+
+					encodeTexel( dstFormat, rgba, dstTexel );
+					dstTexel += dst.texelSize;
+				}
+			}
+		}
+	}
+
+	void generateMipLevel( SubresourceData const & dst
+		, SubresourceData const & src )
+	{
+		TexelFormat format;
+
+		if ( !getTexelFormat( src.format, format )
+			|| !dst.extent.width
+			|| !src.extent.width )
+		{
+			return;
+		}
+
+		if ( dst.extent.depth == 1u
+			&& src.extent.depth == 1u
+			&& format.type == ChannelType::eUnorm
+			&& format.channelSize == 1u )
+		{
+			generateMipLevelBytes( dst, src );
+		}
+		else
+		{
+			generateMipLevelFloat( format, dst, src );
+		}
+	}
+
+	std::array< uint8_t, 16u > packClearColour( VkFormat format
+		, VkClearColorValue const & colour )
+	{
+		std::array< uint8_t, 16u > result{};
+		TexelFormat texelFormat;
+
+		if ( getTexelFormat( format, texelFormat ) )
+		{
+			if ( isIntegerType( texelFormat.type ) )
+			{
+				encodeIntegerTexel( texelFormat, colour.uint32, result.data() );
+			}
+			else
+			{
+				encodeTexel( texelFormat, colour.float32, result.data() );
+			}
+		}
+
+		return result;
+	}
+
+	std::array< uint8_t, 16u > packClearDepthStencil( VkFormat format
+		, VkClearDepthStencilValue const & value )
+	{
+		std::array< uint8_t, 16u > result{};
+		auto stencil = uint8_t( value.stencil );
+
+		switch ( format )
+		{
+		case VK_FORMAT_D16_UNORM:
+		case VK_FORMAT_D16_UNORM_S8_UINT:
+			{
+				auto depth = uint16_t( encodeUnorm( value.depth, 16u ) );
+				std::memcpy( result.data(), &depth, sizeof( depth ) );
+				result[2] = stencil;
+			}
+			break;
+		case VK_FORMAT_X8_D24_UNORM_PACK32:
+		case VK_FORMAT_D24_UNORM_S8_UINT:
+			{
+				auto depth = encodeUnorm( value.depth, 24u ) | ( uint32_t( stencil ) << 24u );
+				std::memcpy( result.data(), &depth, sizeof( depth ) );
+			}
+			break;
+		case VK_FORMAT_D32_SFLOAT:
+		case VK_FORMAT_D32_SFLOAT_S8_UINT:
+			std::memcpy( result.data(), &value.depth, sizeof( value.depth ) );
+			result[4] = stencil;
+			break;
+		case VK_FORMAT_S8_UINT:
+			result[0] = stencil;
+			break;
+		default:
+			break;
+		}
+
+		return result;
+	}
+
+	//*********************************************************************************************
+
+	float halfToFloat( uint16_t value )
+	{
+		uint32_t sign = uint32_t( value & 0x8000u ) << 16u;
+		uint32_t exponent = ( value >> 10u ) & 0x1Fu;
+		uint32_t mantissa = value & 0x3FFu;
+		uint32_t bits{};
+
+		if ( exponent == 0u )
+		{
+			if ( mantissa == 0u )
+			{
+				bits = sign;
+			}
+			else
+			{
+				// Subnormal, normalised for the float representation.
+				exponent = 127u - 15u + 1u;
+
+				while ( !( mantissa & 0x400u ) )
+				{
+					mantissa <<= 1u;
+					--exponent;
+				}
+
+				bits = sign | ( exponent << 23u ) | ( ( mantissa & 0x3FFu ) << 13u );
+			}
+		}
+		else if ( exponent == 0x1Fu )
+		{
+			bits = sign | 0x7F800000u | ( mantissa << 13u );
+		}
+		else
+		{
+			bits = sign | ( ( exponent + 127u - 15u ) << 23u ) | ( mantissa << 13u );
+		}
+
+		float result;
+		std::memcpy( &result, &bits, sizeof( result ) );
+		return result;
+	}
+
+	uint16_t floatToHalf( float value )
+	{
+		uint32_t bits;
+		std::memcpy( &bits, &value, sizeof( bits ) );
+		uint32_t sign = ( bits >> 16u ) & 0x8000u;
+		uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+		if ( magnitude >= 0x7F800000u )
+		{
+			// Infinity or NaN.
+			return uint16_t( sign | 0x7C00u | ( magnitude > 0x7F800000u ? 0x200u : 0u ) );
+		}
+
+		if ( magnitude >= 0x477FF000u )
+		{
+			// Rounds to infinity.
+			return uint16_t( sign | 0x7C00u );
+		}
+
+		if ( magnitude < 0x38800000u )
+		{
+			// Subnormal, or zero.
+			if ( magnitude < 0x33000000u )
+			{
+				return uint16_t( sign );
+			}
+
+			uint32_t mantissa = ( magnitude & 0x7FFFFFu ) | 0x800000u;
+			uint32_t shift = 126u - ( magnitude >> 23u );
+			uint32_t result = mantissa >> shift;
+			uint32_t remainder = mantissa & ( ( 1u << shift ) - 1u );
+			uint32_t half = 1u << ( shift - 1u );
+
+			if ( remainder > half
+				|| ( remainder == half && ( result & 1u ) ) )
+			{
+				++result;
+			}
+
+			return uint16_t( sign | result );
+		}
+
+		// Rebiases the exponent, and rounds to nearest even.
+		uint32_t result = ( magnitude - 0x38000000u ) >> 13u;
+		uint32_t remainder = magnitude & 0x1FFFu;
+
+		if ( remainder > 0x1000u
+			|| ( remainder == 0x1000u && ( result & 1u ) ) )
+		{
+			++result;
+		}
+
+		return uint16_t( sign | result );
+	}
+
+	bool readTexel( VkFormat format
+		, uint8_t const * texel
+		, uint32_t ( & value )[4] )
+	{
+		TexelFormat texelFormat;
+
+		if ( !getTexelFormat( format, texelFormat ) )
+		{
+			return false;
+		}
+
+		if ( !isIntegerType( texelFormat.type ) )
+		{
+			float rgba[4];
+			decodeTexel( texelFormat, texel, rgba );
+			std::memcpy( value, rgba, sizeof( rgba ) );
+			return true;
+		}
+
+		auto isSigned = texelFormat.type == ChannelType::eSint;
+		value[0] = 0u;
+		value[1] = 0u;
+		value[2] = 0u;
+		value[3] = 1u;
+
+		if ( texelFormat.packedSize )
+		{
+			uint32_t packed{};
+			std::memcpy( &packed, texel, texelFormat.packedSize );
+
+			for ( uint32_t c = 0u; c < 4u; ++c )
+			{
+				if ( texelFormat.bits[c] )
+				{
+					auto mask = uint32_t( ( uint64_t( 1u ) << texelFormat.bits[c] ) - 1u );
+					value[c] = ( packed >> texelFormat.shifts[c] ) & mask;
+				}
+			}
+
+			return true;
+		}
+
+		for ( uint32_t i = 0u; i < texelFormat.channelCount; ++i )
+		{
+			uint32_t channel{};
+			std::memcpy( &channel, texel + i * texelFormat.channelSize, texelFormat.channelSize );
+			value[texelFormat.components[i]] = isSigned
+				? uint32_t( signExtend( channel, texelFormat.channelSize * 8u ) )
+				: channel;
+		}
+
+		return true;
+	}
+
+	bool writeTexel( VkFormat format
+		, uint32_t const ( & value )[4]
+		, uint8_t * texel )
+	{
+		TexelFormat texelFormat;
+
+		if ( !getTexelFormat( format, texelFormat ) )
+		{
+			return false;
+		}
+
+		if ( isIntegerType( texelFormat.type ) )
+		{
+			encodeIntegerTexel( texelFormat, value, texel );
+		}
+		else
+		{
+			float rgba[4];
+			std::memcpy( rgba, value, sizeof( rgba ) );
+			encodeTexel( texelFormat, rgba, texel );
+		}
+
+		return true;
+	}
+
+	TexelRange getTexelRange( VkFormat format )
+	{
+		TexelFormat texelFormat;
+
+		if ( !getTexelFormat( format, texelFormat ) )
+		{
+			return TexelRange::eUnsupported;
+		}
+
+		switch ( texelFormat.type )
+		{
+		case ChannelType::eUnorm:
+		case ChannelType::eSrgb:
+			return TexelRange::eUnsigned;
+		case ChannelType::eSnorm:
+			return TexelRange::eSigned;
+		case ChannelType::eSfloat:
+			return TexelRange::eFloat;
+		default:
+			return TexelRange::eInteger;
+		}
+	}
+
+	//*********************************************************************************************
+}
@@ -0,0 +1,144 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+
+namespace ashes::test
+{
+	/**
+	*\brief
+	*	The memory of an image subresource, or of a buffer region seen as one.
+	*\remarks
+	*	For compressed formats, the extent, and the offsets given to the kernels, are in texel blocks.
+	*	For combined depth/stencil formats, an aspect is a byte range inside each texel.
+	*/
+	struct SubresourceData
+	{
+		uint8_t * data{};
+		VkFormat format{};
+		VkExtent3D extent{};
+		VkDeviceSize rowPitch{};
+		VkDeviceSize depthPitch{};
+		uint32_t texelSize{};
+		uint32_t aspectOffset{};
+		uint32_t aspectSize{};
+	};
+	/**
+	*\brief
+	*	Retrieves the byte range of the given aspect, inside a texel of the given format.
+	*/
+	void getAspectRange( VkFormat format
+		, VkImageAspectFlags aspect
+		, uint32_t & offset
+		, uint32_t & size );
+	/**
+	*\brief
+	*	Retrieves the memory of a layer, in a buffer copied to or from an image.
+	*\param[in] data
+	*	The buffer memory, at the copy's bufferOffset.
+	*/
+	SubresourceData getBufferImageData( uint8_t * data
+		, VkFormat imageFormat
+		, VkBufferImageCopy const & copy
+		, uint32_t layer );
+	VkOffset3D getBlockOffset( VkFormat format
+		, VkOffset3D const & offset );
+	VkExtent3D getBlockExtent( VkFormat format
+		, VkExtent3D const & extent );
+	/**
+	*\return
+	*	The bytes of the subresource's aspect, in a region of the given extent, in texel blocks.
+	*/
+	VkDeviceSize getRegionSize( SubresourceData const & data
+		, VkExtent3D const & extent );
+	/**
+	*\name
+	*	Kernels.
+	*\remarks
+	*	The raw memory and mip generation kernels have SSE2 and AVX2 versions,
+	*	selected from the host CPU features, and limited by ASHES_TEST_SIMD ("none" or "sse2").
+	*/
+	/**@{*/
+	void copyMemory( uint8_t * dst
+		, uint8_t const * src
+		, VkDeviceSize size );
+	void fillMemory( uint8_t * dst
+		, VkDeviceSize size
+		, uint8_t const * pattern
+		, uint32_t patternSize );
+	void copyRegion( SubresourceData const & dst
+		, VkOffset3D const & dstOffset
+		, SubresourceData const & src
+		, VkOffset3D const & srcOffset
+		, VkExtent3D const & extent );
+	/**
+	*\param[in] texel
+	*	The packed texel value, only its bytes inside the destination aspect are written.
+	*/
+	void clearRegion( SubresourceData const & dst
+		, VkOffset3D const & offset
+		, VkExtent3D const & extent
+		, uint8_t const * texel );
+	/**
+	*\brief
+	*	Scaled, filtered and format converting copy, as vkCmdBlitImage does.
+	*\remarks
+	*	Only uncompressed colour and depth formats can be converted,
+	*	other formats are only copied when both formats are the same and the filter is nearest.
+	*/
+	void blitRegion( SubresourceData const & dst
+		, VkOffset3D const ( & dstOffsets )[2]
+		, SubresourceData const & src
+		, VkOffset3D const ( & srcOffsets )[2]
+		, VkFilter filter );
+	/**
+	*\brief
+	*	Fills a mip level with the box filtered previous one.
+	*/
+	void generateMipLevel( SubresourceData const & dst
+		, SubresourceData const & src );
+	/**@}*/
+	/**
+	*\return
+	*	The clear value, converted to the given format's texel.
+	*/
+	std::array< uint8_t, 16u > packClearColour( VkFormat format
+		, VkClearColorValue const & colour );
+	std::array< uint8_t, 16u > packClearDepthStencil( VkFormat format
+		, VkClearDepthStencilValue const & value );
+	float halfToFloat( uint16_t value );
+	uint16_t floatToHalf( float value );
+	/**
+	*\brief
+	*	Conversions between a texel and a shader value.
+	*\remarks
+	*	The value holds the RGBA components as float bits, or as integers for the integer formats.
+	*\return
+	*	\p false if the format isn't supported.
+	*/
+	bool readTexel( VkFormat format
+		, uint8_t const * texel
+		, uint32_t ( & value )[4] );
+	bool writeTexel( VkFormat format
+		, uint32_t const ( & value )[4]
+		, uint8_t * texel );
+
+	enum class TexelRange
+	{
+		eUnsupported,
+		eFloat,
+		// UNORM and SRGB formats, in [0, 1].
+		eUnsigned,
+		// SNORM formats, in [-1, 1].
+		eSigned,
+		eInteger,
+	};
+	/**
+	*\return
+	*	The range of the shader values held by the format's texels.
+	*/
+	TexelRange getTexelRange( VkFormat format );
+}
@@ -5,6 +5,8 @@
 
 #include "ashestest_api.hpp"
 
+#include <iostream>
+
 namespace ashes::test
 {
 	namespace
@@ -91,13 +93,47 @@ namespace ashes::test
 			: VkPipelineDynamicStateCreateInfo{} ) }
 		, m_vertexInputStateHash{ doHash( m_vertexInputState ) }
 	{
+		for ( auto & stage : makeArrayView( createInfo.pStages, createInfo.stageCount ) )
+		{
+			if ( stage.stage != VK_SHADER_STAGE_VERTEX_BIT
+				&& stage.stage != VK_SHADER_STAGE_FRAGMENT_BIT )
+			{
+				std::cerr << "Only the vertex and fragment stages are interpreted, the pipeline's draws will be skipped" << std::endl;
+				m_vertexProgram.reset();
+				break;
+			}
+
+			auto & program = stage.stage == VK_SHADER_STAGE_VERTEX_BIT
+				? m_vertexProgram
+				: m_fragmentProgram;
+			program = std::make_unique< ShaderProgram >( get( stage.module )->getCode()
+				, stage.pName
+				, stage.stage
+				, stage.pSpecializationInfo );
+
+			if ( !program->isValid() )
+			{
+				std::cerr << "The " << ( stage.stage == VK_SHADER_STAGE_VERTEX_BIT ? "vertex" : "fragment" )
+					<< " shader can't be interpreted, the pipeline's draws will be skipped: "
+					<< program->getError() << std::endl;
+			}
+		}
 	}
 
 	Pipeline::Pipeline( VkDevice device
 		, VkComputePipelineCreateInfo createInfo )
 		: m_device{ device }
 		, m_layout{ createInfo.layout }
+		, m_computeProgram{ std::make_unique< ShaderProgram >( get( createInfo.stage.module )->getCode()
+			, createInfo.stage.pName
+			, createInfo.stage.stage
+			, createInfo.stage.pSpecializationInfo ) }
 	{
+		if ( !m_computeProgram->isValid() )
+		{
+			std::cerr << "The compute shader can't be interpreted, its dispatches will be skipped: "
+				<< m_computeProgram->getError() << std::endl;
+		}
 	}
 
 	VkDescriptorSetLayoutArray const & Pipeline::getDescriptorsLayouts()const
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "renderer/TestRenderer/Shader/TestShaderModule.hpp"
+#include "renderer/TestRenderer/Shader/TestShaderProgram.hpp"
 
 namespace ashes::test
 {
@@ -26,6 +27,26 @@ namespace ashes::test
 			return m_inputAssemblyState;
 		}
 
+		inline VkPipelineViewportStateCreateInfo const & getViewportState()const
+		{
+			return m_viewportState;
+		}
+
+		inline VkPipelineRasterizationStateCreateInfo const & getRasterizationState()const
+		{
+			return m_rasterizationState;
+		}
+
+		inline Optional< VkPipelineDepthStencilStateCreateInfo > const & getDepthStencilState()const
+		{
+			return m_depthStencilState;
+		}
+
+		inline VkPipelineColorBlendStateCreateInfo const & getColorBlendState()const
+		{
+			return m_colorBlendState;
+		}
+
 		inline bool hasVertexLayout()const
 		{
 			return !m_vertexAttributeDescriptions.empty()
@@ -65,6 +86,30 @@ namespace ashes::test
 		{
 			return m_vertexInputStateHash;
 		}
+		/**
+		*\return
+		*	The decoded compute shader, \p nullptr for graphics pipelines.
+		*/
+		inline ShaderProgram const * getComputeProgram()const
+		{
+			return m_computeProgram.get();
+		}
+		/**
+		*\return
+		*	The decoded vertex shader, \p nullptr for compute pipelines.
+		*/
+		inline ShaderProgram const * getVertexProgram()const
+		{
+			return m_vertexProgram.get();
+		}
+		/**
+		*\return
+		*	The decoded fragment shader, \p nullptr if the pipeline has none.
+		*/
+		inline ShaderProgram const * getFragmentProgram()const
+		{
+			return m_fragmentProgram.get();
+		}
 
 		inline bool hasDynamicStateEnable( VkDynamicState state )const
 		{
@@ -105,6 +150,10 @@ namespace ashes::test
 		VkPipelineDynamicStateCreateInfo m_dynamicState{};
 		//
 		size_t m_vertexInputStateHash{};
+		//
+		std::unique_ptr< ShaderProgram > m_computeProgram;
+		std::unique_ptr< ShaderProgram > m_vertexProgram;
+		std::unique_ptr< ShaderProgram > m_fragmentProgram;
 	};
 }
 
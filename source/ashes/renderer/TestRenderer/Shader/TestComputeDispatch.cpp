@@ -0,0 +1,178 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Shader/TestComputeDispatch.hpp"
+
+#include "Core/TestDevice.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
+#include "Miscellaneous/TestThreadPool.hpp"
+#include "Pipeline/TestPipeline.hpp"
+#include "Shader/TestShaderInvocation.hpp"
+#include "Shader/TestShaderResources.hpp"
+
+#include "ashestest_api.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ashes::test
+{
+	namespace
+	{
+		enum BuiltIn : uint32_t
+		{
+			BuiltInNumWorkgroups = 24,
+			BuiltInWorkgroupSize = 25,
+			BuiltInWorkgroupId = 26,
+			BuiltInLocalInvocationId = 27,
+			BuiltInGlobalInvocationId = 28,
+			BuiltInLocalInvocationIndex = 29,
+		};
+
+		static uint32_t constexpr StorageClassInput = 1u;
+
+		struct Workgroup
+		{
+			ByteArray memory;
+			std::vector< std::unique_ptr< ShaderInvocation > > invocations;
+		};
+
+		void writeBuiltIn( ShaderInvocation & invocation
+			, ShaderProgram::Interface const & variable
+			, uint32_t const ( & value )[3] )
+		{
+			std::memcpy( invocation.getMemory() + variable.offset
+				, value
+				, std::min( size_t( variable.size ), sizeof( value ) ) );
+		}
+
+		std::unique_ptr< Workgroup > createWorkgroup( ShaderProgram const & program
+			, ShaderResources const & resources )
+		{
+			auto & localSize = program.getLocalSize();
+			auto result = std::make_unique< Workgroup >();
+			result->memory.resize( program.getWorkgroupMemorySize() );
+
+			for ( uint32_t i = 0u; i < localSize.width * localSize.height * localSize.depth; ++i )
+			{
+				auto invocation = std::make_unique< ShaderInvocation >( program );
+				invocation->setWorkgroupMemory( result->memory.data(), result->memory.size() );
+				resources.bind( *invocation );
+				result->invocations.push_back( std::move( invocation ) );
+			}
+
+			return result;
+		}
+
+		void runWorkgroup( ShaderProgram const & program
+			, Workgroup & workgroup
+			, VkExtent3D const & groupCount
+			, uint32_t const ( & groupId )[3] )
+		{
+			auto & localSize = program.getLocalSize();
+			std::fill( workgroup.memory.begin(), workgroup.memory.end(), uint8_t{} );
+
+			for ( uint32_t index = 0u; index < workgroup.invocations.size(); ++index )
+			{
+				auto & invocation = *workgroup.invocations[index];
+				uint32_t const localId[3]{ index % localSize.width
+					, ( index / localSize.width ) % localSize.height
+					, index / ( localSize.width * localSize.height ) };
+				invocation.reset();
+
+				for ( auto & variable : program.getInterface() )
+				{
+					if ( variable.storageClass != StorageClassInput )
+					{
+						continue;
+					}
+
+					switch ( variable.builtIn )
+					{
+					case BuiltInNumWorkgroups:
+						writeBuiltIn( invocation, variable, { groupCount.width, groupCount.height, groupCount.depth } );
+						break;
+					case BuiltInWorkgroupSize:
+						writeBuiltIn( invocation, variable, { localSize.width, localSize.height, localSize.depth } );
+						break;
+					case BuiltInWorkgroupId:
+						writeBuiltIn( invocation, variable, groupId );
+						break;
+					case BuiltInLocalInvocationId:
+						writeBuiltIn( invocation, variable, localId );
+						break;
+					case BuiltInGlobalInvocationId:
+						writeBuiltIn( invocation
+							, variable
+							, { groupId[0] * localSize.width + localId[0]
+								, groupId[1] * localSize.height + localId[1]
+								, groupId[2] * localSize.depth + localId[2] } );
+						break;
+					case BuiltInLocalInvocationIndex:
+						writeBuiltIn( invocation, variable, { index, 0u, 0u } );
+						break;
+					default:
+						break;
+					}
+				}
+			}
+
+			// Each pass runs the invocations up to their next barrier, the workgroup is done once they all ended.
+			bool running = true;
+
+			while ( running )
+			{
+				running = false;
+
+				for ( auto & invocation : workgroup.invocations )
+				{
+					if ( invocation->getStatus() != ShaderInvocation::Status::eDone
+						&& invocation->run() != ShaderInvocation::Status::eDone )
+					{
+						running = true;
+					}
+				}
+			}
+		}
+	}
+
+	void dispatchCompute( VkDevice device
+		, VkPipeline pipeline
+		, DescriptorSetBindingArray const & descriptorSets
+		, ByteArray const & pushConstants
+		, VkExtent3D const & groupCount )
+	{
+		auto count = groupCount.width * groupCount.height * groupCount.depth;
+		get( device )->getGpuClock().chargeDispatch( count );
+		auto program = pipeline
+			? get( pipeline )->getComputeProgram()
+			: nullptr;
+
+		if ( !count
+			|| !program
+			|| !program->isValid() )
+		{
+			return;
+		}
+
+		auto & pool = get( device )->getThreadPool();
+		ShaderResources resources{ *program, descriptorSets, pushConstants };
+		std::vector< std::unique_ptr< Workgroup > > workgroups( pool.getWorkerCount() );
+		pool.run( count
+			, [&]( uint32_t index, uint32_t worker )
+			{
+				auto & workgroup = workgroups[worker];
+
+				if ( !workgroup )
+				{
+					workgroup = createWorkgroup( *program, resources );
+				}
+
+				uint32_t const groupId[3]{ index % groupCount.width
+					, ( index / groupCount.width ) % groupCount.height
+					, index / ( groupCount.width * groupCount.height ) };
+				runWorkgroup( *program, *workgroup, groupCount, groupId );
+			} );
+	}
+}
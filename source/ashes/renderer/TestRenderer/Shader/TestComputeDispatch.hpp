@@ -0,0 +1,24 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+
+namespace ashes::test
+{
+	/**
+	*\brief
+	*	Runs the workgroups of a compute dispatch on the device's thread pool.
+	*\remarks
+	*	Each worker reuses its own workgroup memory and invocations, from a workgroup to the next.
+	*	The invocations of a workgroup run on the same thread, interleaved at the workgroup barriers.
+	*	Pipelines whose shader can't be interpreted are skipped.
+	*/
+	void dispatchCompute( VkDevice device
+		, VkPipeline pipeline
+		, DescriptorSetBindingArray const & descriptorSets
+		, ByteArray const & pushConstants
+		, VkExtent3D const & groupCount );
+}
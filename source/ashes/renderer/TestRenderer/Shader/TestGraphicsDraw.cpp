@@ -0,0 +1,827 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Shader/TestGraphicsDraw.hpp"
+
+#include "Buffer/TestBuffer.hpp"
+#include "Core/TestDevice.hpp"
+#include "Miscellaneous/TestDeviceMemory.hpp"
+#include "Miscellaneous/TestGpuClock.hpp"
+#include "Miscellaneous/TestThreadPool.hpp"
+#include "Miscellaneous/TestTransferKernels.hpp"
+#include "Pipeline/TestPipeline.hpp"
+#include "Shader/TestRasterizer.hpp"
+#include "Shader/TestShaderInvocation.hpp"
+#include "Shader/TestShaderResources.hpp"
+
+#include "ashestest_api.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ashes::test
+{
+	namespace
+	{
+		enum BuiltIn : uint32_t
+		{
+			BuiltInPosition = 0,
+			BuiltInPointSize = 1,
+			BuiltInVertexIndex = 42,
+			BuiltInInstanceIndex = 43,
+			BuiltInBaseVertex = 4424,
+			BuiltInBaseInstance = 4425,
+		};
+
+		static uint32_t constexpr StorageClassInput = 1u;
+		static uint32_t constexpr StorageClassOutput = 3u;
+		static uint32_t constexpr NoValue = ~( 0u );
+		// The clip space words of a vertex, before its varyings.
+		static uint32_t constexpr ClipWords = 5u;
+		static uint32_t constexpr PointSizeWord = 4u;
+		// Primitives are only clipped against the x and y planes beyond this multiple of the viewport.
+		static float constexpr GuardBand = 4.0f;
+		static float constexpr MinW = 1.0e-6f;
+
+		struct Attribute
+		{
+			// The offset of the vertex shader input, in its invocation memory.
+			uint32_t offset;
+			uint32_t size;
+			VkFormat format;
+			uint8_t const * data;
+			VkDeviceSize range;
+			uint32_t stride;
+			uint32_t attributeOffset;
+			uint32_t texelSize;
+			bool perInstance;
+		};
+
+		struct VertexStage
+		{
+			std::vector< Attribute > attributes;
+			uint32_t position{ NoValue };
+			uint32_t pointSize{ NoValue };
+			std::vector< std::pair< uint32_t, uint32_t > > builtIns;
+		};
+
+		uint32_t getPrimitiveVertices( VkPrimitiveTopology topology )
+		{
+			switch ( topology )
+			{
+			case VK_PRIMITIVE_TOPOLOGY_POINT_LIST:
+				return 1u;
+			case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+			case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+				return 2u;
+			case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+			case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+			case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN:
+				return 3u;
+			default:
+				return 0u;
+			}
+		}
+
+		// Returns the last binding of the vertex buffer, its memory and its size.
+		uint8_t const * getVertexBuffer( VbosBindingArray const & vbos
+			, uint32_t binding
+			, VkDeviceSize & range )
+		{
+			for ( auto it = vbos.rbegin(); it != vbos.rend(); ++it )
+			{
+				if ( binding >= it->startIndex
+					&& binding < it->startIndex + it->buffers.size() )
+				{
+					auto index = binding - it->startIndex;
+					auto buffer = get( it->buffers[index] );
+					VkDeviceSize offset = it->offsets[index];
+
+					if ( !buffer
+						|| offset >= buffer->getSize() )
+					{
+						break;
+					}
+
+					range = buffer->getSize() - offset;
+					return get( buffer->getMemory() )->getData( buffer->getMemoryOffset() + offset );
+				}
+			}
+
+			range = 0u;
+			return nullptr;
+		}
+
+		VertexStage getVertexStage( Pipeline const & pipeline
+			, ShaderProgram const & program
+			, DrawState const & state )
+		{
+			VertexStage result;
+			auto & inputState = pipeline.getVertexInputState();
+			auto bindings = makeArrayView( inputState.pVertexBindingDescriptions, inputState.vertexBindingDescriptionCount );
+			auto attributes = makeArrayView( inputState.pVertexAttributeDescriptions, inputState.vertexAttributeDescriptionCount );
+
+			for ( auto & variable : program.getInterface() )
+			{
+				if ( variable.storageClass == StorageClassInput )
+				{
+					if ( variable.builtIn != NoValue )
+					{
+						result.builtIns.emplace_back( variable.builtIn, variable.offset );
+						continue;
+					}
+
+					auto attribute = std::find_if( attributes.begin()
+						, attributes.end()
+						, [&variable]( VkVertexInputAttributeDescription const & lookup )
+						{
+							return lookup.location == variable.location;
+						} );
+
+					if ( attribute == attributes.end() )
+					{
+						continue;
+					}
+
+					auto binding = std::find_if( bindings.begin()
+						, bindings.end()
+						, [attribute]( VkVertexInputBindingDescription const & lookup )
+						{
+							return lookup.binding == attribute->binding;
+						} );
+
+					if ( binding == bindings.end() )
+					{
+						continue;
+					}
+
+					Attribute fetch{ variable.offset
+						, std::min( variable.size, 16u )
+						, attribute->format };
+					fetch.data = getVertexBuffer( state.vbos, binding->binding, fetch.range );
+					fetch.stride = binding->stride;
+					fetch.attributeOffset = attribute->offset;
+					fetch.texelSize = uint32_t( getMinimalSize( attribute->format ) );
+					fetch.perInstance = binding->inputRate == VK_VERTEX_INPUT_RATE_INSTANCE;
+
+					if ( fetch.data )
+					{
+						result.attributes.push_back( fetch );
+					}
+				}
+				else if ( variable.storageClass == StorageClassOutput )
+				{
+					if ( variable.builtIn == BuiltInPosition )
+					{
+						result.position = variable.offset;
+					}
+					else if ( variable.builtIn == BuiltInPointSize )
+					{
+						result.pointSize = variable.offset;
+					}
+				}
+			}
+
+			return result;
+		}
+
+		std::vector< Varying > getVaryings( ShaderProgram const & vertex
+			, ShaderProgram const * fragment )
+		{
+			std::vector< Varying > result;
+
+			if ( !fragment )
+			{
+				return result;
+			}
+
+			auto word = RasterBatch::FixedWords;
+
+			for ( auto & input : fragment->getInterface() )
+			{
+				if ( input.storageClass != StorageClassInput
+					|| input.location == NoValue )
+				{
+					continue;
+				}
+
+				auto output = std::find_if( vertex.getInterface().begin()
+					, vertex.getInterface().end()
+					, [&input]( ShaderProgram::Interface const & lookup )
+					{
+						return lookup.storageClass == StorageClassOutput
+							&& lookup.location == input.location;
+					} );
+
+				if ( output != vertex.getInterface().end() )
+				{
+					auto words = std::min( input.size, output->size ) / 4u;
+					result.push_back( { output->offset, input.offset, word, words, input.interpolation } );
+					word += words;
+				}
+			}
+
+			return result;
+		}
+
+		void shadeVertex( ShaderInvocation & invocation
+			, VertexStage const & stage
+			, std::vector< Varying > const & varyings
+			, uint32_t vertexIndex
+			, uint32_t instanceIndex
+			, int32_t baseVertex
+			, uint32_t baseInstance
+			, float * vertex )
+		{
+			invocation.reset();
+			auto memory = invocation.getMemory();
+
+			for ( auto & attribute : stage.attributes )
+			{
+				auto element = attribute.perInstance
+					? instanceIndex
+					: vertexIndex;
+				auto address = VkDeviceSize( element ) * attribute.stride + attribute.attributeOffset;
+				uint32_t value[4]{ 0u, 0u, 0u, 0u };
+
+				// Out of range fetches read zeroes, as with robust buffer access.
+				if ( address + attribute.texelSize <= attribute.range )
+				{
+					readTexel( attribute.format, attribute.data + address, value );
+				}
+
+				std::memcpy( memory + attribute.offset, value, attribute.size );
+			}
+
+			for ( auto & builtIn : stage.builtIns )
+			{
+				uint32_t value{};
+
+				switch ( builtIn.first )
+				{
+				case BuiltInVertexIndex:
+					value = vertexIndex;
+					break;
+				case BuiltInInstanceIndex:
+					value = instanceIndex;
+					break;
+				case BuiltInBaseVertex:
+					value = uint32_t( baseVertex );
+					break;
+				case BuiltInBaseInstance:
+					value = baseInstance;
+					break;
+				default:
+					continue;
+				}
+
+				std::memcpy( memory + builtIn.second, &value, sizeof( value ) );
+			}
+
+			invocation.run();
+
+			if ( stage.position != NoValue )
+			{
+				std::memcpy( vertex, memory + stage.position, 4u * sizeof( float ) );
+			}
+
+			vertex[PointSizeWord] = 1.0f;
+
+			if ( stage.pointSize != NoValue )
+			{
+				std::memcpy( vertex + PointSizeWord, memory + stage.pointSize, sizeof( float ) );
+			}
+
+			for ( auto & varying : varyings )
+			{
+				std::memcpy( vertex + varying.word, memory + varying.source, varying.words * sizeof( float ) );
+			}
+		}
+
+		// Splits the vertices in primitives, each segment between primitive restarts is assembled on its own.
+		void assemble( VkPrimitiveTopology topology
+			, UInt32Array const & slots
+			, RasterBatch & batch )
+		{
+			auto begin = slots.begin();
+
+			while ( begin != slots.end() )
+			{
+				auto end = std::find( begin, slots.end(), NoValue );
+				auto count = uint32_t( std::distance( begin, end ) );
+				auto v = [&begin]( uint32_t index )
+				{
+					return *( begin + index );
+				};
+
+				switch ( topology )
+				{
+				case VK_PRIMITIVE_TOPOLOGY_POINT_LIST:
+					batch.indices.insert( batch.indices.end(), begin, end );
+					break;
+				case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+					batch.indices.insert( batch.indices.end(), begin, begin + ( count - count % 2u ) );
+					break;
+				case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+					for ( uint32_t i = 0u; i + 1u < count; ++i )
+					{
+						batch.indices.insert( batch.indices.end(), { v( i ), v( i + 1u ) } );
+					}
+					break;
+				case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+					batch.indices.insert( batch.indices.end(), begin, begin + ( count - count % 3u ) );
+					break;
+				case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+					// The odd triangles swap their first two vertices, to keep the strip's winding.
+					for ( uint32_t i = 0u; i + 2u < count; ++i )
+					{
+						batch.indices.insert( batch.indices.end(), { v( i ), v( i + 1u + i % 2u ), v( i + 2u - i % 2u ) } );
+					}
+					break;
+				case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN:
+					for ( uint32_t i = 0u; i + 2u < count; ++i )
+					{
+						batch.indices.insert( batch.indices.end(), { v( i + 1u ), v( i + 2u ), v( 0u ) } );
+					}
+					break;
+				default:
+					break;
+				}
+
+				begin = end == slots.end()
+					? end
+					: end + 1;
+			}
+		}
+
+		struct Plane
+		{
+			float x, y, z, w, d;
+
+			float distance( float const * vertex )const
+			{
+				return x * vertex[0] + y * vertex[1] + z * vertex[2] + w * vertex[3] + d;
+			}
+		};
+
+		class Clipper
+		{
+		public:
+			Clipper( RasterBatch & batch
+				, bool depthClamp )
+				: m_batch{ batch }
+			{
+				m_planes.push_back( { 0.0f, 0.0f, 0.0f, 1.0f, -MinW } );
+				m_planes.push_back( { 1.0f, 0.0f, 0.0f, GuardBand, 0.0f } );
+				m_planes.push_back( { -1.0f, 0.0f, 0.0f, GuardBand, 0.0f } );
+				m_planes.push_back( { 0.0f, 1.0f, 0.0f, GuardBand, 0.0f } );
+				m_planes.push_back( { 0.0f, -1.0f, 0.0f, GuardBand, 0.0f } );
+
+				if ( !depthClamp )
+				{
+					m_planes.push_back( { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f } );
+					m_planes.push_back( { 0.0f, 0.0f, -1.0f, 1.0f, 0.0f } );
+				}
+			}
+			/**
+			*\brief
+			*	Clips the assembled primitives, and replaces them with the visible ones.
+			*/
+			void clip()
+			{
+				UInt32Array indices;
+				UInt32Array provoking;
+				indices.swap( m_batch.indices );
+				auto count = m_batch.primitiveVertices;
+
+				for ( size_t i = 0u; i + count <= indices.size(); i += count )
+				{
+					auto primitive = indices.data() + i;
+					auto outside = doGetOutside( primitive, count );
+
+					if ( outside == Outside::eAll )
+					{
+						continue;
+					}
+
+					if ( outside == Outside::eNone )
+					{
+						m_batch.indices.insert( m_batch.indices.end(), primitive, primitive + count );
+						m_batch.provokingVertices.push_back( primitive[0] );
+					}
+					else if ( count == 2u )
+					{
+						doClipLine( primitive );
+					}
+					else if ( count == 3u )
+					{
+						doClipTriangle( primitive );
+					}
+				}
+			}
+
+		private:
+			enum class Outside
+			{
+				eNone,
+				eSome,
+				eAll,
+			};
+
+			Outside doGetOutside( uint32_t const * primitive
+				, uint32_t count )const
+			{
+				auto result = Outside::eNone;
+
+				for ( auto & plane : m_planes )
+				{
+					uint32_t outside{};
+
+					for ( uint32_t i = 0u; i < count; ++i )
+					{
+						if ( plane.distance( doGetVertex( primitive[i] ) ) < 0.0f )
+						{
+							++outside;
+						}
+					}
+
+					// Points are only kept when inside all the planes.
+					if ( outside == count
+						|| ( outside && count == 1u ) )
+					{
+						return Outside::eAll;
+					}
+
+					if ( outside )
+					{
+						result = Outside::eSome;
+					}
+				}
+
+				return result;
+			}
+
+			float * doGetVertex( uint32_t index )
+			{
+				return m_batch.vertices.data() + size_t( index ) * m_batch.vertexWords;
+			}
+
+			float const * doGetVertex( uint32_t index )const
+			{
+				return m_batch.vertices.data() + size_t( index ) * m_batch.vertexWords;
+			}
+
+			// Adds the vertex between a and b, the flat values are read from the primitive's provoking vertex.
+			uint32_t doAddVertex( uint32_t a
+				, uint32_t b
+				, float t )
+			{
+				auto words = m_batch.vertexWords;
+				auto result = uint32_t( m_batch.vertices.size() / words );
+				m_batch.vertices.resize( m_batch.vertices.size() + words );
+				auto dst = doGetVertex( result );
+				auto va = doGetVertex( a );
+				auto vb = doGetVertex( b );
+
+				for ( uint32_t i = 0u; i < words; ++i )
+				{
+					dst[i] = va[i] + ( vb[i] - va[i] ) * t;
+				}
+
+				return result;
+			}
+
+			void doClipLine( uint32_t const * primitive )
+			{
+				float t0 = 0.0f;
+				float t1 = 1.0f;
+
+				for ( auto & plane : m_planes )
+				{
+					auto d0 = plane.distance( doGetVertex( primitive[0] ) );
+					auto d1 = plane.distance( doGetVertex( primitive[1] ) );
+
+					if ( d0 < 0.0f && d1 < 0.0f )
+					{
+						return;
+					}
+
+					if ( d0 < 0.0f )
+					{
+						t0 = std::max( t0, d0 / ( d0 - d1 ) );
+					}
+					else if ( d1 < 0.0f )
+					{
+						t1 = std::min( t1, d0 / ( d0 - d1 ) );
+					}
+				}
+
+				if ( t0 >= t1 )
+				{
+					return;
+				}
+
+				auto v0 = t0 > 0.0f
+					? doAddVertex( primitive[0], primitive[1], t0 )
+					: primitive[0];
+				auto v1 = t1 < 1.0f
+					? doAddVertex( primitive[0], primitive[1], t1 )
+					: primitive[1];
+				m_batch.indices.insert( m_batch.indices.end(), { v0, v1 } );
+				m_batch.provokingVertices.push_back( primitive[0] );
+			}
+
+			void doClipTriangle( uint32_t const * primitive )
+			{
+				UInt32Array polygon{ primitive, primitive + 3u };
+				UInt32Array clipped;
+
+				for ( auto & plane : m_planes )
+				{
+					clipped.clear();
+
+					for ( size_t i = 0u; i < polygon.size(); ++i )
+					{
+						auto a = polygon[i];
+						auto b = polygon[( i + 1u ) % polygon.size()];
+						auto da = plane.distance( doGetVertex( a ) );
+						auto db = plane.distance( doGetVertex( b ) );
+
+						if ( da >= 0.0f )
+						{
+							clipped.push_back( a );
+						}
+
+						if ( ( da >= 0.0f ) != ( db >= 0.0f ) )
+						{
+							clipped.push_back( doAddVertex( a, b, da / ( da - db ) ) );
+						}
+					}
+
+					polygon.swap( clipped );
+
+					if ( polygon.size() < 3u )
+					{
+						return;
+					}
+				}
+
+				// The polygon is split in a fan, which keeps its winding.
+				for ( size_t i = 1u; i + 1u < polygon.size(); ++i )
+				{
+					m_batch.indices.insert( m_batch.indices.end(), { polygon[0], polygon[i], polygon[i + 1u] } );
+					m_batch.provokingVertices.push_back( primitive[0] );
+				}
+			}
+
+		private:
+			RasterBatch & m_batch;
+			std::vector< Plane > m_planes;
+		};
+
+		VkViewport getViewport( Pipeline const & pipeline
+			, DrawState const & state )
+		{
+			if ( pipeline.hasDynamicStateEnable( VK_DYNAMIC_STATE_VIEWPORT ) )
+			{
+				return state.viewports.empty()
+					? VkViewport{}
+					: state.viewports.front();
+			}
+
+			auto & viewportState = pipeline.getViewportState();
+			return viewportState.viewportCount && viewportState.pViewports
+				? viewportState.pViewports[0]
+				: VkViewport{};
+		}
+
+		VkRect2D getScissor( Pipeline const & pipeline
+			, DrawState const & state )
+		{
+			if ( pipeline.hasDynamicStateEnable( VK_DYNAMIC_STATE_SCISSOR ) )
+			{
+				return state.scissors.empty()
+					? VkRect2D{}
+					: state.scissors.front();
+			}
+
+			auto & viewportState = pipeline.getViewportState();
+			return viewportState.scissorCount && viewportState.pScissors
+				? viewportState.pScissors[0]
+				: VkRect2D{};
+		}
+
+		// Moves the vertices from clip space to framebuffer coordinates.
+		void transformVertices( RasterBatch & batch )
+		{
+			auto & viewport = batch.viewport;
+			auto halfWidth = viewport.width / 2.0f;
+			auto halfHeight = viewport.height / 2.0f;
+			auto depthScale = viewport.maxDepth - viewport.minDepth;
+
+			for ( size_t i = 0u; i < batch.vertices.size(); i += batch.vertexWords )
+			{
+				auto vertex = batch.vertices.data() + i;
+				auto invW = 1.0f / std::max( vertex[3], MinW );
+				vertex[0] = viewport.x + halfWidth + halfWidth * vertex[0] * invW;
+				vertex[1] = viewport.y + halfHeight + halfHeight * vertex[1] * invW;
+				vertex[2] = viewport.minDepth + depthScale * vertex[2] * invW;
+				vertex[3] = invW;
+			}
+		}
+
+		// Runs the draw of the given vertex indices, where NoValue is a primitive restart.
+		void runDraw( VkDevice device
+			, DrawState const & state
+			, UInt32Array const & indices
+			, uint32_t instanceCount
+			, uint32_t firstInstance
+			, int32_t baseVertex )
+		{
+			auto pipeline = state.pipeline
+				? get( state.pipeline )
+				: nullptr;
+			auto vertexProgram = pipeline
+				? pipeline->getVertexProgram()
+				: nullptr;
+			auto fragmentProgram = pipeline
+				? pipeline->getFragmentProgram()
+				: nullptr;
+			auto topology = pipeline
+				? pipeline->getInputAssemblyState().topology
+				: VK_PRIMITIVE_TOPOLOGY_MAX_ENUM;
+
+			if ( indices.empty()
+				|| !instanceCount
+				|| !vertexProgram
+				|| !vertexProgram->isValid()
+				|| ( fragmentProgram && !fragmentProgram->isValid() )
+				|| !state.frameBuffer
+				|| !state.subpass
+				|| !getPrimitiveVertices( topology ) )
+			{
+				return;
+			}
+
+			RasterBatch batch;
+			batch.primitiveVertices = getPrimitiveVertices( topology );
+			batch.varyings = getVaryings( *vertexProgram, fragmentProgram );
+			batch.vertexWords = ClipWords;
+
+			for ( auto & varying : batch.varyings )
+			{
+				batch.vertexWords = std::max( batch.vertexWords, varying.word + varying.words );
+			}
+
+			batch.viewport = getViewport( *pipeline, state );
+			batch.scissor = getScissor( *pipeline, state );
+
+			// Each distinct vertex is shaded once per instance.
+			UInt32Array vertices;
+			vertices.reserve( indices.size() );
+			std::copy_if( indices.begin()
+				, indices.end()
+				, std::back_inserter( vertices )
+				, []( uint32_t index )
+				{
+					return index != NoValue;
+				} );
+			std::sort( vertices.begin(), vertices.end() );
+			vertices.erase( std::unique( vertices.begin(), vertices.end() ), vertices.end() );
+			auto vertexCount = uint32_t( vertices.size() );
+
+			if ( !vertexCount )
+			{
+				return;
+			}
+
+			auto stage = getVertexStage( *pipeline, *vertexProgram, state );
+			ShaderResources resources{ *vertexProgram, state.descriptorSets, state.pushConstants };
+			auto & pool = get( device )->getThreadPool();
+			std::vector< std::unique_ptr< ShaderInvocation > > invocations( pool.getWorkerCount() );
+			batch.vertices.resize( size_t( vertexCount ) * instanceCount * batch.vertexWords );
+			pool.run( vertexCount * instanceCount
+				, [&]( uint32_t index, uint32_t worker )
+				{
+					auto & invocation = invocations[worker];
+
+					if ( !invocation )
+					{
+						invocation = std::make_unique< ShaderInvocation >( *vertexProgram );
+						resources.bind( *invocation );
+					}
+
+					shadeVertex( *invocation
+						, stage
+						, batch.varyings
+						, vertices[index % vertexCount]
+						, firstInstance + index / vertexCount
+						, baseVertex
+						, firstInstance
+						, batch.vertices.data() + size_t( index ) * batch.vertexWords );
+				} );
+
+			UInt32Array slots;
+			slots.reserve( indices.size() );
+
+			for ( uint32_t instance = 0u; instance < instanceCount; ++instance )
+			{
+				slots.clear();
+
+				for ( auto index : indices )
+				{
+					slots.push_back( index == NoValue
+						? NoValue
+						: instance * vertexCount + uint32_t( std::distance( vertices.begin()
+							, std::lower_bound( vertices.begin(), vertices.end(), index ) ) ) );
+				}
+
+				assemble( topology, slots, batch );
+			}
+
+			Clipper clipper{ batch, pipeline->getRasterizationState().depthClampEnable != VK_FALSE };
+			clipper.clip();
+
+			if ( batch.indices.empty() )
+			{
+				return;
+			}
+
+			transformVertices( batch );
+			rasterize( device, state, batch );
+		}
+	}
+
+	void drawGraphics( VkDevice device
+		, DrawState const & state
+		, VkDrawIndirectCommand const & draw )
+	{
+		get( device )->getGpuClock().chargeDraw( draw.vertexCount, draw.instanceCount );
+		UInt32Array indices( draw.vertexCount );
+
+		for ( uint32_t i = 0u; i < draw.vertexCount; ++i )
+		{
+			indices[i] = draw.firstVertex + i;
+		}
+
+		runDraw( device
+			, state
+			, indices
+			, draw.instanceCount
+			, draw.firstInstance
+			, int32_t( draw.firstVertex ) );
+	}
+
+	void drawGraphicsIndexed( VkDevice device
+		, DrawState const & state
+		, VkDrawIndexedIndirectCommand const & draw )
+	{
+		get( device )->getGpuClock().chargeDraw( draw.indexCount, draw.instanceCount );
+		auto buffer = state.indexBuffer
+			? get( state.indexBuffer )
+			: nullptr;
+
+		if ( !buffer
+			|| !state.pipeline )
+		{
+			return;
+		}
+
+		auto indexSize = state.indexType == VK_INDEX_TYPE_UINT16
+			? 2u
+			: 4u;
+		auto restart = get( state.pipeline )->getInputAssemblyState().primitiveRestartEnable != VK_FALSE;
+		auto restartValue = indexSize == 2u
+			? 0xFFFFu
+			: 0xFFFFFFFFu;
+		auto range = state.indexOffset < buffer->getSize()
+			? buffer->getSize() - state.indexOffset
+			: 0u;
+		auto data = get( buffer->getMemory() )->getData( buffer->getMemoryOffset() + state.indexOffset );
+		UInt32Array indices( draw.indexCount );
+
+		for ( uint32_t i = 0u; i < draw.indexCount; ++i )
+		{
+			auto offset = VkDeviceSize( draw.firstIndex + i ) * indexSize;
+			uint32_t value{};
+
+			// Out of range indices read zeroes, as with robust buffer access.
+			if ( offset + indexSize <= range )
+			{
+				std::memcpy( &value, data + offset, indexSize );
+			}
+
+			indices[i] = ( restart && value == restartValue )
+				? NoValue
+				: uint32_t( int64_t( value ) + draw.vertexOffset );
+		}
+
+		runDraw( device
+			, state
+			, indices
+			, draw.instanceCount
+			, draw.firstInstance
+			, draw.vertexOffset );
+	}
+}
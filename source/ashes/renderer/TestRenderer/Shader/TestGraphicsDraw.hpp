@@ -0,0 +1,24 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+
+namespace ashes::test
+{
+	/**
+	*\brief
+	*	Runs a draw through the vertex shader, the primitive assembly and clipping, then the rasterizer.
+	*\remarks
+	*	The vertices are shaded on the device's thread pool, once per distinct index and instance.
+	*	Pipelines whose shaders can't be interpreted are skipped.
+	*/
+	void drawGraphics( VkDevice device
+		, DrawState const & state
+		, VkDrawIndirectCommand const & draw );
+	void drawGraphicsIndexed( VkDevice device
+		, DrawState const & state
+		, VkDrawIndexedIndirectCommand const & draw );
+}
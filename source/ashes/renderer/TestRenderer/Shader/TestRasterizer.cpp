@@ -0,0 +1,1084 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Shader/TestRasterizer.hpp"
+
+#include "Core/TestDevice.hpp"
+#include "Image/TestImage.hpp"
+#include "Image/TestImageView.hpp"
+#include "Miscellaneous/TestThreadPool.hpp"
+#include "Miscellaneous/TestTransferKernels.hpp"
+#include "Pipeline/TestPipeline.hpp"
+#include "RenderPass/TestFrameBuffer.hpp"
+#include "Shader/TestShaderInvocation.hpp"
+#include "Shader/TestShaderResources.hpp"
+
+#include "ashestest_api.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace ashes::test
+{
+	namespace
+	{
+		enum BuiltIn : uint32_t
+		{
+			BuiltInFragCoord = 15,
+			BuiltInPointCoord = 16,
+			BuiltInFrontFacing = 17,
+			BuiltInFragDepth = 22,
+		};
+
+		static uint32_t constexpr StorageClassInput = 1u;
+		static uint32_t constexpr StorageClassOutput = 3u;
+		static uint32_t constexpr NoValue = ~( 0u );
+		static int32_t constexpr TileSize = 64;
+		// The triangles' vertices are snapped to 1/256th of a pixel.
+		static int64_t constexpr SubpixelOne = 256;
+		static int64_t constexpr SubpixelHalf = SubpixelOne / 2;
+		static float constexpr MaxPointSize = 64.0f;
+
+		struct ColourTarget
+		{
+			SubresourceData data;
+			TexelRange range;
+			VkPipelineColorBlendAttachmentState blend;
+			// The fragment shader output written to the attachment.
+			uint32_t offset;
+			uint32_t size;
+		};
+		/**
+		*\brief
+		*	The state shared by all the fragments of a draw.
+		*/
+		struct FragmentState
+		{
+			ShaderProgram const * program{};
+			std::unique_ptr< ShaderResources > resources;
+			uint32_t fragCoord{ NoValue };
+			uint32_t pointCoord{ NoValue };
+			uint32_t frontFacing{ NoValue };
+			uint32_t fragDepth{ NoValue };
+			std::vector< ColourTarget > colours;
+			std::array< float, 4u > blendConstants{};
+			SubresourceData depth;
+			VkFormat depthFormat{};
+			SubresourceData stencil;
+			bool depthTest{};
+			bool depthWrite{};
+			VkCompareOp depthCompare{};
+			bool depthClamp{};
+			bool stencilTest{};
+			// Front then back.
+			std::array< VkStencilOpState, 2u > stencilFaces{};
+			// The pixels that can be written, from the scissor and the attachments sizes.
+			VkRect2D area{};
+		};
+		/**
+		*\brief
+		*	A visible primitive, ready to be rasterized.
+		*/
+		struct Primitive
+		{
+			// The index of the primitive in the batch.
+			uint32_t index;
+			uint32_t vertexCount;
+			uint32_t vertices[3];
+			bool frontFacing;
+			// The pixels covered by the primitive's bounds, the maximums are excluded.
+			int32_t minX;
+			int32_t minY;
+			int32_t maxX;
+			int32_t maxY;
+			// Triangles, in fixed point, ordered so that the area is positive.
+			int64_t x[3];
+			int64_t y[3];
+			int64_t area;
+		};
+
+		struct Worker
+		{
+			std::unique_ptr< ShaderInvocation > invocation;
+		};
+
+		int32_t floorToInt( double value )
+		{
+			return int32_t( std::floor( value ) );
+		}
+
+		template< typename ValueT >
+		bool compare( VkCompareOp op
+			, ValueT reference
+			, ValueT value )
+		{
+			switch ( op )
+			{
+			case VK_COMPARE_OP_NEVER:
+				return false;
+			case VK_COMPARE_OP_LESS:
+				return reference < value;
+			case VK_COMPARE_OP_EQUAL:
+				return reference == value;
+			case VK_COMPARE_OP_LESS_OR_EQUAL:
+				return reference <= value;
+			case VK_COMPARE_OP_GREATER:
+				return reference > value;
+			case VK_COMPARE_OP_NOT_EQUAL:
+				return reference != value;
+			case VK_COMPARE_OP_GREATER_OR_EQUAL:
+				return reference >= value;
+			default:
+				return true;
+			}
+		}
+
+		uint8_t * getTexel( SubresourceData const & data
+			, int32_t x
+			, int32_t y )
+		{
+			return data.data
+				+ VkDeviceSize( y ) * data.rowPitch
+				+ VkDeviceSize( x ) * data.texelSize
+				+ data.aspectOffset;
+		}
+
+		bool isUnormDepth( VkFormat format )
+		{
+			return format != VK_FORMAT_D32_SFLOAT
+				&& format != VK_FORMAT_D32_SFLOAT_S8_UINT;
+		}
+
+		float readDepth( VkFormat format
+			, uint8_t const * texel )
+		{
+			switch ( format )
+			{
+			case VK_FORMAT_D16_UNORM:
+			case VK_FORMAT_D16_UNORM_S8_UINT:
+				{
+					uint16_t value{};
+					std::memcpy( &value, texel, sizeof( value ) );
+					return float( value ) / 65535.0f;
+				}
+			case VK_FORMAT_X8_D24_UNORM_PACK32:
+			case VK_FORMAT_D24_UNORM_S8_UINT:
+				{
+					uint32_t value{};
+					std::memcpy( &value, texel, 3u );
+					return float( double( value ) / 16777215.0 );
+				}
+			default:
+				{
+					float value{};
+					std::memcpy( &value, texel, sizeof( value ) );
+					return value;
+				}
+			}
+		}
+
+		void writeDepth( VkFormat format
+			, float depth
+			, uint8_t * texel )
+		{
+			switch ( format )
+			{
+			case VK_FORMAT_D16_UNORM:
+			case VK_FORMAT_D16_UNORM_S8_UINT:
+				{
+					auto value = uint16_t( std::lround( depth * 65535.0f ) );
+					std::memcpy( texel, &value, sizeof( value ) );
+				}
+				break;
+			case VK_FORMAT_X8_D24_UNORM_PACK32:
+			case VK_FORMAT_D24_UNORM_S8_UINT:
+				{
+					auto value = uint32_t( std::llround( double( depth ) * 16777215.0 ) );
+					std::memcpy( texel, &value, 3u );
+				}
+				break;
+			default:
+				std::memcpy( texel, &depth, sizeof( depth ) );
+				break;
+			}
+		}
+
+		void applyStencilOp( VkStencilOpState const & face
+			, VkStencilOp op
+			, uint8_t * texel )
+		{
+			uint32_t value = *texel;
+			uint32_t result = value;
+
+			switch ( op )
+			{
+			case VK_STENCIL_OP_ZERO:
+				result = 0u;
+				break;
+			case VK_STENCIL_OP_REPLACE:
+				result = face.reference;
+				break;
+			case VK_STENCIL_OP_INCREMENT_AND_CLAMP:
+				result = std::min( value + 1u, 0xFFu );
+				break;
+			case VK_STENCIL_OP_DECREMENT_AND_CLAMP:
+				result = value ? value - 1u : 0u;
+				break;
+			case VK_STENCIL_OP_INVERT:
+				result = ~value;
+				break;
+			case VK_STENCIL_OP_INCREMENT_AND_WRAP:
+				result = value + 1u;
+				break;
+			case VK_STENCIL_OP_DECREMENT_AND_WRAP:
+				result = value - 1u;
+				break;
+			default:
+				return;
+			}
+
+			*texel = uint8_t( ( value & ~face.writeMask ) | ( result & face.writeMask ) );
+		}
+		/**
+		*\brief
+		*	Runs the stencil and depth tests, the failure operations are applied.
+		*\param[in] write
+		*	Tells if the stencil pass operation and the depth write are applied, when the tests pass.
+		*/
+		bool testDepthStencil( FragmentState const & state
+			, int32_t x
+			, int32_t y
+			, float depth
+			, bool frontFacing
+			, bool write )
+		{
+			uint8_t * stencil{};
+			auto & face = state.stencilFaces[frontFacing ? 0u : 1u];
+
+			if ( state.stencilTest )
+			{
+				stencil = getTexel( state.stencil, x, y );
+
+				if ( !compare( face.compareOp
+					, face.reference & face.compareMask
+					, *stencil & face.compareMask ) )
+				{
+					applyStencilOp( face, face.failOp, stencil );
+					return false;
+				}
+			}
+
+			uint8_t * texel{};
+
+			if ( state.depthTest )
+			{
+				texel = getTexel( state.depth, x, y );
+
+				if ( isUnormDepth( state.depthFormat ) )
+				{
+					depth = std::max( 0.0f, std::min( 1.0f, depth ) );
+				}
+
+				if ( !compare( state.depthCompare, depth, readDepth( state.depthFormat, texel ) ) )
+				{
+					if ( stencil )
+					{
+						applyStencilOp( face, face.depthFailOp, stencil );
+					}
+
+					return false;
+				}
+			}
+
+			if ( write )
+			{
+				if ( stencil )
+				{
+					applyStencilOp( face, face.passOp, stencil );
+				}
+
+				if ( texel && state.depthWrite )
+				{
+					writeDepth( state.depthFormat, depth, texel );
+				}
+			}
+
+			return true;
+		}
+
+		float getBlendFactor( VkBlendFactor factor
+			, float const * src
+			, float const * dst
+			, float const * constants
+			, uint32_t component )
+		{
+			switch ( factor )
+			{
+			case VK_BLEND_FACTOR_ZERO:
+				return 0.0f;
+			case VK_BLEND_FACTOR_ONE:
+				return 1.0f;
+			case VK_BLEND_FACTOR_SRC_COLOR:
+				return src[component];
+			case VK_BLEND_FACTOR_ONE_MINUS_SRC_COLOR:
+				return 1.0f - src[component];
+			case VK_BLEND_FACTOR_DST_COLOR:
+				return dst[component];
+			case VK_BLEND_FACTOR_ONE_MINUS_DST_COLOR:
+				return 1.0f - dst[component];
+			case VK_BLEND_FACTOR_SRC_ALPHA:
+				return src[3];
+			case VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA:
+				return 1.0f - src[3];
+			case VK_BLEND_FACTOR_DST_ALPHA:
+				return dst[3];
+			case VK_BLEND_FACTOR_ONE_MINUS_DST_ALPHA:
+				return 1.0f - dst[3];
+			case VK_BLEND_FACTOR_CONSTANT_COLOR:
+				return constants[component];
+			case VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_COLOR:
+				return 1.0f - constants[component];
+			case VK_BLEND_FACTOR_CONSTANT_ALPHA:
+				return constants[3];
+			case VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA:
+				return 1.0f - constants[3];
+			case VK_BLEND_FACTOR_SRC_ALPHA_SATURATE:
+				return component == 3u
+					? 1.0f
+					: std::min( src[3], 1.0f - dst[3] );
+			default:
+				// Dual source blending isn't supported.
+				return 0.0f;
+			}
+		}
+
+		float blend( VkBlendOp op
+			, float src
+			, float srcFactor
+			, float dst
+			, float dstFactor )
+		{
+			switch ( op )
+			{
+			case VK_BLEND_OP_ADD:
+				return src * srcFactor + dst * dstFactor;
+			case VK_BLEND_OP_SUBTRACT:
+				return src * srcFactor - dst * dstFactor;
+			case VK_BLEND_OP_REVERSE_SUBTRACT:
+				return dst * dstFactor - src * srcFactor;
+			case VK_BLEND_OP_MIN:
+				return std::min( src, dst );
+			case VK_BLEND_OP_MAX:
+				return std::max( src, dst );
+			default:
+				return src;
+			}
+		}
+
+		void writeColour( ColourTarget const & target
+			, std::array< float, 4u > const & blendConstants
+			, uint8_t const * output
+			, int32_t x
+			, int32_t y )
+		{
+			auto texel = getTexel( target.data, x, y );
+			auto format = target.data.format;
+			auto mask = target.blend.colorWriteMask;
+			uint32_t src[4]{ 0u, 0u, 0u, 0u };
+			uint32_t dst[4]{ 0u, 0u, 0u, 0u };
+			std::memcpy( src, output, std::min( target.size, uint32_t( sizeof( src ) ) ) );
+
+			if ( target.range == TexelRange::eInteger )
+			{
+				if ( mask != 0xFu )
+				{
+					readTexel( format, texel, dst );
+				}
+			}
+			else
+			{
+				float s[4];
+				float d[4]{ 0.0f, 0.0f, 0.0f, 0.0f };
+				float c[4];
+				std::memcpy( s, src, sizeof( s ) );
+				std::copy( blendConstants.begin(), blendConstants.end(), c );
+
+				// The fixed point formats clamp the shader output and the constants.
+				if ( target.range != TexelRange::eFloat )
+				{
+					auto min = target.range == TexelRange::eSigned ? -1.0f : 0.0f;
+
+					for ( uint32_t i = 0u; i < 4u; ++i )
+					{
+						s[i] = std::max( min, std::min( 1.0f, s[i] ) );
+						c[i] = std::max( min, std::min( 1.0f, c[i] ) );
+					}
+				}
+
+				if ( target.blend.blendEnable || mask != 0xFu )
+				{
+					readTexel( format, texel, dst );
+					std::memcpy( d, dst, sizeof( d ) );
+				}
+
+				if ( target.blend.blendEnable )
+				{
+					float result[4];
+
+					for ( uint32_t i = 0u; i < 4u; ++i )
+					{
+						auto isAlpha = i == 3u;
+						result[i] = blend( isAlpha ? target.blend.alphaBlendOp : target.blend.colorBlendOp
+							, s[i]
+							, getBlendFactor( isAlpha ? target.blend.srcAlphaBlendFactor : target.blend.srcColorBlendFactor, s, d, c, i )
+							, d[i]
+							, getBlendFactor( isAlpha ? target.blend.dstAlphaBlendFactor : target.blend.dstColorBlendFactor, s, d, c, i ) );
+					}
+
+					std::memcpy( s, result, sizeof( s ) );
+				}
+
+				std::memcpy( src, s, sizeof( src ) );
+			}
+
+			for ( uint32_t i = 0u; i < 4u; ++i )
+			{
+				if ( !( mask & ( 1u << i ) ) )
+				{
+					src[i] = dst[i];
+				}
+			}
+
+			writeTexel( format, src, texel );
+		}
+
+		SubresourceData getAttachmentData( VkImageView view
+			, VkImageAspectFlags aspect )
+		{
+			auto imageView = get( view );
+			auto & range = imageView->getSubResourceRange();
+			auto result = get( imageView->getImage() )->getSubresourceData( aspect
+				, range.baseMipLevel
+				, range.baseArrayLayer );
+
+			if ( aspect == VK_IMAGE_ASPECT_COLOR_BIT )
+			{
+				result.format = imageView->getFormat();
+			}
+
+			return result;
+		}
+
+		void restrictArea( VkRect2D & area
+			, SubresourceData const & data )
+		{
+			area.extent.width = std::min( area.extent.width, uint32_t( std::max( 0, int32_t( data.extent.width ) - area.offset.x ) ) );
+			area.extent.height = std::min( area.extent.height, uint32_t( std::max( 0, int32_t( data.extent.height ) - area.offset.y ) ) );
+		}
+
+		std::unique_ptr< FragmentState > getFragmentState( DrawState const & state
+			, RasterBatch const & batch )
+		{
+			auto result = std::make_unique< FragmentState >();
+			auto pipeline = get( state.pipeline );
+			auto frameBuffer = get( state.frameBuffer );
+			auto & views = frameBuffer->getAllViews();
+			auto & subpass = *state.subpass;
+			auto & dimensions = frameBuffer->getDimensions();
+			auto & scissor = batch.scissor;
+			auto & area = result->area;
+			area.offset.x = std::max( scissor.offset.x, 0 );
+			area.offset.y = std::max( scissor.offset.y, 0 );
+			area.extent.width = uint32_t( std::max( 0
+				, std::min( int32_t( dimensions.width ), scissor.offset.x + int32_t( scissor.extent.width ) ) - area.offset.x ) );
+			area.extent.height = uint32_t( std::max( 0
+				, std::min( int32_t( dimensions.height ), scissor.offset.y + int32_t( scissor.extent.height ) ) - area.offset.y ) );
+			result->depthClamp = pipeline->getRasterizationState().depthClampEnable != VK_FALSE;
+			result->program = pipeline->getFragmentProgram();
+
+			if ( result->program )
+			{
+				result->resources = std::make_unique< ShaderResources >( *result->program
+					, state.descriptorSets
+					, state.pushConstants );
+				auto & interface = result->program->getInterface();
+				auto & colorBlend = pipeline->getColorBlendState();
+				result->blendConstants = pipeline->hasDynamicStateEnable( VK_DYNAMIC_STATE_BLEND_CONSTANTS )
+					? state.blendConstants
+					: std::array< float, 4u >{ colorBlend.blendConstants[0]
+						, colorBlend.blendConstants[1]
+						, colorBlend.blendConstants[2]
+						, colorBlend.blendConstants[3] };
+
+				for ( auto & variable : interface )
+				{
+					switch ( variable.builtIn )
+					{
+					case BuiltInFragCoord:
+						result->fragCoord = variable.offset;
+						break;
+					case BuiltInPointCoord:
+						result->pointCoord = variable.offset;
+						break;
+					case BuiltInFrontFacing:
+						result->frontFacing = variable.offset;
+						break;
+					case BuiltInFragDepth:
+						result->fragDepth = variable.offset;
+						break;
+					default:
+						break;
+					}
+				}
+
+				for ( uint32_t location = 0u; location < subpass.colorAttachmentCount; ++location )
+				{
+					auto attachment = subpass.pColorAttachments[location].attachment;
+					auto output = std::find_if( interface.begin()
+						, interface.end()
+						, [location]( ShaderProgram::Interface const & lookup )
+						{
+							return lookup.storageClass == StorageClassOutput
+								&& lookup.builtIn == NoValue
+								&& lookup.location == location;
+						} );
+
+					if ( attachment == VK_ATTACHMENT_UNUSED
+						|| attachment >= views.size()
+						|| output == interface.end() )
+					{
+						continue;
+					}
+
+					ColourTarget target{ getAttachmentData( views[attachment], VK_IMAGE_ASPECT_COLOR_BIT ) };
+					target.range = getTexelRange( target.data.format );
+					target.blend = VkPipelineColorBlendAttachmentState{};
+					target.blend.colorWriteMask = 0xFu;
+
+					if ( location < colorBlend.attachmentCount )
+					{
+						target.blend = colorBlend.pAttachments[location];
+					}
+
+					target.offset = output->offset;
+					target.size = output->size;
+
+					if ( target.range != TexelRange::eUnsupported )
+					{
+						restrictArea( area, target.data );
+						result->colours.push_back( target );
+					}
+				}
+			}
+
+			auto & depthStencil = pipeline->getDepthStencilState();
+
+			if ( depthStencil
+				&& subpass.pDepthStencilAttachment
+				&& subpass.pDepthStencilAttachment->attachment < views.size() )
+			{
+				auto view = views[subpass.pDepthStencilAttachment->attachment];
+				auto format = get( view )->getFormat();
+				auto hasDepth = isDepthFormat( format ) || isDepthStencilFormat( format );
+				auto hasStencil = isStencilFormat( format ) || isDepthStencilFormat( format );
+				result->depthFormat = format;
+				result->depthTest = hasDepth && depthStencil->depthTestEnable;
+				result->depthWrite = hasDepth && depthStencil->depthWriteEnable;
+				result->depthCompare = depthStencil->depthCompareOp;
+				result->stencilTest = hasStencil && depthStencil->stencilTestEnable;
+				result->stencilFaces = { depthStencil->front, depthStencil->back };
+
+				for ( uint32_t face = 0u; face < 2u; ++face )
+				{
+					auto & stencilFace = result->stencilFaces[face];
+
+					if ( pipeline->hasDynamicStateEnable( VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK ) )
+					{
+						stencilFace.compareMask = state.stencilCompareMasks[face];
+					}
+
+					if ( pipeline->hasDynamicStateEnable( VK_DYNAMIC_STATE_STENCIL_WRITE_MASK ) )
+					{
+						stencilFace.writeMask = state.stencilWriteMasks[face];
+					}
+
+					if ( pipeline->hasDynamicStateEnable( VK_DYNAMIC_STATE_STENCIL_REFERENCE ) )
+					{
+						stencilFace.reference = state.stencilReferences[face];
+					}
+				}
+
+				if ( result->depthTest )
+				{
+					result->depth = getAttachmentData( view, VK_IMAGE_ASPECT_DEPTH_BIT );
+					restrictArea( area, result->depth );
+				}
+
+				if ( result->stencilTest )
+				{
+					result->stencil = getAttachmentData( view, VK_IMAGE_ASPECT_STENCIL_BIT );
+					restrictArea( area, result->stencil );
+				}
+			}
+
+			return result;
+		}
+
+		float const * getVertex( RasterBatch const & batch
+			, uint32_t index )
+		{
+			return batch.vertices.data() + size_t( index ) * batch.vertexWords;
+		}
+
+		bool setupPrimitive( Pipeline const & pipeline
+			, RasterBatch const & batch
+			, VkRect2D const & area
+			, uint32_t index
+			, Primitive & result )
+		{
+			auto count = batch.primitiveVertices;
+			result.index = index;
+			result.vertexCount = count;
+			result.frontFacing = true;
+			std::copy_n( batch.indices.data() + size_t( index ) * count, count, result.vertices );
+			float minX{ std::numeric_limits< float >::max() };
+			float minY{ std::numeric_limits< float >::max() };
+			float maxX{ std::numeric_limits< float >::lowest() };
+			float maxY{ std::numeric_limits< float >::lowest() };
+			// Points extend around their vertex, and lines are one pixel wide.
+			float extent = 1.0f;
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				auto vertex = getVertex( batch, result.vertices[i] );
+				minX = std::min( minX, vertex[0] );
+				minY = std::min( minY, vertex[1] );
+				maxX = std::max( maxX, vertex[0] );
+				maxY = std::max( maxY, vertex[1] );
+
+				if ( count == 1u )
+				{
+					extent = std::max( 1.0f, std::min( MaxPointSize, vertex[4] ) ) / 2.0f;
+				}
+			}
+
+			if ( count == 3u )
+			{
+				for ( uint32_t i = 0u; i < 3u; ++i )
+				{
+					auto vertex = getVertex( batch, result.vertices[i] );
+					result.x[i] = std::llround( double( vertex[0] ) * SubpixelOne );
+					result.y[i] = std::llround( double( vertex[1] ) * SubpixelOne );
+				}
+
+				result.area = ( result.x[1] - result.x[0] ) * ( result.y[2] - result.y[0] )
+					- ( result.y[1] - result.y[0] ) * ( result.x[2] - result.x[0] );
+
+				if ( !result.area )
+				{
+					return false;
+				}
+
+				// With y pointing down, a positive area is a clockwise triangle.
+				auto & rasterization = pipeline.getRasterizationState();
+				result.frontFacing = rasterization.frontFace == VK_FRONT_FACE_CLOCKWISE
+					? result.area > 0
+					: result.area < 0;
+
+				if ( ( checkFlag( rasterization.cullMode, VK_CULL_MODE_FRONT_BIT ) && result.frontFacing )
+					|| ( checkFlag( rasterization.cullMode, VK_CULL_MODE_BACK_BIT ) && !result.frontFacing ) )
+				{
+					return false;
+				}
+
+				if ( result.area < 0 )
+				{
+					std::swap( result.vertices[1], result.vertices[2] );
+					std::swap( result.x[1], result.x[2] );
+					std::swap( result.y[1], result.y[2] );
+					result.area = -result.area;
+				}
+
+				extent = 0.0f;
+			}
+
+			result.minX = std::max( area.offset.x, floorToInt( minX - extent ) );
+			result.minY = std::max( area.offset.y, floorToInt( minY - extent ) );
+			result.maxX = std::min( area.offset.x + int32_t( area.extent.width ), floorToInt( maxX + extent ) + 1 );
+			result.maxY = std::min( area.offset.y + int32_t( area.extent.height ), floorToInt( maxY + extent ) + 1 );
+			return result.minX < result.maxX
+				&& result.minY < result.maxY;
+		}
+		/**
+		*\brief
+		*	Shades a fragment and writes it to the attachments.
+		*\param[in] weights
+		*	The barycentric coordinates of the fragment in the primitive, in framebuffer space.
+		*/
+		void processFragment( FragmentState const & state
+			, RasterBatch const & batch
+			, Worker & worker
+			, Primitive const & primitive
+			, int32_t x
+			, int32_t y
+			, float const ( & weights )[3]
+			, float const * pointCoord )
+		{
+			float const * vertices[3]{};
+			float depth{};
+			float invW{};
+
+			for ( uint32_t i = 0u; i < primitive.vertexCount; ++i )
+			{
+				vertices[i] = getVertex( batch, primitive.vertices[i] );
+				depth += weights[i] * vertices[i][2];
+				invW += weights[i] * vertices[i][3];
+			}
+
+			if ( state.depthClamp )
+			{
+				auto minDepth = std::min( batch.viewport.minDepth, batch.viewport.maxDepth );
+				auto maxDepth = std::max( batch.viewport.minDepth, batch.viewport.maxDepth );
+				depth = std::max( minDepth, std::min( maxDepth, depth ) );
+			}
+
+			// The tests are run early when the shader doesn't change the depth, they are applied after it.
+			auto early = state.fragDepth == NoValue;
+
+			if ( early
+				&& !testDepthStencil( state, x, y, depth, primitive.frontFacing, false ) )
+			{
+				return;
+			}
+
+			if ( !state.program )
+			{
+				testDepthStencil( state, x, y, depth, primitive.frontFacing, true );
+				return;
+			}
+
+			auto & invocation = *worker.invocation;
+			invocation.reset();
+			auto memory = invocation.getMemory();
+			float perspective[3]{};
+
+			for ( uint32_t i = 0u; i < primitive.vertexCount; ++i )
+			{
+				perspective[i] = weights[i] * vertices[i][3] / invW;
+			}
+
+			for ( auto & varying : batch.varyings )
+			{
+				auto dst = memory + varying.offset;
+
+				if ( varying.interpolation == ShaderProgram::Interpolation::eFlat )
+				{
+					std::memcpy( dst
+						, getVertex( batch, batch.provokingVertices[primitive.index] ) + varying.word
+						, varying.words * sizeof( float ) );
+					continue;
+				}
+
+				auto & factors = varying.interpolation == ShaderProgram::Interpolation::eNoPerspective
+					? weights
+					: perspective;
+
+				for ( uint32_t word = 0u; word < varying.words; ++word )
+				{
+					float value{};
+
+					for ( uint32_t i = 0u; i < primitive.vertexCount; ++i )
+					{
+						value += factors[i] * vertices[i][varying.word + word];
+					}
+
+					std::memcpy( dst + word * sizeof( float ), &value, sizeof( value ) );
+				}
+			}
+
+			if ( state.fragCoord != NoValue )
+			{
+				float const fragCoord[4]{ float( x ) + 0.5f, float( y ) + 0.5f, depth, invW };
+				std::memcpy( memory + state.fragCoord, fragCoord, sizeof( fragCoord ) );
+			}
+
+			if ( state.frontFacing != NoValue )
+			{
+				uint32_t const frontFacing = primitive.frontFacing ? 1u : 0u;
+				std::memcpy( memory + state.frontFacing, &frontFacing, sizeof( frontFacing ) );
+			}
+
+			if ( state.pointCoord != NoValue && pointCoord )
+			{
+				std::memcpy( memory + state.pointCoord, pointCoord, 2u * sizeof( float ) );
+			}
+
+			invocation.run();
+
+			if ( invocation.isKilled() )
+			{
+				return;
+			}
+
+			if ( !early )
+			{
+				std::memcpy( &depth, memory + state.fragDepth, sizeof( depth ) );
+			}
+
+			if ( !testDepthStencil( state, x, y, depth, primitive.frontFacing, true ) )
+			{
+				return;
+			}
+
+			for ( auto & target : state.colours )
+			{
+				writeColour( target, state.blendConstants, memory + target.offset, x, y );
+			}
+		}
+
+		void rasterizeTriangle( FragmentState const & state
+			, RasterBatch const & batch
+			, Worker & worker
+			, Primitive const & primitive
+			, VkRect2D const & tile )
+		{
+			auto minX = std::max( primitive.minX, tile.offset.x );
+			auto minY = std::max( primitive.minY, tile.offset.y );
+			auto maxX = std::min( primitive.maxX, tile.offset.x + int32_t( tile.extent.width ) );
+			auto maxY = std::min( primitive.maxY, tile.offset.y + int32_t( tile.extent.height ) );
+			// Edge i is opposite to vertex i, its function is positive inside the triangle.
+			int64_t dx[3];
+			int64_t dy[3];
+			int64_t bias[3];
+			int64_t rowEdges[3];
+			auto px = minX * SubpixelOne + SubpixelHalf;
+			auto py = minY * SubpixelOne + SubpixelHalf;
+
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				auto j = ( i + 1u ) % 3u;
+				auto k = ( i + 2u ) % 3u;
+				dx[i] = primitive.x[k] - primitive.x[j];
+				dy[i] = primitive.y[k] - primitive.y[j];
+				// Top-left fill rule, the pixels on the other edges are excluded.
+				bias[i] = ( dy[i] < 0 || ( dy[i] == 0 && dx[i] > 0 ) ) ? 0 : -1;
+				rowEdges[i] = dx[i] * ( py - primitive.y[j] ) - dy[i] * ( px - primitive.x[j] );
+			}
+
+			auto area = double( primitive.area );
+
+			for ( auto y = minY; y < maxY; ++y )
+			{
+				int64_t edges[3]{ rowEdges[0], rowEdges[1], rowEdges[2] };
+
+				for ( auto x = minX; x < maxX; ++x )
+				{
+					if ( edges[0] + bias[0] >= 0
+						&& edges[1] + bias[1] >= 0
+						&& edges[2] + bias[2] >= 0 )
+					{
+						float const weights[3]{ float( double( edges[0] ) / area )
+							, float( double( edges[1] ) / area )
+							, float( double( edges[2] ) / area ) };
+						processFragment( state, batch, worker, primitive, x, y, weights, nullptr );
+					}
+
+					for ( uint32_t i = 0u; i < 3u; ++i )
+					{
+						edges[i] -= dy[i] * SubpixelOne;
+					}
+				}
+
+				for ( uint32_t i = 0u; i < 3u; ++i )
+				{
+					rowEdges[i] += dx[i] * SubpixelOne;
+				}
+			}
+		}
+
+		// Lines are drawn one pixel wide, along their major axis, as non strict lines allow.
+		void rasterizeLine( FragmentState const & state
+			, RasterBatch const & batch
+			, Worker & worker
+			, Primitive const & primitive
+			, VkRect2D const & tile )
+		{
+			auto minX = std::max( primitive.minX, tile.offset.x );
+			auto minY = std::max( primitive.minY, tile.offset.y );
+			auto maxX = std::min( primitive.maxX, tile.offset.x + int32_t( tile.extent.width ) );
+			auto maxY = std::min( primitive.maxY, tile.offset.y + int32_t( tile.extent.height ) );
+			auto v0 = getVertex( batch, primitive.vertices[0] );
+			auto v1 = getVertex( batch, primitive.vertices[1] );
+			auto dx = v1[0] - v0[0];
+			auto dy = v1[1] - v0[1];
+			auto xMajor = std::abs( dx ) >= std::abs( dy );
+			auto major = xMajor ? dx : dy;
+
+			if ( major == 0.0f )
+			{
+				return;
+			}
+
+			// The pixels whose centre is in [start, end) along the major axis.
+			auto start = xMajor ? std::min( v0[0], v1[0] ) : std::min( v0[1], v1[1] );
+			auto end = xMajor ? std::max( v0[0], v1[0] ) : std::max( v0[1], v1[1] );
+			auto first = std::max( int32_t( std::ceil( start - 0.5f ) ), xMajor ? minX : minY );
+			auto last = std::min( int32_t( std::ceil( end - 0.5f ) ), xMajor ? maxX : maxY );
+
+			for ( auto pixel = first; pixel < last; ++pixel )
+			{
+				auto t = ( float( pixel ) + 0.5f - ( xMajor ? v0[0] : v0[1] ) ) / major;
+				auto minor = floorToInt( xMajor
+					? v0[1] + t * dy
+					: v0[0] + t * dx );
+				auto x = xMajor ? pixel : minor;
+				auto y = xMajor ? minor : pixel;
+
+				if ( x >= minX && x < maxX
+					&& y >= minY && y < maxY )
+				{
+					float const weights[3]{ 1.0f - t, t, 0.0f };
+					processFragment( state, batch, worker, primitive, x, y, weights, nullptr );
+				}
+			}
+		}
+
+		void rasterizePoint( FragmentState const & state
+			, RasterBatch const & batch
+			, Worker & worker
+			, Primitive const & primitive
+			, VkRect2D const & tile )
+		{
+			auto minX = std::max( primitive.minX, tile.offset.x );
+			auto minY = std::max( primitive.minY, tile.offset.y );
+			auto maxX = std::min( primitive.maxX, tile.offset.x + int32_t( tile.extent.width ) );
+			auto maxY = std::min( primitive.maxY, tile.offset.y + int32_t( tile.extent.height ) );
+			auto vertex = getVertex( batch, primitive.vertices[0] );
+			auto size = std::max( 1.0f, std::min( MaxPointSize, vertex[4] ) );
+			auto left = vertex[0] - size / 2.0f;
+			auto top = vertex[1] - size / 2.0f;
+			float const weights[3]{ 1.0f, 0.0f, 0.0f };
+
+			for ( auto y = minY; y < maxY; ++y )
+			{
+				for ( auto x = minX; x < maxX; ++x )
+				{
+					float const pointCoord[2]{ ( float( x ) + 0.5f - left ) / size
+						, ( float( y ) + 0.5f - top ) / size };
+
+					if ( pointCoord[0] >= 0.0f && pointCoord[0] < 1.0f
+						&& pointCoord[1] >= 0.0f && pointCoord[1] < 1.0f )
+					{
+						processFragment( state, batch, worker, primitive, x, y, weights, pointCoord );
+					}
+				}
+			}
+		}
+	}
+
+	void rasterize( VkDevice device
+		, DrawState const & state
+		, RasterBatch const & batch )
+	{
+		auto fragmentState = getFragmentState( state, batch );
+		auto & area = fragmentState->area;
+
+		if ( !area.extent.width
+			|| !area.extent.height
+			|| ( fragmentState->colours.empty()
+				&& !fragmentState->depthTest
+				&& !fragmentState->stencilTest
+				&& !fragmentState->program ) )
+		{
+			return;
+		}
+
+		auto & pipeline = *get( state.pipeline );
+		auto primitiveCount = uint32_t( batch.indices.size() / batch.primitiveVertices );
+		std::vector< Primitive > primitives;
+		primitives.reserve( primitiveCount );
+
+		for ( uint32_t index = 0u; index < primitiveCount; ++index )
+		{
+			Primitive primitive;
+
+			if ( setupPrimitive( pipeline, batch, area, index, primitive ) )
+			{
+				primitives.push_back( primitive );
+			}
+		}
+
+		// Each tile keeps the primitives overlapping it, in submission order.
+		auto tilesX = ( area.extent.width + TileSize - 1u ) / TileSize;
+		auto tilesY = ( area.extent.height + TileSize - 1u ) / TileSize;
+		std::vector< UInt32Array > bins( tilesX * tilesY );
+
+		for ( uint32_t index = 0u; index < primitives.size(); ++index )
+		{
+			auto & primitive = primitives[index];
+			auto firstX = uint32_t( primitive.minX - area.offset.x ) / TileSize;
+			auto firstY = uint32_t( primitive.minY - area.offset.y ) / TileSize;
+			auto lastX = uint32_t( primitive.maxX - 1 - area.offset.x ) / TileSize;
+			auto lastY = uint32_t( primitive.maxY - 1 - area.offset.y ) / TileSize;
+
+			for ( auto y = firstY; y <= lastY; ++y )
+			{
+				for ( auto x = firstX; x <= lastX; ++x )
+				{
+					bins[y * tilesX + x].push_back( index );
+				}
+			}
+		}
+
+		UInt32Array tiles;
+
+		for ( uint32_t tile = 0u; tile < bins.size(); ++tile )
+		{
+			if ( !bins[tile].empty() )
+			{
+				tiles.push_back( tile );
+			}
+		}
+
+		auto & pool = get( device )->getThreadPool();
+		std::vector< Worker > workers( pool.getWorkerCount() );
+		pool.run( uint32_t( tiles.size() )
+			, [&]( uint32_t index, uint32_t workerIndex )
+			{
+				auto & worker = workers[workerIndex];
+
+				if ( fragmentState->program
+					&& !worker.invocation )
+				{
+					worker.invocation = std::make_unique< ShaderInvocation >( *fragmentState->program );
+					fragmentState->resources->bind( *worker.invocation );
+				}
+
+				auto tileIndex = tiles[index];
+				VkRect2D tile{ { area.offset.x + int32_t( ( tileIndex % tilesX ) * TileSize )
+						, area.offset.y + int32_t( ( tileIndex / tilesX ) * TileSize ) }
+					, { uint32_t( TileSize ), uint32_t( TileSize ) } };
+
+				for ( auto primitiveIndex : bins[tileIndex] )
+				{
+					auto & primitive = primitives[primitiveIndex];
+
+					switch ( primitive.vertexCount )
+					{
+					case 1u:
+						rasterizePoint( *fragmentState, batch, worker, primitive, tile );
+						break;
+					case 2u:
+						rasterizeLine( *fragmentState, batch, worker, primitive, tile );
+						break;
+					default:
+						rasterizeTriangle( *fragmentState, batch, worker, primitive, tile );
+						break;
+					}
+				}
+			} );
+	}
+}
@@ -0,0 +1,60 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/Shader/TestShaderProgram.hpp"
+
+namespace ashes::test
+{
+	/**
+	*\brief
+	*	A fragment shader input, interpolated from the vertex shader output at the same location.
+	*/
+	struct Varying
+	{
+		// The offset of the vertex shader output, in its invocation memory.
+		uint32_t source;
+		// The offset of the fragment shader input, in its invocation memory.
+		uint32_t offset;
+		// The index of the first word, in a RasterBatch vertex.
+		uint32_t word;
+		uint32_t words;
+		ShaderProgram::Interpolation interpolation;
+	};
+	/**
+	*\brief
+	*	The primitives of a draw, after clipping.
+	*\remarks
+	*	A vertex starts with its framebuffer coordinates x, y, z, then 1 / w_clip, and the point size.
+	*	The varyings follow, their words hold float values, or integer bits for the flat ones.
+	*/
+	struct RasterBatch
+	{
+		static uint32_t constexpr FixedWords = 5u;
+
+		std::vector< Varying > varyings;
+		uint32_t vertexWords{ FixedWords };
+		std::vector< float > vertices;
+		// 1, 2 or 3 vertex indices per primitive.
+		uint32_t primitiveVertices{};
+		UInt32Array indices;
+		// The vertex holding the flat values, for each primitive.
+		UInt32Array provokingVertices;
+		VkViewport viewport{};
+		VkRect2D scissor{};
+	};
+	/**
+	*\brief
+	*	Rasterizes the primitives into the subpass attachments.
+	*\remarks
+	*	The primitives are binned into screen tiles, processed in parallel on the device's thread pool.
+	*	Each tile processes its primitives in submission order, so the blending order is kept.
+	*	Fragments run the depth and stencil tests, the fragment shader, then the blending.
+	*	The tests are run before the shader, unless it writes the depth.
+	*/
+	void rasterize( VkDevice device
+		, DrawState const & state
+		, RasterBatch const & batch );
+}
@@ -0,0 +1,1533 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Shader/TestShaderInvocation.hpp"
+
+#include "Miscellaneous/TestTransferKernels.hpp"
+#include "Shader/TestShaderResources.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace ashes::test
+{
+	namespace
+	{
+		using Instruction = ShaderProgram::Instruction;
+
+		static_assert( sizeof( ShaderPointer ) == 4u * sizeof( uint32_t ), "Pointers are 4 registers" );
+		static_assert( sizeof( std::atomic< uint32_t > ) == sizeof( uint32_t ), "Atomics are done in place" );
+
+		float toFloat( uint32_t value )
+		{
+			float result;
+			std::memcpy( &result, &value, sizeof( result ) );
+			return result;
+		}
+
+		uint32_t toBits( float value )
+		{
+			uint32_t result;
+			std::memcpy( &result, &value, sizeof( result ) );
+			return result;
+		}
+
+		ShaderPointer getPointer( uint32_t const * reg )
+		{
+			ShaderPointer result;
+			std::memcpy( &result, reg, sizeof( result ) );
+			return result;
+		}
+
+		void setPointer( uint32_t * reg
+			, ShaderPointer const & pointer )
+		{
+			std::memcpy( reg, &pointer, sizeof( pointer ) );
+		}
+
+		ShaderPointer offsetPointer( ShaderPointer pointer
+			, uint64_t offset )
+		{
+			if ( !pointer.address || offset > pointer.range )
+			{
+				return { nullptr, 0u };
+			}
+
+			return { pointer.address + offset, pointer.range - offset };
+		}
+
+		std::atomic< uint32_t > * getAtomic( ShaderPointer const & pointer )
+		{
+			return ( pointer.address && pointer.range >= sizeof( uint32_t ) )
+				? reinterpret_cast< std::atomic< uint32_t > * >( pointer.address )
+				: nullptr;
+		}
+
+		template< typename FuncT >
+		uint32_t atomicUpdate( std::atomic< uint32_t > & value
+			, FuncT func )
+		{
+			auto current = value.load();
+
+			while ( !value.compare_exchange_weak( current, func( current ) ) )
+			{
+			}
+
+			return current;
+		}
+
+		template< typename FuncT >
+		void unary( uint32_t * dst
+			, uint32_t const * a
+			, uint32_t count
+			, FuncT func )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				dst[i] = func( a[i] );
+			}
+		}
+
+		template< typename FuncT >
+		void binary( uint32_t * dst
+			, uint32_t const * a
+			, uint32_t const * b
+			, uint32_t count
+			, FuncT func )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				dst[i] = func( a[i], b[i] );
+			}
+		}
+
+		template< typename FuncT >
+		void unaryF( uint32_t * dst
+			, uint32_t const * a
+			, uint32_t count
+			, FuncT func )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				dst[i] = toBits( func( toFloat( a[i] ) ) );
+			}
+		}
+
+		template< typename FuncT >
+		void binaryF( uint32_t * dst
+			, uint32_t const * a
+			, uint32_t const * b
+			, uint32_t count
+			, FuncT func )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				dst[i] = toBits( func( toFloat( a[i] ), toFloat( b[i] ) ) );
+			}
+		}
+
+		template< typename FuncT >
+		void compareF( uint32_t * dst
+			, uint32_t const * a
+			, uint32_t const * b
+			, uint32_t count
+			, bool unordered
+			, FuncT func )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				auto x = toFloat( a[i] );
+				auto y = toFloat( b[i] );
+				dst[i] = ( std::isnan( x ) || std::isnan( y ) )
+					? ( unordered ? 1u : 0u )
+					: ( func( x, y ) ? 1u : 0u );
+			}
+		}
+
+		uint32_t convertFToU( float value )
+		{
+			if ( !( value > 0.0f ) )
+			{
+				return 0u;
+			}
+
+			return value >= 4294967296.0f
+				? std::numeric_limits< uint32_t >::max()
+				: uint32_t( value );
+		}
+
+		uint32_t convertFToS( float value )
+		{
+			if ( std::isnan( value ) )
+			{
+				return 0u;
+			}
+
+			auto clamped = std::min( std::max( double( value ), double( std::numeric_limits< int32_t >::min() ) )
+				, double( std::numeric_limits< int32_t >::max() ) );
+			return uint32_t( int32_t( clamped ) );
+		}
+
+		uint32_t bitFieldMask( uint32_t offset
+			, uint32_t count )
+		{
+			return count >= 32u
+				? ~( 0u )
+				: ( ( 1u << count ) - 1u ) << offset;
+		}
+
+		uint32_t findMsb( uint32_t value )
+		{
+			uint32_t result = ~( 0u );
+
+			for ( uint32_t bit = 0u; bit < 32u; ++bit )
+			{
+				if ( value & ( 1u << bit ) )
+				{
+					result = bit;
+				}
+			}
+
+			return result;
+		}
+
+		uint32_t findLsb( uint32_t value )
+		{
+			for ( uint32_t bit = 0u; bit < 32u; ++bit )
+			{
+				if ( value & ( 1u << bit ) )
+				{
+					return bit;
+				}
+			}
+
+			return ~( 0u );
+		}
+
+		uint32_t packNorm( float const * values
+			, uint32_t count
+			, uint32_t bits
+			, bool isSigned )
+		{
+			uint32_t result{};
+			auto max = float( ( 1u << ( isSigned ? bits - 1u : bits ) ) - 1u );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				auto value = isSigned
+					? std::min( std::max( values[i], -1.0f ), 1.0f )
+					: std::min( std::max( values[i], 0.0f ), 1.0f );
+				auto packed = uint32_t( int32_t( std::round( value * max ) ) );
+				result |= ( packed & ( ( 1u << bits ) - 1u ) ) << ( i * bits );
+			}
+
+			return result;
+		}
+
+		void unpackNorm( uint32_t value
+			, uint32_t count
+			, uint32_t bits
+			, bool isSigned
+			, uint32_t * dst )
+		{
+			auto max = float( ( 1u << ( isSigned ? bits - 1u : bits ) ) - 1u );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				auto packed = ( value >> ( i * bits ) ) & ( ( 1u << bits ) - 1u );
+				auto result = isSigned
+					? std::max( float( int32_t( packed << ( 32u - bits ) ) >> ( 32u - bits ) ) / max, -1.0f )
+					: float( packed ) / max;
+				dst[i] = toBits( result );
+			}
+		}
+
+		// Gaussian elimination, on a column major n x n matrix, with partial pivoting.
+		double invert( uint32_t const * matrix
+			, uint32_t n
+			, uint32_t * inverse )
+		{
+			double a[4][8]{};
+
+			for ( uint32_t r = 0u; r < n; ++r )
+			{
+				for ( uint32_t c = 0u; c < n; ++c )
+				{
+					a[r][c] = toFloat( matrix[c * n + r] );
+				}
+
+				a[r][n + r] = 1.0;
+			}
+
+			double determinant = 1.0;
+
+			for ( uint32_t c = 0u; c < n; ++c )
+			{
+				auto pivot = c;
+
+				for ( auto r = c + 1u; r < n; ++r )
+				{
+					if ( std::abs( a[r][c] ) > std::abs( a[pivot][c] ) )
+					{
+						pivot = r;
+					}
+				}
+
+				if ( a[pivot][c] == 0.0 )
+				{
+					determinant = 0.0;
+					break;
+				}
+
+				if ( pivot != c )
+				{
+					std::swap( a[pivot], a[c] );
+					determinant = -determinant;
+				}
+
+				auto value = a[c][c];
+				determinant *= value;
+
+				for ( uint32_t k = 0u; k < 2u * n; ++k )
+				{
+					a[c][k] /= value;
+				}
+
+				for ( uint32_t r = 0u; r < n; ++r )
+				{
+					if ( r != c )
+					{
+						auto factor = a[r][c];
+
+						for ( uint32_t k = 0u; k < 2u * n; ++k )
+						{
+							a[r][k] -= factor * a[c][k];
+						}
+					}
+				}
+			}
+
+			if ( inverse )
+			{
+				for ( uint32_t r = 0u; r < n; ++r )
+				{
+					for ( uint32_t c = 0u; c < n; ++c )
+					{
+						inverse[c * n + r] = toBits( determinant == 0.0
+							? std::numeric_limits< float >::infinity()
+							: float( a[r][n + c] ) );
+					}
+				}
+			}
+
+			return determinant;
+		}
+
+		float dot( uint32_t const * a
+			, uint32_t const * b
+			, uint32_t count )
+		{
+			float result{};
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				result += toFloat( a[i] ) * toFloat( b[i] );
+			}
+
+			return result;
+		}
+
+		// The GLSL.std.450 instructions.
+		void extended( uint32_t * regs
+			, Instruction const & ins
+			, uint32_t const * ops )
+		{
+			auto d = regs + ins.result;
+			auto n = ins.count;
+			auto components = ops[1];
+			auto a = regs + ops[2];
+			auto b = regs + ops[3];
+			auto c = regs + ops[4];
+
+			switch ( ops[0] )
+			{
+			case 1u: // Round
+				unaryF( d, a, n, []( float x ){ return std::round( x ); } );
+				break;
+			case 2u: // RoundEven
+				unaryF( d, a, n, []( float x ){ return std::nearbyint( x ); } );
+				break;
+			case 3u: // Trunc
+				unaryF( d, a, n, []( float x ){ return std::trunc( x ); } );
+				break;
+			case 4u: // FAbs
+				unaryF( d, a, n, []( float x ){ return std::abs( x ); } );
+				break;
+			case 5u: // SAbs
+				unary( d, a, n, []( uint32_t x ){ return int32_t( x ) < 0 ? 0u - x : x; } );
+				break;
+			case 6u: // FSign
+				unaryF( d, a, n, []( float x ){ return x > 0.0f ? 1.0f : ( x < 0.0f ? -1.0f : 0.0f ); } );
+				break;
+			case 7u: // SSign
+				unary( d, a, n, []( uint32_t x ){ return int32_t( x ) > 0 ? 1u : ( int32_t( x ) < 0 ? ~( 0u ) : 0u ); } );
+				break;
+			case 8u: // Floor
+				unaryF( d, a, n, []( float x ){ return std::floor( x ); } );
+				break;
+			case 9u: // Ceil
+				unaryF( d, a, n, []( float x ){ return std::ceil( x ); } );
+				break;
+			case 10u: // Fract
+				unaryF( d, a, n, []( float x ){ return x - std::floor( x ); } );
+				break;
+			case 11u: // Radians
+				unaryF( d, a, n, []( float x ){ return x * 0.01745329251994329577f; } );
+				break;
+			case 12u: // Degrees
+				unaryF( d, a, n, []( float x ){ return x * 57.2957795130823208768f; } );
+				break;
+			case 13u: // Sin
+				unaryF( d, a, n, []( float x ){ return std::sin( x ); } );
+				break;
+			case 14u: // Cos
+				unaryF( d, a, n, []( float x ){ return std::cos( x ); } );
+				break;
+			case 15u: // Tan
+				unaryF( d, a, n, []( float x ){ return std::tan( x ); } );
+				break;
+			case 16u: // Asin
+				unaryF( d, a, n, []( float x ){ return std::asin( x ); } );
+				break;
+			case 17u: // Acos
+				unaryF( d, a, n, []( float x ){ return std::acos( x ); } );
+				break;
+			case 18u: // Atan
+				unaryF( d, a, n, []( float x ){ return std::atan( x ); } );
+				break;
+			case 19u: // Sinh
+				unaryF( d, a, n, []( float x ){ return std::sinh( x ); } );
+				break;
+			case 20u: // Cosh
+				unaryF( d, a, n, []( float x ){ return std::cosh( x ); } );
+				break;
+			case 21u: // Tanh
+				unaryF( d, a, n, []( float x ){ return std::tanh( x ); } );
+				break;
+			case 22u: // Asinh
+				unaryF( d, a, n, []( float x ){ return std::asinh( x ); } );
+				break;
+			case 23u: // Acosh
+				unaryF( d, a, n, []( float x ){ return std::acosh( x ); } );
+				break;
+			case 24u: // Atanh
+				unaryF( d, a, n, []( float x ){ return std::atanh( x ); } );
+				break;
+			case 25u: // Atan2
+				binaryF( d, a, b, n, []( float y, float x ){ return std::atan2( y, x ); } );
+				break;
+			case 26u: // Pow
+				binaryF( d, a, b, n, []( float x, float y ){ return std::pow( x, y ); } );
+				break;
+			case 27u: // Exp
+				unaryF( d, a, n, []( float x ){ return std::exp( x ); } );
+				break;
+			case 28u: // Log
+				unaryF( d, a, n, []( float x ){ return std::log( x ); } );
+				break;
+			case 29u: // Exp2
+				unaryF( d, a, n, []( float x ){ return std::exp2( x ); } );
+				break;
+			case 30u: // Log2
+				unaryF( d, a, n, []( float x ){ return std::log2( x ); } );
+				break;
+			case 31u: // Sqrt
+				unaryF( d, a, n, []( float x ){ return std::sqrt( x ); } );
+				break;
+			case 32u: // InverseSqrt
+				unaryF( d, a, n, []( float x ){ return 1.0f / std::sqrt( x ); } );
+				break;
+			case 33u: // Determinant
+				d[0] = toBits( float( invert( a, components, nullptr ) ) );
+				break;
+			case 34u: // MatrixInverse
+				invert( a, components, d );
+				break;
+			case 36u: // ModfStruct
+				for ( uint32_t i = 0u; i < components; ++i )
+				{
+					float whole{};
+					d[i] = toBits( std::modf( toFloat( a[i] ), &whole ) );
+					d[components + i] = toBits( whole );
+				}
+				break;
+			case 37u: // FMin
+			case 79u: // NMin
+				binaryF( d, a, b, n, []( float x, float y ){ return std::fmin( x, y ); } );
+				break;
+			case 38u: // UMin
+				binary( d, a, b, n, []( uint32_t x, uint32_t y ){ return std::min( x, y ); } );
+				break;
+			case 39u: // SMin
+				binary( d, a, b, n, []( uint32_t x, uint32_t y ){ return uint32_t( std::min( int32_t( x ), int32_t( y ) ) ); } );
+				break;
+			case 40u: // FMax
+			case 80u: // NMax
+				binaryF( d, a, b, n, []( float x, float y ){ return std::fmax( x, y ); } );
+				break;
+			case 41u: // UMax
+				binary( d, a, b, n, []( uint32_t x, uint32_t y ){ return std::max( x, y ); } );
+				break;
+			case 42u: // SMax
+				binary( d, a, b, n, []( uint32_t x, uint32_t y ){ return uint32_t( std::max( int32_t( x ), int32_t( y ) ) ); } );
+				break;
+			case 43u: // FClamp
+			case 81u: // NClamp
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					d[i] = toBits( std::fmin( std::fmax( toFloat( a[i] ), toFloat( b[i] ) ), toFloat( c[i] ) ) );
+				}
+				break;
+			case 44u: // UClamp
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					d[i] = std::min( std::max( a[i], b[i] ), c[i] );
+				}
+				break;
+			case 45u: // SClamp
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					d[i] = uint32_t( std::min( std::max( int32_t( a[i] ), int32_t( b[i] ) ), int32_t( c[i] ) ) );
+				}
+				break;
+			case 46u: // FMix
+			case 47u: // IMix
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					auto x = toFloat( a[i] );
+					d[i] = toBits( x + ( toFloat( b[i] ) - x ) * toFloat( c[i] ) );
+				}
+				break;
+			case 48u: // Step
+				binaryF( d, a, b, n, []( float edge, float x ){ return x < edge ? 0.0f : 1.0f; } );
+				break;
+			case 49u: // SmoothStep
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					auto edge0 = toFloat( a[i] );
+					auto t = std::min( std::max( ( toFloat( c[i] ) - edge0 ) / ( toFloat( b[i] ) - edge0 ), 0.0f ), 1.0f );
+					d[i] = toBits( t * t * ( 3.0f - 2.0f * t ) );
+				}
+				break;
+			case 50u: // Fma
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					d[i] = toBits( std::fma( toFloat( a[i] ), toFloat( b[i] ), toFloat( c[i] ) ) );
+				}
+				break;
+			case 52u: // FrexpStruct
+				for ( uint32_t i = 0u; i < components; ++i )
+				{
+					int exponent{};
+					d[i] = toBits( std::frexp( toFloat( a[i] ), &exponent ) );
+					d[components + i] = uint32_t( exponent );
+				}
+				break;
+			case 53u: // Ldexp
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					d[i] = toBits( std::ldexp( toFloat( a[i] ), int32_t( b[i] ) ) );
+				}
+				break;
+			case 54u: // PackSnorm4x8
+			case 55u: // PackUnorm4x8
+			case 56u: // PackSnorm2x16
+			case 57u: // PackUnorm2x16
+				{
+					float values[4]{};
+
+					for ( uint32_t i = 0u; i < components && i < 4u; ++i )
+					{
+						values[i] = toFloat( a[i] );
+					}
+
+					d[0] = packNorm( values
+						, components
+						, ops[0] <= 55u ? 8u : 16u
+						, ops[0] == 54u || ops[0] == 56u );
+				}
+				break;
+			case 58u: // PackHalf2x16
+				d[0] = uint32_t( floatToHalf( toFloat( a[0] ) ) )
+					| ( uint32_t( floatToHalf( toFloat( a[1] ) ) ) << 16u );
+				break;
+			case 60u: // UnpackSnorm2x16
+				unpackNorm( a[0], 2u, 16u, true, d );
+				break;
+			case 61u: // UnpackUnorm2x16
+				unpackNorm( a[0], 2u, 16u, false, d );
+				break;
+			case 62u: // UnpackHalf2x16
+				d[0] = toBits( halfToFloat( uint16_t( a[0] & 0xFFFFu ) ) );
+				d[1] = toBits( halfToFloat( uint16_t( a[0] >> 16u ) ) );
+				break;
+			case 63u: // UnpackSnorm4x8
+				unpackNorm( a[0], 4u, 8u, true, d );
+				break;
+			case 64u: // UnpackUnorm4x8
+				unpackNorm( a[0], 4u, 8u, false, d );
+				break;
+			case 66u: // Length
+				d[0] = toBits( std::sqrt( dot( a, a, components ) ) );
+				break;
+			case 67u: // Distance
+				{
+					float sum{};
+
+					for ( uint32_t i = 0u; i < components; ++i )
+					{
+						auto diff = toFloat( a[i] ) - toFloat( b[i] );
+						sum += diff * diff;
+					}
+
+					d[0] = toBits( std::sqrt( sum ) );
+				}
+				break;
+			case 68u: // Cross
+				{
+					auto ax = toFloat( a[0] ), ay = toFloat( a[1] ), az = toFloat( a[2] );
+					auto bx = toFloat( b[0] ), by = toFloat( b[1] ), bz = toFloat( b[2] );
+					d[0] = toBits( ay * bz - by * az );
+					d[1] = toBits( az * bx - bz * ax );
+					d[2] = toBits( ax * by - bx * ay );
+				}
+				break;
+			case 69u: // Normalize
+				{
+					auto length = std::sqrt( dot( a, a, components ) );
+					unaryF( d, a, n, [length]( float x ){ return x / length; } );
+				}
+				break;
+			case 70u: // FaceForward
+				{
+					auto negate = dot( c, b, components ) >= 0.0f;
+					unaryF( d, a, n, [negate]( float x ){ return negate ? -x : x; } );
+				}
+				break;
+			case 71u: // Reflect
+				{
+					auto factor = 2.0f * dot( b, a, components );
+
+					for ( uint32_t i = 0u; i < n; ++i )
+					{
+						d[i] = toBits( toFloat( a[i] ) - factor * toFloat( b[i] ) );
+					}
+				}
+				break;
+			case 72u: // Refract
+				{
+					auto eta = toFloat( c[0] );
+					auto ni = dot( b, a, components );
+					auto k = 1.0f - eta * eta * ( 1.0f - ni * ni );
+
+					for ( uint32_t i = 0u; i < n; ++i )
+					{
+						d[i] = k < 0.0f
+							? 0u
+							: toBits( eta * toFloat( a[i] ) - ( eta * ni + std::sqrt( k ) ) * toFloat( b[i] ) );
+					}
+				}
+				break;
+			case 73u: // FindILsb
+				unary( d, a, n, findLsb );
+				break;
+			case 74u: // FindSMsb
+				unary( d, a, n, []( uint32_t x ){ return findMsb( int32_t( x ) < 0 ? ~x : x ); } );
+				break;
+			case 75u: // FindUMsb
+				unary( d, a, n, findMsb );
+				break;
+			default:
+				std::fill_n( d, n, 0u );
+				break;
+			}
+		}
+
+		uint8_t * getTexel( ImageResource const * image
+			, uint32_t const * coords
+			, uint32_t dimensions
+			, uint32_t arrayed )
+		{
+			if ( !image )
+			{
+				return nullptr;
+			}
+
+			auto & data = image->data;
+			uint32_t x = coords[0];
+			uint32_t y = dimensions > 1u ? coords[1] : 0u;
+			uint32_t z = dimensions > 2u ? coords[2] : 0u;
+			uint32_t layer = arrayed ? coords[dimensions] : 0u;
+
+			// Negative coordinates wrap to large values, and are rejected too.
+			if ( x >= data.extent.width
+				|| y >= data.extent.height
+				|| z >= data.extent.depth
+				|| layer >= image->layerCount )
+			{
+				return nullptr;
+			}
+
+			return data.data
+				+ layer * image->layerPitch
+				+ z * data.depthPitch
+				+ y * data.rowPitch
+				+ x * VkDeviceSize( data.texelSize );
+		}
+	}
+
+	//*********************************************************************************************
+
+	ShaderInvocation::ShaderInvocation( ShaderProgram const & program )
+		: m_program{ program }
+		, m_initialRegisters{ program.getInitialRegisters() }
+		, m_registers( m_initialRegisters.size(), 0u )
+		, m_memory( program.getInvocationMemorySize(), uint8_t{} )
+	{
+		for ( auto & variable : program.getInvocationVariables() )
+		{
+			setPointer( variable.first
+				, { m_memory.data() + variable.second, m_memory.size() - variable.second } );
+		}
+	}
+
+	void ShaderInvocation::setPointer( uint32_t reg
+		, ShaderPointer const & pointer )
+	{
+		test::setPointer( m_initialRegisters.data() + reg, pointer );
+	}
+
+	void ShaderInvocation::setWorkgroupMemory( uint8_t * memory
+		, uint64_t size )
+	{
+		for ( auto & variable : m_program.getWorkgroupVariables() )
+		{
+			setPointer( variable.first
+				, { memory + variable.second, size - variable.second } );
+		}
+	}
+
+	void ShaderInvocation::reset()
+	{
+		std::copy( m_initialRegisters.begin(), m_initialRegisters.end(), m_registers.begin() );
+		std::fill( m_memory.begin(), m_memory.end(), uint8_t{} );
+		m_frames.clear();
+		m_pc = m_program.getEntryPc();
+		m_block = ~( 0u );
+		m_previous = ~( 0u );
+		m_status = Status::eRunning;
+		m_killed = false;
+	}
+
+	ShaderInvocation::Status ShaderInvocation::run()
+	{
+		auto instructions = m_program.getInstructions().data();
+		auto operands = m_program.getOperands().data();
+		auto regs = m_registers.data();
+
+		while ( m_status == Status::eRunning )
+		{
+			auto & ins = instructions[m_pc++];
+			auto ops = operands + ins.operands;
+			auto d = regs + ins.result;
+			auto n = ins.count;
+
+			switch ( ins.op )
+			{
+			case ShaderOp::eMove:
+				std::memmove( d, regs + ops[0], n * sizeof( uint32_t ) );
+				break;
+			case ShaderOp::eConstruct:
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					auto words = ops[i * 2u + 1u];
+					std::memcpy( d, regs + ops[i * 2u], words * sizeof( uint32_t ) );
+					d += words;
+				}
+				break;
+			case ShaderOp::eGather:
+				m_scratch.resize( std::max( size_t( n ), m_scratch.size() ) );
+
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					m_scratch[i] = regs[ops[i]];
+				}
+
+				std::copy_n( m_scratch.begin(), n, d );
+				break;
+			case ShaderOp::eExtractDynamic:
+				{
+					auto index = regs[ops[1]];
+					d[0] = index < ops[2] ? regs[ops[0] + index] : 0u;
+				}
+				break;
+			case ShaderOp::eInsertDynamic:
+				{
+					auto index = regs[ops[2]];
+					std::memmove( d, regs + ops[0], n * sizeof( uint32_t ) );
+
+					if ( index < n )
+					{
+						d[index] = regs[ops[1]];
+					}
+				}
+				break;
+			case ShaderOp::eSelect:
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					d[i] = regs[ops[0] + i] ? regs[ops[1] + i] : regs[ops[2] + i];
+				}
+				break;
+			case ShaderOp::eSelectScalar:
+				std::memmove( d, regs + ( regs[ops[0]] ? ops[1] : ops[2] ), n * sizeof( uint32_t ) );
+				break;
+
+			case ShaderOp::eIAdd:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x + y; } );
+				break;
+			case ShaderOp::eISub:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x - y; } );
+				break;
+			case ShaderOp::eIMul:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x * y; } );
+				break;
+			case ShaderOp::eUDiv:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return y ? x / y : 0u; } );
+				break;
+			case ShaderOp::eSDiv:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y )
+					{
+						return y ? uint32_t( int64_t( int32_t( x ) ) / int64_t( int32_t( y ) ) ) : 0u;
+					} );
+				break;
+			case ShaderOp::eUMod:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return y ? x % y : 0u; } );
+				break;
+			case ShaderOp::eSRem:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y )
+					{
+						return y ? uint32_t( int64_t( int32_t( x ) ) % int64_t( int32_t( y ) ) ) : 0u;
+					} );
+				break;
+			case ShaderOp::eSMod:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y )
+					{
+						if ( !y )
+						{
+							return 0u;
+						}
+
+						// The result has the sign of the divisor.
+						auto divisor = int64_t( int32_t( y ) );
+						auto result = int64_t( int32_t( x ) ) % divisor;
+						return uint32_t( ( result != 0 && ( ( result < 0 ) != ( divisor < 0 ) ) ) ? result + divisor : result );
+					} );
+				break;
+			case ShaderOp::eSNegate:
+				unary( d, regs + ops[0], n, []( uint32_t x ){ return 0u - x; } );
+				break;
+			case ShaderOp::eShl:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x << ( y & 31u ); } );
+				break;
+			case ShaderOp::eShrL:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x >> ( y & 31u ); } );
+				break;
+			case ShaderOp::eShrA:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return uint32_t( int32_t( x ) >> ( y & 31u ) ); } );
+				break;
+			case ShaderOp::eAnd:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x & y; } );
+				break;
+			case ShaderOp::eOr:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x | y; } );
+				break;
+			case ShaderOp::eXor:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x ^ y; } );
+				break;
+			case ShaderOp::eNot:
+				unary( d, regs + ops[0], n, []( uint32_t x ){ return ~x; } );
+				break;
+			case ShaderOp::eLogicalNot:
+				unary( d, regs + ops[0], n, []( uint32_t x ){ return x ? 0u : 1u; } );
+				break;
+			case ShaderOp::eBitFieldInsert:
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					auto offset = regs[ops[2]] & 31u;
+					auto mask = bitFieldMask( offset, regs[ops[3]] );
+					d[i] = ( regs[ops[0] + i] & ~mask ) | ( ( regs[ops[1] + i] << offset ) & mask );
+				}
+				break;
+			case ShaderOp::eBitFieldSExtract:
+			case ShaderOp::eBitFieldUExtract:
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					auto offset = regs[ops[1]] & 31u;
+					auto count = std::min( regs[ops[2]], 32u - offset );
+					auto value = count
+						? ( regs[ops[0] + i] >> offset ) & bitFieldMask( 0u, count )
+						: 0u;
+
+					if ( ins.op == ShaderOp::eBitFieldSExtract
+						&& count
+						&& count < 32u
+						&& ( value & ( 1u << ( count - 1u ) ) ) )
+					{
+						value |= ~bitFieldMask( 0u, count );
+					}
+
+					d[i] = value;
+				}
+				break;
+			case ShaderOp::eBitReverse:
+				unary( d, regs + ops[0], n, []( uint32_t x )
+					{
+						uint32_t result{};
+
+						for ( uint32_t bit = 0u; bit < 32u; ++bit )
+						{
+							result |= ( ( x >> bit ) & 1u ) << ( 31u - bit );
+						}
+
+						return result;
+					} );
+				break;
+			case ShaderOp::eBitCount:
+				unary( d, regs + ops[0], n, []( uint32_t x )
+					{
+						uint32_t result{};
+
+						for ( ; x; x &= x - 1u )
+						{
+							++result;
+						}
+
+						return result;
+					} );
+				break;
+			case ShaderOp::eIAddCarry:
+			case ShaderOp::eISubBorrow:
+			case ShaderOp::eUMulExtended:
+			case ShaderOp::eSMulExtended:
+				// The result is a structure of two vectors.
+				for ( uint32_t i = 0u; i < n; ++i )
+				{
+					auto x = regs[ops[0] + i];
+					auto y = regs[ops[1] + i];
+					uint64_t result{};
+
+					switch ( ins.op )
+					{
+					case ShaderOp::eIAddCarry:
+						result = uint64_t( x ) + y;
+						break;
+					case ShaderOp::eISubBorrow:
+						result = ( uint64_t( x >= y ? 0u : 1u ) << 32u ) | uint32_t( x - y );
+						break;
+					case ShaderOp::eUMulExtended:
+						result = uint64_t( x ) * y;
+						break;
+					default:
+						result = uint64_t( int64_t( int32_t( x ) ) * int64_t( int32_t( y ) ) );
+						break;
+					}
+
+					d[i] = uint32_t( result );
+					d[n + i] = uint32_t( result >> 32u );
+				}
+				break;
+			case ShaderOp::eIEqual:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x == y ? 1u : 0u; } );
+				break;
+			case ShaderOp::eINotEqual:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x != y ? 1u : 0u; } );
+				break;
+			case ShaderOp::eUGreater:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x > y ? 1u : 0u; } );
+				break;
+			case ShaderOp::eUGreaterEqual:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x >= y ? 1u : 0u; } );
+				break;
+			case ShaderOp::eULess:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x < y ? 1u : 0u; } );
+				break;
+			case ShaderOp::eULessEqual:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return x <= y ? 1u : 0u; } );
+				break;
+			case ShaderOp::eSGreater:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return int32_t( x ) > int32_t( y ) ? 1u : 0u; } );
+				break;
+			case ShaderOp::eSGreaterEqual:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return int32_t( x ) >= int32_t( y ) ? 1u : 0u; } );
+				break;
+			case ShaderOp::eSLess:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return int32_t( x ) < int32_t( y ) ? 1u : 0u; } );
+				break;
+			case ShaderOp::eSLessEqual:
+				binary( d, regs + ops[0], regs + ops[1], n, []( uint32_t x, uint32_t y ){ return int32_t( x ) <= int32_t( y ) ? 1u : 0u; } );
+				break;
+			case ShaderOp::eAny:
+			case ShaderOp::eAll:
+				{
+					auto any = false;
+					auto all = true;
+
+					for ( uint32_t i = 0u; i < n; ++i )
+					{
+						any = any || regs[ops[0] + i];
+						all = all && regs[ops[0] + i];
+					}
+
+					d[0] = ( ins.op == ShaderOp::eAny ? any : all ) ? 1u : 0u;
+				}
+				break;
+
+			case ShaderOp::eFAdd:
+				binaryF( d, regs + ops[0], regs + ops[1], n, []( float x, float y ){ return x + y; } );
+				break;
+			case ShaderOp::eFSub:
+				binaryF( d, regs + ops[0], regs + ops[1], n, []( float x, float y ){ return x - y; } );
+				break;
+			case ShaderOp::eFMul:
+				binaryF( d, regs + ops[0], regs + ops[1], n, []( float x, float y ){ return x * y; } );
+				break;
+			case ShaderOp::eFDiv:
+				binaryF( d, regs + ops[0], regs + ops[1], n, []( float x, float y ){ return x / y; } );
+				break;
+			case ShaderOp::eFRem:
+				binaryF( d, regs + ops[0], regs + ops[1], n, []( float x, float y ){ return std::fmod( x, y ); } );
+				break;
+			case ShaderOp::eFMod:
+				binaryF( d, regs + ops[0], regs + ops[1], n, []( float x, float y ){ return x - y * std::floor( x / y ); } );
+				break;
+			case ShaderOp::eFNegate:
+				unary( d, regs + ops[0], n, []( uint32_t x ){ return x ^ 0x80000000u; } );
+				break;
+			case ShaderOp::eFOrdEqual:
+				compareF( d, regs + ops[0], regs + ops[1], n, false, []( float x, float y ){ return x == y; } );
+				break;
+			case ShaderOp::eFOrdNotEqual:
+				compareF( d, regs + ops[0], regs + ops[1], n, false, []( float x, float y ){ return x != y; } );
+				break;
+			case ShaderOp::eFOrdLess:
+				compareF( d, regs + ops[0], regs + ops[1], n, false, []( float x, float y ){ return x < y; } );
+				break;
+			case ShaderOp::eFOrdLessEqual:
+				compareF( d, regs + ops[0], regs + ops[1], n, false, []( float x, float y ){ return x <= y; } );
+				break;
+			case ShaderOp::eFOrdGreater:
+				compareF( d, regs + ops[0], regs + ops[1], n, false, []( float x, float y ){ return x > y; } );
+				break;
+			case ShaderOp::eFOrdGreaterEqual:
+				compareF( d, regs + ops[0], regs + ops[1], n, false, []( float x, float y ){ return x >= y; } );
+				break;
+			case ShaderOp::eFUnordEqual:
+				compareF( d, regs + ops[0], regs + ops[1], n, true, []( float x, float y ){ return x == y; } );
+				break;
+			case ShaderOp::eFUnordNotEqual:
+				compareF( d, regs + ops[0], regs + ops[1], n, true, []( float x, float y ){ return x != y; } );
+				break;
+			case ShaderOp::eFUnordLess:
+				compareF( d, regs + ops[0], regs + ops[1], n, true, []( float x, float y ){ return x < y; } );
+				break;
+			case ShaderOp::eFUnordLessEqual:
+				compareF( d, regs + ops[0], regs + ops[1], n, true, []( float x, float y ){ return x <= y; } );
+				break;
+			case ShaderOp::eFUnordGreater:
+				compareF( d, regs + ops[0], regs + ops[1], n, true, []( float x, float y ){ return x > y; } );
+				break;
+			case ShaderOp::eFUnordGreaterEqual:
+				compareF( d, regs + ops[0], regs + ops[1], n, true, []( float x, float y ){ return x >= y; } );
+				break;
+			case ShaderOp::eIsNan:
+				unary( d, regs + ops[0], n, []( uint32_t x ){ return std::isnan( toFloat( x ) ) ? 1u : 0u; } );
+				break;
+			case ShaderOp::eIsInf:
+				unary( d, regs + ops[0], n, []( uint32_t x ){ return std::isinf( toFloat( x ) ) ? 1u : 0u; } );
+				break;
+			case ShaderOp::eVectorTimesScalar:
+				{
+					auto scalar = toFloat( regs[ops[1]] );
+					unaryF( d, regs + ops[0], n, [scalar]( float x ){ return x * scalar; } );
+				}
+				break;
+			case ShaderOp::eDot:
+				d[0] = toBits( dot( regs + ops[0], regs + ops[1], n ) );
+				break;
+			case ShaderOp::eMatrixTimesVector:
+				{
+					auto m = regs + ops[0];
+					auto v = regs + ops[1];
+					auto rows = ops[2];
+					auto columns = ops[3];
+
+					for ( uint32_t r = 0u; r < rows; ++r )
+					{
+						float sum{};
+
+						for ( uint32_t c = 0u; c < columns; ++c )
+						{
+							sum += toFloat( m[c * rows + r] ) * toFloat( v[c] );
+						}
+
+						m_scratch.resize( std::max( size_t( rows ), m_scratch.size() ) );
+						m_scratch[r] = toBits( sum );
+					}
+
+					std::copy_n( m_scratch.begin(), rows, d );
+				}
+				break;
+			case ShaderOp::eVectorTimesMatrix:
+				{
+					auto v = regs + ops[0];
+					auto m = regs + ops[1];
+					auto rows = ops[2];
+					auto columns = ops[3];
+
+					for ( uint32_t c = 0u; c < columns; ++c )
+					{
+						d[c] = toBits( dot( v, m + c * rows, rows ) );
+					}
+				}
+				break;
+			case ShaderOp::eMatrixTimesMatrix:
+				{
+					auto a = regs + ops[0];
+					auto b = regs + ops[1];
+					auto rows = ops[2];
+					auto inner = ops[3];
+					auto columns = ops[4];
+					m_scratch.resize( std::max( size_t( rows * columns ), m_scratch.size() ) );
+
+					for ( uint32_t c = 0u; c < columns; ++c )
+					{
+						for ( uint32_t r = 0u; r < rows; ++r )
+						{
+							float sum{};
+
+							for ( uint32_t k = 0u; k < inner; ++k )
+							{
+								sum += toFloat( a[k * rows + r] ) * toFloat( b[c * inner + k] );
+							}
+
+							m_scratch[c * rows + r] = toBits( sum );
+						}
+					}
+
+					std::copy_n( m_scratch.begin(), rows * columns, d );
+				}
+				break;
+			case ShaderOp::eOuterProduct:
+				{
+					auto rows = ops[2];
+					auto columns = ops[3];
+
+					for ( uint32_t c = 0u; c < columns; ++c )
+					{
+						for ( uint32_t r = 0u; r < rows; ++r )
+						{
+							d[c * rows + r] = toBits( toFloat( regs[ops[0] + r] ) * toFloat( regs[ops[1] + c] ) );
+						}
+					}
+				}
+				break;
+			case ShaderOp::eTranspose:
+				{
+					auto m = regs + ops[0];
+					auto rows = ops[1];
+					auto columns = ops[2];
+
+					for ( uint32_t c = 0u; c < columns; ++c )
+					{
+						for ( uint32_t r = 0u; r < rows; ++r )
+						{
+							d[r * columns + c] = m[c * rows + r];
+						}
+					}
+				}
+				break;
+			case ShaderOp::eExtended:
+				extended( regs, ins, ops );
+				break;
+
+			case ShaderOp::eConvertFToU:
+				unary( d, regs + ops[0], n, []( uint32_t x ){ return convertFToU( toFloat( x ) ); } );
+				break;
+			case ShaderOp::eConvertFToS:
+				unary( d, regs + ops[0], n, []( uint32_t x ){ return convertFToS( toFloat( x ) ); } );
+				break;
+			case ShaderOp::eConvertSToF:
+				unary( d, regs + ops[0], n, []( uint32_t x ){ return toBits( float( int32_t( x ) ) ); } );
+				break;
+			case ShaderOp::eConvertUToF:
+				unary( d, regs + ops[0], n, []( uint32_t x ){ return toBits( float( x ) ); } );
+				break;
+			case ShaderOp::eQuantizeToF16:
+				unaryF( d, regs + ops[0], n, []( float x ){ return halfToFloat( floatToHalf( x ) ); } );
+				break;
+
+			case ShaderOp::eLoad:
+				doLoad( ops[1], getPointer( regs + ops[0] ), d );
+				break;
+			case ShaderOp::eStore:
+				doStore( ops[2], getPointer( regs + ops[0] ), regs + ops[1] );
+				break;
+			case ShaderOp::eCopyMemory:
+				m_scratch.resize( std::max( size_t( n ), m_scratch.size() ) );
+				doLoad( ops[3], getPointer( regs + ops[1] ), m_scratch.data() );
+				doStore( ops[2], getPointer( regs + ops[0] ), m_scratch.data() );
+				break;
+			case ShaderOp::eAccessChain:
+				{
+					auto pointer = getPointer( regs + ops[0] );
+					auto step = ops + 2u;
+
+					for ( uint32_t i = 0u; i < ops[1]; ++i, step += 3u )
+					{
+						switch ( step[0] )
+						{
+						case 0u:
+							pointer = offsetPointer( pointer, step[1] );
+							break;
+						case 1u:
+							pointer = offsetPointer( pointer, uint64_t( regs[step[1]] ) * step[2] );
+							break;
+						default:
+							{
+								// Descriptor arrays hold the pointers to their elements.
+								auto index = step[0] == 2u ? regs[step[1]] : step[1];
+								auto element = offsetPointer( pointer, uint64_t( index ) * step[2] );
+								pointer = ( element.address && element.range >= sizeof( ShaderPointer ) )
+									? getPointer( reinterpret_cast< uint32_t const * >( element.address ) )
+									: ShaderPointer{ nullptr, 0u };
+							}
+							break;
+						}
+					}
+
+					test::setPointer( d, pointer );
+				}
+				break;
+			case ShaderOp::eArrayLength:
+				{
+					auto pointer = getPointer( regs + ops[0] );
+					d[0] = ( pointer.range > ops[1] && ops[2] )
+						? uint32_t( ( pointer.range - ops[1] ) / ops[2] )
+						: 0u;
+				}
+				break;
+			case ShaderOp::eAtomicLoad:
+				{
+					auto atomic = getAtomic( getPointer( regs + ops[0] ) );
+					d[0] = atomic ? atomic->load() : 0u;
+				}
+				break;
+			case ShaderOp::eAtomicStore:
+				if ( auto atomic = getAtomic( getPointer( regs + ops[0] ) ) )
+				{
+					atomic->store( regs[ops[1]] );
+				}
+				break;
+			case ShaderOp::eAtomicCompareExchange:
+				if ( auto atomic = getAtomic( getPointer( regs + ops[0] ) ) )
+				{
+					auto expected = regs[ops[2]];
+					atomic->compare_exchange_strong( expected, regs[ops[1]] );
+					d[0] = expected;
+				}
+				else
+				{
+					d[0] = 0u;
+				}
+				break;
+			case ShaderOp::eAtomicExchange:
+			case ShaderOp::eAtomicIIncrement:
+			case ShaderOp::eAtomicIDecrement:
+			case ShaderOp::eAtomicIAdd:
+			case ShaderOp::eAtomicISub:
+			case ShaderOp::eAtomicSMin:
+			case ShaderOp::eAtomicUMin:
+			case ShaderOp::eAtomicSMax:
+			case ShaderOp::eAtomicUMax:
+			case ShaderOp::eAtomicAnd:
+			case ShaderOp::eAtomicOr:
+			case ShaderOp::eAtomicXor:
+				{
+					auto atomic = getAtomic( getPointer( regs + ops[0] ) );
+
+					if ( !atomic )
+					{
+						d[0] = 0u;
+						break;
+					}
+
+					auto value = ( ins.op == ShaderOp::eAtomicIIncrement || ins.op == ShaderOp::eAtomicIDecrement )
+						? 1u
+						: regs[ops[1]];
+
+					switch ( ins.op )
+					{
+					case ShaderOp::eAtomicExchange:
+						d[0] = atomic->exchange( value );
+						break;
+					case ShaderOp::eAtomicIIncrement:
+					case ShaderOp::eAtomicIAdd:
+						d[0] = atomic->fetch_add( value );
+						break;
+					case ShaderOp::eAtomicIDecrement:
+					case ShaderOp::eAtomicISub:
+						d[0] = atomic->fetch_sub( value );
+						break;
+					case ShaderOp::eAtomicSMin:
+						d[0] = atomicUpdate( *atomic, [value]( uint32_t x ){ return uint32_t( std::min( int32_t( x ), int32_t( value ) ) ); } );
+						break;
+					case ShaderOp::eAtomicUMin:
+						d[0] = atomicUpdate( *atomic, [value]( uint32_t x ){ return std::min( x, value ); } );
+						break;
+					case ShaderOp::eAtomicSMax:
+						d[0] = atomicUpdate( *atomic, [value]( uint32_t x ){ return uint32_t( std::max( int32_t( x ), int32_t( value ) ) ); } );
+						break;
+					case ShaderOp::eAtomicUMax:
+						d[0] = atomicUpdate( *atomic, [value]( uint32_t x ){ return std::max( x, value ); } );
+						break;
+					case ShaderOp::eAtomicAnd:
+						d[0] = atomic->fetch_and( value );
+						break;
+					case ShaderOp::eAtomicOr:
+						d[0] = atomic->fetch_or( value );
+						break;
+					default:
+						d[0] = atomic->fetch_xor( value );
+						break;
+					}
+				}
+				break;
+
+			case ShaderOp::eImageRead:
+				{
+					uint32_t value[4]{ 0u, 0u, 0u, 0u };
+					auto image = reinterpret_cast< ImageResource const * >( getPointer( regs + ops[0] ).address );
+
+					if ( auto texel = getTexel( image, regs + ops[1], ops[2], ops[3] ) )
+					{
+						readTexel( image->data.format, texel, value );
+					}
+
+					std::copy_n( value, std::min( n, 4u ), d );
+				}
+				break;
+			case ShaderOp::eImageWrite:
+				{
+					auto image = reinterpret_cast< ImageResource const * >( getPointer( regs + ops[0] ).address );
+
+					if ( auto texel = getTexel( image, regs + ops[1], ops[3], ops[4] ) )
+					{
+						uint32_t value[4]{ 0u, 0u, 0u, 0u };
+						std::copy_n( regs + ops[2], std::min( n, 4u ), value );
+						writeTexel( image->data.format, value, texel );
+					}
+				}
+				break;
+			case ShaderOp::eImageQuerySize:
+				{
+					uint32_t value[4]{ 0u, 0u, 0u, 0u };
+					auto image = reinterpret_cast< ImageResource const * >( getPointer( regs + ops[0] ).address );
+
+					if ( image )
+					{
+						auto dimensions = ops[1];
+						value[0] = image->data.extent.width;
+						value[1] = image->data.extent.height;
+						value[2] = image->data.extent.depth;
+						value[dimensions] = ops[2] ? image->layerCount : value[dimensions];
+					}
+
+					std::copy_n( value, std::min( n, 4u ), d );
+				}
+				break;
+
+			case ShaderOp::ePhis:
+				{
+					// All the phis read their value before any is written.
+					auto phi = ops + 1u;
+					size_t words{};
+
+					for ( uint32_t i = 0u; i < n; ++i )
+					{
+						auto count = phi[1];
+						auto pairs = phi[2];
+						m_scratch.resize( std::max( words + count, m_scratch.size() ) );
+						std::fill_n( m_scratch.begin() + words, count, 0u );
+
+						for ( uint32_t pair = 0u; pair < pairs; ++pair )
+						{
+							if ( phi[3u + pair * 2u] == m_previous )
+							{
+								std::copy_n( regs + phi[4u + pair * 2u], count, m_scratch.begin() + words );
+								break;
+							}
+						}
+
+						words += count;
+						phi += 3u + pairs * 2u;
+					}
+
+					phi = ops + 1u;
+					words = 0u;
+
+					for ( uint32_t i = 0u; i < n; ++i )
+					{
+						auto count = phi[1];
+						std::copy_n( m_scratch.begin() + words, count, regs + phi[0] );
+						words += count;
+						phi += 3u + phi[2] * 2u;
+					}
+				}
+				break;
+			case ShaderOp::eBranch:
+				doJump( ops[0] );
+				break;
+			case ShaderOp::eBranchConditional:
+				doJump( regs[ops[0]] ? ops[1] : ops[2] );
+				break;
+			case ShaderOp::eSwitch:
+				{
+					auto selector = regs[ops[0]];
+					auto target = ops[1];
+
+					for ( uint32_t i = 0u; i < ops[2]; ++i )
+					{
+						if ( ops[3u + i * 2u] == selector )
+						{
+							target = ops[4u + i * 2u];
+							break;
+						}
+					}
+
+					doJump( target );
+				}
+				break;
+			case ShaderOp::eCall:
+				{
+					auto & function = m_program.getFunctions()[ops[0]];
+
+					for ( uint32_t i = 0u; i < ops[1]; ++i )
+					{
+						auto arg = ops + 2u + i * 3u;
+						std::memmove( regs + arg[1], regs + arg[0], arg[2] * sizeof( uint32_t ) );
+					}
+
+					m_frames.push_back( { m_pc, ins.result, n, m_block, m_previous } );
+					m_pc = function.pc;
+					m_block = function.label;
+					m_previous = ~( 0u );
+				}
+				break;
+			case ShaderOp::eReturn:
+				doReturn();
+				break;
+			case ShaderOp::eReturnValue:
+				if ( !m_frames.empty() )
+				{
+					auto & frame = m_frames.back();
+					std::memmove( regs + frame.result, regs + ops[0], frame.words * sizeof( uint32_t ) );
+				}
+				doReturn();
+				break;
+			case ShaderOp::eKill:
+				m_killed = true;
+				m_status = Status::eDone;
+				break;
+			case ShaderOp::eExit:
+				m_status = Status::eDone;
+				break;
+			case ShaderOp::eControlBarrier:
+				m_status = Status::eBarrier;
+				break;
+			case ShaderOp::eMemoryBarrier:
+				std::atomic_thread_fence( std::memory_order_seq_cst );
+				break;
+			}
+		}
+
+		auto result = m_status;
+
+		if ( m_status == Status::eBarrier )
+		{
+			m_status = Status::eRunning;
+		}
+
+		return result;
+	}
+
+	void ShaderInvocation::doJump( uint32_t label )
+	{
+		m_previous = m_block;
+		m_block = label;
+		m_pc = m_program.getLabels()[label];
+	}
+
+	void ShaderInvocation::doReturn()
+	{
+		if ( m_frames.empty() )
+		{
+			m_status = Status::eDone;
+			return;
+		}
+
+		auto & frame = m_frames.back();
+		m_pc = frame.pc;
+		m_block = frame.block;
+		m_previous = frame.previous;
+		m_frames.pop_back();
+	}
+
+	void ShaderInvocation::doLoad( uint32_t layoutIndex
+		, ShaderPointer const & pointer
+		, uint32_t * dst )const
+	{
+		auto & layout = m_program.getLayouts()[layoutIndex];
+
+		if ( !pointer.address || pointer.range < layout.size )
+		{
+			std::fill_n( dst, layout.words, 0u );
+			return;
+		}
+
+		for ( auto & run : layout.runs )
+		{
+			std::memcpy( dst + run.word, pointer.address + run.offset, run.words * sizeof( uint32_t ) );
+		}
+	}
+
+	void ShaderInvocation::doStore( uint32_t layoutIndex
+		, ShaderPointer const & pointer
+		, uint32_t const * src )const
+	{
+		auto & layout = m_program.getLayouts()[layoutIndex];
+
+		if ( !pointer.address || pointer.range < layout.size )
+		{
+			return;
+		}
+
+		for ( auto & run : layout.runs )
+		{
+			std::memcpy( pointer.address + run.offset, src + run.word, run.words * sizeof( uint32_t ) );
+		}
+	}
+}
@@ -0,0 +1,102 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/Shader/TestShaderProgram.hpp"
+
+namespace ashes::test
+{
+	/**
+	*\brief
+	*	The state of one shader invocation: its registers, its memory, and its position in the program.
+	*\remarks
+	*	An invocation runs until it ends or reaches a workgroup barrier,
+	*	so that the invocations of a workgroup can be interleaved on a single thread.
+	*/
+	class ShaderInvocation
+	{
+	public:
+		enum class Status
+		{
+			eRunning,
+			eBarrier,
+			eDone,
+		};
+
+	public:
+		explicit ShaderInvocation( ShaderProgram const & program );
+		ShaderInvocation( ShaderInvocation const & ) = delete;
+		ShaderInvocation & operator=( ShaderInvocation const & ) = delete;
+		/**
+		*\brief
+		*	Sets a pointer register's value, kept by the following resets.
+		*/
+		void setPointer( uint32_t reg
+			, ShaderPointer const & pointer );
+		void setWorkgroupMemory( uint8_t * memory
+			, uint64_t size );
+		/**
+		*\brief
+		*	Restores the initial registers, clears the memory, and restarts at the program entry.
+		*/
+		void reset();
+		/**
+		*\brief
+		*	Runs until the end of the program, or until a workgroup barrier.
+		*/
+		Status run();
+
+		inline uint8_t * getMemory()
+		{
+			return m_memory.data();
+		}
+
+		inline Status getStatus()const
+		{
+			return m_status;
+		}
+		/**
+		*\return
+		*	\p true if the invocation ended with OpKill.
+		*/
+		inline bool isKilled()const
+		{
+			return m_killed;
+		}
+
+	private:
+		struct Frame
+		{
+			uint32_t pc;
+			uint32_t result;
+			uint32_t words;
+			uint32_t block;
+			uint32_t previous;
+		};
+
+	private:
+		void doJump( uint32_t label );
+		void doReturn();
+		void doLoad( uint32_t layout
+			, ShaderPointer const & pointer
+			, uint32_t * dst )const;
+		void doStore( uint32_t layout
+			, ShaderPointer const & pointer
+			, uint32_t const * src )const;
+
+	private:
+		ShaderProgram const & m_program;
+		UInt32Array m_initialRegisters;
+		UInt32Array m_registers;
+		UInt32Array m_scratch;
+		ByteArray m_memory;
+		std::vector< Frame > m_frames;
+		uint32_t m_pc{};
+		uint32_t m_block{};
+		uint32_t m_previous{};
+		Status m_status{ Status::eDone };
+		bool m_killed{};
+	};
+}
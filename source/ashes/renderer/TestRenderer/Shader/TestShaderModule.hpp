@@ -27,6 +27,11 @@ namespace ashes::test
 			return m_device;
 		}
 
+		inline UInt32Array const & getCode()const
+		{
+			return m_code;
+		}
+
 	private:
 		VkDevice m_device;
 		VkShaderModuleCreateInfo m_createInfo;
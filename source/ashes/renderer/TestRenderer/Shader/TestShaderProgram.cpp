@@ -0,0 +1,2102 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Shader/TestShaderProgram.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ashes::test
+{
+	namespace
+	{
+		uint32_t constexpr MagicNumber = 0x07230203u;
+		uint32_t constexpr NoValue = ~( 0u );
+
+		enum SpirVOp
+			: uint32_t
+		{
+			OpNop = 0,
+			OpUndef = 1,
+			OpSourceContinued = 2,
+			OpSource = 3,
+			OpSourceExtension = 4,
+			OpName = 5,
+			OpMemberName = 6,
+			OpString = 7,
+			OpLine = 8,
+			OpExtension = 10,
+			OpExtInstImport = 11,
+			OpExtInst = 12,
+			OpMemoryModel = 14,
+			OpEntryPoint = 15,
+			OpExecutionMode = 16,
+			OpCapability = 17,
+			OpTypeVoid = 19,
+			OpTypeBool = 20,
+			OpTypeInt = 21,
+			OpTypeFloat = 22,
+			OpTypeVector = 23,
+			OpTypeMatrix = 24,
+			OpTypeImage = 25,
+			OpTypeSampler = 26,
+			OpTypeSampledImage = 27,
+			OpTypeArray = 28,
+			OpTypeRuntimeArray = 29,
+			OpTypeStruct = 30,
+			OpTypePointer = 32,
+			OpTypeFunction = 33,
+			OpConstantTrue = 41,
+			OpConstantFalse = 42,
+			OpConstant = 43,
+			OpConstantComposite = 44,
+			OpConstantNull = 46,
+			OpSpecConstantTrue = 48,
+			OpSpecConstantFalse = 49,
+			OpSpecConstant = 50,
+			OpSpecConstantComposite = 51,
+			OpSpecConstantOp = 52,
+			OpFunction = 54,
+			OpFunctionParameter = 55,
+			OpFunctionEnd = 56,
+			OpFunctionCall = 57,
+			OpVariable = 59,
+			OpLoad = 61,
+			OpStore = 62,
+			OpCopyMemory = 63,
+			OpAccessChain = 65,
+			OpInBoundsAccessChain = 66,
+			OpArrayLength = 68,
+			OpDecorate = 71,
+			OpMemberDecorate = 72,
+			OpDecorationGroup = 73,
+			OpGroupDecorate = 74,
+			OpGroupMemberDecorate = 75,
+			OpVectorExtractDynamic = 77,
+			OpVectorInsertDynamic = 78,
+			OpVectorShuffle = 79,
+			OpCompositeConstruct = 80,
+			OpCompositeExtract = 81,
+			OpCompositeInsert = 82,
+			OpCopyObject = 83,
+			OpTranspose = 84,
+			OpSampledImage = 86,
+			OpImageRead = 98,
+			OpImageWrite = 99,
+			OpImage = 100,
+			OpImageQuerySizeLod = 103,
+			OpImageQuerySize = 104,
+			OpConvertFToU = 109,
+			OpConvertFToS = 110,
+			OpConvertSToF = 111,
+			OpConvertUToF = 112,
+			OpUConvert = 113,
+			OpSConvert = 114,
+			OpFConvert = 115,
+			OpQuantizeToF16 = 116,
+			OpBitcast = 124,
+			OpSNegate = 126,
+			OpFNegate = 127,
+			OpIAdd = 128,
+			OpFAdd = 129,
+			OpISub = 130,
+			OpFSub = 131,
+			OpIMul = 132,
+			OpFMul = 133,
+			OpUDiv = 134,
+			OpSDiv = 135,
+			OpFDiv = 136,
+			OpUMod = 137,
+			OpSRem = 138,
+			OpSMod = 139,
+			OpFRem = 140,
+			OpFMod = 141,
+			OpVectorTimesScalar = 142,
+			OpMatrixTimesScalar = 143,
+			OpVectorTimesMatrix = 144,
+			OpMatrixTimesVector = 145,
+			OpMatrixTimesMatrix = 146,
+			OpOuterProduct = 147,
+			OpDot = 148,
+			OpIAddCarry = 149,
+			OpISubBorrow = 150,
+			OpUMulExtended = 151,
+			OpSMulExtended = 152,
+			OpAny = 154,
+			OpAll = 155,
+			OpIsNan = 156,
+			OpIsInf = 157,
+			OpLogicalEqual = 164,
+			OpLogicalNotEqual = 165,
+			OpLogicalOr = 166,
+			OpLogicalAnd = 167,
+			OpLogicalNot = 168,
+			OpSelect = 169,
+			OpIEqual = 170,
+			OpINotEqual = 171,
+			OpUGreaterThan = 172,
+			OpSGreaterThan = 173,
+			OpUGreaterThanEqual = 174,
+			OpSGreaterThanEqual = 175,
+			OpULessThan = 176,
+			OpSLessThan = 177,
+			OpULessThanEqual = 178,
+			OpSLessThanEqual = 179,
+			OpFOrdEqual = 180,
+			OpFUnordEqual = 181,
+			OpFOrdNotEqual = 182,
+			OpFUnordNotEqual = 183,
+			OpFOrdLessThan = 184,
+			OpFUnordLessThan = 185,
+			OpFOrdGreaterThan = 186,
+			OpFUnordGreaterThan = 187,
+			OpFOrdLessThanEqual = 188,
+			OpFUnordLessThanEqual = 189,
+			OpFOrdGreaterThanEqual = 190,
+			OpFUnordGreaterThanEqual = 191,
+			OpShiftRightLogical = 194,
+			OpShiftRightArithmetic = 195,
+			OpShiftLeftLogical = 196,
+			OpBitwiseOr = 197,
+			OpBitwiseXor = 198,
+			OpBitwiseAnd = 199,
+			OpNot = 200,
+			OpBitFieldInsert = 201,
+			OpBitFieldSExtract = 202,
+			OpBitFieldUExtract = 203,
+			OpBitReverse = 204,
+			OpBitCount = 205,
+			OpControlBarrier = 224,
+			OpMemoryBarrier = 225,
+			OpAtomicLoad = 227,
+			OpAtomicStore = 228,
+			OpAtomicExchange = 229,
+			OpAtomicCompareExchange = 230,
+			OpAtomicCompareExchangeWeak = 231,
+			OpAtomicIIncrement = 232,
+			OpAtomicIDecrement = 233,
+			OpAtomicIAdd = 234,
+			OpAtomicISub = 235,
+			OpAtomicSMin = 236,
+			OpAtomicUMin = 237,
+			OpAtomicSMax = 238,
+			OpAtomicUMax = 239,
+			OpAtomicAnd = 240,
+			OpAtomicOr = 241,
+			OpAtomicXor = 242,
+			OpPhi = 245,
+			OpLoopMerge = 246,
+			OpSelectionMerge = 247,
+			OpLabel = 248,
+			OpBranch = 249,
+			OpBranchConditional = 250,
+			OpSwitch = 251,
+			OpKill = 252,
+			OpReturn = 253,
+			OpReturnValue = 254,
+			OpUnreachable = 255,
+			OpLifetimeStart = 256,
+			OpLifetimeStop = 257,
+			OpNoLine = 317,
+			OpModuleProcessed = 330,
+			OpExecutionModeId = 331,
+			OpDecorateId = 332,
+			OpCopyLogical = 400,
+			OpTerminateInvocation = 4416,
+			OpDecorateString = 5632,
+			OpMemberDecorateString = 5633,
+		};
+
+		enum Decoration
+			: uint32_t
+		{
+			DecorationSpecId = 1,
+			DecorationBlock = 2,
+			DecorationBufferBlock = 3,
+			DecorationRowMajor = 4,
+			DecorationArrayStride = 6,
+			DecorationMatrixStride = 7,
+			DecorationBuiltIn = 11,
+			DecorationNoPerspective = 13,
+			DecorationFlat = 14,
+			DecorationLocation = 30,
+			DecorationBinding = 33,
+			DecorationDescriptorSet = 34,
+			DecorationOffset = 35,
+		};
+
+		enum StorageClass
+			: uint32_t
+		{
+			StorageClassUniformConstant = 0,
+			StorageClassInput = 1,
+			StorageClassUniform = 2,
+			StorageClassOutput = 3,
+			StorageClassWorkgroup = 4,
+			StorageClassPrivate = 6,
+			StorageClassFunction = 7,
+			StorageClassPushConstant = 9,
+			StorageClassStorageBuffer = 12,
+		};
+
+		uint32_t constexpr ExecutionModeLocalSize = 17u;
+		uint32_t constexpr ExecutionModeLocalSizeId = 38u;
+		uint32_t constexpr BuiltInWorkgroupSize = 25u;
+		uint32_t constexpr ScopeWorkgroup = 2u;
+
+		enum Dim
+			: uint32_t
+		{
+			Dim1D = 0,
+			Dim2D = 1,
+			Dim3D = 2,
+			DimCube = 3,
+			DimRect = 4,
+		};
+
+		enum GlslOp
+			: uint32_t
+		{
+			GlslDeterminant = 33,
+			GlslMatrixInverse = 34,
+			GlslModf = 35,
+			GlslFrexp = 51,
+			GlslPackDouble2x32 = 59,
+			GlslUnpackDouble2x32 = 65,
+			GlslInterpolateAtCentroid = 76,
+			GlslInterpolateAtOffset = 78,
+			GlslNClamp = 81,
+		};
+
+		uint32_t getExecutionModel( VkShaderStageFlagBits stage )
+		{
+			switch ( stage )
+			{
+			case VK_SHADER_STAGE_VERTEX_BIT:
+				return 0u;
+			case VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT:
+				return 1u;
+			case VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT:
+				return 2u;
+			case VK_SHADER_STAGE_GEOMETRY_BIT:
+				return 3u;
+			case VK_SHADER_STAGE_FRAGMENT_BIT:
+				return 4u;
+			case VK_SHADER_STAGE_COMPUTE_BIT:
+				return 5u;
+			default:
+				return NoValue;
+			}
+		}
+
+		std::string getString( uint32_t const * words
+			, uint32_t count
+			, uint32_t & read )
+		{
+			std::string result;
+			read = 0u;
+
+			while ( read < count )
+			{
+				auto word = words[read++];
+
+				for ( uint32_t i = 0u; i < 4u; ++i )
+				{
+					auto c = char( ( word >> ( i * 8u ) ) & 0xFFu );
+
+					if ( !c )
+					{
+						return result;
+					}
+
+					result += c;
+				}
+			}
+
+			return result;
+		}
+
+		bool hasTypedResult( uint32_t opcode )
+		{
+			return opcode == OpUndef
+				|| opcode == OpExtInst
+				|| opcode == OpFunctionParameter
+				|| opcode == OpFunctionCall
+				|| opcode == OpVariable
+				|| opcode == OpLoad
+				|| ( opcode >= OpAccessChain && opcode <= OpArrayLength )
+				|| ( opcode >= OpVectorExtractDynamic && opcode <= OpTranspose )
+				|| ( opcode >= OpSampledImage && opcode <= 107u )
+				|| ( opcode >= OpConvertFToU && opcode <= OpBitcast )
+				|| ( opcode >= OpSNegate && opcode <= 215u )
+				|| opcode == OpAtomicLoad
+				|| ( opcode >= OpAtomicExchange && opcode <= OpAtomicXor )
+				|| opcode == OpPhi
+				|| opcode == OpCopyLogical;
+		}
+
+		uint32_t alignUp( uint32_t value
+			, uint32_t align )
+		{
+			return ( value + align - 1u ) & ~( align - 1u );
+		}
+	}
+
+	ShaderProgram::ShaderProgram( UInt32Array const & code
+		, std::string const & entryPoint
+		, VkShaderStageFlagBits stage
+		, VkSpecializationInfo const * specialization )
+	{
+		// Register 0 is always zero, undefined shuffle components read it.
+		m_initialRegisters.push_back( 0u );
+		doDecode( code, entryPoint, stage, specialization );
+		m_types.clear();
+		m_decorations.clear();
+		m_idTypes.clear();
+		m_registers.clear();
+		m_constants.clear();
+		m_pointerLayouts.clear();
+		m_labelIndices.clear();
+		m_functionIndices.clear();
+		m_functionParameters.clear();
+		m_layoutIndices.clear();
+		m_prologue.clear();
+	}
+
+	void ShaderProgram::doDecode( UInt32Array const & code
+		, std::string const & entryPoint
+		, VkShaderStageFlagBits stage
+		, VkSpecializationInfo const * specialization )
+	{
+		if ( code.size() < 5u || code[0] != MagicNumber )
+		{
+			doFail( "Invalid SPIR-V header" );
+			return;
+		}
+
+		m_executionModel = getExecutionModel( stage );
+		m_entryPointName = entryPoint;
+		std::vector< Source > body;
+		auto pos = size_t( 5u );
+		auto inFunction = false;
+
+		// Global instructions are decoded in order, function bodies are kept for later.
+		while ( pos < code.size() && isValid() )
+		{
+			auto opcode = code[pos] & 0xFFFFu;
+			auto count = code[pos] >> 16u;
+
+			if ( !count || pos + count > code.size() )
+			{
+				doFail( "Truncated SPIR-V instruction" );
+				return;
+			}
+
+			Source source{ code.data() + pos, count };
+
+			if ( inFunction || opcode == OpFunction )
+			{
+				inFunction = opcode != OpFunctionEnd;
+				body.push_back( source );
+			}
+			else
+			{
+				doDecodeGlobal( source, specialization );
+			}
+
+			pos += count;
+		}
+
+		if ( !isValid() )
+		{
+			return;
+		}
+
+		if ( m_entryFunction == NoValue )
+		{
+			doFail( "Entry point " + entryPoint + " not found" );
+			return;
+		}
+
+		for ( size_t i = 0u; i < m_localSizeIds.size(); ++i )
+		{
+			( &m_localSize.width )[i] = doGetConstant( m_localSizeIds[i] );
+		}
+
+		for ( auto & decoration : m_decorations )
+		{
+			if ( decoration.second.builtIn == BuiltInWorkgroupSize
+				&& m_registers.find( decoration.first ) != m_registers.end() )
+			{
+				auto reg = m_registers[decoration.first];
+				m_localSize = { m_initialRegisters[reg]
+					, m_initialRegisters[reg + 1u]
+					, m_initialRegisters[reg + 2u] };
+			}
+		}
+
+		// First pass on the functions, gathers the types of the results, the labels, and the parameters.
+		uint32_t function{};
+
+		for ( auto & source : body )
+		{
+			auto opcode = source.words[0] & 0xFFFFu;
+
+			if ( source.count >= 3u && hasTypedResult( opcode ) )
+			{
+				m_idTypes[source.words[2]] = source.words[1];
+			}
+
+			if ( opcode == OpFunction && source.count >= 3u )
+			{
+				function = source.words[2];
+				m_functionIndices[function] = uint32_t( m_functions.size() );
+				m_functions.push_back( { 0u, NoValue } );
+				m_functionParameters[function];
+			}
+			else if ( opcode == OpFunctionParameter && source.count >= 3u )
+			{
+				m_functionParameters[function].push_back( source.words[2] );
+			}
+			else if ( opcode == OpLabel && source.count >= 2u )
+			{
+				m_labelIndices[source.words[1]] = uint32_t( m_labels.size() );
+				m_labels.push_back( 0u );
+			}
+		}
+
+		// Second pass, decodes the instructions.
+		auto current = m_functions.end();
+
+		for ( size_t i = 0u; i < body.size() && isValid(); ++i )
+		{
+			auto & source = body[i];
+			auto opcode = source.words[0] & 0xFFFFu;
+
+			if ( opcode == OpFunction )
+			{
+				current = m_functions.begin() + m_functionIndices[source.words[2]];
+				current->pc = uint32_t( m_instructions.size() );
+			}
+			else if ( opcode == OpLabel )
+			{
+				auto label = m_labelIndices[source.words[1]];
+				m_labels[label] = uint32_t( m_instructions.size() );
+
+				if ( current->label == NoValue )
+				{
+					current->label = label;
+				}
+			}
+			else if ( opcode == OpPhi )
+			{
+				// The consecutive phis of a block are evaluated at once, they may read each other.
+				UInt32Array operands{ 0u };
+
+				while ( i < body.size()
+					&& isValid() )
+				{
+					auto & phi = body[i];
+					auto phiOpcode = phi.words[0] & 0xFFFFu;
+
+					if ( phiOpcode == OpPhi )
+					{
+						auto pairs = ( phi.count - 3u ) / 2u;
+						++operands[0];
+						operands.push_back( doGetRegister( phi.words[2] ) );
+						operands.push_back( doGetWords( phi.words[2] ) );
+						operands.push_back( pairs );
+
+						for ( uint32_t pair = 0u; pair < pairs; ++pair )
+						{
+							operands.push_back( m_labelIndices[phi.words[4u + pair * 2u]] );
+							operands.push_back( doGetRegister( phi.words[3u + pair * 2u] ) );
+						}
+					}
+					else if ( phiOpcode != OpLine
+						&& phiOpcode != OpNoLine )
+					{
+						break;
+					}
+
+					++i;
+				}
+
+				--i;
+				doEmit( m_instructions, ShaderOp::ePhis, operands[0], 0u, operands );
+			}
+			else if ( opcode == OpFunctionParameter )
+			{
+				// Pointer parameters get their pointee's natural layout.
+				auto & type = doGetType( source.words[1] );
+
+				if ( type.opcode == OpTypePointer )
+				{
+					m_pointerLayouts[source.words[2]] = doGetLayout( type.element );
+				}
+			}
+			else if ( opcode != OpFunctionEnd )
+			{
+				doDecodeInstruction( source, m_instructions );
+			}
+		}
+
+		if ( !isValid() )
+		{
+			return;
+		}
+
+		// The entry code evaluates the specialisation constant operations and the private variables initialisers,
+		// then calls the entry point function.
+		m_entryPc = uint32_t( m_instructions.size() );
+		m_instructions.insert( m_instructions.end(), m_prologue.begin(), m_prologue.end() );
+		doEmit( m_instructions, ShaderOp::eCall, 0u, 0u, { m_functionIndices[m_entryFunction], 0u } );
+		doEmit( m_instructions, ShaderOp::eExit, 0u, 0u, {} );
+		m_invocationMemorySize = std::max( 16u, m_invocationMemorySize );
+		m_workgroupMemorySize = std::max( 16u, m_workgroupMemorySize );
+	}
+
+	bool ShaderProgram::doDecodeGlobal( Source const & source
+		, VkSpecializationInfo const * specialization )
+	{
+		auto w = source.words;
+		auto count = source.count;
+		auto opcode = w[0] & 0xFFFFu;
+
+		switch ( opcode )
+		{
+		case OpExtInstImport:
+			{
+				uint32_t read{};
+
+				if ( getString( w + 2u, count - 2u, read ) == "GLSL.std.450" )
+				{
+					m_glslExtension = w[1];
+				}
+			}
+			break;
+
+		case OpEntryPoint:
+			{
+				uint32_t read{};
+
+				if ( w[1] == m_executionModel
+					&& getString( w + 3u, count - 3u, read ) == m_entryPointName )
+				{
+					m_entryFunction = w[2];
+				}
+			}
+			break;
+
+		case OpExecutionMode:
+			if ( w[1] == m_entryFunction
+				&& w[2] == ExecutionModeLocalSize
+				&& count >= 6u )
+			{
+				m_localSize = { w[3], w[4], w[5] };
+			}
+			break;
+
+		case OpExecutionModeId:
+			if ( w[1] == m_entryFunction
+				&& w[2] == ExecutionModeLocalSizeId
+				&& count >= 6u )
+			{
+				m_localSizeIds = { w[3], w[4], w[5] };
+			}
+			break;
+
+		case OpDecorate:
+			{
+				auto & decorations = m_decorations[w[1]];
+				auto value = count > 3u ? w[3] : 0u;
+
+				switch ( w[2] )
+				{
+				case DecorationSpecId:
+					decorations.specId = value;
+					break;
+				case DecorationBlock:
+					decorations.block = true;
+					break;
+				case DecorationBufferBlock:
+					decorations.bufferBlock = true;
+					break;
+				case DecorationArrayStride:
+					decorations.arrayStride = value;
+					break;
+				case DecorationBuiltIn:
+					decorations.builtIn = value;
+					break;
+				case DecorationNoPerspective:
+					decorations.interpolation = Interpolation::eNoPerspective;
+					break;
+				case DecorationFlat:
+					decorations.interpolation = Interpolation::eFlat;
+					break;
+				case DecorationLocation:
+					decorations.location = value;
+					break;
+				case DecorationBinding:
+					decorations.binding = value;
+					break;
+				case DecorationDescriptorSet:
+					decorations.set = value;
+					break;
+				default:
+					break;
+				}
+			}
+			break;
+
+		case OpMemberDecorate:
+			{
+				auto & decorations = m_decorations[w[1]];
+				auto member = w[2];
+				auto value = count > 4u ? w[4] : 0u;
+
+				switch ( w[3] )
+				{
+				case DecorationRowMajor:
+					decorations.memberRowMajors[member] = true;
+					break;
+				case DecorationMatrixStride:
+					decorations.memberMatrixStrides[member] = value;
+					break;
+				case DecorationOffset:
+					decorations.memberOffsets[member] = value;
+					break;
+				case DecorationBuiltIn:
+					decorations.memberBuiltIns[member] = value;
+					break;
+				case DecorationNoPerspective:
+					decorations.memberInterpolations[member] = Interpolation::eNoPerspective;
+					break;
+				case DecorationFlat:
+					decorations.memberInterpolations[member] = Interpolation::eFlat;
+					break;
+				case DecorationLocation:
+					decorations.memberLocations[member] = value;
+					break;
+				default:
+					break;
+				}
+			}
+			break;
+
+		case OpGroupDecorate:
+			for ( uint32_t i = 2u; i < count; ++i )
+			{
+				m_decorations[w[i]] = m_decorations[w[1]];
+			}
+			break;
+
+		case OpTypeVoid:
+			doAddType( w[1], { opcode } );
+			break;
+
+		case OpTypeBool:
+			{
+				Type type{ opcode };
+				type.width = 32u;
+				type.words = 1u;
+				doAddType( w[1], type );
+			}
+			break;
+
+		case OpTypeInt:
+		case OpTypeFloat:
+			if ( w[2] != 32u )
+			{
+				return doFail( "Only 32 bits scalar types are supported" );
+			}
+			else
+			{
+				Type type{ opcode };
+				type.width = w[2];
+				type.isSigned = opcode == OpTypeInt && w[3] != 0u;
+				type.words = 1u;
+				doAddType( w[1], type );
+			}
+			break;
+
+		case OpTypeVector:
+		case OpTypeMatrix:
+			{
+				Type type{ opcode };
+				type.element = w[2];
+				type.count = w[3];
+				type.words = type.count * doGetType( w[2] ).words;
+				doAddType( w[1], type );
+			}
+			break;
+
+		case OpTypeImage:
+			{
+				Type type{ opcode };
+				type.element = w[2];
+				type.dim = w[3];
+				type.arrayed = w[5] != 0u;
+				type.words = 4u;
+				doAddType( w[1], type );
+			}
+			break;
+
+		case OpTypeSampler:
+		case OpTypeSampledImage:
+			{
+				Type type{ opcode };
+				type.words = 4u;
+				doAddType( w[1], type );
+			}
+			break;
+
+		case OpTypeArray:
+		case OpTypeRuntimeArray:
+			{
+				Type type{ opcode };
+				type.element = w[2];
+				type.count = opcode == OpTypeArray
+					? doGetConstant( w[3] )
+					: 0u;
+				type.words = type.count * doGetType( w[2] ).words;
+				doAddType( w[1], type );
+			}
+			break;
+
+		case OpTypeStruct:
+			{
+				Type type{ opcode };
+				type.members.assign( w + 2u, w + count );
+
+				for ( auto member : type.members )
+				{
+					type.words += doGetType( member ).words;
+				}
+
+				doAddType( w[1], type );
+			}
+			break;
+
+		case OpTypePointer:
+			{
+				Type type{ opcode };
+				type.storageClass = w[2];
+				type.element = w[3];
+				type.words = 4u;
+				doAddType( w[1], type );
+			}
+			break;
+
+		case OpTypeFunction:
+			doAddType( w[1], { opcode } );
+			break;
+
+		case OpConstantTrue:
+		case OpConstantFalse:
+		case OpSpecConstantTrue:
+		case OpSpecConstantFalse:
+			{
+				m_idTypes[w[2]] = w[1];
+				uint32_t value = ( opcode == OpConstantTrue || opcode == OpSpecConstantTrue ) ? 1u : 0u;
+				auto & decorations = m_decorations[w[2]];
+
+				if ( opcode >= OpSpecConstantTrue
+					&& specialization
+					&& decorations.specId != NoValue )
+				{
+					for ( auto & entry : makeArrayView( specialization->pMapEntries, specialization->mapEntryCount ) )
+					{
+						if ( entry.constantID == decorations.specId
+							&& entry.offset + entry.size <= specialization->dataSize )
+						{
+							uint32_t data{};
+							std::memcpy( &data
+								, static_cast< uint8_t const * >( specialization->pData ) + entry.offset
+								, std::min( size_t( sizeof( data ) ), entry.size ) );
+							value = data != 0u ? 1u : 0u;
+						}
+					}
+				}
+
+				m_initialRegisters[doGetRegister( w[2] )] = value;
+				m_constants[w[2]] = value;
+			}
+			break;
+
+		case OpConstant:
+		case OpSpecConstant:
+			{
+				m_idTypes[w[2]] = w[1];
+				auto value = w[3];
+				auto & decorations = m_decorations[w[2]];
+
+				if ( opcode == OpSpecConstant
+					&& specialization
+					&& decorations.specId != NoValue )
+				{
+					for ( auto & entry : makeArrayView( specialization->pMapEntries, specialization->mapEntryCount ) )
+					{
+						if ( entry.constantID == decorations.specId
+							&& entry.offset + entry.size <= specialization->dataSize )
+						{
+							std::memcpy( &value
+								, static_cast< uint8_t const * >( specialization->pData ) + entry.offset
+								, std::min( size_t( sizeof( value ) ), entry.size ) );
+						}
+					}
+				}
+
+				m_initialRegisters[doGetRegister( w[2] )] = value;
+				m_constants[w[2]] = value;
+			}
+			break;
+
+		case OpConstantComposite:
+		case OpSpecConstantComposite:
+			{
+				m_idTypes[w[2]] = w[1];
+				auto reg = doGetRegister( w[2] );
+
+				for ( uint32_t i = 3u; i < count; ++i )
+				{
+					auto src = doGetRegister( w[i] );
+					auto words = doGetWords( w[i] );
+					std::copy_n( m_initialRegisters.begin() + src
+						, words
+						, m_initialRegisters.begin() + reg );
+					reg += words;
+				}
+			}
+			break;
+
+		case OpConstantNull:
+		case OpUndef:
+			m_idTypes[w[2]] = w[1];
+			doGetRegister( w[2] );
+			m_constants[w[2]] = 0u;
+			break;
+
+		case OpSpecConstantOp:
+			{
+				// Decoded as the instruction it holds, run before the entry point.
+				m_idTypes[w[2]] = w[1];
+				UInt32Array words{ ( ( count - 1u ) << 16u ) | w[3], w[1], w[2] };
+				words.insert( words.end(), w + 4u, w + count );
+				return doDecodeInstruction( { words.data(), uint32_t( words.size() ) }, m_prologue );
+			}
+
+		case OpVariable:
+			m_idTypes[w[2]] = w[1];
+			doDecodeVariable( w[1]
+				, w[2]
+				, w[3]
+				, count > 4u ? w[4] : 0u
+				, m_prologue );
+			break;
+
+		case OpCapability:
+		case OpExtension:
+		case OpMemoryModel:
+		case OpSource:
+		case OpSourceContinued:
+		case OpSourceExtension:
+		case OpName:
+		case OpMemberName:
+		case OpString:
+		case OpLine:
+		case OpNoLine:
+		case OpModuleProcessed:
+		case OpDecorationGroup:
+		case OpGroupMemberDecorate:
+		case OpDecorateId:
+		case OpDecorateString:
+		case OpMemberDecorateString:
+			break;
+
+		default:
+			return doFail( "Unsupported global instruction " + std::to_string( opcode ) );
+		}
+
+		return isValid();
+	}
+
+	void ShaderProgram::doDecodeVariable( uint32_t typeId
+		, uint32_t id
+		, uint32_t storageClass
+		, uint32_t initializer
+		, std::vector< Instruction > & out )
+	{
+		auto pointee = doGetType( typeId ).element;
+		auto reg = doGetRegister( id );
+		auto & decorations = m_decorations[id];
+		uint32_t layout{};
+
+		switch ( storageClass )
+		{
+		case StorageClassFunction:
+		case StorageClassPrivate:
+		case StorageClassInput:
+		case StorageClassOutput:
+			{
+				layout = doGetLayout( pointee );
+				auto offset = alignUp( m_invocationMemorySize, 16u );
+				auto size = m_layouts[layout].size;
+				m_invocationMemorySize = offset + size;
+				m_invocationVariables.emplace_back( reg, offset );
+
+				if ( storageClass == StorageClassInput
+					|| storageClass == StorageClassOutput )
+				{
+					doAddInterface( storageClass
+						, pointee
+						, layout
+						, offset
+						, decorations.builtIn
+						, decorations.location
+						, decorations.interpolation );
+				}
+			}
+			break;
+
+		case StorageClassWorkgroup:
+			{
+				layout = doGetLayout( pointee );
+				auto offset = alignUp( m_workgroupMemorySize, 16u );
+				m_workgroupMemorySize = offset + m_layouts[layout].size;
+				m_workgroupVariables.emplace_back( reg, offset );
+			}
+			break;
+
+		case StorageClassUniform:
+		case StorageClassStorageBuffer:
+		case StorageClassUniformConstant:
+			{
+				auto & type = doGetType( pointee );
+				auto isArray = type.opcode == OpTypeArray
+					|| type.opcode == OpTypeRuntimeArray;
+				auto & resourceType = isArray
+					? doGetType( type.element )
+					: type;
+
+				if ( resourceType.opcode == OpTypeSampler
+					|| resourceType.opcode == OpTypeSampledImage )
+				{
+					doFail( "Samplers aren't supported" );
+					return;
+				}
+
+				if ( resourceType.opcode == OpTypeImage
+					&& ( resourceType.dim > DimRect ) )
+				{
+					doFail( "Only storage images are supported" );
+					return;
+				}
+
+				auto isImage = resourceType.opcode == OpTypeImage;
+
+				if ( isArray && !isImage )
+				{
+					// Each element of a buffers array is a separate resource.
+					Layout indirect;
+					indirect.indirect = true;
+					indirect.element = doGetLayout( type.element );
+					indirect.stride = uint32_t( sizeof( ShaderPointer ) );
+					indirect.size = type.count * indirect.stride;
+					layout = uint32_t( m_layouts.size() );
+					m_layouts.push_back( std::move( indirect ) );
+				}
+				else
+				{
+					layout = doGetLayout( pointee );
+				}
+
+				m_resources.push_back( { decorations.set
+					, decorations.binding
+					, reg
+					, isArray ? type.count : 1u
+					, isImage ? ResourceType::eImage : ResourceType::eBuffer } );
+			}
+			break;
+
+		case StorageClassPushConstant:
+			layout = doGetLayout( pointee );
+			m_pushConstantsRegister = reg;
+			break;
+
+		default:
+			doFail( "Unsupported storage class " + std::to_string( storageClass ) );
+			return;
+		}
+
+		m_pointerLayouts[id] = layout;
+
+		if ( initializer )
+		{
+			doEmit( out
+				, ShaderOp::eStore
+				, m_layouts[layout].words
+				, 0u
+				, { reg, doGetRegister( initializer ), layout } );
+		}
+	}
+
+	uint32_t ShaderProgram::doAddInterface( uint32_t storageClass
+		, uint32_t typeId
+		, uint32_t layout
+		, uint32_t offset
+		, uint32_t builtIn
+		, uint32_t location
+		, Interpolation interpolation )
+	{
+		// Returns the count of locations consumed by the value.
+		auto type = doGetType( typeId );
+		auto memory = m_layouts[layout];
+
+		if ( builtIn == NoValue
+			&& type.opcode == OpTypeStruct )
+		{
+			auto & decorations = m_decorations[typeId];
+			auto next = location;
+
+			for ( uint32_t i = 0u; i < type.members.size(); ++i )
+			{
+				auto memberBuiltIn = decorations.memberBuiltIns.find( i );
+				auto memberLocation = decorations.memberLocations.find( i );
+				auto memberInterpolation = decorations.memberInterpolations.find( i );
+
+				if ( memberLocation != decorations.memberLocations.end() )
+				{
+					next = memberLocation->second;
+				}
+
+				auto count = doAddInterface( storageClass
+					, type.members[i]
+					, memory.members[i]
+					, offset + memory.offsets[i]
+					, ( memberBuiltIn != decorations.memberBuiltIns.end()
+						? memberBuiltIn->second
+						: NoValue )
+					, next
+					, ( memberInterpolation != decorations.memberInterpolations.end()
+						? memberInterpolation->second
+						: interpolation ) );
+
+				if ( next != NoValue )
+				{
+					next += count;
+				}
+			}
+
+			return next == NoValue || location == NoValue
+				? 0u
+				: next - location;
+		}
+
+		if ( builtIn == NoValue
+			&& ( type.opcode == OpTypeArray || type.opcode == OpTypeMatrix ) )
+		{
+			uint32_t count{};
+
+			for ( uint32_t i = 0u; i < type.count; ++i )
+			{
+				count += doAddInterface( storageClass
+					, type.element
+					, memory.element
+					, offset + i * memory.stride
+					, NoValue
+					, location == NoValue ? NoValue : location + count
+					, interpolation );
+			}
+
+			return count;
+		}
+
+		m_interface.push_back( { storageClass
+			, builtIn
+			, location
+			, offset
+			, memory.size
+			, interpolation } );
+		return 1u;
+	}
+
+	bool ShaderProgram::doDecodeInstruction( Source const & source
+		, std::vector< Instruction > & out )
+	{
+		auto w = source.words;
+		auto count = source.count;
+		auto opcode = w[0] & 0xFFFFu;
+		auto emitUnary = [&]( ShaderOp op )
+		{
+			doEmit( out, op, doGetWords( w[2] ), doGetRegister( w[2] ), { doGetRegister( w[3] ) } );
+			return isValid();
+		};
+		auto emitBinary = [&]( ShaderOp op )
+		{
+			doEmit( out, op, doGetWords( w[2] ), doGetRegister( w[2] ), { doGetRegister( w[3] ), doGetRegister( w[4] ) } );
+			return isValid();
+		};
+		auto emitCompare = [&]( ShaderOp op )
+		{
+			// The count is the operands one, the result being the same count of booleans.
+			doEmit( out, op, doGetWords( w[3] ), doGetRegister( w[2] ), { doGetRegister( w[3] ), doGetRegister( w[4] ) } );
+			return isValid();
+		};
+		auto emitAtomic = [&]( ShaderOp op
+			, uint32_t valueIndex )
+		{
+			UInt32Array operands{ doGetRegister( w[3] ) };
+
+			if ( valueIndex )
+			{
+				operands.push_back( doGetRegister( w[valueIndex] ) );
+			}
+
+			doEmit( out, op, 1u, doGetRegister( w[2] ), operands );
+			return isValid();
+		};
+
+		switch ( opcode )
+		{
+		case OpNop:
+		case OpLine:
+		case OpNoLine:
+		case OpSelectionMerge:
+		case OpLoopMerge:
+		case OpLifetimeStart:
+		case OpLifetimeStop:
+			return true;
+
+		case OpUndef:
+			doGetRegister( w[2] );
+			return isValid();
+
+		case OpExtInst:
+			return doDecodeExtended( source, out );
+
+		case OpFunctionCall:
+			{
+				auto & parameters = m_functionParameters[w[3]];
+				UInt32Array operands{ m_functionIndices[w[3]], uint32_t( parameters.size() ) };
+
+				for ( uint32_t i = 0u; i < parameters.size() && 4u + i < count; ++i )
+				{
+					operands.push_back( doGetRegister( w[4u + i] ) );
+					operands.push_back( doGetRegister( parameters[i] ) );
+					operands.push_back( doGetWords( parameters[i] ) );
+				}
+
+				doEmit( out, ShaderOp::eCall, doGetWords( w[2] ), doGetRegister( w[2] ), operands );
+			}
+			return isValid();
+
+		case OpVariable:
+			doDecodeVariable( w[1]
+				, w[2]
+				, w[3]
+				, count > 4u ? w[4] : 0u
+				, out );
+			return isValid();
+
+		case OpLoad:
+			{
+				auto layout = m_pointerLayouts[w[3]];
+				doEmit( out, ShaderOp::eLoad, doGetWords( w[2] ), doGetRegister( w[2] ), { doGetRegister( w[3] ), layout } );
+			}
+			return isValid();
+
+		case OpStore:
+			{
+				auto layout = m_pointerLayouts[w[1]];
+				doEmit( out, ShaderOp::eStore, doGetWords( w[2] ), 0u, { doGetRegister( w[1] ), doGetRegister( w[2] ), layout } );
+			}
+			return isValid();
+
+		case OpCopyMemory:
+			{
+				auto dstLayout = m_pointerLayouts[w[1]];
+				auto srcLayout = m_pointerLayouts[w[2]];
+				doEmit( out
+					, ShaderOp::eCopyMemory
+					, m_layouts[dstLayout].words
+					, 0u
+					, { doGetRegister( w[1] ), doGetRegister( w[2] ), dstLayout, srcLayout } );
+			}
+			return isValid();
+
+		case OpAccessChain:
+		case OpInBoundsAccessChain:
+			{
+				// The steps are: 0 for a constant offset, 1 for a dynamic index,
+				// 2 for a dynamic index in a descriptor array, 3 for a constant one.
+				auto layout = m_pointerLayouts[w[3]];
+				UInt32Array operands{ doGetRegister( w[3] ), 0u };
+				uint32_t offset{};
+				auto flushOffset = [&]()
+				{
+					if ( offset )
+					{
+						operands.insert( operands.end(), { 0u, offset, 0u } );
+						++operands[1];
+						offset = 0u;
+					}
+				};
+
+				for ( uint32_t i = 4u; i < count; ++i )
+				{
+					auto & current = m_layouts[layout];
+					auto isConstant = m_constants.find( w[i] ) != m_constants.end();
+
+					if ( current.indirect )
+					{
+						flushOffset();
+						operands.insert( operands.end()
+							, { isConstant ? 3u : 2u
+								, isConstant ? doGetConstant( w[i] ) : doGetRegister( w[i] )
+								, current.stride } );
+						++operands[1];
+						layout = current.element;
+					}
+					else if ( !current.members.empty() )
+					{
+						auto member = doGetConstant( w[i] );
+
+						if ( member >= current.members.size() )
+						{
+							return doFail( "Invalid access chain member" );
+						}
+
+						offset += current.offsets[member];
+						layout = current.members[member];
+					}
+					else if ( isConstant )
+					{
+						offset += doGetConstant( w[i] ) * current.stride;
+						layout = current.element;
+					}
+					else
+					{
+						flushOffset();
+						operands.insert( operands.end(), { 1u, doGetRegister( w[i] ), current.stride } );
+						++operands[1];
+						layout = current.element;
+					}
+				}
+
+				flushOffset();
+				m_pointerLayouts[w[2]] = layout;
+				doEmit( out, ShaderOp::eAccessChain, 4u, doGetRegister( w[2] ), operands );
+			}
+			return isValid();
+
+		case OpArrayLength:
+			{
+				auto & layout = m_layouts[m_pointerLayouts[w[3]]];
+
+				if ( w[4] >= layout.members.size() )
+				{
+					return doFail( "Invalid array length member" );
+				}
+
+				doEmit( out
+					, ShaderOp::eArrayLength
+					, 1u
+					, doGetRegister( w[2] )
+					, { doGetRegister( w[3] ), layout.offsets[w[4]], m_layouts[layout.members[w[4]]].stride } );
+			}
+			return isValid();
+
+		case OpVectorExtractDynamic:
+			doEmit( out
+				, ShaderOp::eExtractDynamic
+				, 1u
+				, doGetRegister( w[2] )
+				, { doGetRegister( w[3] ), doGetRegister( w[4] ), doGetWords( w[3] ) } );
+			return isValid();
+
+		case OpVectorInsertDynamic:
+			doEmit( out
+				, ShaderOp::eInsertDynamic
+				, doGetWords( w[2] )
+				, doGetRegister( w[2] )
+				, { doGetRegister( w[3] ), doGetRegister( w[4] ), doGetRegister( w[5] ) } );
+			return isValid();
+
+		case OpVectorShuffle:
+			{
+				auto first = doGetRegister( w[3] );
+				auto second = doGetRegister( w[4] );
+				auto firstCount = doGetWords( w[3] );
+				UInt32Array operands;
+
+				for ( uint32_t i = 5u; i < count; ++i )
+				{
+					operands.push_back( w[i] == NoValue
+						? 0u
+						: ( w[i] < firstCount
+							? first + w[i]
+							: second + w[i] - firstCount ) );
+				}
+
+				doEmit( out, ShaderOp::eGather, uint32_t( operands.size() ), doGetRegister( w[2] ), operands );
+			}
+			return isValid();
+
+		case OpCompositeConstruct:
+			{
+				UInt32Array operands;
+
+				for ( uint32_t i = 3u; i < count; ++i )
+				{
+					operands.push_back( doGetRegister( w[i] ) );
+					operands.push_back( doGetWords( w[i] ) );
+				}
+
+				doEmit( out, ShaderOp::eConstruct, count - 3u, doGetRegister( w[2] ), operands );
+			}
+			return isValid();
+
+		case OpCompositeExtract:
+		case OpCompositeInsert:
+			{
+				auto isInsert = opcode == OpCompositeInsert;
+				auto composite = isInsert ? w[4] : w[3];
+				auto typeId = m_idTypes[composite];
+				uint32_t offset{};
+
+				for ( uint32_t i = isInsert ? 5u : 4u; i < count; ++i )
+				{
+					auto & type = doGetType( typeId );
+
+					if ( type.opcode == OpTypeStruct )
+					{
+						for ( uint32_t member = 0u; member < w[i] && member < type.members.size(); ++member )
+						{
+							offset += doGetType( type.members[member] ).words;
+						}
+
+						typeId = type.members[std::min( size_t( w[i] ), type.members.size() - 1u )];
+					}
+					else
+					{
+						typeId = type.element;
+						offset += w[i] * doGetType( typeId ).words;
+					}
+				}
+
+				if ( isInsert )
+				{
+					auto result = doGetRegister( w[2] );
+					doEmit( out, ShaderOp::eMove, doGetWords( w[2] ), result, { doGetRegister( composite ) } );
+					doEmit( out, ShaderOp::eMove, doGetWords( w[3] ), result + offset, { doGetRegister( w[3] ) } );
+				}
+				else
+				{
+					doEmit( out, ShaderOp::eMove, doGetWords( w[2] ), doGetRegister( w[2] ), { doGetRegister( composite ) + offset } );
+				}
+			}
+			return isValid();
+
+		case OpCopyObject:
+		case OpCopyLogical:
+		case OpUConvert:
+		case OpSConvert:
+		case OpFConvert:
+		case OpBitcast:
+		case OpImage:
+			return emitUnary( ShaderOp::eMove );
+
+		case OpTranspose:
+			{
+				auto & type = doGetType( m_idTypes[w[3]] );
+				auto columns = type.count;
+				auto rows = doGetType( type.element ).count;
+				doEmit( out, ShaderOp::eTranspose, doGetWords( w[2] ), doGetRegister( w[2] ), { doGetRegister( w[3] ), rows, columns } );
+			}
+			return isValid();
+
+		case OpImageRead:
+		case OpImageWrite:
+		case OpImageQuerySize:
+		case OpImageQuerySizeLod:
+			return doDecodeImage( source, out );
+
+		case OpConvertFToU:
+			return emitUnary( ShaderOp::eConvertFToU );
+		case OpConvertFToS:
+			return emitUnary( ShaderOp::eConvertFToS );
+		case OpConvertSToF:
+			return emitUnary( ShaderOp::eConvertSToF );
+		case OpConvertUToF:
+			return emitUnary( ShaderOp::eConvertUToF );
+		case OpQuantizeToF16:
+			return emitUnary( ShaderOp::eQuantizeToF16 );
+		case OpSNegate:
+			return emitUnary( ShaderOp::eSNegate );
+		case OpFNegate:
+			return emitUnary( ShaderOp::eFNegate );
+		case OpIAdd:
+			return emitBinary( ShaderOp::eIAdd );
+		case OpFAdd:
+			return emitBinary( ShaderOp::eFAdd );
+		case OpISub:
+			return emitBinary( ShaderOp::eISub );
+		case OpFSub:
+			return emitBinary( ShaderOp::eFSub );
+		case OpIMul:
+			return emitBinary( ShaderOp::eIMul );
+		case OpFMul:
+			return emitBinary( ShaderOp::eFMul );
+		case OpUDiv:
+			return emitBinary( ShaderOp::eUDiv );
+		case OpSDiv:
+			return emitBinary( ShaderOp::eSDiv );
+		case OpFDiv:
+			return emitBinary( ShaderOp::eFDiv );
+		case OpUMod:
+			return emitBinary( ShaderOp::eUMod );
+		case OpSRem:
+			return emitBinary( ShaderOp::eSRem );
+		case OpSMod:
+			return emitBinary( ShaderOp::eSMod );
+		case OpFRem:
+			return emitBinary( ShaderOp::eFRem );
+		case OpFMod:
+			return emitBinary( ShaderOp::eFMod );
+		case OpVectorTimesScalar:
+		case OpMatrixTimesScalar:
+			return emitBinary( ShaderOp::eVectorTimesScalar );
+
+		case OpVectorTimesMatrix:
+			{
+				auto & type = doGetType( m_idTypes[w[4]] );
+				doEmit( out
+					, ShaderOp::eVectorTimesMatrix
+					, doGetWords( w[2] )
+					, doGetRegister( w[2] )
+					, { doGetRegister( w[3] ), doGetRegister( w[4] ), doGetType( type.element ).count, type.count } );
+			}
+			return isValid();
+
+		case OpMatrixTimesVector:
+			{
+				auto & type = doGetType( m_idTypes[w[3]] );
+				doEmit( out
+					, ShaderOp::eMatrixTimesVector
+					, doGetWords( w[2] )
+					, doGetRegister( w[2] )
+					, { doGetRegister( w[3] ), doGetRegister( w[4] ), doGetType( type.element ).count, type.count } );
+			}
+			return isValid();
+
+		case OpMatrixTimesMatrix:
+			{
+				auto & lhs = doGetType( m_idTypes[w[3]] );
+				auto & rhs = doGetType( m_idTypes[w[4]] );
+				doEmit( out
+					, ShaderOp::eMatrixTimesMatrix
+					, doGetWords( w[2] )
+					, doGetRegister( w[2] )
+					, { doGetRegister( w[3] ), doGetRegister( w[4] ), doGetType( lhs.element ).count, lhs.count, rhs.count } );
+			}
+			return isValid();
+
+		case OpOuterProduct:
+			doEmit( out
+				, ShaderOp::eOuterProduct
+				, doGetWords( w[2] )
+				, doGetRegister( w[2] )
+				, { doGetRegister( w[3] ), doGetRegister( w[4] ), doGetWords( w[3] ), doGetWords( w[4] ) } );
+			return isValid();
+
+		case OpDot:
+			return emitCompare( ShaderOp::eDot );
+		case OpIAddCarry:
+			return emitCompare( ShaderOp::eIAddCarry );
+		case OpISubBorrow:
+			return emitCompare( ShaderOp::eISubBorrow );
+		case OpUMulExtended:
+			return emitCompare( ShaderOp::eUMulExtended );
+		case OpSMulExtended:
+			return emitCompare( ShaderOp::eSMulExtended );
+
+		case OpAny:
+		case OpAll:
+			doEmit( out
+				, opcode == OpAny ? ShaderOp::eAny : ShaderOp::eAll
+				, doGetWords( w[3] )
+				, doGetRegister( w[2] )
+				, { doGetRegister( w[3] ) } );
+			return isValid();
+
+		case OpIsNan:
+			return emitUnary( ShaderOp::eIsNan );
+		case OpIsInf:
+			return emitUnary( ShaderOp::eIsInf );
+		case OpLogicalEqual:
+		case OpIEqual:
+			return emitBinary( ShaderOp::eIEqual );
+		case OpLogicalNotEqual:
+		case OpINotEqual:
+			return emitBinary( ShaderOp::eINotEqual );
+		case OpLogicalOr:
+		case OpBitwiseOr:
+			return emitBinary( ShaderOp::eOr );
+		case OpLogicalAnd:
+		case OpBitwiseAnd:
+			return emitBinary( ShaderOp::eAnd );
+		case OpLogicalNot:
+			return emitUnary( ShaderOp::eLogicalNot );
+
+		case OpSelect:
+			doEmit( out
+				, doGetWords( w[3] ) == 1u ? ShaderOp::eSelectScalar : ShaderOp::eSelect
+				, doGetWords( w[2] )
+				, doGetRegister( w[2] )
+				, { doGetRegister( w[3] ), doGetRegister( w[4] ), doGetRegister( w[5] ) } );
+			return isValid();
+
+		case OpUGreaterThan:
+			return emitBinary( ShaderOp::eUGreater );
+		case OpSGreaterThan:
+			return emitBinary( ShaderOp::eSGreater );
+		case OpUGreaterThanEqual:
+			return emitBinary( ShaderOp::eUGreaterEqual );
+		case OpSGreaterThanEqual:
+			return emitBinary( ShaderOp::eSGreaterEqual );
+		case OpULessThan:
+			return emitBinary( ShaderOp::eULess );
+		case OpSLessThan:
+			return emitBinary( ShaderOp::eSLess );
+		case OpULessThanEqual:
+			return emitBinary( ShaderOp::eULessEqual );
+		case OpSLessThanEqual:
+			return emitBinary( ShaderOp::eSLessEqual );
+		case OpFOrdEqual:
+			return emitBinary( ShaderOp::eFOrdEqual );
+		case OpFUnordEqual:
+			return emitBinary( ShaderOp::eFUnordEqual );
+		case OpFOrdNotEqual:
+			return emitBinary( ShaderOp::eFOrdNotEqual );
+		case OpFUnordNotEqual:
+			return emitBinary( ShaderOp::eFUnordNotEqual );
+		case OpFOrdLessThan:
+			return emitBinary( ShaderOp::eFOrdLess );
+		case OpFUnordLessThan:
+			return emitBinary( ShaderOp::eFUnordLess );
+		case OpFOrdGreaterThan:
+			return emitBinary( ShaderOp::eFOrdGreater );
+		case OpFUnordGreaterThan:
+			return emitBinary( ShaderOp::eFUnordGreater );
+		case OpFOrdLessThanEqual:
+			return emitBinary( ShaderOp::eFOrdLessEqual );
+		case OpFUnordLessThanEqual:
+			return emitBinary( ShaderOp::eFUnordLessEqual );
+		case OpFOrdGreaterThanEqual:
+			return emitBinary( ShaderOp::eFOrdGreaterEqual );
+		case OpFUnordGreaterThanEqual:
+			return emitBinary( ShaderOp::eFUnordGreaterEqual );
+		case OpShiftRightLogical:
+			return emitBinary( ShaderOp::eShrL );
+		case OpShiftRightArithmetic:
+			return emitBinary( ShaderOp::eShrA );
+		case OpShiftLeftLogical:
+			return emitBinary( ShaderOp::eShl );
+		case OpBitwiseXor:
+			return emitBinary( ShaderOp::eXor );
+		case OpNot:
+			return emitUnary( ShaderOp::eNot );
+
+		case OpBitFieldInsert:
+			doEmit( out
+				, ShaderOp::eBitFieldInsert
+				, doGetWords( w[2] )
+				, doGetRegister( w[2] )
+				, { doGetRegister( w[3] ), doGetRegister( w[4] ), doGetRegister( w[5] ), doGetRegister( w[6] ) } );
+			return isValid();
+
+		case OpBitFieldSExtract:
+		case OpBitFieldUExtract:
+			doEmit( out
+				, opcode == OpBitFieldSExtract ? ShaderOp::eBitFieldSExtract : ShaderOp::eBitFieldUExtract
+				, doGetWords( w[2] )
+				, doGetRegister( w[2] )
+				, { doGetRegister( w[3] ), doGetRegister( w[4] ), doGetRegister( w[5] ) } );
+			return isValid();
+
+		case OpBitReverse:
+			return emitUnary( ShaderOp::eBitReverse );
+		case OpBitCount:
+			return emitUnary( ShaderOp::eBitCount );
+
+		case OpControlBarrier:
+			if ( doGetConstant( w[1] ) == ScopeWorkgroup )
+			{
+				m_hasBarriers = true;
+				doEmit( out, ShaderOp::eControlBarrier, 0u, 0u, {} );
+			}
+			else
+			{
+				doEmit( out, ShaderOp::eMemoryBarrier, 0u, 0u, {} );
+			}
+			return isValid();
+
+		case OpMemoryBarrier:
+			doEmit( out, ShaderOp::eMemoryBarrier, 0u, 0u, {} );
+			return isValid();
+
+		case OpAtomicLoad:
+			return emitAtomic( ShaderOp::eAtomicLoad, 0u );
+
+		case OpAtomicStore:
+			doEmit( out, ShaderOp::eAtomicStore, 1u, 0u, { doGetRegister( w[1] ), doGetRegister( w[4] ) } );
+			return isValid();
+
+		case OpAtomicExchange:
+			return emitAtomic( ShaderOp::eAtomicExchange, 6u );
+
+		case OpAtomicCompareExchange:
+		case OpAtomicCompareExchangeWeak:
+			doEmit( out
+				, ShaderOp::eAtomicCompareExchange
+				, 1u
+				, doGetRegister( w[2] )
+				, { doGetRegister( w[3] ), doGetRegister( w[7] ), doGetRegister( w[8] ) } );
+			return isValid();
+
+		case OpAtomicIIncrement:
+			return emitAtomic( ShaderOp::eAtomicIIncrement, 0u );
+		case OpAtomicIDecrement:
+			return emitAtomic( ShaderOp::eAtomicIDecrement, 0u );
+		case OpAtomicIAdd:
+			return emitAtomic( ShaderOp::eAtomicIAdd, 6u );
+		case OpAtomicISub:
+			return emitAtomic( ShaderOp::eAtomicISub, 6u );
+		case OpAtomicSMin:
+			return emitAtomic( ShaderOp::eAtomicSMin, 6u );
+		case OpAtomicUMin:
+			return emitAtomic( ShaderOp::eAtomicUMin, 6u );
+		case OpAtomicSMax:
+			return emitAtomic( ShaderOp::eAtomicSMax, 6u );
+		case OpAtomicUMax:
+			return emitAtomic( ShaderOp::eAtomicUMax, 6u );
+		case OpAtomicAnd:
+			return emitAtomic( ShaderOp::eAtomicAnd, 6u );
+		case OpAtomicOr:
+			return emitAtomic( ShaderOp::eAtomicOr, 6u );
+		case OpAtomicXor:
+			return emitAtomic( ShaderOp::eAtomicXor, 6u );
+
+		case OpBranch:
+			doEmit( out, ShaderOp::eBranch, 0u, 0u, { m_labelIndices[w[1]] } );
+			return isValid();
+
+		case OpBranchConditional:
+			doEmit( out
+				, ShaderOp::eBranchConditional
+				, 0u
+				, 0u
+				, { doGetRegister( w[1] ), m_labelIndices[w[2]], m_labelIndices[w[3]] } );
+			return isValid();
+
+		case OpSwitch:
+			{
+				auto cases = ( count - 3u ) / 2u;
+				UInt32Array operands{ doGetRegister( w[1] ), m_labelIndices[w[2]], cases };
+
+				for ( uint32_t i = 0u; i < cases; ++i )
+				{
+					operands.push_back( w[3u + i * 2u] );
+					operands.push_back( m_labelIndices[w[4u + i * 2u]] );
+				}
+
+				doEmit( out, ShaderOp::eSwitch, 0u, 0u, operands );
+			}
+			return isValid();
+
+		case OpKill:
+		case OpTerminateInvocation:
+			doEmit( out, ShaderOp::eKill, 0u, 0u, {} );
+			return isValid();
+
+		case OpReturn:
+			doEmit( out, ShaderOp::eReturn, 0u, 0u, {} );
+			return isValid();
+
+		case OpReturnValue:
+			doEmit( out, ShaderOp::eReturnValue, doGetWords( w[1] ), 0u, { doGetRegister( w[1] ) } );
+			return isValid();
+
+		case OpUnreachable:
+			doEmit( out, ShaderOp::eExit, 0u, 0u, {} );
+			return isValid();
+
+		default:
+			if ( opcode >= OpSampledImage && opcode <= 97u )
+			{
+				return doFail( "Image sampling isn't supported" );
+			}
+
+			return doFail( "Unsupported instruction " + std::to_string( opcode ) );
+		}
+	}
+
+	bool ShaderProgram::doDecodeExtended( Source const & source
+		, std::vector< Instruction > & out )
+	{
+		auto w = source.words;
+		auto count = source.count;
+
+		if ( w[3] != m_glslExtension )
+		{
+			// Non semantic instructions don't produce values.
+			if ( doGetType( w[1] ).opcode == OpTypeVoid )
+			{
+				return true;
+			}
+
+			return doFail( "Unsupported extended instruction set" );
+		}
+
+		auto instruction = w[4];
+
+		if ( instruction == GlslModf
+			|| instruction == GlslFrexp
+			|| instruction == GlslPackDouble2x32
+			|| instruction == GlslUnpackDouble2x32
+			|| ( instruction >= GlslInterpolateAtCentroid && instruction <= GlslInterpolateAtOffset )
+			|| instruction > GlslNClamp )
+		{
+			return doFail( "Unsupported GLSL.std.450 instruction " + std::to_string( instruction ) );
+		}
+
+		// The operands are: the instruction, the first argument's component count, and the arguments.
+		auto components = count > 5u ? doGetWords( w[5] ) : 0u;
+
+		if ( instruction == GlslDeterminant
+			|| instruction == GlslMatrixInverse )
+		{
+			components = doGetType( m_idTypes[w[5]] ).count;
+		}
+
+		UInt32Array operands{ instruction, components };
+
+		for ( uint32_t i = 5u; i < count; ++i )
+		{
+			operands.push_back( doGetRegister( w[i] ) );
+		}
+
+		// Missing arguments read the zero register.
+		operands.resize( std::max( operands.size(), size_t( 5u ) ), 0u );
+		doEmit( out, ShaderOp::eExtended, doGetWords( w[2] ), doGetRegister( w[2] ), operands );
+		return isValid();
+	}
+
+	bool ShaderProgram::doDecodeImage( Source const & source
+		, std::vector< Instruction > & out )
+	{
+		auto w = source.words;
+		auto opcode = w[0] & 0xFFFFu;
+		auto image = opcode == OpImageWrite ? w[1] : w[3];
+		auto & type = doGetType( m_idTypes[image] );
+
+		if ( type.opcode != OpTypeImage )
+		{
+			return doFail( "Invalid image operand" );
+		}
+
+		// The coordinates are the spatial ones, followed by the layer, for arrayed and cube images.
+		auto dimensions = type.dim == Dim1D
+			? 1u
+			: ( type.dim == Dim3D ? 3u : 2u );
+		auto arrayed = ( type.arrayed || type.dim == DimCube ) ? 1u : 0u;
+
+		switch ( opcode )
+		{
+		case OpImageRead:
+			doEmit( out
+				, ShaderOp::eImageRead
+				, doGetWords( w[2] )
+				, doGetRegister( w[2] )
+				, { doGetRegister( w[3] ), doGetRegister( w[4] ), dimensions, arrayed } );
+			break;
+		case OpImageWrite:
+			doEmit( out
+				, ShaderOp::eImageWrite
+				, doGetWords( w[3] )
+				, 0u
+				, { doGetRegister( w[1] ), doGetRegister( w[2] ), doGetRegister( w[3] ), dimensions, arrayed } );
+			break;
+		default:
+			doEmit( out
+				, ShaderOp::eImageQuerySize
+				, doGetWords( w[2] )
+				, doGetRegister( w[2] )
+				, { doGetRegister( w[3] ), dimensions, arrayed } );
+			break;
+		}
+
+		return isValid();
+	}
+
+	void ShaderProgram::doAddType( uint32_t id
+		, Type type )
+	{
+		m_types[id] = std::move( type );
+	}
+
+	uint32_t ShaderProgram::doGetLayout( uint32_t typeId
+		, uint32_t stride
+		, bool rowMajor )
+	{
+		auto key = std::make_tuple( typeId, stride, rowMajor );
+		auto it = m_layoutIndices.find( key );
+
+		if ( it != m_layoutIndices.end() )
+		{
+			return it->second;
+		}
+
+		auto & type = doGetType( typeId );
+		auto & decorations = m_decorations[typeId];
+		Layout layout;
+		layout.words = type.words;
+
+		switch ( type.opcode )
+		{
+		case OpTypeBool:
+		case OpTypeInt:
+		case OpTypeFloat:
+			layout.size = 4u;
+			layout.runs.push_back( { 0u, 0u, 1u } );
+			break;
+
+		case OpTypeImage:
+		case OpTypeSampler:
+		case OpTypeSampledImage:
+		case OpTypePointer:
+			layout.size = uint32_t( sizeof( ShaderPointer ) );
+			layout.runs.push_back( { 0u, 0u, 4u } );
+			break;
+
+		case OpTypeVector:
+			// The stride is the components one, only set for the columns of row major matrices.
+			layout.element = doGetLayout( type.element );
+			layout.stride = stride ? stride : 4u;
+			layout.size = ( type.count - 1u ) * layout.stride + 4u;
+			break;
+
+		case OpTypeMatrix:
+			{
+				auto rows = doGetType( type.element ).count;
+
+				if ( rowMajor )
+				{
+					layout.element = doGetLayout( type.element, stride ? stride : type.count * 4u );
+					layout.stride = 4u;
+				}
+				else
+				{
+					layout.element = doGetLayout( type.element );
+					layout.stride = stride ? stride : rows * 4u;
+				}
+
+				layout.size = ( type.count - 1u ) * layout.stride + m_layouts[layout.element].size;
+			}
+			break;
+
+		case OpTypeArray:
+		case OpTypeRuntimeArray:
+			{
+				// The matrix layout applies to arrays of matrices.
+				auto elementType = type.element;
+
+				while ( doGetType( elementType ).opcode == OpTypeArray )
+				{
+					elementType = doGetType( elementType ).element;
+				}
+
+				layout.element = doGetType( elementType ).opcode == OpTypeMatrix
+					? doGetLayout( type.element, stride, rowMajor )
+					: doGetLayout( type.element );
+				layout.stride = decorations.arrayStride
+					? decorations.arrayStride
+					: m_layouts[layout.element].size;
+				layout.size = type.count
+					? ( type.count - 1u ) * layout.stride + m_layouts[layout.element].size
+					: 0u;
+			}
+			break;
+
+		case OpTypeStruct:
+			{
+				uint32_t offset{};
+
+				for ( uint32_t i = 0u; i < type.members.size(); ++i )
+				{
+					auto matrixStride = decorations.memberMatrixStrides.find( i );
+					auto isRowMajor = decorations.memberRowMajors.find( i );
+					auto member = doGetLayout( type.members[i]
+						, matrixStride == decorations.memberMatrixStrides.end() ? 0u : matrixStride->second
+						, isRowMajor != decorations.memberRowMajors.end() );
+					auto explicitOffset = decorations.memberOffsets.find( i );
+
+					if ( explicitOffset != decorations.memberOffsets.end() )
+					{
+						offset = explicitOffset->second;
+					}
+
+					layout.members.push_back( member );
+					layout.offsets.push_back( offset );
+					offset += m_layouts[member].size;
+					layout.size = std::max( layout.size, offset );
+				}
+			}
+			break;
+
+		default:
+			doFail( "Unsupported type in memory" );
+			break;
+		}
+
+		if ( layout.runs.empty() )
+		{
+			doAddRuns( layout, NoValue, 0u, 0u );
+		}
+
+		auto result = uint32_t( m_layouts.size() );
+		m_layouts.push_back( std::move( layout ) );
+		m_layoutIndices[key] = result;
+		return result;
+	}
+
+	void ShaderProgram::doAddRuns( Layout & layout
+		, uint32_t layoutIndex
+		, uint32_t offset
+		, uint32_t word )
+	{
+		if ( layoutIndex != NoValue )
+		{
+			// Appends the child layout's runs, merging the contiguous ones.
+			for ( auto run : m_layouts[layoutIndex].runs )
+			{
+				run.offset += offset;
+				run.word += word;
+
+				if ( !layout.runs.empty()
+					&& layout.runs.back().offset + layout.runs.back().words * 4u == run.offset
+					&& layout.runs.back().word + layout.runs.back().words == run.word )
+				{
+					layout.runs.back().words += run.words;
+				}
+				else
+				{
+					layout.runs.push_back( run );
+				}
+			}
+
+			return;
+		}
+
+		if ( !layout.members.empty() )
+		{
+			uint32_t memberWord{};
+
+			for ( size_t i = 0u; i < layout.members.size(); ++i )
+			{
+				doAddRuns( layout, layout.members[i], layout.offsets[i], memberWord );
+				memberWord += m_layouts[layout.members[i]].words;
+			}
+		}
+		else if ( layout.size )
+		{
+			auto elementWords = m_layouts[layout.element].words;
+			auto elements = elementWords ? layout.words / elementWords : 0u;
+
+			for ( uint32_t i = 0u; i < elements; ++i )
+			{
+				doAddRuns( layout, layout.element, i * layout.stride, i * elementWords );
+			}
+		}
+	}
+
+	uint32_t ShaderProgram::doGetRegister( uint32_t id )
+	{
+		auto it = m_registers.find( id );
+
+		if ( it != m_registers.end() )
+		{
+			return it->second;
+		}
+
+		auto result = uint32_t( m_initialRegisters.size() );
+		m_initialRegisters.resize( m_initialRegisters.size() + std::max( 1u, doGetWords( id ) ) );
+		m_registers.emplace( id, result );
+		return result;
+	}
+
+	uint32_t ShaderProgram::doGetWords( uint32_t id )
+	{
+		auto it = m_idTypes.find( id );
+
+		if ( it == m_idTypes.end() )
+		{
+			doFail( "Unknown result id " + std::to_string( id ) );
+			return 0u;
+		}
+
+		return doGetType( it->second ).words;
+	}
+
+	uint32_t ShaderProgram::doGetConstant( uint32_t id )
+	{
+		auto it = m_constants.find( id );
+
+		if ( it == m_constants.end() )
+		{
+			doFail( "Non constant value " + std::to_string( id ) );
+			return 0u;
+		}
+
+		return it->second;
+	}
+
+	ShaderProgram::Type const & ShaderProgram::doGetType( uint32_t typeId )
+	{
+		static Type const dummy{};
+		auto it = m_types.find( typeId );
+
+		if ( it == m_types.end() )
+		{
+			doFail( "Unknown type " + std::to_string( typeId ) );
+			return dummy;
+		}
+
+		return it->second;
+	}
+
+	void ShaderProgram::doEmit( std::vector< Instruction > & out
+		, ShaderOp op
+		, uint32_t count
+		, uint32_t result
+		, UInt32Array const & operands )
+	{
+		out.push_back( { op
+			, uint16_t( count )
+			, result
+			, uint32_t( m_operands.size() ) } );
+		m_operands.insert( m_operands.end(), operands.begin(), operands.end() );
+	}
+
+	bool ShaderProgram::doFail( std::string error )
+	{
+		if ( m_error.empty() )
+		{
+			m_error = std::move( error );
+		}
+
+		return false;
+	}
+}
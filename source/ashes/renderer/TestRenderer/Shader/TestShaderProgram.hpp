@@ -0,0 +1,483 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+namespace ashes::test
+{
+	/**
+	*\brief
+	*	A pointer value, in the shader registers and in descriptor memory.
+	*\remarks
+	*	The range is the count of bytes accessible from the address,
+	*	accesses outside of it read zeroes and don't write, as with robust buffer access.
+	*/
+	struct ShaderPointer
+	{
+		uint8_t * address;
+		uint64_t range;
+	};
+
+	enum class ShaderOp
+		: uint16_t
+	{
+		eMove,
+		eConstruct,
+		eGather,
+		eExtractDynamic,
+		eInsertDynamic,
+		eSelect,
+		eSelectScalar,
+		// Integer
+		eIAdd,
+		eISub,
+		eIMul,
+		eUDiv,
+		eSDiv,
+		eUMod,
+		eSRem,
+		eSMod,
+		eSNegate,
+		eShl,
+		eShrL,
+		eShrA,
+		eAnd,
+		eOr,
+		eXor,
+		eNot,
+		eLogicalNot,
+		eBitFieldInsert,
+		eBitFieldSExtract,
+		eBitFieldUExtract,
+		eBitReverse,
+		eBitCount,
+		eIAddCarry,
+		eISubBorrow,
+		eUMulExtended,
+		eSMulExtended,
+		eIEqual,
+		eINotEqual,
+		eUGreater,
+		eUGreaterEqual,
+		eULess,
+		eULessEqual,
+		eSGreater,
+		eSGreaterEqual,
+		eSLess,
+		eSLessEqual,
+		eAny,
+		eAll,
+		// Float
+		eFAdd,
+		eFSub,
+		eFMul,
+		eFDiv,
+		eFRem,
+		eFMod,
+		eFNegate,
+		eFOrdEqual,
+		eFOrdNotEqual,
+		eFOrdLess,
+		eFOrdLessEqual,
+		eFOrdGreater,
+		eFOrdGreaterEqual,
+		eFUnordEqual,
+		eFUnordNotEqual,
+		eFUnordLess,
+		eFUnordLessEqual,
+		eFUnordGreater,
+		eFUnordGreaterEqual,
+		eIsNan,
+		eIsInf,
+		eVectorTimesScalar,
+		eDot,
+		eMatrixTimesVector,
+		eVectorTimesMatrix,
+		eMatrixTimesMatrix,
+		eOuterProduct,
+		eTranspose,
+		eExtended,
+		// Conversions
+		eConvertFToU,
+		eConvertFToS,
+		eConvertSToF,
+		eConvertUToF,
+		eQuantizeToF16,
+		// Memory
+		eLoad,
+		eStore,
+		eCopyMemory,
+		eAccessChain,
+		eArrayLength,
+		eAtomicLoad,
+		eAtomicStore,
+		eAtomicExchange,
+		eAtomicCompareExchange,
+		eAtomicIIncrement,
+		eAtomicIDecrement,
+		eAtomicIAdd,
+		eAtomicISub,
+		eAtomicSMin,
+		eAtomicUMin,
+		eAtomicSMax,
+		eAtomicUMax,
+		eAtomicAnd,
+		eAtomicOr,
+		eAtomicXor,
+		// Images
+		eImageRead,
+		eImageWrite,
+		eImageQuerySize,
+		// Control flow
+		ePhis,
+		eBranch,
+		eBranchConditional,
+		eSwitch,
+		eCall,
+		eReturn,
+		eReturnValue,
+		eKill,
+		eExit,
+		eControlBarrier,
+		eMemoryBarrier,
+	};
+	/**
+	*\brief
+	*	A SPIR-V entry point, decoded once for the interpreter.
+	*\remarks
+	*	Each result id gets a fixed slot of 32 bits words in the registers, constants are held by the initial registers.
+	*	The instructions operate on registers, each operand is a register index or a precomputed value,
+	*	such as the memory layout of a load, the offsets of an access chain, or a branch target.
+	*	The variables are laid out in per invocation memory (Input, Output, Private and Function),
+	*	in per workgroup memory (Workgroup), or bound to resources by their pointer register.
+	*	Supported are the 32 bits scalar types, their vectors, matrices, arrays and structures,
+	*	buffers, push constants and storage images, without sampling nor 64 bits types.
+	*/
+	class ShaderProgram
+	{
+	public:
+		struct Instruction
+		{
+			ShaderOp op;
+			// The count of words of the result, or of components processed.
+			uint32_t count;
+			uint32_t result;
+			// The index of the first operand.
+			uint32_t operands;
+		};
+		/**
+		*\brief
+		*	A run of contiguous words, between memory and registers.
+		*/
+		struct Run
+		{
+			uint32_t offset;
+			uint32_t word;
+			uint32_t words;
+		};
+		/**
+		*\brief
+		*	The memory layout of a type, in some storage class.
+		*/
+		struct Layout
+		{
+			// The byte size in memory, 0 for runtime arrays.
+			uint32_t size{};
+			uint32_t words{};
+			// Arrays, vectors and matrices.
+			uint32_t element{};
+			uint32_t stride{};
+			// Structures.
+			UInt32Array members;
+			UInt32Array offsets;
+			// The elements are the 16 bytes ShaderPointer of the resources of a descriptor array.
+			bool indirect{};
+			std::vector< Run > runs;
+		};
+		struct Function
+		{
+			uint32_t pc;
+			uint32_t label;
+		};
+
+		enum class ResourceType
+		{
+			eBuffer,
+			eImage,
+		};
+		/**
+		*\brief
+		*	A descriptor binding, its pointer register is set at dispatch time.
+		*\remarks
+		*	Buffers point to the buffer memory, or to an array of ShaderPointer, for descriptor arrays.
+		*	Images always point to an array of ShaderPointer, each one addressing an ImageResource.
+		*/
+		struct Resource
+		{
+			uint32_t set;
+			uint32_t binding;
+			uint32_t reg;
+			uint32_t count;
+			ResourceType type;
+		};
+		enum class Interpolation
+			: uint8_t
+		{
+			eSmooth,
+			eNoPerspective,
+			eFlat,
+		};
+		/**
+		*\brief
+		*	An input or output value in the per invocation memory.
+		*\remarks
+		*	The variables are split into values consuming one location each,
+		*	the members of the built-in blocks, such as gl_PerVertex, are split too.
+		*/
+		struct Interface
+		{
+			uint32_t storageClass;
+			uint32_t builtIn;
+			uint32_t location;
+			uint32_t offset;
+			uint32_t size;
+			Interpolation interpolation;
+		};
+
+	public:
+		ShaderProgram( UInt32Array const & code
+			, std::string const & entryPoint
+			, VkShaderStageFlagBits stage
+			, VkSpecializationInfo const * specialization );
+
+		inline bool isValid()const
+		{
+			return m_error.empty();
+		}
+
+		inline std::string const & getError()const
+		{
+			return m_error;
+		}
+
+		inline std::vector< Instruction > const & getInstructions()const
+		{
+			return m_instructions;
+		}
+
+		inline UInt32Array const & getOperands()const
+		{
+			return m_operands;
+		}
+
+		inline std::vector< Layout > const & getLayouts()const
+		{
+			return m_layouts;
+		}
+
+		inline std::vector< Function > const & getFunctions()const
+		{
+			return m_functions;
+		}
+
+		inline UInt32Array const & getLabels()const
+		{
+			return m_labels;
+		}
+
+		inline UInt32Array const & getInitialRegisters()const
+		{
+			return m_initialRegisters;
+		}
+
+		inline uint32_t getEntryPc()const
+		{
+			return m_entryPc;
+		}
+		/**
+		*\return
+		*	The pointer registers to set with the invocation memory address, and their offset.
+		*/
+		inline std::vector< std::pair< uint32_t, uint32_t > > const & getInvocationVariables()const
+		{
+			return m_invocationVariables;
+		}
+
+		inline std::vector< std::pair< uint32_t, uint32_t > > const & getWorkgroupVariables()const
+		{
+			return m_workgroupVariables;
+		}
+
+		inline std::vector< Resource > const & getResources()const
+		{
+			return m_resources;
+		}
+
+		inline std::vector< Interface > const & getInterface()const
+		{
+			return m_interface;
+		}
+		/**
+		*\return
+		*	The pointer register of the push constants block, 0 if none.
+		*/
+		inline uint32_t getPushConstantsRegister()const
+		{
+			return m_pushConstantsRegister;
+		}
+
+		inline uint32_t getRegisterCount()const
+		{
+			return uint32_t( m_initialRegisters.size() );
+		}
+
+		inline uint32_t getInvocationMemorySize()const
+		{
+			return m_invocationMemorySize;
+		}
+
+		inline uint32_t getWorkgroupMemorySize()const
+		{
+			return m_workgroupMemorySize;
+		}
+
+		inline VkExtent3D const & getLocalSize()const
+		{
+			return m_localSize;
+		}
+
+		inline bool hasBarriers()const
+		{
+			return m_hasBarriers;
+		}
+
+	private:
+		struct Type
+		{
+			uint32_t opcode{};
+			uint32_t width{};
+			bool isSigned{};
+			uint32_t element{};
+			uint32_t count{};
+			uint32_t storageClass{};
+			UInt32Array members;
+			uint32_t words{};
+			// Images.
+			uint32_t dim{};
+			bool arrayed{};
+		};
+
+		struct Decorations
+		{
+			uint32_t set{};
+			uint32_t binding{};
+			uint32_t location{ ~( 0u ) };
+			uint32_t builtIn{ ~( 0u ) };
+			uint32_t specId{ ~( 0u ) };
+			uint32_t arrayStride{};
+			Interpolation interpolation{};
+			bool block{};
+			bool bufferBlock{};
+			std::map< uint32_t, uint32_t > memberOffsets;
+			std::map< uint32_t, uint32_t > memberMatrixStrides;
+			std::map< uint32_t, bool > memberRowMajors;
+			std::map< uint32_t, uint32_t > memberBuiltIns;
+			std::map< uint32_t, uint32_t > memberLocations;
+			std::map< uint32_t, Interpolation > memberInterpolations;
+		};
+
+		struct Source
+		{
+			uint32_t const * words;
+			uint32_t count;
+		};
+
+	private:
+		void doDecode( UInt32Array const & code
+			, std::string const & entryPoint
+			, VkShaderStageFlagBits stage
+			, VkSpecializationInfo const * specialization );
+		bool doDecodeGlobal( Source const & source
+			, VkSpecializationInfo const * specialization );
+		void doDecodeVariable( uint32_t typeId
+			, uint32_t id
+			, uint32_t storageClass
+			, uint32_t initializer
+			, std::vector< Instruction > & out );
+		uint32_t doAddInterface( uint32_t storageClass
+			, uint32_t typeId
+			, uint32_t layout
+			, uint32_t offset
+			, uint32_t builtIn
+			, uint32_t location
+			, Interpolation interpolation );
+		bool doDecodeInstruction( Source const & source
+			, std::vector< Instruction > & out );
+		bool doDecodeExtended( Source const & source
+			, std::vector< Instruction > & out );
+		bool doDecodeImage( Source const & source
+			, std::vector< Instruction > & out );
+		void doAddType( uint32_t id
+			, Type type );
+		uint32_t doGetLayout( uint32_t typeId
+			, uint32_t stride = 0u
+			, bool rowMajor = false );
+		void doAddRuns( Layout & layout
+			, uint32_t layoutIndex
+			, uint32_t offset
+			, uint32_t word );
+		uint32_t doGetRegister( uint32_t id );
+		uint32_t doGetWords( uint32_t id );
+		uint32_t doGetConstant( uint32_t id );
+		Type const & doGetType( uint32_t typeId );
+		void doEmit( std::vector< Instruction > & out
+			, ShaderOp op
+			, uint32_t count
+			, uint32_t result
+			, UInt32Array const & operands );
+		bool doFail( std::string error );
+
+	private:
+		std::string m_error;
+		std::vector< Instruction > m_instructions;
+		UInt32Array m_operands;
+		std::vector< Layout > m_layouts;
+		std::vector< Function > m_functions;
+		UInt32Array m_labels;
+		UInt32Array m_initialRegisters;
+		uint32_t m_entryPc{};
+		std::vector< std::pair< uint32_t, uint32_t > > m_invocationVariables;
+		std::vector< std::pair< uint32_t, uint32_t > > m_workgroupVariables;
+		std::vector< Resource > m_resources;
+		std::vector< Interface > m_interface;
+		uint32_t m_pushConstantsRegister{};
+		uint32_t m_invocationMemorySize{};
+		uint32_t m_workgroupMemorySize{};
+		VkExtent3D m_localSize{ 1u, 1u, 1u };
+		bool m_hasBarriers{};
+		// Decoding state.
+		std::unordered_map< uint32_t, Type > m_types;
+		std::unordered_map< uint32_t, Decorations > m_decorations;
+		std::unordered_map< uint32_t, uint32_t > m_idTypes;
+		std::unordered_map< uint32_t, uint32_t > m_registers;
+		std::unordered_map< uint32_t, uint32_t > m_constants;
+		std::unordered_map< uint32_t, uint32_t > m_pointerLayouts;
+		std::unordered_map< uint32_t, uint32_t > m_labelIndices;
+		std::unordered_map< uint32_t, uint32_t > m_functionIndices;
+		std::unordered_map< uint32_t, UInt32Array > m_functionParameters;
+		std::map< std::tuple< uint32_t, uint32_t, bool >, uint32_t > m_layoutIndices;
+		std::vector< Instruction > m_prologue;
+		UInt32Array m_localSizeIds;
+		std::string m_entryPointName;
+		uint32_t m_executionModel{};
+		uint32_t m_entryFunction{ ~( 0u ) };
+		uint32_t m_glslExtension{ ~( 0u ) };
+	};
+}
@@ -0,0 +1,176 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Shader/TestShaderResources.hpp"
+
+#include "Buffer/TestBuffer.hpp"
+#include "Descriptor/TestDescriptorSet.hpp"
+#include "Image/TestImage.hpp"
+#include "Image/TestImageView.hpp"
+#include "Miscellaneous/TestDeviceMemory.hpp"
+#include "Shader/TestShaderInvocation.hpp"
+
+#include "ashestest_api.hpp"
+
+#include <algorithm>
+
+namespace ashes::test
+{
+	namespace
+	{
+		VkWriteDescriptorSet const * findWrite( LayoutBindingWrites const & bindingWrites
+			, uint32_t element
+			, uint32_t & index )
+		{
+			// The last write covering the element is the one in effect.
+			for ( auto it = bindingWrites.writes.rbegin(); it != bindingWrites.writes.rend(); ++it )
+			{
+				if ( element >= it->dstArrayElement
+					&& element < it->dstArrayElement + it->descriptorCount )
+				{
+					index = element - it->dstArrayElement;
+					return &( *it );
+				}
+			}
+
+			return nullptr;
+		}
+	}
+
+	ShaderResources::ShaderResources( ShaderProgram const & program
+		, DescriptorSetBindingArray const & descriptorSets
+		, ByteArray pushConstants )
+		: m_pushConstants{ std::move( pushConstants ) }
+	{
+		for ( auto & resource : program.getResources() )
+		{
+			std::vector< ShaderPointer > pointers( resource.count, ShaderPointer{ nullptr, 0u } );
+
+			if ( resource.set < descriptorSets.size()
+				&& descriptorSets[resource.set].set )
+			{
+				auto & descriptorSet = descriptorSets[resource.set];
+
+				if ( auto bindingWrites = get( descriptorSet.set )->getBindingWrites( resource.binding ) )
+				{
+					for ( uint32_t element = 0u; element < resource.count; ++element )
+					{
+						uint32_t index{};
+
+						if ( auto write = findWrite( *bindingWrites, element, index ) )
+						{
+							pointers[element] = resource.type == ShaderProgram::ResourceType::eImage
+								? doGetImage( *write, index )
+								: doGetBuffer( descriptorSet, *write, index, element );
+						}
+					}
+				}
+			}
+
+			if ( resource.type == ShaderProgram::ResourceType::eBuffer
+				&& resource.count == 1u )
+			{
+				m_pointers.emplace_back( resource.reg, pointers.front() );
+			}
+			else
+			{
+				m_arrays.push_back( std::move( pointers ) );
+				auto & array = m_arrays.back();
+				m_pointers.emplace_back( resource.reg
+					, ShaderPointer{ reinterpret_cast< uint8_t * >( array.data() )
+						, array.size() * sizeof( ShaderPointer ) } );
+			}
+		}
+
+		if ( program.getPushConstantsRegister() )
+		{
+			m_pointers.emplace_back( program.getPushConstantsRegister()
+				, ShaderPointer{ m_pushConstants.data(), m_pushConstants.size() } );
+		}
+	}
+
+	void ShaderResources::bind( ShaderInvocation & invocation )const
+	{
+		for ( auto & pointer : m_pointers )
+		{
+			invocation.setPointer( pointer.first, pointer.second );
+		}
+	}
+
+	ShaderPointer ShaderResources::doGetBuffer( DescriptorSetBinding const & descriptorSet
+		, VkWriteDescriptorSet const & write
+		, uint32_t index
+		, uint32_t arrayElement )
+	{
+		if ( !write.pBufferInfo
+			|| !write.pBufferInfo[index].buffer )
+		{
+			return { nullptr, 0u };
+		}
+
+		auto & info = write.pBufferInfo[index];
+		auto buffer = get( info.buffer );
+		VkDeviceSize dynamicOffset{};
+
+		if ( write.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC
+			|| write.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC )
+		{
+			// The dynamic offsets are ordered by binding, then by array element.
+			uint32_t offsetIndex{};
+
+			for ( auto dynamic : get( descriptorSet.set )->getDynamicBuffers() )
+			{
+				if ( dynamic->binding.binding == write.dstBinding )
+				{
+					break;
+				}
+
+				offsetIndex += dynamic->binding.descriptorCount;
+			}
+
+			offsetIndex += arrayElement;
+			dynamicOffset = offsetIndex < descriptorSet.dynamicOffsets.size()
+				? descriptorSet.dynamicOffsets[offsetIndex]
+				: 0u;
+		}
+
+		auto offset = info.offset + dynamicOffset;
+
+		if ( offset >= buffer->getSize() )
+		{
+			return { nullptr, 0u };
+		}
+
+		auto range = info.range == WholeSize
+			? buffer->getSize() - info.offset
+			: info.range;
+		return { get( buffer->getMemory() )->getData( buffer->getMemoryOffset() + offset )
+			, std::min( range, buffer->getSize() - offset ) };
+	}
+
+	ShaderPointer ShaderResources::doGetImage( VkWriteDescriptorSet const & write
+		, uint32_t index )
+	{
+		if ( !write.pImageInfo
+			|| !write.pImageInfo[index].imageView )
+		{
+			return { nullptr, 0u };
+		}
+
+		auto view = get( write.pImageInfo[index].imageView );
+		auto image = get( view->getImage() );
+		auto & range = view->getSubResourceRange();
+		ImageResource resource;
+		resource.data = image->getSubresourceData( range.aspectMask
+			, range.baseMipLevel
+			, range.baseArrayLayer );
+		resource.data.format = view->getFormat();
+		resource.layerPitch = image->getSubresourceLayout( { range.aspectMask, range.baseMipLevel, range.baseArrayLayer } ).arrayPitch;
+		resource.layerCount = range.layerCount == VK_REMAINING_ARRAY_LAYERS
+			? image->getLayerCount() - range.baseArrayLayer
+			: range.layerCount;
+		m_images.push_back( resource );
+		return { reinterpret_cast< uint8_t * >( &m_images.back() ), sizeof( ImageResource ) };
+	}
+}
@@ -0,0 +1,60 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/Miscellaneous/TestTransferKernels.hpp"
+#include "renderer/TestRenderer/Shader/TestShaderProgram.hpp"
+
+#include <deque>
+
+namespace ashes::test
+{
+	class ShaderInvocation;
+	/**
+	*\brief
+	*	A storage image view, as seen by the shaders.
+	*/
+	struct ImageResource
+	{
+		// The view's first layer, with the view format.
+		SubresourceData data;
+		VkDeviceSize layerPitch{};
+		uint32_t layerCount{};
+	};
+	/**
+	*\brief
+	*	The memory of the resources used by a program, resolved from the bound descriptor sets.
+	*\remarks
+	*	Unbound or unwritten descriptors resolve to null pointers, reading zeroes.
+	*/
+	class ShaderResources
+	{
+	public:
+		ShaderResources( ShaderProgram const & program
+			, DescriptorSetBindingArray const & descriptorSets
+			, ByteArray pushConstants );
+		ShaderResources( ShaderResources const & ) = delete;
+		ShaderResources & operator=( ShaderResources const & ) = delete;
+		/**
+		*\brief
+		*	Sets the resources pointer registers of the invocation.
+		*/
+		void bind( ShaderInvocation & invocation )const;
+
+	private:
+		ShaderPointer doGetBuffer( DescriptorSetBinding const & descriptorSet
+			, VkWriteDescriptorSet const & write
+			, uint32_t index
+			, uint32_t arrayElement );
+		ShaderPointer doGetImage( VkWriteDescriptorSet const & write
+			, uint32_t index );
+
+	private:
+		ByteArray m_pushConstants;
+		std::vector< std::pair< uint32_t, ShaderPointer > > m_pointers;
+		std::deque< std::vector< ShaderPointer > > m_arrays;
+		std::deque< ImageResource > m_images;
+	};
+}
@@ -14,18 +14,34 @@ namespace ashes::test
 
 	VkResult Event::getStatus()const
 	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
 		return m_status;
 	}
 
 	VkResult Event::set()const
 	{
-		m_status = VK_EVENT_SET;
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_status = VK_EVENT_SET;
+		}
+		m_condition.notify_all();
 		return VK_SUCCESS;
 	}
 
 	VkResult Event::reset()const
 	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
 		m_status = VK_EVENT_RESET;
 		return VK_SUCCESS;
 	}
+
+	void Event::wait()const
+	{
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		m_condition.wait( lock
+			, [this]()
+			{
+				return m_status == VK_EVENT_SET;
+			} );
+	}
 }
@@ -6,6 +6,9 @@ See LICENSE file in root folder
 
 #include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
 
+#include <condition_variable>
+#include <mutex>
+
 namespace ashes::test
 {
 	class Event
@@ -24,8 +27,15 @@ namespace ashes::test
 		*\copydoc	ashes::Event::getStatus
 		*/
 		VkResult reset()const;
+		/**
+		*\brief
+		*	Blocks until the event is set, by the host or by another queue.
+		*/
+		void wait()const;
 
 	private:
+		mutable std::mutex m_mutex;
+		mutable std::condition_variable m_condition;
 		mutable VkResult m_status{ VK_EVENT_RESET };
 	};
 }
@@ -4,24 +4,116 @@ See LICENSE file in root folder.
 */
 #include "Sync/TestFence.hpp"
 
+#include "Sync/TestSyncWait.hpp"
+
+#include "ashestest_api.hpp"
+
+#include <algorithm>
+
 namespace ashes::test
 {
+	namespace
+	{
+		// Fences signaled after this delay are detected by vkWaitForFences with waitAll set to false.
+		static std::chrono::microseconds constexpr AnyFencePollDelay{ 100 };
+	}
+
 	Fence::Fence( VkDevice device
 		, VkFenceCreateFlags flags )
+		: m_signaled{ checkFlag( flags, VK_FENCE_CREATE_SIGNALED_BIT ) }
 	{
 	}
 
 	VkResult Fence::wait( uint64_t timeout )const
 	{
-		return VK_SUCCESS;
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		return waitFor( m_condition
+				, lock
+				, timeout
+				, [this]()
+				{
+					return m_signaled;
+				} )
+			? VK_SUCCESS
+			: VK_TIMEOUT;
 	}
 
 	void Fence::reset()const
 	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		m_signaled = false;
 	}
 
 	VkResult Fence::getStatus()const
 	{
-		return VK_SUCCESS;
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		return m_signaled
+			? VK_SUCCESS
+			: VK_NOT_READY;
+	}
+
+	void Fence::signal()const
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_signaled = true;
+		}
+		m_condition.notify_all();
+	}
+
+	VkResult Fence::wait( ArrayView< VkFence const > const & fences
+		, bool waitAll
+		, uint64_t timeout )
+	{
+		if ( fences.empty() )
+		{
+			return VK_SUCCESS;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		auto getRemaining = [&start, timeout]()
+		{
+			auto elapsed = uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - start ).count() );
+			return elapsed >= timeout
+				? 0u
+				: timeout - elapsed;
+		};
+
+		if ( waitAll )
+		{
+			for ( auto & fence : fences )
+			{
+				if ( get( fence )->wait( getRemaining() ) != VK_SUCCESS )
+				{
+					return VK_TIMEOUT;
+				}
+			}
+
+			return VK_SUCCESS;
+		}
+
+		while ( true )
+		{
+			if ( std::any_of( fences.begin()
+				, fences.end()
+				, []( VkFence fence )
+				{
+					return get( fence )->getStatus() == VK_SUCCESS;
+				} ) )
+			{
+				return VK_SUCCESS;
+			}
+
+			auto remaining = getRemaining();
+
+			if ( !remaining )
+			{
+				return VK_TIMEOUT;
+			}
+
+			// Sleeps on the first fence, waking up regularly to check the others.
+			get( *fences.begin() )->wait( std::min( remaining
+				, uint64_t( std::chrono::nanoseconds{ AnyFencePollDelay }.count() ) ) );
+		}
 	}
 }
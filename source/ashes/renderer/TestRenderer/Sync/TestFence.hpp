@@ -6,6 +6,9 @@ See LICENSE file in root folder
 
 #include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
 
+#include <condition_variable>
+#include <mutex>
+
 namespace ashes::test
 {
 	class Fence
@@ -17,5 +20,22 @@ namespace ashes::test
 		VkResult wait( uint64_t timeout )const;
 		void reset()const;
 		VkResult getStatus()const;
+		/**
+		*\brief
+		*	Called by the queue, once the submission using the fence is complete.
+		*/
+		void signal()const;
+		/**
+		*\brief
+		*	Waits for all or any of the fences, as vkWaitForFences does.
+		*/
+		static VkResult wait( ArrayView< VkFence const > const & fences
+			, bool waitAll
+			, uint64_t timeout );
+
+	private:
+		mutable std::mutex m_mutex;
+		mutable std::condition_variable m_condition;
+		mutable bool m_signaled;
 	};
 }
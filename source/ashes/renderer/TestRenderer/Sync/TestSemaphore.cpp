@@ -4,9 +4,133 @@ See LICENSE file in root folder.
 */
 #include "Sync/TestSemaphore.hpp"
 
+#include "Sync/TestSyncWait.hpp"
+
+#include "ashestest_api.hpp"
+
+#include <algorithm>
+
 namespace ashes::test
 {
-	Semaphore::Semaphore( VkDevice device )
+	namespace
+	{
+		// Semaphores signaled after this delay are detected by vkWaitSemaphores with VK_SEMAPHORE_WAIT_ANY_BIT.
+		static std::chrono::microseconds constexpr AnySemaphorePollDelay{ 100 };
+	}
+
+	Semaphore::Semaphore( VkDevice device
+		, VkSemaphoreCreateInfo const & createInfo )
 	{
+#if VK_KHR_timeline_semaphore
+		if ( auto typeInfo = tryGet< VkSemaphoreTypeCreateInfoKHR >( createInfo.pNext ) )
+		{
+			m_timeline = typeInfo->semaphoreType == VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+			m_value = m_timeline
+				? typeInfo->initialValue
+				: 0u;
+		}
+#endif
+	}
+
+	void Semaphore::signal( uint64_t value )const
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_value = m_timeline
+				? std::max( m_value, value )
+				: 1u;
+		}
+		m_condition.notify_all();
+	}
+
+	VkResult Semaphore::wait( uint64_t value
+		, uint64_t timeout )const
+	{
+		std::unique_lock< std::mutex > lock{ m_mutex };
+
+		if ( !m_timeline )
+		{
+			value = 1u;
+		}
+
+		if ( !waitFor( m_condition
+			, lock
+			, timeout
+			, [this, value]()
+			{
+				return m_value >= value;
+			} ) )
+		{
+			return VK_TIMEOUT;
+		}
+
+		if ( !m_timeline )
+		{
+			m_value = 0u;
+		}
+
+		return VK_SUCCESS;
+	}
+
+	uint64_t Semaphore::getValue()const
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		return m_value;
+	}
+
+	VkResult Semaphore::wait( ArrayView< VkSemaphore const > const & semaphores
+		, ArrayView< uint64_t const > const & values
+		, bool waitAll
+		, uint64_t timeout )
+	{
+		if ( semaphores.empty() )
+		{
+			return VK_SUCCESS;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		auto getRemaining = [&start, timeout]()
+		{
+			auto elapsed = uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - start ).count() );
+			return elapsed >= timeout
+				? 0u
+				: timeout - elapsed;
+		};
+
+		if ( waitAll )
+		{
+			for ( size_t i = 0u; i < semaphores.size(); ++i )
+			{
+				if ( get( semaphores[i] )->wait( values[i], getRemaining() ) != VK_SUCCESS )
+				{
+					return VK_TIMEOUT;
+				}
+			}
+
+			return VK_SUCCESS;
+		}
+
+		while ( true )
+		{
+			for ( size_t i = 0u; i < semaphores.size(); ++i )
+			{
+				if ( get( semaphores[i] )->getValue() >= values[i] )
+				{
+					return VK_SUCCESS;
+				}
+			}
+
+			auto remaining = getRemaining();
+
+			if ( !remaining )
+			{
+				return VK_TIMEOUT;
+			}
+
+			// Sleeps on the first semaphore, waking up regularly to check the others.
+			get( semaphores[0] )->wait( values[0]
+				, std::min( remaining
+					, uint64_t( std::chrono::nanoseconds{ AnySemaphorePollDelay }.count() ) ) );
+		}
 	}
 }
@@ -6,11 +6,52 @@ See LICENSE file in root folder.
 
 #include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
 
+#include <condition_variable>
+#include <mutex>
+
 namespace ashes::test
 {
+	/**
+	*\brief
+	*	A binary or timeline semaphore.
+	*\remarks
+	*	A binary semaphore holds 1 when signaled, and its wait operation resets it to 0.
+	*/
 	class Semaphore
 	{
 	public:
-		explicit Semaphore( VkDevice device );
+		Semaphore( VkDevice device
+			, VkSemaphoreCreateInfo const & createInfo );
+		/**
+		*\brief
+		*	Sets the payload, the value is ignored by binary semaphores.
+		*/
+		void signal( uint64_t value )const;
+		/**
+		*\brief
+		*	Waits for the payload to reach the value, the value is ignored by binary semaphores.
+		*/
+		VkResult wait( uint64_t value
+			, uint64_t timeout )const;
+		uint64_t getValue()const;
+		/**
+		*\brief
+		*	Waits for all or any of the timeline semaphores, as vkWaitSemaphores does.
+		*/
+		static VkResult wait( ArrayView< VkSemaphore const > const & semaphores
+			, ArrayView< uint64_t const > const & values
+			, bool waitAll
+			, uint64_t timeout );
+
+		inline bool isTimeline()const noexcept
+		{
+			return m_timeline;
+		}
+
+	private:
+		bool m_timeline{};
+		mutable std::mutex m_mutex;
+		mutable std::condition_variable m_condition;
+		mutable uint64_t m_value{};
 	};
 }
@@ -0,0 +1,41 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace ashes::test
+{
+	/**
+	*\brief
+	*	Waits until the predicate is satisfied, for at most timeout nanoseconds.
+	*\remarks
+	*	Timeouts too large to be added to the current time, like UINT64_MAX, wait indefinitely.
+	*\return
+	*	\p false if the predicate is still unsatisfied once the timeout has elapsed.
+	*/
+	template< typename PredicateT >
+	bool waitFor( std::condition_variable & condition
+		, std::unique_lock< std::mutex > & lock
+		, uint64_t timeout
+		, PredicateT predicate )
+	{
+		static uint64_t constexpr MaxTimeout = uint64_t( std::chrono::hours{ 24 * 365 } / std::chrono::nanoseconds{ 1 } );
+
+		if ( timeout >= MaxTimeout )
+		{
+			condition.wait( lock, predicate );
+			return true;
+		}
+
+		return condition.wait_for( lock
+			, std::chrono::nanoseconds{ timeout }
+			, predicate );
+	}
+}
@@ -58,7 +58,6 @@ namespace ashes::test
 	class Attribute;
 	class Buffer;
 	class BufferView;
-	class CommandBase;
 	class CommandBuffer;
 	class CommandPool;
 	class DescriptorPool;
@@ -83,6 +82,8 @@ namespace ashes::test
 	class ShaderModule;
 	class Surface;
 	class SwapChain;
+	class ThreadPool;
+	class GpuClock;
 	class Image;
 	class ImageView;
 	class VertexBufferBase;
@@ -97,12 +98,8 @@ namespace ashes::test
 	class DebugUtilsMessengerEXT;
 	class ValidationCacheEXT;
 
-	using Action = std::function< void() >;
-	using ActionArray = std::vector< Action >;
-
 	using AttributeArray = std::vector< Attribute >;
 
-	using CommandPtr = std::unique_ptr< CommandBase >;
 	using CommandPoolPtr = std::unique_ptr< CommandPool >;
 	using PipelinePtr = std::unique_ptr< Pipeline >;
 	using PhysicalDevicePtr = std::unique_ptr< PhysicalDevice >;
@@ -123,8 +120,6 @@ namespace ashes::test
 	using VertexLayoutCRef = std::reference_wrapper< VertexLayout const >;
 	using VertexBufferCRef = std::reference_wrapper< VertexBufferBase const >;
 
-	using CommandArray = std::vector< CommandPtr >;
-
 	template< typename Dst, typename Src >
 	std::vector< std::reference_wrapper< Dst const > > staticCast( std::vector< std::reference_wrapper< Src const > > const & src )
 	{
@@ -138,22 +133,6 @@ namespace ashes::test
 		return result;
 	}
 
-	struct PushConstantsDesc
-	{
-		VkShaderStageFlags stageFlags{};
-		uint32_t offset{};
-		uint32_t size{};
-		std::vector< uint8_t > data;
-	};
-
-	struct PushConstantsBuffer
-	{
-		VkBuffer ubo{};
-		uint32_t location{};
-		PushConstantsDesc data;
-		VkDeviceMemory memory{};
-	};
-
 	struct VbosBinding
 	{
 		uint32_t startIndex{};
@@ -164,6 +143,40 @@ namespace ashes::test
 
 	using VbosBindingArray = std::vector< VbosBinding >;
 
+	struct DescriptorSetBinding
+	{
+		VkDescriptorSet set{};
+		UInt32Array dynamicOffsets;
+	};
+
+	using DescriptorSetBindingArray = std::vector< DescriptorSetBinding >;
+
+	/**
+	*\brief
+	*	The state a draw runs with, tracked while the command buffer executes.
+	*\remarks
+	*	The dynamic states are only used when the pipeline enables them.
+	*/
+	struct DrawState
+	{
+		VkPipeline pipeline{};
+		VkFramebuffer frameBuffer{};
+		VkSubpassDescription const * subpass{};
+		VbosBindingArray vbos;
+		VkBuffer indexBuffer{};
+		VkDeviceSize indexOffset{};
+		VkIndexType indexType{};
+		DescriptorSetBindingArray descriptorSets;
+		ByteArray pushConstants;
+		VkViewportArray viewports;
+		VkScissorArray scissors;
+		std::array< float, 4u > blendConstants{};
+		// The stencil states are indexed by face, front then back.
+		std::array< uint32_t, 2u > stencilCompareMasks{};
+		std::array< uint32_t, 2u > stencilWriteMasks{};
+		std::array< uint32_t, 2u > stencilReferences{};
+	};
+
 	struct LayoutBindingWrites
 	{
 		VkDescriptorSetLayoutBinding binding;
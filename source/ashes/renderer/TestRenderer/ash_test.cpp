@@ -9,6 +9,8 @@
 
 #include "ashestest_api.hpp"
 
+#include <renderer/RendererCommon/ProcAddrTable.hpp>
+
 #include <ashes/common/Exception.hpp>
 
 #include <cstring>
@@ -502,9 +504,9 @@ namespace ashes::test
 		uint32_t fenceCount,
 		const VkFence* pFences )
 	{
-		for ( uint32_t i = 0u; i < fenceCount; ++i )
+		for ( auto & fence : makeArrayView( pFences, fenceCount ) )
 		{
-			get( *pFences )->reset();
+			get( fence )->reset();
 		}
 
 		return VK_SUCCESS;
@@ -524,12 +526,9 @@ namespace ashes::test
 		VkBool32 waitAll,
 		uint64_t timeout )
 	{
-		for ( uint32_t i = 0u; i < fenceCount; ++i )
-		{
-			get( *pFences )->wait( timeout );
-		}
-
-		return VK_SUCCESS;
+		return Fence::wait( makeArrayView( pFences, fenceCount )
+			, waitAll != VK_FALSE
+			, timeout );
 	}
 
 	VkResult VKAPI_CALL vkCreateSemaphore(
@@ -541,7 +540,8 @@ namespace ashes::test
 		assert( pSemaphore );
 		return allocate( *pSemaphore
 			, pAllocator
-			, device );
+			, device
+			, *pCreateInfo );
 	}
 
 	void VKAPI_CALL vkDestroySemaphore(
@@ -1872,6 +1872,7 @@ namespace ashes::test
 		VkCommandPool commandPool,
 		VkCommandPoolTrimFlags flags )
 	{
+		get( commandPool )->trim();
 	}
 
 	void VKAPI_CALL vkGetDeviceQueue2(
@@ -2024,7 +2025,7 @@ namespace ashes::test
 		uint32_t firstQuery,
 		uint32_t queryCount )
 	{
-		reportUnsupported( device, "vkResetQueryPool" );
+		get( queryPool )->reset( firstQuery, queryCount );
 	}
 
 	VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreCounterValue(
@@ -2032,7 +2033,8 @@ namespace ashes::test
 		VkSemaphore semaphore,
 		uint64_t * pValue )
 	{
-		return reportUnsupported( device, "vkGetSemaphoreCounterValue" );
+		*pValue = get( semaphore )->getValue();
+		return VK_SUCCESS;
 	}
 
 	VKAPI_ATTR VkResult VKAPI_CALL vkWaitSemaphores(
@@ -2040,14 +2042,18 @@ namespace ashes::test
 		const VkSemaphoreWaitInfo * pWaitInfo,
 		uint64_t timeout )
 	{
-		return reportUnsupported( device, "vkWaitSemaphores" );
+		return Semaphore::wait( makeArrayView( pWaitInfo->pSemaphores, pWaitInfo->semaphoreCount )
+			, makeArrayView( pWaitInfo->pValues, pWaitInfo->semaphoreCount )
+			, !checkFlag( pWaitInfo->flags, VK_SEMAPHORE_WAIT_ANY_BIT )
+			, timeout );
 	}
 
 	VKAPI_ATTR VkResult VKAPI_CALL vkSignalSemaphore(
 		VkDevice device,
 		const VkSemaphoreSignalInfo * pSignalInfo )
 	{
-		return reportUnsupported( device, "vkSignalSemaphore" );
+		get( pSignalInfo->semaphore )->signal( pSignalInfo->value );
+		return VK_SUCCESS;
 	}
 
 	VKAPI_ATTR VkDeviceAddress VKAPI_CALL vkGetBufferDeviceAddress(
@@ -2084,7 +2090,8 @@ namespace ashes::test
 		VkSemaphore semaphore,
 		uint64_t * pValue )
 	{
-		return reportUnsupported( device, "vkGetSemaphoreCounterValueKHR" );
+		*pValue = get( semaphore )->getValue();
+		return VK_SUCCESS;
 	}
 
 	VKAPI_ATTR VkResult VKAPI_CALL vkWaitSemaphoresKHR(
@@ -2092,14 +2099,18 @@ namespace ashes::test
 		const VkSemaphoreWaitInfoKHR * pWaitInfo,
 		uint64_t timeout )
 	{
-		return reportUnsupported( device, "vkWaitSemaphoresKHR" );
+		return Semaphore::wait( makeArrayView( pWaitInfo->pSemaphores, pWaitInfo->semaphoreCount )
+			, makeArrayView( pWaitInfo->pValues, pWaitInfo->semaphoreCount )
+			, !checkFlag( pWaitInfo->flags, VK_SEMAPHORE_WAIT_ANY_BIT_KHR )
+			, timeout );
 	}
 
 	VKAPI_ATTR VkResult VKAPI_CALL vkSignalSemaphoreKHR(
 		VkDevice device,
 		const VkSemaphoreSignalInfoKHR * pSignalInfo )
 	{
-		return reportUnsupported( device, "vkSignalSemaphoreKHR" );
+		get( pSignalInfo->semaphore )->signal( pSignalInfo->value );
+		return VK_SUCCESS;
 	}
 #endif
 #pragma endregion
@@ -2552,6 +2563,7 @@ namespace ashes::test
 		VkCommandPool commandPool,
 		VkCommandPoolTrimFlagsKHR flags )
 	{
+		get( commandPool )->trim();
 	}
 
 #endif
@@ -4327,6 +4339,20 @@ namespace ashes::test
 	}
 
 #	endif
+#endif
+#pragma endregion
+#pragma region VK_EXT_headless_surface
+#ifdef VK_EXT_headless_surface
+
+	VkResult VKAPI_CALL vkCreateHeadlessSurfaceEXT(
+		VkInstance instance,
+		const VkHeadlessSurfaceCreateInfoEXT* pCreateInfo,
+		const VkAllocationCallbacks* pAllocator,
+		VkSurfaceKHR* pSurface )
+	{
+		return reportUnsupported( instance, "vkCreateHeadlessSurfaceEXT" );
+	}
+
 #endif
 #pragma endregion
 #pragma region VK_KHR_win32_surface
@@ -4513,53 +4539,43 @@ namespace ashes::test
 			&& get( device )->hasExtension( extension.data() );
 	}
 
-	PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(
-		VkInstance instance,
-		const char* pName )
+	ProcAddrTable makeInstanceFunctions()
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		static std::map< std::string, PFN_vkVoidFunction > functions
-		{
+		ProcAddrTable result{};
 #define VK_LIB_GLOBAL_FUNCTION( v, x )\
-			{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
+		result[ashesFunctionIndex( "vk"#x )] = PFN_vkVoidFunction( vk##x );
 #define VK_LIB_INSTANCE_FUNCTION( v, x )\
-			{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
+		result[ashesFunctionIndex( "vk"#x )] = PFN_vkVoidFunction( vk##x );
 #define VK_LIB_DEVICE_FUNCTION( v, x )\
-			{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
+		result[ashesFunctionIndex( "vk"#x )] = PFN_vkVoidFunction( vk##x );
 #include <ashes/ashes_functions_list.hpp>
-		};
-
-		auto it = functions.find( pName );
-
-		if ( it != functions.end() )
-		{
-			result = it->second;
-		}
-
 		return result;
 	}
 
-	PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(
-		VkDevice device,
-		const char* pName )
+	ProcAddrTable makeDeviceFunctions()
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		static std::map< std::string, PFN_vkVoidFunction > functions
-		{
-			{ "vkGetDeviceProcAddr", PFN_vkVoidFunction( vkGetDeviceProcAddr ) },
+		ProcAddrTable result{};
+		result[ashesFunctionIndex( "vkGetDeviceProcAddr" )] = PFN_vkVoidFunction( vkGetDeviceProcAddr );
 #define VK_LIB_DEVICE_FUNCTION( v, x )\
-			{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
+		result[ashesFunctionIndex( "vk"#x )] = PFN_vkVoidFunction( vk##x );
 #include <ashes/ashes_functions_list.hpp>
-		};
-
-		auto it = functions.find( pName );
+		return result;
+	}
 
-		if ( it != functions.end() )
-		{
-			result = it->second;
-		}
+	PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(
+		VkInstance instance,
+		const char* pName )
+	{
+		static ProcAddrTable const functions = makeInstanceFunctions();
+		return getProcAddr( functions, pName );
+	}
 
-		return result;
+	PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(
+		VkDevice device,
+		const char* pName )
+	{
+		static ProcAddrTable const functions = makeDeviceFunctions();
+		return getProcAddr( functions, pName );
 	}
 
 #pragma warning( pop )
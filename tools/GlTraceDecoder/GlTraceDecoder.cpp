@@ -0,0 +1,273 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+
+Converts a binary GL call trace, written by the GL renderer built with
+ASHES_GL_TRACE_CALLS and run with ASHES_GL_TRACE_FILE set, to text or
+to Chrome trace event JSON (loadable in chrome://tracing or Perfetto).
+
+Usage: ashes-gl-trace-decode <trace file> [--json] [-o <output file>]
+*/
+#include <renderer/GlRenderer/Miscellaneous/GlCallTraceFormat.hpp>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using ashes::gl::CallTraceArgKind;
+	using ashes::gl::CallTraceHeader;
+	using ashes::gl::CallTraceRecord;
+
+	struct Options
+	{
+		std::string input;
+		std::string output;
+		bool json{ false };
+	};
+
+	struct Trace
+	{
+		std::vector< std::string > names;
+		std::vector< CallTraceRecord > records;
+	};
+
+	bool parseOptions( int argc
+		, char ** argv
+		, Options & options )
+	{
+		for ( int i = 1; i < argc; ++i )
+		{
+			std::string arg = argv[i];
+
+			if ( arg == "--json" )
+			{
+				options.json = true;
+			}
+			else if ( arg == "-o" && i + 1 < argc )
+			{
+				options.output = argv[++i];
+			}
+			else if ( options.input.empty() )
+			{
+				options.input = arg;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return !options.input.empty();
+	}
+
+	bool read( std::string const & path
+		, Trace & trace )
+	{
+		auto file = std::fopen( path.c_str(), "rb" );
+
+		if ( !file )
+		{
+			std::fprintf( stderr, "Couldn't open %s\n", path.c_str() );
+			return false;
+		}
+
+		CallTraceHeader header{};
+		bool result = std::fread( &header, sizeof( header ), 1u, file ) == 1u
+			&& std::memcmp( header.magic, ashes::gl::CallTraceMagic, sizeof( header.magic ) ) == 0
+			&& header.version == ashes::gl::CallTraceVersion
+			&& header.recordSize == sizeof( CallTraceRecord );
+
+		for ( uint32_t i = 0u; result && i < header.opCount; ++i )
+		{
+			uint16_t length{};
+			result = std::fread( &length, sizeof( length ), 1u, file ) == 1u;
+			std::string name( length, '\0' );
+			result = result
+				&& std::fread( &name[0], 1u, length, file ) == length;
+			trace.names.push_back( std::move( name ) );
+		}
+
+		if ( !result )
+		{
+			std::fprintf( stderr, "%s isn't a supported GL call trace\n", path.c_str() );
+			std::fclose( file );
+			return false;
+		}
+
+		CallTraceRecord record{};
+
+		while ( std::fread( &record, sizeof( record ), 1u, file ) == 1u )
+		{
+			trace.records.push_back( record );
+		}
+
+		std::fclose( file );
+		// The records are written per thread batch.
+		std::stable_sort( trace.records.begin()
+			, trace.records.end()
+			, []( CallTraceRecord const & lhs, CallTraceRecord const & rhs )
+			{
+				return lhs.timestamp < rhs.timestamp;
+			} );
+		return true;
+	}
+
+	std::string getName( Trace const & trace
+		, CallTraceRecord const & record )
+	{
+		if ( record.op == ashes::gl::CallTraceDroppedOp )
+		{
+			return "<dropped>";
+		}
+
+		return record.op < trace.names.size()
+			? trace.names[record.op]
+			: "<unknown " + std::to_string( record.op ) + ">";
+	}
+
+	std::string formatArg( CallTraceRecord const & record
+		, uint32_t index )
+	{
+		char buffer[64]{};
+		auto word = record.args[index];
+
+		switch ( ashes::gl::getArgKind( record, index ) )
+		{
+		case CallTraceArgKind::eSigned:
+			std::snprintf( buffer, sizeof( buffer ), "%" PRId64, int64_t( word ) );
+			break;
+		case CallTraceArgKind::eFloat:
+			{
+				double value{};
+				std::memcpy( &value, &word, sizeof( value ) );
+				std::snprintf( buffer, sizeof( buffer ), "%g", value );
+			}
+			break;
+		case CallTraceArgKind::ePointer:
+			std::snprintf( buffer, sizeof( buffer ), "0x%016" PRIx64, word );
+			break;
+		default:
+			// Most unsigned GL values are enums, better read in hexadecimal.
+			std::snprintf( buffer, sizeof( buffer ), word > 0xFFFFu ? "0x%" PRIx64 : "%" PRIu64, word );
+			break;
+		}
+
+		return buffer;
+	}
+
+	std::string formatArgs( CallTraceRecord const & record
+		, bool json )
+	{
+		std::string result;
+		auto count = std::min( record.argCount, ashes::gl::CallTraceMaxArgs );
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			if ( i )
+			{
+				result += ", ";
+			}
+
+			if ( json )
+			{
+				result += "\"a" + std::to_string( i ) + "\": \"" + formatArg( record, i ) + "\"";
+			}
+			else
+			{
+				result += formatArg( record, i );
+			}
+		}
+
+		if ( !json && record.argCount > count )
+		{
+			result += ", ...";
+		}
+
+		return result;
+	}
+
+	void writeText( Trace const & trace
+		, std::FILE * file )
+	{
+		for ( auto & record : trace.records )
+		{
+			std::fprintf( file, "%14.3f us [T%02u] %10.3f us  %s(%s)\n"
+				, double( record.timestamp ) / 1000.0
+				, record.thread
+				, double( record.duration ) / 1000.0
+				, getName( trace, record ).c_str()
+				, formatArgs( record, false ).c_str() );
+		}
+	}
+
+	void writeJson( Trace const & trace
+		, std::FILE * file )
+	{
+		std::fprintf( file, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n" );
+		char const * separator = "";
+
+		for ( auto & record : trace.records )
+		{
+			std::fprintf( file, "%s{\"name\": \"%s\", \"cat\": \"gl\", \"ph\": \"X\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f, \"args\": {%s}}"
+				, separator
+				, getName( trace, record ).c_str()
+				, record.thread
+				, double( record.timestamp ) / 1000.0
+				, double( record.duration ) / 1000.0
+				, formatArgs( record, true ).c_str() );
+			separator = ",\n";
+		}
+
+		std::fprintf( file, "\n]}\n" );
+	}
+}
+
+int main( int argc, char ** argv )
+{
+	Options options;
+
+	if ( !parseOptions( argc, argv, options ) )
+	{
+		std::fprintf( stderr, "Usage: %s <trace file> [--json] [-o <output file>]\n", argv[0] );
+		return EXIT_FAILURE;
+	}
+
+	Trace trace;
+
+	if ( !read( options.input, trace ) )
+	{
+		return EXIT_FAILURE;
+	}
+
+	auto file = options.output.empty()
+		? stdout
+		: std::fopen( options.output.c_str(), "w" );
+
+	if ( !file )
+	{
+		std::fprintf( stderr, "Couldn't open %s\n", options.output.c_str() );
+		return EXIT_FAILURE;
+	}
+
+	if ( options.json )
+	{
+		writeJson( trace, file );
+	}
+	else
+	{
+		writeText( trace, file );
+	}
+
+	if ( file != stdout )
+	{
+		std::fclose( file );
+	}
+
+	return EXIT_SUCCESS;
+}
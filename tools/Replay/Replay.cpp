@@ -0,0 +1,1022 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+
+Replays a Vulkan calls capture, written by the loader built with ASHES_CAPTURE_CALLS
+and run with ASHES_CAPTURE_FILE set, against a plugin (test, gl, ...), and reports
+the CPU time spent in each Vulkan function, each captured frame, and each vkQueueSubmit.
+
+The swapchains aren't replayed: their images are plain images, vkAcquireNextImageKHR
+is replayed as a submit signaling its semaphore and fence, and vkQueuePresentKHR
+as a submit waiting on its semaphores.
+
+Usage: ashes-replay <capture file> [--plugin NAME] [--llvmpipe] [--submits FILE]
+--llvmpipe forces Mesa's software rasteriser, so that the gl plugin runs headless.
+--submits writes one CSV line per vkQueueSubmit: frame (-1 before the captured frames), submits, command buffers, nanoseconds.
+*/
+#include <capture/CaptureCodecs.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	using ashes::capture::CallCodecs;
+	using ashes::capture::CallId;
+	using ashes::capture::CaptureHeader;
+	using ashes::capture::Decoder;
+	using Clock = std::chrono::steady_clock;
+
+	struct Options
+	{
+		std::string input;
+		std::string plugin;
+		std::string submits;
+		bool llvmpipe{ false };
+	};
+
+	struct CallStats
+	{
+		uint64_t count{};
+		uint64_t total{};
+		uint64_t max{};
+	};
+
+	struct FrameStats
+	{
+		uint32_t index{};
+		uint64_t calls{};
+		uint64_t submits{};
+		// Time spent in the Vulkan functions.
+		uint64_t cpu{};
+		// Time from the frame's first record to its last one, the decoding included.
+		uint64_t wall{};
+		Clock::time_point begin;
+	};
+
+	struct SubmitStats
+	{
+		int64_t frame{};
+		uint32_t submitCount{};
+		uint32_t commandBufferCount{};
+		uint64_t duration{};
+	};
+
+	struct Mapping
+	{
+		uint8_t * data{};
+		VkDeviceSize offset{};
+	};
+
+	struct Swapchain
+	{
+		VkDevice device{};
+		VkFormat format{};
+		VkExtent2D extent{};
+		uint32_t arrayLayers{};
+		VkImageUsageFlags usage{};
+		std::vector< VkImage > images;
+		std::vector< VkDeviceMemory > memories;
+	};
+
+	template< typename FuncT >
+	struct FunctionArgs;
+
+	template< typename RetT, typename ... ParamsT >
+	struct FunctionArgs< RetT( VKAPI_PTR * )( ParamsT... ) >
+	{
+		using Type = std::tuple< ParamsT... >;
+	};
+
+	template< typename FuncT >
+	using ArgsOf = typename FunctionArgs< FuncT >::Type;
+
+	class Player
+	{
+	public:
+		explicit Player( AshPluginStaticFunction const & functions )
+			: functions{ functions }
+		{
+		}
+
+		template< CallId Id, typename ArgsT >
+		bool decode( Decoder & ar
+			, ArgsT & args )
+		{
+			CallCodecs< Id >::Type::decode( ar, args );
+
+			if ( !ar.isValid() )
+			{
+				++invalidRecords;
+			}
+
+			return ar.isValid();
+		}
+
+		template< CallId Id, typename ArgsT >
+		void complete( Decoder & ar
+			, ArgsT & args )
+		{
+			CallCodecs< Id >::Type::complete( ar, args );
+		}
+		/**
+		*\brief
+		*	Calls the function with the given arguments, and adds its duration to the id's statistics.
+		*\return
+		*	The call's result, VK_SUCCESS for the functions without one.
+		*/
+		template< typename PfnT, typename ArgsT >
+		VkResult call( CallId id
+			, PfnT function
+			, ArgsT && args )
+		{
+			VkResult result = VK_SUCCESS;
+			auto begin = Clock::now();
+
+			if constexpr ( std::is_same_v< decltype( std::apply( function, args ) ), VkResult > )
+			{
+				result = std::apply( function, args );
+			}
+			else
+			{
+				std::apply( function, args );
+			}
+
+			addTiming( id, uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - begin ).count() ) );
+
+			if ( result < VK_SUCCESS && failures++ < 10u )
+			{
+				std::fprintf( stderr, "%s failed (%d)\n", ashes::capture::getCallName( id ), int( result ) );
+			}
+
+			return result;
+		}
+
+		void addTiming( CallId id
+			, uint64_t duration )
+		{
+			auto & stats = calls[size_t( id )];
+			++stats.count;
+			stats.total += duration;
+			stats.max = std::max( stats.max, duration );
+			lastDuration = duration;
+
+			if ( inFrame )
+			{
+				++frames.back().calls;
+				frames.back().cpu += duration;
+			}
+			else
+			{
+				++setupCalls;
+				setupTime += duration;
+			}
+		}
+
+		void beginFrame( uint32_t index )
+		{
+			inFrame = true;
+			frames.push_back( { index } );
+			frames.back().begin = Clock::now();
+		}
+
+		void endFrame()
+		{
+			if ( inFrame )
+			{
+				auto & frame = frames.back();
+				frame.wall = uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - frame.begin ).count() );
+				inFrame = false;
+			}
+		}
+
+		void addSubmit( uint32_t submitCount
+			, uint32_t commandBufferCount )
+		{
+			submits.push_back( { inFrame ? int64_t( frames.back().index ) : -1
+				, submitCount
+				, commandBufferCount
+				, lastDuration } );
+
+			if ( inFrame )
+			{
+				++frames.back().submits;
+			}
+		}
+
+		uint32_t findMemoryType( uint32_t typeBits
+			, VkMemoryPropertyFlags flags )const
+		{
+			for ( uint32_t i = 0u; i < memoryProperties.memoryTypeCount; ++i )
+			{
+				if ( ( typeBits & ( 1u << i ) )
+					&& ( memoryProperties.memoryTypes[i].propertyFlags & flags ) == flags )
+				{
+					return i;
+				}
+			}
+
+			for ( uint32_t i = 0u; i < memoryProperties.memoryTypeCount; ++i )
+			{
+				if ( typeBits & ( 1u << i ) )
+				{
+					return i;
+				}
+			}
+
+			return 0u;
+		}
+
+	public:
+		AshPluginStaticFunction functions;
+		ashes::capture::HandleMap handles;
+		ashes::capture::Arena arena;
+		VkPhysicalDeviceMemoryProperties memoryProperties{};
+		VkDevice device{};
+		VkQueue queue{};
+		std::unordered_map< uint64_t, Mapping > mappings;
+		std::unordered_map< uint64_t, Swapchain > swapchains;
+		uint64_t lastSwapchain{};
+		std::array< CallStats, size_t( CallId::eCount ) > calls{};
+		std::vector< FrameStats > frames;
+		std::vector< SubmitStats > submits;
+		bool inFrame{ false };
+		uint64_t lastDuration{};
+		uint64_t setupCalls{};
+		uint64_t setupTime{};
+		uint64_t records{};
+		uint64_t skippedRecords{};
+		uint64_t invalidRecords{};
+		uint64_t failures{};
+		uint64_t memoryWrites{};
+		uint64_t memoryBytes{};
+		uint64_t lostMemoryWrites{};
+	};
+
+	using ReplayFunction = void( * )( Player &, Decoder & );
+
+	//*********************************************************************************************
+
+	template< typename FuncT >
+	struct ReplayCall;
+
+	template< typename RetT, typename ... ParamsT >
+	struct ReplayCall< RetT( VKAPI_PTR * )( ParamsT... ) >
+	{
+		using PfnT = RetT( VKAPI_PTR * )( ParamsT... );
+
+		template< PfnT AshPluginStaticFunction::* Member, CallId Id >
+		static void replay( Player & player
+			, Decoder & ar )
+		{
+			std::tuple< ParamsT... > args{};
+
+			if ( player.decode< Id >( ar, args ) )
+			{
+				player.call( Id, player.functions.*Member, args );
+				player.complete< Id >( ar, args );
+			}
+		}
+	};
+
+	void replayMemoryWrite( Player & player
+		, Decoder & ar )
+	{
+		VkDeviceMemory memory{};
+		ar.handle( memory );
+		auto offset = ar.varint();
+		auto size = size_t( ar.varint() );
+		// Whether it was written at a submit, informative.
+		( void )ar.varint();
+		auto data = ar.allocate< uint8_t >( size );
+
+		if ( data )
+		{
+			ar.read( data, size );
+		}
+
+		if ( !ar.isValid() )
+		{
+			++player.invalidRecords;
+			return;
+		}
+
+		auto it = player.mappings.find( ashes::capture::toHandleValue( memory ) );
+
+		if ( it == player.mappings.end()
+			|| offset < it->second.offset )
+		{
+			++player.lostMemoryWrites;
+			return;
+		}
+
+		std::memcpy( it->second.data + ( offset - it->second.offset ), data, size );
+		++player.memoryWrites;
+		player.memoryBytes += size;
+	}
+
+	void replayFrameBegin( Player & player
+		, Decoder & ar )
+	{
+		player.beginFrame( uint32_t( ar.varint() ) );
+	}
+
+	void replayFrameEnd( Player & player
+		, Decoder & )
+	{
+		player.endFrame();
+	}
+
+	void replayCreateInstance( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkCreateInstance > args{};
+
+		if ( player.decode< CallId::eCreateInstance >( ar, args ) )
+		{
+			// The captured layers and extensions (surfaces, debug) aren't needed to replay.
+			if ( auto createInfo = const_cast< VkInstanceCreateInfo * >( std::get< 0 >( args ) ) )
+			{
+				createInfo->enabledLayerCount = 0u;
+				createInfo->enabledExtensionCount = 0u;
+			}
+
+			player.call( CallId::eCreateInstance, player.functions.CreateInstance, args );
+			player.complete< CallId::eCreateInstance >( ar, args );
+		}
+	}
+
+	void replayCreateDevice( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkCreateDevice > args{};
+
+		if ( player.decode< CallId::eCreateDevice >( ar, args ) )
+		{
+			if ( auto createInfo = const_cast< VkDeviceCreateInfo * >( std::get< 1 >( args ) ) )
+			{
+				createInfo->enabledLayerCount = 0u;
+				createInfo->enabledExtensionCount = 0u;
+			}
+
+			if ( player.call( CallId::eCreateDevice, player.functions.CreateDevice, args ) == VK_SUCCESS )
+			{
+				player.device = *std::get< 3 >( args );
+				player.functions.GetPhysicalDeviceMemoryProperties( std::get< 0 >( args ), &player.memoryProperties );
+			}
+
+			player.complete< CallId::eCreateDevice >( ar, args );
+		}
+	}
+
+	void replayGetDeviceQueue( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkGetDeviceQueue > args{};
+
+		if ( player.decode< CallId::eGetDeviceQueue >( ar, args ) )
+		{
+			player.call( CallId::eGetDeviceQueue, player.functions.GetDeviceQueue, args );
+			// The acquisitions and presentations are replayed on the last retrieved queue.
+			player.queue = *std::get< 3 >( args );
+			player.complete< CallId::eGetDeviceQueue >( ar, args );
+		}
+	}
+
+	void replayMapMemory( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkMapMemory > args{};
+
+		if ( player.decode< CallId::eMapMemory >( ar, args ) )
+		{
+			if ( player.call( CallId::eMapMemory, player.functions.MapMemory, args ) == VK_SUCCESS )
+			{
+				player.mappings[ashes::capture::toHandleValue( std::get< 1 >( args ) )] = Mapping{ static_cast< uint8_t * >( *std::get< 5 >( args ) )
+					, std::get< 2 >( args ) };
+			}
+
+			player.complete< CallId::eMapMemory >( ar, args );
+		}
+	}
+
+	void replayUnmapMemory( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkUnmapMemory > args{};
+
+		if ( player.decode< CallId::eUnmapMemory >( ar, args ) )
+		{
+			player.call( CallId::eUnmapMemory, player.functions.UnmapMemory, args );
+			player.mappings.erase( ashes::capture::toHandleValue( std::get< 1 >( args ) ) );
+			player.complete< CallId::eUnmapMemory >( ar, args );
+		}
+	}
+
+	void replayFreeMemory( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkFreeMemory > args{};
+
+		if ( player.decode< CallId::eFreeMemory >( ar, args ) )
+		{
+			player.mappings.erase( ashes::capture::toHandleValue( std::get< 1 >( args ) ) );
+			player.call( CallId::eFreeMemory, player.functions.FreeMemory, args );
+			player.complete< CallId::eFreeMemory >( ar, args );
+		}
+	}
+
+	void replayQueueSubmit( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkQueueSubmit > args{};
+
+		if ( player.decode< CallId::eQueueSubmit >( ar, args ) )
+		{
+			uint32_t commandBufferCount{};
+
+			for ( uint32_t i = 0u; i < std::get< 1 >( args ) && std::get< 2 >( args ); ++i )
+			{
+				commandBufferCount += std::get< 2 >( args )[i].commandBufferCount;
+			}
+
+			player.call( CallId::eQueueSubmit, player.functions.QueueSubmit, args );
+			player.addSubmit( std::get< 1 >( args ), commandBufferCount );
+			player.complete< CallId::eQueueSubmit >( ar, args );
+		}
+	}
+
+	//*********************************************************************************************
+
+	void replayCreateSwapchain( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkCreateSwapchainKHR > args{};
+
+		if ( player.decode< CallId::eCreateSwapchainKHR >( ar, args ) )
+		{
+			auto createInfo = std::get< 1 >( args );
+			auto handle = ++player.lastSwapchain;
+			auto & swapchain = player.swapchains[handle];
+			swapchain.device = std::get< 0 >( args );
+
+			if ( createInfo )
+			{
+				swapchain.format = createInfo->imageFormat;
+				swapchain.extent = createInfo->imageExtent;
+				swapchain.arrayLayers = std::max( 1u, createInfo->imageArrayLayers );
+				swapchain.usage = createInfo->imageUsage;
+			}
+
+			*std::get< 3 >( args ) = ashes::capture::fromHandleValue< VkSwapchainKHR >( handle );
+			player.complete< CallId::eCreateSwapchainKHR >( ar, args );
+		}
+	}
+
+	void replayDestroySwapchain( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkDestroySwapchainKHR > args{};
+
+		if ( player.decode< CallId::eDestroySwapchainKHR >( ar, args ) )
+		{
+			auto it = player.swapchains.find( ashes::capture::toHandleValue( std::get< 1 >( args ) ) );
+
+			if ( it != player.swapchains.end() )
+			{
+				auto & swapchain = it->second;
+
+				for ( size_t i = 0u; i < swapchain.images.size(); ++i )
+				{
+					player.functions.DestroyImage( swapchain.device, swapchain.images[i], nullptr );
+					player.functions.FreeMemory( swapchain.device, swapchain.memories[i], nullptr );
+				}
+
+				player.swapchains.erase( it );
+			}
+
+			player.complete< CallId::eDestroySwapchainKHR >( ar, args );
+		}
+	}
+
+	VkImage createSwapchainImage( Player & player
+		, Swapchain & swapchain )
+	{
+		auto & functions = player.functions;
+		VkImageCreateInfo createInfo{ VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO
+			, nullptr
+			, 0u
+			, VK_IMAGE_TYPE_2D
+			, swapchain.format
+			, { swapchain.extent.width, swapchain.extent.height, 1u }
+			, 1u
+			, swapchain.arrayLayers
+			, VK_SAMPLE_COUNT_1_BIT
+			, VK_IMAGE_TILING_OPTIMAL
+			, swapchain.usage | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT
+			, VK_SHARING_MODE_EXCLUSIVE
+			, 0u
+			, nullptr
+			, VK_IMAGE_LAYOUT_UNDEFINED };
+		VkImage image{};
+
+		if ( functions.CreateImage( swapchain.device, &createInfo, nullptr, &image ) != VK_SUCCESS )
+		{
+			return VK_NULL_HANDLE;
+		}
+
+		VkMemoryRequirements requirements{};
+		functions.GetImageMemoryRequirements( swapchain.device, image, &requirements );
+		VkMemoryAllocateInfo allocateInfo{ VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO
+			, nullptr
+			, requirements.size
+			, player.findMemoryType( requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT ) };
+		VkDeviceMemory memory{};
+
+		if ( functions.AllocateMemory( swapchain.device, &allocateInfo, nullptr, &memory ) != VK_SUCCESS )
+		{
+			functions.DestroyImage( swapchain.device, image, nullptr );
+			return VK_NULL_HANDLE;
+		}
+
+		functions.BindImageMemory( swapchain.device, image, memory, 0u );
+		swapchain.images.push_back( image );
+		swapchain.memories.push_back( memory );
+		return image;
+	}
+
+	void replayGetSwapchainImages( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkGetSwapchainImagesKHR > args{};
+
+		if ( !player.decode< CallId::eGetSwapchainImagesKHR >( ar, args ) )
+		{
+			return;
+		}
+
+		auto it = player.swapchains.find( ashes::capture::toHandleValue( std::get< 1 >( args ) ) );
+		auto images = std::get< 3 >( args );
+		auto & count = *std::get< 2 >( args );
+
+		if ( it == player.swapchains.end() )
+		{
+			count = 0u;
+		}
+		else if ( images )
+		{
+			auto & swapchain = it->second;
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				images[i] = i < swapchain.images.size()
+					? swapchain.images[i]
+					: createSwapchainImage( player, swapchain );
+			}
+		}
+
+		player.complete< CallId::eGetSwapchainImagesKHR >( ar, args );
+	}
+
+	void replayAcquireNextImage( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkAcquireNextImageKHR > args{};
+
+		if ( !player.decode< CallId::eAcquireNextImageKHR >( ar, args ) )
+		{
+			return;
+		}
+
+		auto semaphore = std::get< 3 >( args );
+		auto fence = std::get< 4 >( args );
+
+		if ( player.queue
+			&& ( semaphore || fence ) )
+		{
+			VkSubmitInfo submitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO
+				, nullptr
+				, 0u
+				, nullptr
+				, nullptr
+				, 0u
+				, nullptr
+				, semaphore ? 1u : 0u
+				, &semaphore };
+			player.call( CallId::eAcquireNextImageKHR
+				, player.functions.QueueSubmit
+				, std::make_tuple( player.queue, 1u, &submitInfo, fence ) );
+		}
+		else
+		{
+			player.addTiming( CallId::eAcquireNextImageKHR, 0u );
+		}
+
+		player.complete< CallId::eAcquireNextImageKHR >( ar, args );
+	}
+
+	void replayQueuePresent( Player & player
+		, Decoder & ar )
+	{
+		ArgsOf< PFN_vkQueuePresentKHR > args{};
+
+		if ( !player.decode< CallId::eQueuePresentKHR >( ar, args ) )
+		{
+			return;
+		}
+
+		auto queue = std::get< 0 >( args );
+		auto presentInfo = std::get< 1 >( args );
+
+		if ( queue
+			&& presentInfo
+			&& presentInfo->waitSemaphoreCount
+			&& presentInfo->pWaitSemaphores )
+		{
+			std::vector< VkPipelineStageFlags > stages( presentInfo->waitSemaphoreCount, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT );
+			VkSubmitInfo submitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO
+				, nullptr
+				, presentInfo->waitSemaphoreCount
+				, presentInfo->pWaitSemaphores
+				, stages.data()
+				, 0u
+				, nullptr
+				, 0u
+				, nullptr };
+			player.call( CallId::eQueuePresentKHR
+				, player.functions.QueueSubmit
+				, std::make_tuple( queue, 1u, &submitInfo, VkFence{ VK_NULL_HANDLE } ) );
+		}
+		else
+		{
+			player.addTiming( CallId::eQueuePresentKHR, 0u );
+		}
+
+		player.complete< CallId::eQueuePresentKHR >( ar, args );
+	}
+
+	std::array< ReplayFunction, size_t( CallId::eCount ) > makeReplayFunctions()
+	{
+		std::array< ReplayFunction, size_t( CallId::eCount ) > result{};
+#define ASHES_CAPTURE_CALL( name, ... )\
+		result[size_t( CallId::e##name )] = &ReplayCall< PFN_vk##name >::replay< &AshPluginStaticFunction::name, CallId::e##name >;
+#include <capture/CaptureCallsList.inl>
+		result[size_t( CallId::eMemoryWrite )] = &replayMemoryWrite;
+		result[size_t( CallId::eFrameBegin )] = &replayFrameBegin;
+		result[size_t( CallId::eFrameEnd )] = &replayFrameEnd;
+		result[size_t( CallId::eCreateInstance )] = &replayCreateInstance;
+		result[size_t( CallId::eCreateDevice )] = &replayCreateDevice;
+		result[size_t( CallId::eGetDeviceQueue )] = &replayGetDeviceQueue;
+		result[size_t( CallId::eMapMemory )] = &replayMapMemory;
+		result[size_t( CallId::eUnmapMemory )] = &replayUnmapMemory;
+		result[size_t( CallId::eFreeMemory )] = &replayFreeMemory;
+		result[size_t( CallId::eQueueSubmit )] = &replayQueueSubmit;
+		result[size_t( CallId::eCreateSwapchainKHR )] = &replayCreateSwapchain;
+		result[size_t( CallId::eDestroySwapchainKHR )] = &replayDestroySwapchain;
+		result[size_t( CallId::eGetSwapchainImagesKHR )] = &replayGetSwapchainImages;
+		result[size_t( CallId::eAcquireNextImageKHR )] = &replayAcquireNextImage;
+		result[size_t( CallId::eQueuePresentKHR )] = &replayQueuePresent;
+		return result;
+	}
+
+	//*********************************************************************************************
+
+	bool parseOptions( int argc
+		, char ** argv
+		, Options & options )
+	{
+		for ( int i = 1; i < argc; ++i )
+		{
+			std::string arg = argv[i];
+			bool hasValue = i + 1 < argc;
+
+			if ( arg == "--plugin" && hasValue )
+			{
+				options.plugin = argv[++i];
+			}
+			else if ( arg == "--submits" && hasValue )
+			{
+				options.submits = argv[++i];
+			}
+			else if ( arg == "--llvmpipe" )
+			{
+				options.llvmpipe = true;
+			}
+			else if ( options.input.empty() )
+			{
+				options.input = arg;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return !options.input.empty();
+	}
+
+	void setEnv( char const * name
+		, char const * value )
+	{
+#if _WIN32
+		_putenv_s( name, value );
+#else
+		setenv( name, value, 1 );
+#endif
+	}
+
+	bool readCapture( std::string const & path
+		, std::vector< uint8_t > & data
+		, CaptureHeader & header )
+	{
+		auto file = std::fopen( path.c_str(), "rb" );
+
+		if ( !file )
+		{
+			std::fprintf( stderr, "Couldn't open %s\n", path.c_str() );
+			return false;
+		}
+
+		bool result = std::fread( &header, sizeof( header ), 1u, file ) == 1u
+			&& std::memcmp( header.magic, ashes::capture::CaptureMagic, sizeof( header.magic ) ) == 0
+			&& header.version == ashes::capture::CaptureVersion;
+
+		if ( !result )
+		{
+			std::fprintf( stderr, "%s isn't a supported Vulkan calls capture\n", path.c_str() );
+			std::fclose( file );
+			return false;
+		}
+
+		uint8_t buffer[65536];
+		size_t read{};
+
+		while ( ( read = std::fread( buffer, 1u, sizeof( buffer ), file ) ) != 0u )
+		{
+			data.insert( data.end(), buffer, buffer + read );
+		}
+
+		std::fclose( file );
+		return true;
+	}
+
+	bool selectPlugin( std::string const & name
+		, AshPluginDescription & description )
+	{
+		if ( !name.empty() )
+		{
+			uint32_t count{};
+			ashEnumeratePluginsDescriptions( &count, nullptr );
+			std::vector< AshPluginDescription > plugins( count );
+			ashEnumeratePluginsDescriptions( &count, plugins.data() );
+			plugins.resize( count );
+			auto it = std::find_if( plugins.begin()
+				, plugins.end()
+				, [&name]( AshPluginDescription const & lookup )
+				{
+					return name == lookup.name;
+				} );
+
+			if ( it == plugins.end()
+				|| ashSelectPlugin( *it ) != VK_SUCCESS )
+			{
+				std::fprintf( stderr, "Plugin %s isn't available\n", name.c_str() );
+				return false;
+			}
+		}
+
+		return ashGetCurrentPluginDescription( &description ) == VK_SUCCESS;
+	}
+
+	bool readVarint( std::vector< uint8_t > const & data
+		, size_t & offset
+		, uint64_t & value )
+	{
+		value = 0u;
+
+		for ( uint32_t shift = 0u; offset < data.size() && shift < 64u; shift += 7u )
+		{
+			auto byte = data[offset++];
+			value |= uint64_t( byte & 0x7Fu ) << shift;
+
+			if ( !( byte & 0x80u ) )
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void replay( Player & player
+		, std::vector< uint8_t > const & data )
+	{
+		auto functions = makeReplayFunctions();
+		size_t offset{};
+		uint64_t id{};
+		uint64_t size{};
+
+		while ( readVarint( data, offset, id )
+			&& readVarint( data, offset, size ) )
+		{
+			if ( size > data.size() - offset )
+			{
+				std::fprintf( stderr, "The capture is truncated\n" );
+				break;
+			}
+
+			player.arena.clear();
+			Decoder ar{ data.data() + offset
+				, size_t( size )
+				, player.handles
+				, player.memoryProperties
+				, player.arena };
+			offset += size_t( size );
+			++player.records;
+
+			if ( id < uint64_t( CallId::eCount )
+				&& functions[size_t( id )] )
+			{
+				functions[size_t( id )]( player, ar );
+			}
+			else
+			{
+				++player.skippedRecords;
+			}
+		}
+
+		player.endFrame();
+
+		if ( player.device )
+		{
+			player.functions.DeviceWaitIdle( player.device );
+		}
+	}
+
+	double toMs( uint64_t ns )
+	{
+		return double( ns ) / 1000000.0;
+	}
+
+	double toUs( uint64_t ns )
+	{
+		return double( ns ) / 1000.0;
+	}
+
+	void printReport( Player const & player
+		, AshPluginDescription const & plugin
+		, CaptureHeader const & header )
+	{
+		std::printf( "Plugin: %s (%s)\n", plugin.name, plugin.description );
+		std::printf( "Captured frames: %u to %u, %" PRIu64 " records", header.firstFrame, header.lastFrame, player.records );
+
+		if ( player.skippedRecords || player.invalidRecords )
+		{
+			std::printf( ", %" PRIu64 " skipped, %" PRIu64 " invalid", player.skippedRecords, player.invalidRecords );
+		}
+
+		std::printf( "\nMemory writes: %" PRIu64 " (%" PRIu64 " bytes)", player.memoryWrites, player.memoryBytes );
+
+		if ( player.lostMemoryWrites )
+		{
+			std::printf( ", %" PRIu64 " to unmapped memory", player.lostMemoryWrites );
+		}
+
+		std::printf( "\nFailed calls: %" PRIu64 "\n\n", player.failures );
+		std::printf( "Before the captured frames: %" PRIu64 " calls, %.3f ms\n\n", player.setupCalls, toMs( player.setupTime ) );
+
+		std::printf( "%-8s %10s %10s %12s %12s\n", "Frame", "Calls", "Submits", "CPU (ms)", "Wall (ms)" );
+
+		for ( auto & frame : player.frames )
+		{
+			std::printf( "%-8u %10" PRIu64 " %10" PRIu64 " %12.3f %12.3f\n"
+				, frame.index
+				, frame.calls
+				, frame.submits
+				, toMs( frame.cpu )
+				, toMs( frame.wall ) );
+		}
+
+		std::vector< size_t > order;
+
+		for ( size_t i = 0u; i < player.calls.size(); ++i )
+		{
+			if ( player.calls[i].count )
+			{
+				order.push_back( i );
+			}
+		}
+
+		std::sort( order.begin()
+			, order.end()
+			, [&player]( size_t lhs, size_t rhs )
+			{
+				return player.calls[lhs].total > player.calls[rhs].total;
+			} );
+		std::printf( "\n%-36s %10s %12s %12s %12s\n", "Function", "Count", "Total (ms)", "Mean (us)", "Max (us)" );
+
+		for ( auto index : order )
+		{
+			auto & stats = player.calls[index];
+			std::printf( "%-36s %10" PRIu64 " %12.3f %12.3f %12.3f\n"
+				, ashes::capture::getCallName( CallId( index ) )
+				, stats.count
+				, toMs( stats.total )
+				, toUs( stats.total ) / double( stats.count )
+				, toUs( stats.max ) );
+		}
+
+		if ( !player.submits.empty() )
+		{
+			std::vector< uint64_t > durations;
+
+			for ( auto & submit : player.submits )
+			{
+				durations.push_back( submit.duration );
+			}
+
+			std::sort( durations.begin(), durations.end() );
+			std::printf( "\nvkQueueSubmit: %zu calls, median %.3f us, 95th percentile %.3f us, max %.3f us\n"
+				, durations.size()
+				, toUs( durations[durations.size() / 2u] )
+				, toUs( durations[( durations.size() * 95u ) / 100u] )
+				, toUs( durations.back() ) );
+		}
+	}
+
+	bool writeSubmits( std::string const & path
+		, Player const & player )
+	{
+		auto file = std::fopen( path.c_str(), "w" );
+
+		if ( !file )
+		{
+			std::fprintf( stderr, "Couldn't open %s\n", path.c_str() );
+			return false;
+		}
+
+		std::fprintf( file, "frame,submits,commandBuffers,ns\n" );
+
+		for ( auto & submit : player.submits )
+		{
+			std::fprintf( file, "%" PRId64 ",%u,%u,%" PRIu64 "\n"
+				, submit.frame
+				, submit.submitCount
+				, submit.commandBufferCount
+				, submit.duration );
+		}
+
+		std::fclose( file );
+		return true;
+	}
+}
+
+int main( int argc, char ** argv )
+{
+	Options options;
+
+	if ( !parseOptions( argc, argv, options ) )
+	{
+		std::fprintf( stderr, "Usage: %s <capture file> [--plugin NAME] [--llvmpipe] [--submits FILE]\n", argv[0] );
+		return EXIT_FAILURE;
+	}
+
+	if ( options.llvmpipe )
+	{
+		// Must be set before the GL plugin loads the driver.
+		setEnv( "LIBGL_ALWAYS_SOFTWARE", "1" );
+		setEnv( "GALLIUM_DRIVER", "llvmpipe" );
+	}
+
+	std::vector< uint8_t > data;
+	CaptureHeader header{};
+	AshPluginDescription plugin{};
+
+	if ( !readCapture( options.input, data, header )
+		|| !selectPlugin( options.plugin, plugin ) )
+	{
+		return EXIT_FAILURE;
+	}
+
+	Player player{ plugin.functions };
+	replay( player, data );
+	printReport( player, plugin, header );
+
+	if ( !options.submits.empty()
+		&& !writeSubmits( options.submits, player ) )
+	{
+		return EXIT_FAILURE;
+	}
+
+	return player.invalidRecords
+		? EXIT_FAILURE
+		: EXIT_SUCCESS;
+}